@@ -15,6 +15,7 @@
 package com.tencent.kuikly.compose.coroutines.internal
 
 import com.tencent.kuikly.core.exception.ExceptionTracker
+import com.tencent.kuikly.core.nvi.RenderCommandBatcher
 import kotlinx.cinterop.ByteVar
 import kotlinx.cinterop.CPointer
 import kotlinx.cinterop.ExperimentalForeignApi
@@ -35,6 +36,7 @@ internal actual inline fun platformScheduleOnKuiklyThread(pagerId: String) {
     com_tencent_kuikly_ScheduleContextTask(pagerId, staticCFunction { pagerIdBytes: CPointer<ByteVar>? ->
         val idStr = pagerIdBytes?.toKString() ?: return@staticCFunction
         KuiklyContextScheduler.runTask(idStr)
+        RenderCommandBatcher.flushAll()
     })
 }
 
@@ -35,6 +35,7 @@ class OhOsTargetEntryBuilder(private val catchException: Boolean) : KuiklyCoreAb
             addImport("com.tencent.kuikly.core.manager", "KotlinMethod")
             addImport("kotlinx.cinterop", "staticCFunction")
             addImport("ohos", "com_tencent_kuikly_SetCallKotlin")
+            addImport("com.tencent.kuikly.core.nvi", "RenderCommandBatcher")
 
             addFunction(createCallNativeFunc())
             addFunction(createInitKuiklyMethod(pagesAnnotations))
@@ -91,6 +92,8 @@ class OhOsTargetEntryBuilder(private val catchException: Boolean) : KuiklyCoreAb
                             }else{
                                 callKotlinClosure()
                             }
+                            // 本次调用中缓存的渲染指令整批交给 native
+                            RenderCommandBatcher.flushAll()
                 })
             """.trimIndent())
             .build()
@@ -38,6 +38,7 @@ class OhOsTargetMultiEntryBuilder(private val catchException: Boolean, private v
                 addImport("com.tencent.kuikly.core.manager", "KotlinMethod")
                 addImport("kotlinx.cinterop", "staticCFunction")
                 addImport("ohos", "com_tencent_kuikly_SetCallKotlin")
+                addImport("com.tencent.kuikly.core.nvi", "RenderCommandBatcher")
 
                 addFunction(createCallNativeFunc())
                 addFunction(createInitKuiklyMethod(pagesAnnotations))
@@ -95,6 +96,8 @@ class OhOsTargetMultiEntryBuilder(private val catchException: Boolean, private v
                             }else{
                                 callKotlinClosure()
                             }
+                            // 本次调用中缓存的渲染指令整批交给 native
+                            RenderCommandBatcher.flushAll()
                 })
             """.trimIndent())
             .build()
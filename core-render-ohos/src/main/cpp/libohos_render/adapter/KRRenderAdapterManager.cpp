@@ -18,6 +18,7 @@
 #include <sys/stat.h>
 #include "libohos_render/manager/KRArkTSManager.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
+#include "libohos_render/utils/KRRenderLoger.h"
 
 KRRenderAdapterManager &KRRenderAdapterManager::GetInstance() {
     static KRRenderAdapterManager adapter_manager;
@@ -25,6 +26,8 @@ KRRenderAdapterManager &KRRenderAdapterManager::GetInstance() {
 }
 
 void KRRenderAdapterManager::OnFatalException(const std::string &instance_id, const std::string &stack) {
+    // 异常上报后宿主可能直接结束进程，先把异步日志冲刷出去
+    KRRenderLog::Flush();
     CallArkTsExceptionModule(instance_id, "onException", stack);
 }
 
@@ -45,8 +48,9 @@ void KRRenderAdapterManager::Log(const LogLevel &log_level, const std::string &t
         LogInfo(tag, msg);
     } else if (log_level == LogLevel::LOG_DEBUG) {
         LogDebug(tag, msg);
-    } else if (log_level == LogLevel::LOG_ERROR) {
-        LogError(tag, msg);
+    } else if (log_level == LogLevel::LOG_ERROR || log_level == LogLevel::LOG_WARN ||
+               log_level == LogLevel::LOG_FATAL) {
+        LogError(tag, msg);  // IKRLogAdapter 没有 warn / fatal 通道
     }
 }
 
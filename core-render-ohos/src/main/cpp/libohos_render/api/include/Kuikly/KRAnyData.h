@@ -241,6 +241,23 @@ KRAnyData KRAnyDataCreateString(const char* value);
  */
 KRAnyData KRAnyDataCreateBytes(const char* value, int size);
 
+/**
+ * @brief 二进制数据释放回调，最后一个引用释放时调用，调用线程不确定
+ * @param value 创建时传入的二进制数据地址
+ * @param userData 创建时传入的用户数据
+ */
+typedef void (*KRAnyDataBytesRelease)(const char* value, void* userData);
+
+/**
+ * @brief 创建一个新的 KRAnyData 值为 二进制 类型，直接引用 value 指向的内存而不拷贝
+ * @param value 二进制数据，需在 release 回调前保持有效且不被修改
+ * @param size 二进制数据的长度
+ * @param release 释放回调，可为 nullptr
+ * @param userData 透传给 release 的用户数据
+ * @return KRAnyData
+ */
+KRAnyData KRAnyDataCreateBytesNoCopy(const char* value, int size, KRAnyDataBytesRelease release, void* userData);
+
 /**
  * @brief 创建一个新的 KRAnyData 值为 Array 类型
  * @param size 设置的数组长度
@@ -298,6 +298,13 @@ typedef void (*KRLogAdapter)(int logLevel, const char *tag, const char *message)
  */
 void KRRegisterLogAdapter(KRLogAdapter adapter);
 
+/**
+ * 设置最低日志级别，低于该级别的日志在格式化前即被丢弃（包括 Kotlin 侧通过 KRLogModule 输出的日志）。
+ * 默认输出全部级别，可在任意时刻、任意线程调用。
+ * @param logLevel KRLogLevelDebug / KRLogLevelInfo / KRLogLevelError
+ */
+void KRSetMinLogLevel(int logLevel);
+
 
 /**
  * Color Adapter回调
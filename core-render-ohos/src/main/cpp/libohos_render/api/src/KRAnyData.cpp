@@ -99,7 +99,7 @@ int KRAnyDataVisitMap(KRAnyData data, KRAnyDataMapVisitor visitor, void *userDat
         return KRANYDATA_TYPE_MISMATCH;
     }
     
-    auto map = internal->anyValue->toMap();
+    const auto &map = internal->anyValue->toMapRef();
     for (const auto& pair : map) {
         KRAnyDataInternal tempValue;
         tempValue.anyValue = pair.second;
@@ -121,13 +121,12 @@ int KRAnyDataGetMapValue(KRAnyData data, const char* key, KRAnyData* value) {
         return KRANYDATA_TYPE_MISMATCH;
     }
     
-    auto map = internal->anyValue->toMap();
-    auto it = map.find(key);
-    if (it == map.end()) {
+    const auto &found = internal->anyValue->valueForKey(key);
+    if (found == nullptr) {
         *value = nullptr;
         return KRANYDATA_KEY_NOT_FOUND;
     }
-    *value = it->second.get();
+    *value = found.get();
     return KRANYDATA_SUCCESS;
 }
 
@@ -189,17 +188,24 @@ int KRAnyDataGetBool(KRAnyData data, bool* value) {
 }
 
 int KRAnyDataGetBytes(KRAnyData data, const char** value, int *size) {
-    if (value == nullptr) {
+    if (value == nullptr || size == nullptr) {
         return KRANYDATA_NULL_OUTPUT;
     }
     struct KRAnyDataInternal *internal = (struct KRAnyDataInternal *)data;
     if (internal == nullptr || internal->anyValue == nullptr) {
         return KRANYDATA_NULL_INPUT;
     }
-    auto cValue = internal->anyValue->toCValue();
+    if (internal->anyValue->isByteArray()) {
+        // 直接返回底层缓冲区，不经过 KRRenderCValue
+        const auto &bytes = internal->anyValue->toByteArray();
+        *value = reinterpret_cast<const char *>(bytes->data());
+        *size = static_cast<int>(bytes->size());
+        return KRANYDATA_SUCCESS;
+    }
+    const auto &cValue = internal->anyValue->toCValue();
     *value = cValue.value.bytesValue;
-    *size = cValue.size; 
-    return 0;
+    *size = cValue.size;
+    return KRANYDATA_SUCCESS;
 }
 
 int KRAnyDataGetStr(KRAnyData data, const char** value) {
@@ -223,7 +229,7 @@ int KRAnyDataGetArraySize(KRAnyData data, int* size) {
     if (internal == nullptr || internal->anyValue == nullptr) {
         return KRANYDATA_NULL_INPUT;
     }
-    *size = internal->anyValue->toArray().size();
+    *size = internal->anyValue->toArrayRef().size();
     return KRANYDATA_SUCCESS;
 }
 
@@ -235,7 +241,8 @@ int KRAnyDataGetArrayElement(KRAnyData data, KRAnyData* value, int index) {
     if (internal == nullptr || internal->anyValue == nullptr) {
         return KRANYDATA_NULL_INPUT;
     }
-    auto array = internal->anyValue->toArray();
+    // 借用解析缓存中的元素，避免返回临时拷贝中的指针
+    const auto &array = internal->anyValue->toArrayRef();
     if (index < 0 || index >= array.size()) {
         return KRANYDATA_OUT_OF_INDEX;
     }
@@ -287,7 +294,18 @@ KRAnyData KRAnyDataCreateString(const char* value) {
 
 KRAnyData KRAnyDataCreateBytes(const char* value, int size) {
     auto data = new KRAnyDataInternal();
-    auto byteArray = std::make_shared<std::vector<uint8_t>>(value, value + size);
+    auto byteArray = KRByteBuffer::Copy(value, size > 0 ? size : 0);
+    data->anyValue = KRRenderValue::Make(byteArray);
+    return data;
+}
+
+KRAnyData KRAnyDataCreateBytesNoCopy(const char* value, int size, KRAnyDataBytesRelease release, void* userData) {
+    auto data = new KRAnyDataInternal();
+    auto byteArray = KRByteBuffer::Wrap(value, size > 0 ? size : 0, [value, release, userData] {
+        if (release != nullptr) {
+            release(value, userData);
+        }
+    });
     data->anyValue = KRRenderValue::Make(byteArray);
     return data;
 }
@@ -27,6 +27,7 @@
 #include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
 #include "libohos_render/export/IKRRenderModuleExport.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
+#include "libohos_render/utils/KRRenderLoger.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -333,6 +334,10 @@ void KRRegisterLogAdapter(KRLogAdapter adapter) {
     KRRenderAdapterManager::GetInstance().RegisterLogAdapter(std::dynamic_pointer_cast<IKRLogAdapter>(bridge));
 }
     
+void KRSetMinLogLevel(int logLevel) {
+    KRRenderLog::SetMinLevel(logLevel);
+}
+
 void KRRegisterColorAdapter(KRColorAdapterParseColor adapter){
     class BridgedColorParseAdapter : public IKRColorParseAdapter {
      public:
@@ -40,6 +40,12 @@ IKRRenderNativeContextHandler::OnCallNative(const KuiklyRenderNativeMethod &meth
                               : KRRenderValue::Make();
 }
 
+void IKRRenderNativeContextHandler::OnCallNativeBatch(const uint8_t *data, size_t size) {
+    if (call_native_callback_) {
+        call_native_callback_->OnCallNativeBatch(data, size);
+    }
+}
+
 KRRenderCValue IKRRenderNativeContextHandler::DispatchCallNative(const std::string &instanceId, int methodId,
                                                                  const KRRenderCValue &arg0, const KRRenderCValue &arg1,
                                                                  const KRRenderCValue &arg2, const KRRenderCValue &arg3,
@@ -49,6 +55,11 @@ KRRenderCValue IKRRenderNativeContextHandler::DispatchCallNative(const std::stri
                                                                                  arg3, arg4, arg5);
 }
 
+void IKRRenderNativeContextHandler::DispatchCallNativeBatch(const std::string &instanceId, const uint8_t *data,
+                                                            size_t size) {
+    KRRenderNativeContextHandlerManager::GetInstance().DispatchCallNativeBatch(instanceId, data, size);
+}
+
 void IKRRenderNativeContextHandler::Init(const std::shared_ptr<KRRenderContextParams> context_params) {
     this->instance_id_ = context_params->InstanceId();
     KRRenderNativeContextHandlerManager::GetInstance().RegisterContextHandler(this->instance_id_, shared_from_this());
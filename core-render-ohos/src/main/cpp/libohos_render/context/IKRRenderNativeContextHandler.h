@@ -51,7 +51,8 @@ enum class KuiklyRenderNativeMethod {
     KuiklyRenderNativeMethodCallShadowMethod = 14,        // "callShadowModule方法"
     KuiklyRenderNativeMethodFireFatalException = 15,      // "fireFatalException"方法
     KuiklyRenderNativeMethodSyncFlushUI = 16,             // "syncFlushUI方法"
-    KuiklyRenderNativeMethodCallTDFNativeMethod = 17      // "callTDFModuleMethod"
+    KuiklyRenderNativeMethodCallTDFNativeMethod = 17,     // "callTDFModuleMethod"
+    KuiklyRenderNativeMethodClearTimeout = 18             // "clearTimeout方法"
 };
 
 class IKRRenderNativeContextHandler;
@@ -68,6 +69,12 @@ class ICallNativeCallback {
                  std::shared_ptr<KRRenderValue> &arg1, std::shared_ptr<KRRenderValue> &arg2,
                  std::shared_ptr<KRRenderValue> &arg3, std::shared_ptr<KRRenderValue> &arg4,
                  std::shared_ptr<KRRenderValue> &arg5) = 0;
+    /**
+     * 批量渲染指令回调, 运行在 context 线程
+     * @param data 二进制指令 buffer, 仅在调用期间有效
+     * @param size buffer 长度
+     */
+    virtual void OnCallNativeBatch(const uint8_t *data, size_t size) {}
 };
 
 class IKRRenderNativeContextHandler : public std::enable_shared_from_this<IKRRenderNativeContextHandler> {
@@ -79,6 +86,8 @@ class IKRRenderNativeContextHandler : public std::enable_shared_from_this<IKRRen
                                              const KRRenderCValue &arg3, const KRRenderCValue &arg4,
                                              const KRRenderCValue &arg5);
     
+    static void DispatchCallNativeBatch(const std::string &instanceId, const uint8_t *data, size_t size);
+
     static void SetContextHandlerCreator(const KRRenderContextHandlerCreator &creator);
 
     static std::shared_ptr<IKRRenderNativeContextHandler>
@@ -92,6 +101,8 @@ class IKRRenderNativeContextHandler : public std::enable_shared_from_this<IKRRen
                  std::shared_ptr<KRRenderValue> &arg3, std::shared_ptr<KRRenderValue> &arg4,
                  std::shared_ptr<KRRenderValue> &arg5);
 
+    void OnCallNativeBatch(const uint8_t *data, size_t size);
+
     void Init(const std::shared_ptr<KRRenderContextParams> context_params);
 
     virtual void InitContext();  //  初始化通信上下文
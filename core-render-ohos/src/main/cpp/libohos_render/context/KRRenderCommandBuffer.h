@@ -0,0 +1,407 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
+#define CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
+
+/**
+ * Kotlin -> Native 批量渲染指令的二进制编解码。
+ *
+ * 布局(小端):
+ *   header : magic(u32 'KRCB') | version(u16) | flags(u16) | op_count(u32)
+ *   op     : opcode(u8) | 操作数...
+ *   string : length(u32) | utf8 bytes(不含 '\0')
+ *   value  : type(u8, 取值同 KRRenderCValue::Type) | payload
+ *
+ * 本文件只依赖标准库, 方便在 host 上直接编译做 benchmark / 单测。
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "libohos_render/foundation/type/KRRenderCValue.h"
+
+/**
+ * 指令码, 数值与 KuiklyRenderNativeMethod 保持一致
+ */
+enum class KRRenderCommandOp : uint8_t {
+    kCreateRenderView = 1,
+    kRemoveRenderView = 2,
+    kInsertSubRenderView = 3,
+    kSetViewProp = 4,
+    kSetRenderViewFrame = 5,
+    kCreateShadow = 9,
+    kRemoveShadow = 10,
+    kSetShadowProp = 11,
+    kSetShadowForView = 12,
+};
+
+constexpr uint32_t kKRRenderCommandBufferMagic = 0x4243524B;  // "KRCB"
+constexpr uint16_t kKRRenderCommandBufferVersion = 1;
+constexpr size_t kKRRenderCommandBufferHeaderSize = 12;
+/**
+ * header flags: buffer 中包含 shadow 相关指令, 需要先在 context 线程同步执行
+ */
+constexpr uint16_t kKRRenderCommandBufferFlagHasShadowOps = 1 << 0;
+
+/**
+ * 解码出的属性值, 字符串/二进制直接指向 buffer 内存, 不做拷贝
+ */
+struct KRRenderCommandValue {
+    KRRenderCValue::Type type = KRRenderCValue::Type::NULL_VALUE;
+    int64_t int_value = 0;
+    double double_value = 0;
+    std::string_view bytes;
+};
+
+/**
+ * 单次遍历解码器, 通过 Visitor 回调把指令直接派发给调用方, 解码过程中不产生堆分配。
+ * Visitor 需实现:
+ *   void OnCreateRenderView(int32_t tag, std::string_view view_name);
+ *   void OnRemoveRenderView(int32_t tag);
+ *   void OnInsertSubRenderView(int32_t parent_tag, int32_t child_tag, int32_t index);
+ *   void OnSetViewProp(int32_t tag, std::string_view key, const KRRenderCommandValue &value);
+ *   void OnSetRenderViewFrame(int32_t tag, float x, float y, float width, float height);
+ *   void OnCreateShadow(int32_t tag, std::string_view view_name);
+ *   void OnRemoveShadow(int32_t tag);
+ *   void OnSetShadowProp(int32_t tag, std::string_view key, const KRRenderCommandValue &value);
+ *   void OnSetShadowForView(int32_t tag);
+ */
+class KRRenderCommandBufferReader {
+ public:
+    KRRenderCommandBufferReader(const uint8_t *data, size_t size) : data_(data), size_(size) {
+        if (data_ == nullptr || size_ < kKRRenderCommandBufferHeaderSize) {
+            return;
+        }
+        uint32_t magic = 0;
+        uint16_t version = 0;
+        std::memcpy(&magic, data_, sizeof(magic));
+        std::memcpy(&version, data_ + 4, sizeof(version));
+        std::memcpy(&flags_, data_ + 6, sizeof(flags_));
+        std::memcpy(&op_count_, data_ + 8, sizeof(op_count_));
+        valid_ = magic == kKRRenderCommandBufferMagic && version == kKRRenderCommandBufferVersion;
+    }
+
+    bool IsValid() const {
+        return valid_;
+    }
+
+    uint32_t OpCount() const {
+        return op_count_;
+    }
+
+    bool HasShadowOps() const {
+        return (flags_ & kKRRenderCommandBufferFlagHasShadowOps) != 0;
+    }
+
+    /**
+     * 按顺序解码全部指令
+     * @param visitor 指令接收者, 不关心的指令实现为空即可
+     * @return buffer 是否完整合法, 非法时已派发的指令不会回滚
+     */
+    template <typename Visitor>
+    bool Decode(Visitor &visitor) const {
+        if (!valid_) {
+            return false;
+        }
+        size_t pos = kKRRenderCommandBufferHeaderSize;
+        for (uint32_t i = 0; i < op_count_; i++) {
+            uint8_t op = 0;
+            if (!Read(pos, op)) {
+                return false;
+            }
+            int32_t tag = 0;
+            if (!Read(pos, tag)) {
+                return false;
+            }
+            switch (static_cast<KRRenderCommandOp>(op)) {
+            case KRRenderCommandOp::kCreateRenderView:
+            case KRRenderCommandOp::kCreateShadow: {
+                std::string_view view_name;
+                if (!ReadString(pos, view_name)) {
+                    return false;
+                }
+                if (op == static_cast<uint8_t>(KRRenderCommandOp::kCreateRenderView)) {
+                    visitor.OnCreateRenderView(tag, view_name);
+                } else {
+                    visitor.OnCreateShadow(tag, view_name);
+                }
+                break;
+            }
+            case KRRenderCommandOp::kRemoveRenderView: {
+                visitor.OnRemoveRenderView(tag);
+                break;
+            }
+            case KRRenderCommandOp::kInsertSubRenderView: {
+                int32_t child_tag = 0;
+                int32_t index = 0;
+                if (!Read(pos, child_tag) || !Read(pos, index)) {
+                    return false;
+                }
+                visitor.OnInsertSubRenderView(tag, child_tag, index);
+                break;
+            }
+            case KRRenderCommandOp::kSetViewProp:
+            case KRRenderCommandOp::kSetShadowProp: {
+                std::string_view key;
+                KRRenderCommandValue value;
+                if (!ReadString(pos, key) || !ReadValue(pos, value)) {
+                    return false;
+                }
+                if (op == static_cast<uint8_t>(KRRenderCommandOp::kSetViewProp)) {
+                    visitor.OnSetViewProp(tag, key, value);
+                } else {
+                    visitor.OnSetShadowProp(tag, key, value);
+                }
+                break;
+            }
+            case KRRenderCommandOp::kSetRenderViewFrame: {
+                float frame[4];
+                if (pos + sizeof(frame) > size_) {
+                    return false;
+                }
+                std::memcpy(frame, data_ + pos, sizeof(frame));
+                pos += sizeof(frame);
+                visitor.OnSetRenderViewFrame(tag, frame[0], frame[1], frame[2], frame[3]);
+                break;
+            }
+            case KRRenderCommandOp::kRemoveShadow: {
+                visitor.OnRemoveShadow(tag);
+                break;
+            }
+            case KRRenderCommandOp::kSetShadowForView: {
+                visitor.OnSetShadowForView(tag);
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+        return true;
+    }
+
+ private:
+    template <typename T>
+    bool Read(size_t &pos, T &out) const {
+        if (pos + sizeof(T) > size_) {
+            return false;
+        }
+        std::memcpy(&out, data_ + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(size_t &pos, std::string_view &out) const {
+        uint32_t length = 0;
+        if (!Read(pos, length) || length > size_ - pos) {
+            return false;
+        }
+        out = std::string_view(reinterpret_cast<const char *>(data_ + pos), length);
+        pos += length;
+        return true;
+    }
+
+    bool ReadValue(size_t &pos, KRRenderCommandValue &out) const {
+        uint8_t type = 0;
+        if (!Read(pos, type)) {
+            return false;
+        }
+        out.type = static_cast<KRRenderCValue::Type>(type);
+        switch (out.type) {
+        case KRRenderCValue::Type::NULL_VALUE:
+            return true;
+        case KRRenderCValue::Type::BOOL: {
+            uint8_t b = 0;
+            bool ok = Read(pos, b);
+            out.int_value = b;
+            return ok;
+        }
+        case KRRenderCValue::Type::INT: {
+            int32_t v = 0;
+            bool ok = Read(pos, v);
+            out.int_value = v;
+            return ok;
+        }
+        case KRRenderCValue::Type::LONG:
+            return Read(pos, out.int_value);
+        case KRRenderCValue::Type::FLOAT: {
+            float v = 0;
+            bool ok = Read(pos, v);
+            out.double_value = v;
+            return ok;
+        }
+        case KRRenderCValue::Type::DOUBLE:
+            return Read(pos, out.double_value);
+        case KRRenderCValue::Type::STRING:
+        case KRRenderCValue::Type::BYTES:
+            return ReadString(pos, out.bytes);
+        default:
+            return false;
+        }
+    }
+
+    const uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+    bool valid_ = false;
+    uint16_t flags_ = 0;
+    uint32_t op_count_ = 0;
+};
+
+/**
+ * 编码器, 格式即文件头约定(Kotlin 侧须按相同格式编码), 供 native 侧构造批量指令及测试使用
+ */
+class KRRenderCommandBufferWriter {
+ public:
+    KRRenderCommandBufferWriter() {
+        buffer_.resize(kKRRenderCommandBufferHeaderSize);
+    }
+
+    void CreateRenderView(int32_t tag, std::string_view view_name) {
+        BeginOp(KRRenderCommandOp::kCreateRenderView, tag);
+        WriteString(view_name);
+    }
+
+    void RemoveRenderView(int32_t tag) {
+        BeginOp(KRRenderCommandOp::kRemoveRenderView, tag);
+    }
+
+    void InsertSubRenderView(int32_t parent_tag, int32_t child_tag, int32_t index) {
+        BeginOp(KRRenderCommandOp::kInsertSubRenderView, parent_tag);
+        Write(child_tag);
+        Write(index);
+    }
+
+    template <typename T>
+    void SetViewProp(int32_t tag, std::string_view key, const T &value) {
+        BeginOp(KRRenderCommandOp::kSetViewProp, tag);
+        WriteString(key);
+        WriteValue(value);
+    }
+
+    void SetRenderViewFrame(int32_t tag, float x, float y, float width, float height) {
+        BeginOp(KRRenderCommandOp::kSetRenderViewFrame, tag);
+        const float frame[4] = {x, y, width, height};
+        Append(frame, sizeof(frame));
+    }
+
+    void CreateShadow(int32_t tag, std::string_view view_name) {
+        BeginOp(KRRenderCommandOp::kCreateShadow, tag);
+        WriteString(view_name);
+        flags_ |= kKRRenderCommandBufferFlagHasShadowOps;
+    }
+
+    void RemoveShadow(int32_t tag) {
+        BeginOp(KRRenderCommandOp::kRemoveShadow, tag);
+        flags_ |= kKRRenderCommandBufferFlagHasShadowOps;
+    }
+
+    template <typename T>
+    void SetShadowProp(int32_t tag, std::string_view key, const T &value) {
+        BeginOp(KRRenderCommandOp::kSetShadowProp, tag);
+        WriteString(key);
+        WriteValue(value);
+        flags_ |= kKRRenderCommandBufferFlagHasShadowOps;
+    }
+
+    void SetShadowForView(int32_t tag) {
+        BeginOp(KRRenderCommandOp::kSetShadowForView, tag);
+        flags_ |= kKRRenderCommandBufferFlagHasShadowOps;
+    }
+
+    /**
+     * 回填 header 并返回完整 buffer
+     */
+    const std::vector<uint8_t> &Finish() {
+        std::memcpy(buffer_.data(), &kKRRenderCommandBufferMagic, sizeof(uint32_t));
+        std::memcpy(buffer_.data() + 4, &kKRRenderCommandBufferVersion, sizeof(uint16_t));
+        std::memcpy(buffer_.data() + 6, &flags_, sizeof(uint16_t));
+        std::memcpy(buffer_.data() + 8, &op_count_, sizeof(uint32_t));
+        return buffer_;
+    }
+
+    void Reset() {
+        buffer_.resize(kKRRenderCommandBufferHeaderSize);
+        flags_ = 0;
+        op_count_ = 0;
+    }
+
+ private:
+    void BeginOp(KRRenderCommandOp op, int32_t tag) {
+        op_count_++;
+        Write(static_cast<uint8_t>(op));
+        Write(tag);
+    }
+
+    void Append(const void *data, size_t size) {
+        auto *p = static_cast<const uint8_t *>(data);
+        buffer_.insert(buffer_.end(), p, p + size);
+    }
+
+    template <typename T>
+    void Write(const T &value) {
+        Append(&value, sizeof(T));
+    }
+
+    void WriteString(std::string_view str) {
+        Write(static_cast<uint32_t>(str.size()));
+        Append(str.data(), str.size());
+    }
+
+    void WriteTypedValue(KRRenderCValue::Type type) {
+        Write(static_cast<uint8_t>(type));
+    }
+
+    void WriteValue(std::nullptr_t) {
+        WriteTypedValue(KRRenderCValue::Type::NULL_VALUE);
+    }
+    void WriteValue(bool value) {
+        WriteTypedValue(KRRenderCValue::Type::BOOL);
+        Write(static_cast<uint8_t>(value ? 1 : 0));
+    }
+    void WriteValue(int32_t value) {
+        WriteTypedValue(KRRenderCValue::Type::INT);
+        Write(value);
+    }
+    void WriteValue(int64_t value) {
+        WriteTypedValue(KRRenderCValue::Type::LONG);
+        Write(value);
+    }
+    void WriteValue(float value) {
+        WriteTypedValue(KRRenderCValue::Type::FLOAT);
+        Write(value);
+    }
+    void WriteValue(double value) {
+        WriteTypedValue(KRRenderCValue::Type::DOUBLE);
+        Write(value);
+    }
+    void WriteValue(std::string_view value) {
+        WriteTypedValue(KRRenderCValue::Type::STRING);
+        WriteString(value);
+    }
+    void WriteValue(const std::string &value) {
+        WriteValue(std::string_view(value));
+    }
+    void WriteValue(const char *value) {
+        WriteValue(std::string_view(value));
+    }
+
+    std::vector<uint8_t> buffer_;
+    uint16_t flags_ = 0;
+    uint32_t op_count_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
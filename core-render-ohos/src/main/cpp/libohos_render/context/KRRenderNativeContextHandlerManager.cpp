@@ -108,3 +108,13 @@ KRRenderCValue KRRenderNativeContextHandlerManager::DispatchCallNative(
     ScheduleDeallocRenderValues(return_value);
     return return_value->toCValue();
 }
+
+void KRRenderNativeContextHandlerManager::DispatchCallNativeBatch(const std::string &instanceId, const uint8_t *data,
+                                                                  size_t size) {
+    // 整个 batch 只查找一次 handler, 且不为每条指令构造 KRRenderValue 参数
+    auto handler = context_handler_map_.Get(instanceId);
+    if (!handler || nullptr == KRRenderManager::GetInstance().GetRenderView(instanceId)) {
+        return;
+    }
+    handler->OnCallNativeBatch(data, size);
+}
@@ -67,6 +67,7 @@ class KRRenderNativeContextHandlerManager {
                                       const KRRenderCValue &arg1, const KRRenderCValue &arg2,
                                       const KRRenderCValue &arg3, const KRRenderCValue &arg4,
                                       const KRRenderCValue &arg5);
+    void DispatchCallNativeBatch(const std::string &instanceId, const uint8_t *data, size_t size);
     static KRRenderNativeContextHandlerManager &GetInstance() {
         static KRRenderNativeContextHandlerManager m_instance;  // 局部静态变量
         return m_instance;
@@ -18,6 +18,8 @@
 #include <cmath>
 #include <functional>
 #include <memory>
+#include "libohos_render/context/KRRenderCommandBuffer.h"
+#include "libohos_render/foundation/KRChunkAllocator.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/layer/KRRenderLayerHandler.h"
 #include "libohos_render/manager/KRArkTSManager.h"
@@ -34,6 +36,13 @@ const KRRenderCValue com_tencent_kuikly_CallNative(int methodId, KRRenderCValue
                                                              arg2, arg3, arg4, arg5);
 }
 
+void com_tencent_kuikly_CallNativeBatch(const char *pagerId, const uint8_t *data, int32_t size) {
+    if (pagerId == nullptr || data == nullptr || size <= 0) {
+        return;
+    }
+    IKRRenderNativeContextHandler::DispatchCallNativeBatch(std::string(pagerId), data, static_cast<size_t>(size));
+}
+
 CallKotlin callKotlin_;
 int com_tencent_kuikly_SetCallKotlin(CallKotlin callKotlin) {
     callKotlin_ = callKotlin;
@@ -69,7 +78,7 @@ KRRenderCore::KRRenderCore(std::weak_ptr<IKRRenderView> renderView, std::shared_
     renderView_ = renderView;
     context_ = context;
     defaultNullValue_ = KRRenderValue::Make();
-    uiScheduler_ = std::make_shared<KRUIScheduler>(this);
+    uiScheduler_ = std::make_shared<KRUIScheduler>(this, context_->InstanceId());
     contextHandler_ = IKRRenderNativeContextHandler::CreateContextHandler(context);
     // 注册kotlin call native回调（走onCallNative接口）
     contextHandler_->RegisterCallNative(this);
@@ -164,6 +173,8 @@ std::shared_ptr<IKRRenderModuleExport> KRRenderCore::GetModuleOrCreate(const std
 void KRRenderCore::WillDealloc(const std::string &instanceId) {
     contextHandler_->WillDestroy();
     renderLayerHandler_->WillDestroy();
+    // 页面的setTimeout及UI调度的兜底定时器一次性丢弃
+    KRTimerQueue::GetInstance().CancelGroup(instanceId);
     auto self = shared_from_this();
     std::string id = instanceId;
     PerformTaskOnContextQueue(false, 0, [self, id] {
@@ -232,6 +243,7 @@ bool KRRenderCore::ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method,
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetShadowProp ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetShadowForView ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetTimeout ||
+           method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodClearTimeout ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallShadowMethod ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSyncFlushUI ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallTDFNativeMethod;
@@ -283,25 +295,7 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
     }
 
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetRenderViewFrame: {
-        // 在 frame 入口处统一按像素取整：
-        // 把 frame 视为 [left, top, right, bottom] 四条边界，分别将其 vp -> px 后用 std::round
-        // 取到最近的整数像素，再换算回 vp；width/height 由对齐后的边界相减得到。
-        // 这样可保证：
-        //   1) 相邻节点（前一个的 right == 后一个的 left）对齐到同一物理像素，避免接缝/重叠；
-        //   2) std::round 对负数也按"远离 0"四舍五入，行为与正数一致；
-        //   3) 下游属性流直接使用已取整的 vp 值，无需再分散处理。
-        const auto &config = context_->Config();
-        auto alignEdgeToPixel = [&config](float vp) {
-            return config->Px2Vp(std::round(config->vp2px(vp)));
-        };
-        const float left = alignEdgeToPixel(arg2->toFloat());
-        const float top = alignEdgeToPixel(arg3->toFloat());
-        const float right = alignEdgeToPixel(arg2->toFloat() + arg4->toFloat());
-        const float bottom = alignEdgeToPixel(arg3->toFloat() + arg5->toFloat());
-        auto rect = KRRect(left, top, right - left, bottom - top);
-        std::string rectData((const char *)&rect, sizeof(KRRect));
-        auto value = KRRenderValue::Make(rectData);
-        renderLayerHandler_->SetProp(arg1->toInt(), "frame", value);
+        SetRenderViewFrame(arg1->toInt(), arg2->toFloat(), arg3->toFloat(), arg4->toFloat(), arg5->toFloat());
         break;
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCalculateRenderViewSize: {
@@ -384,13 +378,32 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetTimeout: {
         std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
-        PerformTaskOnContextQueue(false, arg1->toInt() > 0 ? arg1->toInt() : 1, [weakSelf, arg2] {
-            if (auto lock = weakSelf.lock()) {
-                auto nullValue = lock->defaultNullValue_;
-                lock->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, arg2, nullValue,
-                                       nullValue, nullValue, nullValue);
-            }
-        });
+        auto delayMs = arg1->toInt() > 0 ? arg1->toInt() : 1;
+        auto instanceId = context_->InstanceId();
+        auto callbackId = arg2->toString();
+        // 定时器按页面分组，clearTimeout或页面销毁时直接从定时器队列移除，不再唤醒context线程
+        auto timerId = KRTimerQueue::GetInstance().Schedule(
+            [weakSelf, arg2] {
+                PerformTaskOnContextQueue(false, 0, [weakSelf, arg2] {
+                    if (auto lock = weakSelf.lock()) {
+                        lock->timeouts_.erase(arg2->toString());
+                        auto nullValue = lock->defaultNullValue_;
+                        lock->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, arg2,
+                                               nullValue, nullValue, nullValue, nullValue);
+                    }
+                });
+            },
+            delayMs, instanceId);
+        timeouts_[callbackId] = timerId;
+        break;
+    }
+
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodClearTimeout: {
+        auto it = timeouts_.find(arg1->toString());
+        if (it != timeouts_.end()) {
+            KRTimerQueue::GetInstance().Cancel(it->second);
+            timeouts_.erase(it);
+        }
         break;
     }
 
@@ -417,6 +430,166 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
     return defaultNullValue_;
 }
 
+void KRRenderCore::SetRenderViewFrame(int tag, float x, float y, float width, float height) {
+    // 在 frame 入口处统一按像素取整：
+    // 把 frame 视为 [left, top, right, bottom] 四条边界，分别将其 vp -> px 后用 std::round
+    // 取到最近的整数像素，再换算回 vp；width/height 由对齐后的边界相减得到。
+    // 这样可保证：
+    //   1) 相邻节点（前一个的 right == 后一个的 left）对齐到同一物理像素，避免接缝/重叠；
+    //   2) std::round 对负数也按"远离 0"四舍五入，行为与正数一致；
+    //   3) 下游属性流直接使用已取整的 vp 值，无需再分散处理。
+    const auto &config = context_->Config();
+    auto alignEdgeToPixel = [&config](float vp) {
+        return config->Px2Vp(std::round(config->vp2px(vp)));
+    };
+    const float left = alignEdgeToPixel(x);
+    const float top = alignEdgeToPixel(y);
+    const float right = alignEdgeToPixel(x + width);
+    const float bottom = alignEdgeToPixel(y + height);
+    auto rect = KRRect(left, top, right - left, bottom - top);
+    std::string rectData((const char *)&rect, sizeof(KRRect));
+    auto value = KRRenderValue::Make(rectData);
+    renderLayerHandler_->SetProp(tag, "frame", value);
+}
+
+/**
+ * 批量指令的属性值对象（含 shared_ptr 控制块）在块内连续分配, 一整块只做一次堆分配;
+ * 块在其中所有属性值释放后释放, 被 view 长期持有的属性值最多滞留一个块
+ */
+static constexpr size_t kCommandValueBlockSize = sizeof(KRRenderValue) + 64;
+
+template <typename T>
+static KRAnyValue MakeArenaValue(KRChunkArena &arena, T &&value) {
+    KRChunkAllocator<KRRenderValue> allocator(arena.Reserve(kCommandValueBlockSize));
+    return KRRenderValue::MakeWithAllocator(allocator, std::forward<T>(value));
+}
+
+/** 把解码出的属性值转换为 KRRenderValue */
+static KRAnyValue MakeCommandValue(KRChunkArena &arena, const KRRenderCommandValue &value) {
+    switch (value.type) {
+    case KRRenderCValue::Type::BOOL:
+        return MakeArenaValue(arena, value.int_value != 0);
+    case KRRenderCValue::Type::INT:
+        return MakeArenaValue(arena, static_cast<int32_t>(value.int_value));
+    case KRRenderCValue::Type::LONG:
+        return MakeArenaValue(arena, value.int_value);
+    case KRRenderCValue::Type::FLOAT:
+        return MakeArenaValue(arena, static_cast<float>(value.double_value));
+    case KRRenderCValue::Type::DOUBLE:
+        return MakeArenaValue(arena, value.double_value);
+    case KRRenderCValue::Type::STRING:
+        return MakeArenaValue(arena, std::string(value.bytes));
+    case KRRenderCValue::Type::BYTES:
+        return MakeArenaValue(arena, KRByteBuffer::Copy(value.bytes.data(), value.bytes.size()));
+    default:
+        return MakeArenaValue(arena, nullptr);
+    }
+}
+
+/** setShadowForView 在 context 线程取到的 shadow 及其主线程任务, 按指令顺序交给主线程消费 */
+struct KRPendingShadowForView {
+    std::shared_ptr<IKRRenderShadowExport> shadow;
+    KRSchedulerTask task;
+};
+
+struct KRRenderCore::CommandBufferShadowVisitor {
+    KRRenderCore *core;
+    std::vector<KRPendingShadowForView> *pending_shadow_for_views;
+    KRChunkArena arena{};
+
+    void OnCreateRenderView(int32_t tag, std::string_view view_name) {}
+    void OnRemoveRenderView(int32_t tag) {}
+    void OnInsertSubRenderView(int32_t parent_tag, int32_t child_tag, int32_t index) {}
+    void OnSetViewProp(int32_t tag, std::string_view key, const KRRenderCommandValue &value) {}
+    void OnSetRenderViewFrame(int32_t tag, float x, float y, float width, float height) {}
+    void OnCreateShadow(int32_t tag, std::string_view view_name) {
+        core->renderLayerHandler_->CreateShadow(tag, std::string(view_name));
+    }
+    void OnRemoveShadow(int32_t tag) {
+        core->renderLayerHandler_->RemoveShadow(tag);
+    }
+    void OnSetShadowProp(int32_t tag, std::string_view key, const KRRenderCommandValue &value) {
+        core->renderLayerHandler_->SetShadowProp(tag, std::string(key), MakeCommandValue(arena, value));
+    }
+    void OnSetShadowForView(int32_t tag) {
+        KRPendingShadowForView pending;
+        pending.shadow = core->renderLayerHandler_->Shadow(tag);
+        if (pending.shadow) {
+            pending.task = pending.shadow->TaskToMainQueueWhenWillSetShadowToView();
+        }
+        pending_shadow_for_views->push_back(std::move(pending));
+    }
+};
+
+struct KRRenderCore::CommandBufferViewVisitor {
+    KRRenderCore *core;
+    std::vector<KRPendingShadowForView> *pending_shadow_for_views;
+    size_t next_shadow_for_view = 0;
+    KRChunkArena arena{};
+
+    void OnCreateRenderView(int32_t tag, std::string_view view_name) {
+        core->renderLayerHandler_->CreateRenderView(tag, std::string(view_name));
+    }
+    void OnRemoveRenderView(int32_t tag) {
+        core->renderLayerHandler_->RemoveRenderView(tag);
+    }
+    void OnInsertSubRenderView(int32_t parent_tag, int32_t child_tag, int32_t index) {
+        core->renderLayerHandler_->InsertSubRenderView(parent_tag, child_tag, index);
+    }
+    void OnSetViewProp(int32_t tag, std::string_view key, const KRRenderCommandValue &value) {
+        core->renderLayerHandler_->SetProp(tag, std::string(key), MakeCommandValue(arena, value));
+    }
+    void OnSetRenderViewFrame(int32_t tag, float x, float y, float width, float height) {
+        core->SetRenderViewFrame(tag, x, y, width, height);
+    }
+    void OnCreateShadow(int32_t tag, std::string_view view_name) {}
+    void OnRemoveShadow(int32_t tag) {}
+    void OnSetShadowProp(int32_t tag, std::string_view key, const KRRenderCommandValue &value) {}
+    void OnSetShadowForView(int32_t tag) {
+        if (pending_shadow_for_views == nullptr || next_shadow_for_view >= pending_shadow_for_views->size()) {
+            return;
+        }
+        auto &pending = (*pending_shadow_for_views)[next_shadow_for_view++];
+        if (!pending.shadow) {
+            return;
+        }
+        if (pending.task) {
+            pending.task();
+        }
+        core->renderLayerHandler_->SetShadow(tag, pending.shadow);
+    }
+};
+
+void KRRenderCore::OnCallNativeBatch(const uint8_t *data, size_t size) {  // 运行在 context 线程
+    KRRenderCommandBufferReader reader(data, size);
+    if (!reader.IsValid()) {
+        KR_LOG_ERROR << "invalid render command buffer, size:" << size;
+        return;
+    }
+    if (!uiScheduler_) {
+        return;
+    }
+    // shadow 指令与逐条调用时一样需在 context 线程同步执行（Kotlin 侧紧接着会同步测量）
+    std::shared_ptr<std::vector<KRPendingShadowForView>> pending_shadow_for_views;
+    if (reader.HasShadowOps()) {
+        pending_shadow_for_views = std::make_shared<std::vector<KRPendingShadowForView>>();
+        CommandBufferShadowVisitor shadow_visitor{this, pending_shadow_for_views.get()};
+        if (!reader.Decode(shadow_visitor)) {
+            KR_LOG_ERROR << "malformed render command buffer, op count:" << reader.OpCount();
+        }
+    }
+    // Kotlin 侧 buffer 仅在本次调用内有效, 整体拷贝一次, 整批 view 指令合并为一个主线程任务
+    auto buffer = std::make_shared<std::vector<uint8_t>>(data, data + size);
+    std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
+    uiScheduler_->AddTaskToMainQueueWithTask([weakSelf, buffer, pending_shadow_for_views] {
+        if (auto locked = weakSelf.lock()) {
+            KRRenderCommandBufferReader reader(buffer->data(), buffer->size());
+            CommandBufferViewVisitor view_visitor{locked.get(), pending_shadow_for_views.get()};
+            reader.Decode(view_visitor);
+        }
+    });
+}
+
 void KRRenderCore::WillPerformUITasksWithScheduler() {  // 运行在 context 线程
     // 去触发layout to kotlin
     // 同步主线程任务前，需要告诉kotlin侧 去 layoutIfNeed, 避免viewFrame设置时机和创建view时机不同步
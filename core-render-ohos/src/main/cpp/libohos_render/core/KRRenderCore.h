@@ -22,6 +22,7 @@
 #include <arkui/native_node.h>
 #include "libohos_render/context/IKRRenderNativeContextHandler.h"
 #include "libohos_render/context/KRRenderContextParams.h"
+#include "libohos_render/foundation/thread/KRTimerQueue.h"
 #include "libohos_render/layer/IKRRenderLayer.h"
 #include "libohos_render/scheduler/KRUIScheduler.h"
 #include "libohos_render/view/IKRRenderView.h"
@@ -64,6 +65,8 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
                  std::shared_ptr<KRRenderValue> &arg1, std::shared_ptr<KRRenderValue> &arg2,
                  std::shared_ptr<KRRenderValue> &arg3, std::shared_ptr<KRRenderValue> &arg4,
                  std::shared_ptr<KRRenderValue> &arg5) override;
+    /** 批量渲染指令, 运行在 context 线程 */
+    void OnCallNativeBatch(const uint8_t *data, size_t size) override;
     /** KRRenderUISchedulerDelegate interface override */
     void WillPerformUITasksWithScheduler() override;
     /** core初始化之后必须调用该DidInit进行初始化 */
@@ -131,6 +134,8 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
  private:
     /** UI任务调度器 */
     std::shared_ptr<KRUIScheduler> uiScheduler_;
+    /** 未到期的setTimeout，callbackId -> 定时器id（仅在context线程访问） */
+    std::unordered_map<std::string, KRTimerId> timeouts_;
     /** 根渲染容器 */
     std::weak_ptr<IKRRenderView> renderView_;
     /** 页面上下文，包含page_name, page_data, 执行模式*/
@@ -155,6 +160,13 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
     KRAnyValue PerformNativeCallback(const KuiklyRenderNativeMethod &method, const KRAnyValue &arg1, const KRAnyValue &arg2,
                                      const KRAnyValue &arg3, const KRAnyValue &arg4, const KRAnyValue &arg5, bool sync);
     bool ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method, std::shared_ptr<KRRenderValue> &arg5);
+    /** 设置 view frame，入口处统一按像素取整 */
+    void SetRenderViewFrame(int tag, float x, float y, float width, float height);
+
+    /** 批量指令中 shadow 部分的解码器（context 线程） */
+    struct CommandBufferShadowVisitor;
+    /** 批量指令中 view 部分的解码器（主线程） */
+    struct CommandBufferViewVisitor;
 
     void OnDestroy();
 };
@@ -15,9 +15,68 @@
 
 #include "libohos_render/expand/components/apng/APNGAnimateView.h"
 
+#include <multimedia/image_framework/image/image_source_native.h>
 #include "libohos_render/expand/components/apng/APNGCache.h"
-#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
 #include "libohos_render/utils/KRRenderLoger.h"
+
+/**
+ * 将单帧 PNG 解码为 RGBA_8888 像素
+ */
+static bool DecodeFramePixels(const std::vector<uint8_t> &png, int width, int height, std::vector<uint8_t> &rgba) {
+    OH_ImageSourceNative *source = nullptr;
+    Image_ErrorCode errCode =
+        OH_ImageSourceNative_CreateFromData(const_cast<uint8_t *>(png.data()), png.size(), &source);
+    if (errCode != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "APNG OH_ImageSourceNative_CreateFromData failed, errCode: " << errCode;
+        return false;
+    }
+
+    OH_DecodingOptions *ops = nullptr;
+    OH_DecodingOptions_Create(&ops);
+    OH_DecodingOptions_SetDesiredDynamicRange(ops, IMAGE_DYNAMIC_RANGE_AUTO);
+    OH_DecodingOptions_SetPixelFormat(ops, PIXEL_FORMAT_RGBA_8888);
+    OH_PixelmapNative *pixelmap = nullptr;
+    errCode = OH_ImageSourceNative_CreatePixelmap(source, ops, &pixelmap);
+    OH_DecodingOptions_Release(ops);
+    OH_ImageSourceNative_Release(source);
+    if (errCode != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "APNG OH_ImageSourceNative_CreatePixelmap failed, errCode: " << errCode;
+        return false;
+    }
+
+    size_t bufferSize = static_cast<size_t>(width) * height * 4;
+    rgba.resize(bufferSize);
+    errCode = OH_PixelmapNative_ReadPixels(pixelmap, rgba.data(), &bufferSize);
+    OH_PixelmapNative_Release(pixelmap);
+    if (errCode != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "APNG OH_PixelmapNative_ReadPixels failed, errCode: " << errCode;
+        return false;
+    }
+    return true;
+}
+
+static OH_PixelmapNative *CreatePixelmapFromPixels(const uint8_t *pixels, size_t size, int width, int height) {
+    OH_Pixelmap_InitializationOptions *createOpts = nullptr;
+    OH_PixelmapInitializationOptions_Create(&createOpts);
+    OH_PixelmapInitializationOptions_SetWidth(createOpts, width);
+    OH_PixelmapInitializationOptions_SetHeight(createOpts, height);
+    OH_PixelmapInitializationOptions_SetPixelFormat(createOpts, PIXEL_FORMAT_RGBA_8888);
+    OH_PixelmapNative *pixelmap = nullptr;
+    Image_ErrorCode errCode = OH_PixelmapNative_CreateEmptyPixelmap(createOpts, &pixelmap);
+    OH_PixelmapInitializationOptions_Release(createOpts);
+    if (errCode != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "APNG OH_PixelmapNative_CreateEmptyPixelmap failed, errCode: " << errCode;
+        return nullptr;
+    }
+    errCode = OH_PixelmapNative_WritePixels(pixelmap, const_cast<uint8_t *>(pixels), size);
+    if (errCode != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "APNG OH_PixelmapNative_WritePixels failed, errCode: " << errCode;
+        OH_PixelmapNative_Release(pixelmap);
+        return nullptr;
+    }
+    return pixelmap;
+}
 /**
  * 实例初始化构造器
  * @param filePath 设置资源文件路径
@@ -33,7 +92,8 @@ void APNGAnimateView::Init(std::string &filePath, ArkUI_NodeHandle parentNode, b
     // 放入线程池执行IO操作
     std::shared_ptr<APNGAnimateView> self = shared_from_this();
     auto start = std::chrono::steady_clock::now();
-    FetchAPNG(filePath, [self, start](std::shared_ptr<APNG> apng) {
+    fetch_request_id_ = FetchAPNG(filePath, [self, start](std::shared_ptr<APNG> apng) {
+        self->fetch_request_id_ = 0;
         if (apng) {
             // 加载成功
             self->LoadSuccess(apng);
@@ -49,18 +109,25 @@ void APNGAnimateView::Init(std::string &filePath, ArkUI_NodeHandle parentNode, b
 
 void APNGAnimateView::Destroy() {
     Stop();
+    if (fetch_request_id_) {
+        // 不再等待加载结果，所有请求方都取消时放弃读取和解析
+        CancelFetchAPNG(fetch_request_id_);
+        fetch_request_id_ = 0;
+    }
     if (parent_node_) {
         kuikly::util::GetNodeApi()->removeChild(parent_node_, image_node_);
         kuikly::util::GetNodeApi()->disposeNode(image_node_);
         image_node_ = nullptr;
         parent_node_ = nullptr;
     }
+    ReleaseFrameDrawables();
 }
 
 APNGAnimateView::~APNGAnimateView() {
     Destroy();
-    KRGCDQueue::GetInstance().DispatchAsync([apng = apng_] {
-        apng->width;  // sub thread gc
+    auto &queue = kuikly::dispatch::KRExecutor::GetInstance().Global(kuikly::dispatch::QoS::Background);
+    queue.Async([apng = apng_, stream = stream_] {
+        // sub thread gc
     });
 }
 
@@ -99,6 +166,9 @@ void APNGAnimateView::Stop() {
     play_timeout_flag_ = -1;
     current_frame_index_ = -1;
     did_play_loop_count_ = 0;
+    if (stream_) {
+        stream_->Trim();
+    }
 }
 
 void APNGAnimateView::SetFrame(KRRect parent_frame) {
@@ -109,6 +179,10 @@ void APNGAnimateView::SetFrame(KRRect parent_frame) {
 void APNGAnimateView::LoadSuccess(std::shared_ptr<APNG> apng) {
     // 开始播放
     apng_ = apng;
+    stream_ = APNGFrameStream::Create(apng, DecodeFramePixels, [](std::function<void()> task) {
+        auto &queue = kuikly::dispatch::KRExecutor::GetInstance().Global(kuikly::dispatch::QoS::Utility);
+        queue.Async(std::move(task));
+    });
     SyncAutoPlayIfNeed();
     if (animation_start_callback_) {
         animation_start_callback_();
@@ -123,28 +197,21 @@ void APNGAnimateView::LoadFailure() {
 }
 
 void APNGAnimateView::PlayNextFrame() {
-    if (apng_->frames.size() == 0) {
+    if (!stream_ || stream_->FrameCount() == 0) {
         return;
     }
     bool need_play_next_frame = true;
 
-    std::shared_ptr<APNGDrawable> apngDrawable = apng_->GetDrawable(current_frame_index_ + 1);
-    if (apngDrawable == nullptr) {
-        if (!(apng_->IsParsing())) {  // 说明最后一个了
-            did_play_loop_count_ += 1;
-            if (did_play_loop_count_ < repeat_count_) {
-                current_frame_index_ = 0;
-                apngDrawable = apng_->GetDrawable(current_frame_index_);
-            } else {
-                need_play_next_frame = false;
-            }
-        } else {  // 还在解析 延迟等待
-            need_play_next_frame = true;
+    int index = current_frame_index_ + 1;
+    if (index >= stream_->FrameCount()) {  // 说明最后一个了
+        did_play_loop_count_ += 1;
+        if (did_play_loop_count_ < repeat_count_) {
+            index = 0;
+        } else {
+            need_play_next_frame = false;
         }
-    } else {
-        current_frame_index_ += 1;
     }
-    if (apngDrawable && apngDrawable->isLast && did_play_loop_count_ + 1 >= repeat_count_) {
+    if (need_play_next_frame && stream_->IsLast(index) && did_play_loop_count_ + 1 >= repeat_count_) {
         need_play_next_frame = false;
     }
 
@@ -155,11 +222,11 @@ void APNGAnimateView::PlayNextFrame() {
         // 播放结束
         return;
     }
-    UpdateCurrentFrameToRender(apngDrawable);
-    int delay = 16;
-    if (apngDrawable) {
-        delay = apngDrawable->nextFrameDelay / speed_rate_;
-    }
+    current_frame_index_ = index;
+    UpdateCurrentFrameToRender(index);
+    // 在展示间隔内于工作线程合成后续帧
+    stream_->Prefetch((index + 1) % stream_->FrameCount());
+    int delay = stream_->NextFrameDelay(index) / speed_rate_;
     delay = std::max(delay, 16);
     play_timeout_flag_ += 1;
     auto flag = play_timeout_flag_;
@@ -174,9 +241,46 @@ void APNGAnimateView::PlayNextFrame() {
         delay);
 }
 
-void APNGAnimateView::UpdateCurrentFrameToRender(std::shared_ptr<APNGDrawable> apngDrawable) {
-    if (apngDrawable && apngDrawable->drawable) {
-        kuikly::util::SetArkUIImageSrc(image_node_, apngDrawable->drawable);
+void APNGAnimateView::UpdateCurrentFrameToRender(int index) {
+    if (!image_node_) {
+        return;
+    }
+    OH_PixelmapNative *pixelmap = nullptr;
+    int width = stream_->Width();
+    int height = stream_->Height();
+    stream_->ReadFrame(index, [&pixelmap, width, height](const uint8_t *pixels, size_t size) {
+        pixelmap = CreatePixelmapFromPixels(pixels, size, width, height);
+    });
+    if (!pixelmap) {
+        return;
+    }
+    auto drawable = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(pixelmap);
+    kuikly::util::SetArkUIImageSrc(image_node_, drawable);
+    // 只保留当前帧和上一帧
+    if (drawables_[1]) {
+        OH_ArkUI_DrawableDescriptor_Dispose(drawables_[1]);
+    }
+    if (pixelmaps_[1]) {
+        OH_PixelmapNative_Release(pixelmaps_[1]);
+    }
+    drawables_[1] = drawables_[0];
+    pixelmaps_[1] = pixelmaps_[0];
+    drawables_[0] = drawable;
+    pixelmaps_[0] = pixelmap;
+}
+
+void APNGAnimateView::ReleaseFrameDrawables() {
+    for (auto &drawable : drawables_) {
+        if (drawable) {
+            OH_ArkUI_DrawableDescriptor_Dispose(drawable);
+            drawable = nullptr;
+        }
+    }
+    for (auto &pixelmap : pixelmaps_) {
+        if (pixelmap) {
+            OH_PixelmapNative_Release(pixelmap);
+            pixelmap = nullptr;
+        }
     }
 }
 
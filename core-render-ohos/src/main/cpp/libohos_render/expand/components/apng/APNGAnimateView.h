@@ -16,7 +16,9 @@
 #ifndef CORE_RENDER_OHOS_APNGANIMATEVIEW_H
 #define CORE_RENDER_OHOS_APNGANIMATEVIEW_H
 
+#include <arkui/drawable_descriptor.h>
 #include <arkui/native_type.h>
+#include <multimedia/image_framework/image/pixelmap_native.h>
 #include <array>
 #include <cstdint>
 #include <cstring>
@@ -24,9 +26,9 @@
 #include <stdexcept>
 #include <string>
 #include <vector>
+#include "libohos_render/expand/components/apng/APNGFrameStream.h"
 #include "libohos_render/expand/components/apng/APNGStructs.h"
 #include "libohos_render/foundation/KRRect.h"
-#include "libohos_render/foundation/thread/KRGCDQueue.h"
 #include "libohos_render/utils/KRViewUtil.h"
 /**
  * @class APNGAnimateView
@@ -111,13 +113,18 @@ class APNGAnimateView : public std::enable_shared_from_this<APNGAnimateView> {
     ArkUI_NodeHandle parent_node_ = nullptr;  // 父节点句柄
     ArkUI_NodeHandle image_node_ = nullptr;   // 图片节点句柄
     std::shared_ptr<APNG> apng_ = nullptr;    // APNG 动画对象
+    std::shared_ptr<APNGFrameStream> stream_ = nullptr;  // 按需合成帧
     bool auto_play_ = true;                   // 是否自动播放
     int32_t current_frame_index_ = -1;        // 当前帧索引
     int32_t play_timeout_flag_ = -1;          // 播放超时标志
+    uint64_t fetch_request_id_ = 0;           // 进行中的 FetchAPNG 请求
     uint32_t repeat_count_ = INT32_MAX;       // 循环播放次数，默认无限循环
     uint32_t did_play_loop_count_ = 0;        // 已播放的循环次数
     float speed_rate_ = 1;                    // 播放速率
     KRRect frame_;                            // 视图布局大小
+    // 正在展示与上一次展示的帧（图片节点切换 src 期间上一帧仍可能被引用）
+    std::array<OH_PixelmapNative *, 2> pixelmaps_ = {nullptr, nullptr};
+    std::array<ArkUI_DrawableDescriptor *, 2> drawables_ = {nullptr, nullptr};
 
     std::function<void()> load_failure_callback_ = nullptr;     // 加载失败回调函数
     std::function<void()> animation_start_callback_ = nullptr;  // 动画开始回调函数
@@ -141,9 +148,14 @@ class APNGAnimateView : public std::enable_shared_from_this<APNGAnimateView> {
 
     /**
      * 更新当前帧以进行渲染
-     * @param apngDrawable APNG 可绘制对象
+     * @param index 帧索引
      */
-    void UpdateCurrentFrameToRender(std::shared_ptr<APNGDrawable> apngDrawable);
+    void UpdateCurrentFrameToRender(int index);
+
+    /**
+     * 释放展示过的帧
+     */
+    void ReleaseFrameDrawables();
 };
 
 #endif  // CORE_RENDER_OHOS_APNGANIMATEVIEW_H
@@ -20,6 +20,7 @@
 #include <rawfile/raw_file.h>
 #include <rawfile/raw_file_manager.h>
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
@@ -33,8 +34,10 @@
 #include <vector>
 #include "libohos_render/expand/components/apng/ApngParser.h"
 #include "libohos_render/expand/modules/log/KRLogModule.h"
+#include "libohos_render/foundation/KRAssetCache.h"
+#include "libohos_render/foundation/KRCacheBudgetCoordinator.h"
 #include "libohos_render/foundation/KRRect.h"
-#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/KRViewUtil.h"
 
@@ -56,90 +59,69 @@ bool ReadFileToBuffer(const std::string &filePath, std::vector<uint8_t> &buffer)
     return true;
 }
 
+// APNG 缓存字节预算（只计每帧压缩态数据）
+constexpr size_t kAPNGAssetCacheBytes = 16 * 1024 * 1024;
+
+/**
+ * 进程级 APNG 缓存：在 Utility 全局队列上读取并解析文件，在主线程回调
+ */
+inline KRAssetCache<APNG> &GetAPNGAssetCache() {
+    static auto *cache = new KRAssetCache<APNG>(
+        kAPNGAssetCacheBytes,
+        [](std::function<void()> task) {
+            auto &queue = kuikly::dispatch::KRExecutor::GetInstance().Global(kuikly::dispatch::QoS::Utility);
+            queue.Async(std::move(task));
+        },
+        [](std::function<void()> task) { KRMainThread::RunOnMainThread(std::move(task)); });
+    static auto budget_id = KRCacheBudgetCoordinator::GetInstance().Register(
+        "apng_asset", KRCacheBudgetCoordinator::kPriorityAPNGAsset, [] { return cache->GetStats().bytes; },
+        [](size_t target_bytes) { cache->TrimToBytes(target_bytes); });
+    (void)budget_id;
+    return *cache;
+}
+
 /**
  * 异步获取 APNG（动画便携式网络图形）文件，并在完成时调用完成回调函数。
  *
- * 该函数从给定的文件路径异步获取 APNG 文件。如果已经有针对相同文件路径的获取请求正在进行中，
- * 则不会启动新的获取，而是将完成回调函数添加到完成列表中，以便在获取完成时调用。这避免了对同一文件的不必要获取。
+ * 已缓存的 APNG 直接同步回调；否则在工作线程读取并解析文件，完成后在主线程回调。
+ * 同一文件的并发请求合并为一次读取和解析，所有请求共享结果。
+ * 解析后的 APNG 按压缩数据大小计入缓存字节预算，超出预算时淘汰最久未使用的文件。
  *
- * 获取到的 APNG 还将在内存中缓存 1 分钟，以提高后续获取相同文件的性能。
- * 在开始新的获取之前，会检查缓存，如果在缓存中找到相同文件路径的有效 APNG，则返回缓存的 APNG，而不执行获取。
- *
- * 获取 APNG 后，将在主线程上调用完成回调函数并传递获取到的 APNG。如果 APNG 有效（即，它不为 null，它是
- * APNG，并且至少有一帧）， 则将 APNG 传递给完成回调函数。如果 APNG 无效，则将 null 传递给完成回调函数。
+ * 如果 APNG 有效（即，它不为 null，它是 APNG，并且至少有一帧），则将 APNG 传递给完成回调函数，
+ * 否则将 null 传递给完成回调函数（失败结果不缓存）。
  *
  * @param filePath 要获取的 APNG 文件的路径。
  * @param completion 获取完成时要调用的函数。获取到的 APNG 将传递给此函数。
+ * @return 请求 id，可通过 CancelFetchAPNG 取消；命中缓存时返回 0
  */
-
-void FetchAPNG(const std::string &filePath, std::function<void(std::shared_ptr<APNG>)> completion) {
-    static std::unordered_map<std::string, std::vector<std::function<void(std::shared_ptr<APNG>)>>> pendingRequests;
-    static std::unordered_map<std::string, std::shared_ptr<APNG>> apngCache;
-
-    {
-        auto it = apngCache.find(filePath);
-        if (it != apngCache.end()) {
-            // 使用缓存的APNG
-            completion(it->second);
-            return;
-        }
-    }
-
-    {
-        auto it = pendingRequests.find(filePath);
-        if (it != pendingRequests.end()) {
-            // 如果已经有一个相同的请求正在进行，将回调函数添加到列表中
-            it->second.push_back(completion);
-            return;
-        } else {
-            // 如果没有相同的请求正在进行，创建一个新的回调函数列表
-            pendingRequests[filePath] = {completion};
-        }
-    }
-    auto start = std::chrono::steady_clock::now();
-    KRGCDQueue::GetInstance().DispatchAsync([filePath, start]() {
+inline uint64_t FetchAPNG(const std::string &filePath, std::function<void(std::shared_ptr<APNG>)> completion) {
+    auto loader = [filePath](const std::function<bool()> &cancelled, size_t &cost) -> std::shared_ptr<APNG> {
+        auto start = std::chrono::steady_clock::now();
         std::vector<uint8_t> buffer;
-        bool res = ReadFileToBuffer(filePath, buffer);
+        if (!ReadFileToBuffer(filePath, buffer) || cancelled()) {
+            return nullptr;
+        }
         auto end0 = std::chrono::steady_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end0 - start);
-
-        parseAPNG(buffer, [end0, duration, filePath](std::shared_ptr<APNG> apng) {
-            auto end1 = std::chrono::steady_clock::now();
-            auto duration1 = std::chrono::duration_cast<std::chrono::milliseconds>(end1 - end0);
-            bool isValidApng = apng && apng->isAPNG && apng->frames.size();
-            KR_LOG_INFO << "ReadFileToBuffer cost time:" << (duration).count() << " parse apng c:" << duration1.count();
-            KRMainThread::RunOnMainThread([filePath, apng, isValidApng] {
-                auto it = pendingRequests.find(filePath);
-                if (it != pendingRequests.end()) {
-                    std::vector<std::function<void(std::shared_ptr<APNG>)>> completions = std::move(it->second);
-                    pendingRequests.erase(it);
-
-                    if (isValidApng) {
-                        apngCache[filePath] = apng;
-                        // 设置缓存过期时间为1分钟
-                        KRMainThread::RunOnMainThread(
-                            [filePath, apng] {
-                                KRGCDQueue::GetInstance().DispatchAsync([apng] {
-                                    apng->width;  // sub thread release
-                                });
-                                apngCache.erase(filePath);
-                            },
-                            10 * 60000);
-                    }
+        std::shared_ptr<APNG> result;
+        parseAPNG(buffer, [&result](std::shared_ptr<APNG> apng) { result = apng; });
+        auto end1 = std::chrono::steady_clock::now();
+        KR_LOG_INFO << "ReadFileToBuffer cost time:"
+                    << std::chrono::duration_cast<std::chrono::milliseconds>(end0 - start).count()
+                    << " parse apng c:" << std::chrono::duration_cast<std::chrono::milliseconds>(end1 - end0).count();
+        if (!result || !result->isAPNG || result->frames.empty()) {
+            return nullptr;
+        }
+        cost = sizeof(APNG) + result->CompressedBytes();
+        return result;
+    };
+    return GetAPNGAssetCache().Fetch(filePath, std::move(loader), std::move(completion));
+}
 
-                    for (const auto &completion : completions) {
-                        if (isValidApng) {
-                            // 加载成功
-                            completion(apng);
-                        } else {
-                            // 播放失败
-                            completion(nullptr);
-                        }
-                    }
-                }
-            });
-        });
-    });
+/**
+ * 取消 FetchAPNG 请求，之后不再回调；所有请求方都取消时放弃读取和解析
+ */
+inline void CancelFetchAPNG(uint64_t requestId) {
+    GetAPNGAssetCache().Cancel(requestId);
 }
 
 #endif  // CORE_RENDER_OHOS_APNGCACHE_H
@@ -0,0 +1,340 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/apng/APNGFrameStream.h"
+
+#include <algorithm>
+#include <utility>
+#include "libohos_render/foundation/KRCacheBudgetCoordinator.h"
+#include "libohos_render/utils/KRPixelKernels.h"
+
+namespace {
+
+constexpr size_t kDefaultGlobalBudgetBytes = 32 * 1024 * 1024;
+
+struct FrameRegion {
+    int left = 0;
+    int top = 0;
+    int width = 0;   // 裁剪到画布内的宽度
+    int height = 0;  // 裁剪到画布内的高度
+};
+
+FrameRegion ClipFrame(const Frame &frame, int canvas_width, int canvas_height) {
+    FrameRegion region;
+    region.left = frame.left;
+    region.top = frame.top;
+    if (frame.left < 0 || frame.top < 0 || frame.left >= canvas_width || frame.top >= canvas_height) {
+        return region;
+    }
+    region.width = std::min(frame.width, canvas_width - frame.left);
+    region.height = std::min(frame.height, canvas_height - frame.top);
+    return region;
+}
+
+}  // namespace
+
+APNGFrameBudget &APNGFrameBudget::GetInstance() {
+    static auto *instance = new APNGFrameBudget(kDefaultGlobalBudgetBytes);
+    // 帧缓冲由播放中的流持有，只参与统计
+    static auto budget_id = KRCacheBudgetCoordinator::GetInstance().Register(
+        "apng_frames", KRCacheBudgetCoordinator::kPriorityPinned, [] { return instance->UsedBytes(); }, nullptr);
+    (void)budget_id;
+    return *instance;
+}
+
+bool APNGFrameBudget::TryAcquire(size_t bytes) {
+    auto used = used_bytes_.load(std::memory_order_relaxed);
+    do {
+        if (used + bytes > capacity_bytes_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+    } while (!used_bytes_.compare_exchange_weak(used, used + bytes, std::memory_order_relaxed));
+    return true;
+}
+
+std::shared_ptr<APNGFrameStream> APNGFrameStream::Create(std::shared_ptr<APNG> apng, APNGFrameDecoder decoder,
+                                                         APNGFrameExecutor executor,
+                                                         const APNGFrameStreamOptions &options) {
+    return std::make_shared<APNGFrameStream>(std::move(apng), std::move(decoder), std::move(executor), options);
+}
+
+APNGFrameStream::APNGFrameStream(std::shared_ptr<APNG> apng, APNGFrameDecoder decoder, APNGFrameExecutor executor,
+                                 const APNGFrameStreamOptions &options)
+    : apng_(std::move(apng)),
+      decoder_(std::move(decoder)),
+      executor_(std::move(executor)),
+      options_(options),
+      global_budget_(options.global_budget ? options.global_budget : &APNGFrameBudget::GetInstance()) {
+    if (!apng_ || apng_->width <= 0 || apng_->height <= 0) {
+        return;
+    }
+    width_ = apng_->width;
+    height_ = apng_->height;
+    canvas_bytes_ = static_cast<size_t>(width_) * height_ * 4;
+    // 从第一个与画布等大的帧开始播放，跳过空帧（如首个 fcTL 之前的默认图）
+    bool started = false;
+    for (int i = 0; i < static_cast<int>(apng_->frames.size()); i++) {
+        const auto &frame = apng_->frames[i];
+        if (frame->width == 0 || frame->height == 0) {
+            continue;
+        }
+        if (!started) {
+            if (frame->width != width_ || frame->height != height_) {
+                continue;
+            }
+            started = true;
+        }
+        playable_.push_back(i);
+        has_dispose_previous_ = has_dispose_previous_ || frame->disposeOp == 2;
+    }
+}
+
+APNGFrameStream::~APNGFrameStream() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ReleaseBuffersLocked();
+}
+
+int APNGFrameStream::NextFrameDelay(int index) const {
+    if (index < 0 || index >= FrameCount()) {
+        return 0;
+    }
+    const auto &frames = apng_->frames;
+    size_t next = playable_[index] + 1;
+    return next < frames.size() ? frames[next]->delay : frames.back()->delay;
+}
+
+bool APNGFrameStream::IsLast(int index) const {
+    if (index < 0 || index >= FrameCount()) {
+        return false;
+    }
+    return static_cast<size_t>(playable_[index]) + 1 >= apng_->frames.size();
+}
+
+bool APNGFrameStream::ReadFrame(int index, const std::function<void(const uint8_t *pixels, size_t size)> &reader) {
+    if (index < 0 || index >= FrameCount()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!EnsureBuffersLocked()) {
+        return false;
+    }
+    Slot *slot = FindSlotLocked(index);
+    if (slot) {
+        stats_.prefetch_hit++;
+    } else {
+        stats_.sync_composite++;
+        slot = AcquireSlotLocked(index);
+        SeekLocked(index);
+        CompositeNextLocked(slot);
+    }
+    if (reader) {
+        reader(slot->pixels.data(), slot->pixels.size());
+    }
+    return true;
+}
+
+void APNGFrameStream::Prefetch(int index) {
+    if (!executor_ || FrameCount() == 0) {
+        return;
+    }
+    uint32_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!buffers_ready_ || slots_.size() <= 1) {
+            return;
+        }
+        generation = generation_;
+    }
+    std::weak_ptr<APNGFrameStream> weak_self = shared_from_this();
+    executor_([weak_self, index, generation] {
+        if (auto self = weak_self.lock()) {
+            self->PrefetchNow(index, generation);
+        }
+    });
+}
+
+void APNGFrameStream::PrefetchNow(int index, uint32_t generation) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (generation != generation_ || !buffers_ready_) {
+        return;
+    }
+    int count = std::min<int>(options_.prefetch_count, static_cast<int>(slots_.size()) - 1);
+    for (int k = 0; k < count; k++) {
+        int i = (index + k) % FrameCount();
+        if (FindSlotLocked(i)) {
+            continue;
+        }
+        if (i < next_index_ && i != 0) {
+            // 预取只顺序向前（或循环回到开头），不为此从头重新合成
+            break;
+        }
+        Slot *slot = AcquireSlotLocked(index);
+        SeekLocked(i);
+        CompositeNextLocked(slot);
+    }
+}
+
+void APNGFrameStream::Trim() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ReleaseBuffersLocked();
+}
+
+APNGFrameStream::Stats APNGFrameStream::GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.allocated_bytes = forced_bytes_ + budgeted_bytes_;
+    stats_.output_slots = static_cast<int>(slots_.size());
+    return stats_;
+}
+
+bool APNGFrameStream::EnsureBuffersLocked() {
+    if (buffers_ready_) {
+        return true;
+    }
+    if (canvas_bytes_ == 0 || playable_.empty()) {
+        return false;
+    }
+    size_t max_frame_bytes = 0;
+    for (int index : playable_) {
+        const auto &frame = apng_->frames[index];
+        max_frame_bytes = std::max(max_frame_bytes, static_cast<size_t>(frame->width) * frame->height * 4);
+    }
+    // 必需：画布 + 单帧解码缓冲 + 一个输出帧（+ dispose previous 备份）
+    size_t required = canvas_bytes_ * (has_dispose_previous_ ? 3 : 2) + max_frame_bytes;
+    int prefetch_slots = 0;
+    if (options_.budget_bytes > required) {
+        prefetch_slots = std::min<size_t>(options_.prefetch_count, (options_.budget_bytes - required) / canvas_bytes_);
+    }
+    global_budget_->ForceAcquire(required);
+    while (prefetch_slots > 0 && !global_budget_->TryAcquire(canvas_bytes_ * prefetch_slots)) {
+        prefetch_slots--;
+    }
+    forced_bytes_ = required;
+    budgeted_bytes_ = canvas_bytes_ * prefetch_slots;
+
+    canvas_.assign(canvas_bytes_, 0);
+    if (has_dispose_previous_) {
+        backup_.assign(canvas_bytes_, 0);
+    }
+    decode_buffer_.reserve(max_frame_bytes);
+    slots_.resize(1 + prefetch_slots);
+    for (auto &slot : slots_) {
+        slot.pixels.assign(canvas_bytes_, 0);
+        slot.index = -1;
+    }
+    next_index_ = 0;
+    buffers_ready_ = true;
+    return true;
+}
+
+void APNGFrameStream::ReleaseBuffersLocked() {
+    generation_++;
+    if (!buffers_ready_) {
+        return;
+    }
+    std::vector<uint8_t>().swap(canvas_);
+    std::vector<uint8_t>().swap(backup_);
+    std::vector<uint8_t>().swap(decode_buffer_);
+    std::vector<Slot>().swap(slots_);
+    global_budget_->Release(forced_bytes_ + budgeted_bytes_);
+    forced_bytes_ = 0;
+    budgeted_bytes_ = 0;
+    next_index_ = 0;
+    buffers_ready_ = false;
+}
+
+APNGFrameStream::Slot *APNGFrameStream::FindSlotLocked(int index) {
+    for (auto &slot : slots_) {
+        if (slot.index == index) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+APNGFrameStream::Slot *APNGFrameStream::AcquireSlotLocked(int window_start) {
+    // 播放窗口 [window_start, window_start + 预取数] 之外的输出帧已展示过，可直接复用
+    int count = FrameCount();
+    int window = std::max(1, options_.prefetch_count);
+    Slot *farthest = nullptr;
+    int farthest_distance = -1;
+    for (auto &slot : slots_) {
+        if (slot.index < 0) {
+            return &slot;
+        }
+        int distance = (slot.index - window_start + count) % count;
+        if (distance >= window) {
+            slot.index = -1;
+            return &slot;
+        }
+        if (distance > farthest_distance) {
+            farthest_distance = distance;
+            farthest = &slot;
+        }
+    }
+    farthest->index = -1;
+    return farthest;
+}
+
+void APNGFrameStream::SeekLocked(int index) {
+    if (index < next_index_) {
+        next_index_ = 0;
+        stats_.rewind_count += index > 0 ? 1 : 0;
+    }
+    while (next_index_ < index) {
+        CompositeNextLocked(nullptr);
+    }
+}
+
+void APNGFrameStream::CompositeNextLocked(Slot *output) {
+    int index = next_index_;
+    const Frame &frame = *apng_->frames[playable_[index]];
+    if (index == 0) {
+        std::fill(canvas_.begin(), canvas_.end(), 0);
+    }
+    size_t frame_bytes = static_cast<size_t>(frame.width) * frame.height * 4;
+    decode_buffer_.resize(frame_bytes);
+    bool decoded = decoder_ && decoder_(frame.data, frame.width, frame.height, decode_buffer_) &&
+                   decode_buffer_.size() >= frame_bytes;
+    stats_.decode_count++;
+
+    if (frame.disposeOp == 2) {
+        std::copy(canvas_.begin(), canvas_.end(), backup_.begin());
+    }
+    auto region = ClipFrame(frame, width_, height_);
+    if (decoded) {
+        // 首帧直接作为画布内容，之后的帧按 blend_op 合成
+        int blend_op = index == 0 ? 0 : frame.blendOp;
+        for (int y = 0; y < region.height; ++y) {
+            uint8_t *dst = canvas_.data() + (static_cast<size_t>(y + region.top) * width_ + region.left) * 4;
+            const uint8_t *src = decode_buffer_.data() + static_cast<size_t>(y) * frame.width * 4;
+            if (blend_op == 0) {
+                KRPixelKernels::CopyPixels(dst, src, region.width);
+            } else if (blend_op == 1) {
+                KRPixelKernels::BlendOver(dst, src, region.width);
+            }
+        }
+    }
+    if (output) {
+        std::copy(canvas_.begin(), canvas_.end(), output->pixels.begin());
+        output->index = index;
+    }
+    if (frame.disposeOp == 1 && region.width > 0) {
+        uint8_t *dst = canvas_.data() + (static_cast<size_t>(region.top) * width_ + region.left) * 4;
+        KRPixelKernels::ClearRect(dst, static_cast<size_t>(width_) * 4, region.width, region.height);
+    } else if (frame.disposeOp == 2) {
+        std::swap(canvas_, backup_);
+    }
+    next_index_ = index + 1;
+}
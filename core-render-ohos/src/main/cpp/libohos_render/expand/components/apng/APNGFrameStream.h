@@ -0,0 +1,205 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_APNGFRAMESTREAM_H
+#define CORE_RENDER_OHOS_APNGFRAMESTREAM_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "libohos_render/expand/components/apng/APNGStructs.h"
+
+/**
+ * APNG 解码像素的全局字节预算（所有播放中的动画共享）
+ * 每个动画必需的缓冲（合成画布 + 一个输出帧）总能申请成功，预取帧只有在预算充足时才分配。
+ */
+class APNGFrameBudget {
+ public:
+    static APNGFrameBudget &GetInstance();
+
+    explicit APNGFrameBudget(size_t capacity_bytes) : capacity_bytes_(capacity_bytes) {}
+
+    APNGFrameBudget(const APNGFrameBudget &) = delete;
+    APNGFrameBudget &operator=(const APNGFrameBudget &) = delete;
+
+    /**
+     * 预算内申请，超出预算时失败
+     */
+    bool TryAcquire(size_t bytes);
+
+    /**
+     * 必需的缓冲，不受预算限制
+     */
+    void ForceAcquire(size_t bytes) {
+        used_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void Release(size_t bytes) {
+        used_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    size_t UsedBytes() const {
+        return used_bytes_.load(std::memory_order_relaxed);
+    }
+
+    size_t CapacityBytes() const {
+        return capacity_bytes_.load(std::memory_order_relaxed);
+    }
+
+    void SetCapacityBytes(size_t capacity_bytes) {
+        capacity_bytes_.store(capacity_bytes, std::memory_order_relaxed);
+    }
+
+ private:
+    std::atomic<size_t> capacity_bytes_;
+    std::atomic<size_t> used_bytes_{0};
+};
+
+/**
+ * 将单帧 PNG 数据解码为 RGBA_8888 像素（width * height * 4），失败返回false
+ */
+using APNGFrameDecoder =
+    std::function<bool(const std::vector<uint8_t> &png, int width, int height, std::vector<uint8_t> &rgba)>;
+
+/**
+ * 在工作线程执行任务（用于预取）
+ */
+using APNGFrameExecutor = std::function<void(std::function<void()>)>;
+
+struct APNGFrameStreamOptions {
+    size_t budget_bytes = 8 * 1024 * 1024;   // 单个动画的像素预算
+    int prefetch_count = 2;                  // 最多预取的帧数
+    APNGFrameBudget *global_budget = nullptr;  // 为空时使用 APNGFrameBudget::GetInstance()
+};
+
+/**
+ * APNG 流式帧合成器（每个播放视图一个）
+ *
+ * 1. 只引用 APNG 中压缩态的帧数据，按播放顺序逐帧解码并合成到画布上；
+ * 2. 像素缓冲固定为：合成画布、dispose_op 为 previous 时的画布备份、单帧解码缓冲，以及一个小的输出帧环
+ *    （当前帧 + 预取帧），全部复用，内存与帧数无关；
+ * 3. 输出帧环大小受单动画预算与全局预算约束，预算不足时不预取，只在读取时同步合成；
+ * 4. ReadFrame 与预取任务通过内部锁串行化，可在任意线程调用；Trim 释放全部像素缓冲，再次读取时重新分配。
+ *
+ * 合成规则与原先一次性全量解码保持一致：从第一个与画布等大的帧开始播放，该帧直接作为画布内容，
+ * 之后的帧按 blend_op 合成，按 dispose_op 处置。
+ */
+class APNGFrameStream : public std::enable_shared_from_this<APNGFrameStream> {
+ public:
+    struct Stats {
+        uint64_t decode_count = 0;     // 解码帧数
+        uint64_t prefetch_hit = 0;     // 读取时已由预取合成好的帧数
+        uint64_t sync_composite = 0;   // 读取时同步合成的帧数
+        uint64_t rewind_count = 0;     // 非顺序读取导致从头合成的次数
+        size_t allocated_bytes = 0;    // 当前持有的像素字节数
+        int output_slots = 0;          // 输出帧环大小
+    };
+
+    static std::shared_ptr<APNGFrameStream> Create(std::shared_ptr<APNG> apng, APNGFrameDecoder decoder,
+                                                   APNGFrameExecutor executor,
+                                                   const APNGFrameStreamOptions &options = APNGFrameStreamOptions());
+
+    APNGFrameStream(std::shared_ptr<APNG> apng, APNGFrameDecoder decoder, APNGFrameExecutor executor,
+                    const APNGFrameStreamOptions &options);
+    ~APNGFrameStream();
+
+    APNGFrameStream(const APNGFrameStream &) = delete;
+    APNGFrameStream &operator=(const APNGFrameStream &) = delete;
+
+    int Width() const {
+        return width_;
+    }
+
+    int Height() const {
+        return height_;
+    }
+
+    /**
+     * 可播放帧数
+     */
+    int FrameCount() const {
+        return static_cast<int>(playable_.size());
+    }
+
+    /**
+     * 第 index 帧展示后到下一帧的间隔（ms）
+     */
+    int NextFrameDelay(int index) const;
+
+    /**
+     * 第 index 帧是否为动画最后一帧
+     */
+    bool IsLast(int index) const;
+
+    /**
+     * 读取第 index 帧的合成结果，reader 在内部锁内同步调用，pixels 为 Width() * Height() * 4 字节的 RGBA
+     * @return index 越界时返回false
+     */
+    bool ReadFrame(int index, const std::function<void(const uint8_t *pixels, size_t size)> &reader);
+
+    /**
+     * 在工作线程预取从 index 开始的若干帧
+     */
+    void Prefetch(int index);
+
+    /**
+     * 释放全部像素缓冲（停止播放时调用）
+     */
+    void Trim();
+
+    Stats GetStats();
+
+ private:
+    struct Slot {
+        std::vector<uint8_t> pixels;
+        int index = -1;
+    };
+
+    bool EnsureBuffersLocked();
+    void ReleaseBuffersLocked();
+    Slot *FindSlotLocked(int index);
+    Slot *AcquireSlotLocked(int window_start);
+    void SeekLocked(int index);
+    void CompositeNextLocked(Slot *output);
+    void PrefetchNow(int index, uint32_t generation);
+
+    std::shared_ptr<APNG> apng_;
+    APNGFrameDecoder decoder_;
+    APNGFrameExecutor executor_;
+    APNGFrameStreamOptions options_;
+    APNGFrameBudget *global_budget_;
+    int width_ = 0;
+    int height_ = 0;
+    size_t canvas_bytes_ = 0;
+    bool has_dispose_previous_ = false;
+    std::vector<int> playable_;  // 可播放帧在 apng_->frames 中的下标
+
+    std::mutex mutex_;
+    uint32_t generation_ = 0;  // Trim 后递增，使排队中的预取失效
+    bool buffers_ready_ = false;
+    size_t forced_bytes_ = 0;      // 向全局预算强制申请的字节数
+    size_t budgeted_bytes_ = 0;    // 向全局预算按预算申请的字节数
+    std::vector<uint8_t> canvas_;  // 已合成到 next_index_ - 1 帧并完成其 dispose 的画布
+    std::vector<uint8_t> backup_;  // dispose_op 为 previous 时合成前的画布
+    std::vector<uint8_t> decode_buffer_;
+    std::vector<Slot> slots_;
+    int next_index_ = 0;  // 画布上下一帧的下标
+    Stats stats_;
+};
+
+#endif  // CORE_RENDER_OHOS_APNGFRAMESTREAM_H
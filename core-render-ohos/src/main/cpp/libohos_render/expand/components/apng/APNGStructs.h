@@ -16,26 +16,10 @@
 #ifndef CORE_RENDER_OHOS_APNGSTRUCTS_H
 #define CORE_RENDER_OHOS_APNGSTRUCTS_H
 
-#include <arkui/drawable_descriptor.h>
-#include <hilog/log.h>
-#include <linux/kd.h>
-#include <multimedia/image_framework/image/image_common.h>
-#include <multimedia/image_framework/image/image_packer_native.h>
-#include <multimedia/image_framework/image/image_receiver_native.h>
-#include <multimedia/image_framework/image/image_source_native.h>
-#include <multimedia/image_framework/image/pixelmap_native.h>
-#include <multimedia/image_framework/image_pixel_map_mdk.h>
-#include <native_drawing/drawing_canvas.h>
-#include <array>
 #include <cstdint>
-#include <cstring>
-#include <execution>  // For std::execution::par
-#include <iostream>
-#include <stdexcept>
+#include <memory>
 #include <string>
 #include <vector>
-#include "libohos_render/expand/components/apng/APNGUtil.h"
-#include "libohos_render/utils/KRRenderLoger.h"
 
 class Frame {
  public:
@@ -47,20 +31,16 @@ class Frame {
     int disposeOp = 0;
     int blendOp = 0;
     std::vector<std::vector<uint8_t>> dataParts;
-    std::vector<uint8_t> data;
+    std::vector<uint8_t> data;  // 该帧独立的 PNG 数据（压缩态），播放时按需解码
     std::string base64Image;
 
     void SetImageBuffer(std::vector<std::vector<uint8_t>> &image_buffer);
 };
 
-class APNGDrawable {
- public:
-    int nextFrameDelay = 0;  // 如果为-1, 则没有下一个drawable
-    bool isLast = false;
-    OH_PixelmapNative *pixelmap = nullptr;
-    ArkUI_DrawableDescriptor *drawable = nullptr;
-};
-
+/**
+ * 解析后的 APNG：只保存每帧压缩态的 PNG 数据与帧控制信息，不持有解码后的像素，
+ * 可在多个播放视图间共享（只读）。像素由每个播放视图各自的 APNGFrameStream 按需合成。
+ */
 class APNG {
  public:
     bool isAPNG = true;
@@ -69,38 +49,17 @@ class APNG {
     int numPlays = 0;
     int playTime = 0;
     std::vector<std::shared_ptr<Frame>> frames;
-    std::vector<std::shared_ptr<APNGDrawable>> animateDrawables;  // 播放帧
-    ~APNG();
-
-    void WillParseFrame() {
-        isParsing.store(true);
-    }
-    bool DidAddFrame(std::shared_ptr<Frame> frame, int index);
-    void DidEndParserFrame() {
-        isParsing.store(false);
-        lazyBeforeNextFrameTask = nullptr;
-    }
 
-    bool IsParsing() {
-        return isParsing.load();
+    /**
+     * 所有帧压缩数据的总字节数
+     */
+    size_t CompressedBytes() const {
+        size_t bytes = 0;
+        for (const auto &frame : frames) {
+            bytes += frame->data.size();
+        }
+        return bytes;
     }
-
-    std::shared_ptr<APNGDrawable> GetDrawable(int index);
-
- private:
-    std::atomic_bool isParsing = true;
-    std::function<void()> lazyBeforeNextFrameTask = nullptr;
-    std::vector<uint8_t> curBitmapBuffer;
-    std::vector<uint8_t> previousBuffer;
-    std::mutex drawableMutex;
-
-    bool hasFirstFullFrame = false;
-
-    void HandleFrameBlendOp(std::shared_ptr<Frame> frame, int index);
-
-    void HandlePostFrameDisposeOp(std::shared_ptr<Frame> frame);
-    //
-    void AddDrawable(std::shared_ptr<APNGDrawable> drawable, int curFrameIndex);
 };
 
 enum APNGEvent { LOAD_FAILURE, ANIMATION_START, ANIMATION_END };
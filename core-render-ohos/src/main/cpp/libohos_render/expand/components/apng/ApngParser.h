@@ -16,14 +16,18 @@
 #ifndef CORE_RENDER_OHOS_APNGPARSER_H
 #define CORE_RENDER_OHOS_APNGPARSER_H
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
 #include "libohos_render/expand/components/apng/APNGStructs.h"
+#include "libohos_render/utils/KRPixelKernels.h"
 
 class DataView {
  public:
@@ -79,32 +83,11 @@ class DataView {
     std::vector<uint8_t> &buffer_;
 };
 
-static std::array<uint32_t, 256> generateTable() {
-    std::array<uint32_t, 256> table;
-
-    for (uint32_t i = 0; i < 256; ++i) {
-        uint32_t c = i;
-        for (uint32_t k = 0; k < 8; ++k) {
-            c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
-        }
-        table[i] = c;
-    }
-
-    return table;
-}
-
 static uint32_t crc32(const std::vector<uint8_t> &bytes, size_t start = 0, size_t length = std::string::npos) {
-    static const auto table = generateTable();
-
     if (length == std::string::npos) {
         length = bytes.size() - start;
     }
-
-    uint32_t crc = ~0u;
-    for (size_t i = start, l = start + length; i < l; i++) {
-        crc = (crc >> 8) ^ table[(crc ^ bytes[i]) & 0xFF];
-    }
-    return ~crc;
+    return KRPixelKernels::Crc32(bytes.data() + start, length);
 }
 
 static std::string readString(const std::vector<uint8_t> &bytes, size_t off, size_t length) {
@@ -248,9 +231,7 @@ static void parseAPNG(std::vector<uint8_t> &buffer, std::function<void(std::shar
         completion(apng);
         return;
     }
-    apng->WillParseFrame();
-    int index = 0;
-    bool didAddFrameSuccess = false;
+    // 每帧只拼装为独立的 PNG 数据（压缩态），像素在播放时由 APNGFrameStream 按需解码合成
     for (auto frame : apng->frames) {
         std::vector<std::vector<uint8_t>> bb;
         // 预先分配内存
@@ -270,22 +251,9 @@ static void parseAPNG(std::vector<uint8_t> &buffer, std::function<void(std::shar
         }
         bb.insert(bb.end(), postDataParts.begin(), postDataParts.end());
         frame->SetImageBuffer(bb);
-        if (apng->DidAddFrame(frame, index) && !didAddFrameSuccess) {
-            didAddFrameSuccess = true;
-            completion(apng);
-        }
         frame->dataParts.clear();
-        bb.clear();
-        index++;
-    }
-    apng->DidEndParserFrame();
-
-    if (apng->frames.empty()) {
-        apng->isAPNG = false;
-    }
-    if (!didAddFrameSuccess) {
-        completion(apng);
     }
+    completion(apng);
 }
 
 #endif  // CORE_RENDER_OHOS_APNGPARSER_H
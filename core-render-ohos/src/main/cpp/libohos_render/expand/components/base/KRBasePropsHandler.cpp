@@ -66,209 +66,253 @@ bool KRBasePropsHandler::SetPropWithoutAnimation(const std::string &prop_key, co
     if (node_ == nullptr) {
         return false;
     }
-    if (strcmp(prop_key.c_str(), kBackgroundColor) == 0) {  // 背景色
-        kuikly::util::UpdateNodeBackgroundColor(node_, kuikly::util::ConvertToHexColor(prop_value->toString()));
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kBorderRadius) == 0) {  // 圆角
-        auto borderRadiuses = kuikly::util::ConverToBorderRadiuses(prop_value->toString());
-        kuikly::util::UpdateNodeBorderRadius(node_, borderRadiuses);
-        force_overflow_ = !borderRadiuses.isAllZero(); // 圆角不为0，需要强制clip 子孩子，避免超出自身边界
-        if (!has_clip_path_) {
-            kuikly::util::UpdateNodeOverflow(node_, css_overflow_ || force_overflow_);
-        }
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kBorder) == 0) {  // 边框样式
-        kuikly::util::UpdateNodeBorder(node_, prop_value->toString());
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kFrame) == 0) {
-        if (prop_value->isString()) {
-            KRRect frame;
-            const std::string &s = prop_value->toString();
-            memcpy(&frame, s.data(), s.size());
-            ResetTransformIfNeed();
-            kuikly::util::UpdateNodeFrame(node_, frame);
-            frame_ = frame;
-            if (css_transform_.length()) {
-                UpdateTransform(css_transform_);
-            }
-            return true;
-        }
-    }
-    if (strcmp(prop_key.c_str(), kBackgroundImage) == 0) {  // 背景渐变
-        kuikly::util::UpdateNodeBackgroundImage(node_, prop_value->toString());
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kTransform) == 0) {  // transform(旋转，位移，缩放，倾斜) （+anchor）
-        css_transform_ = prop_value->toString();
-        UpdateTransform(css_transform_);
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kOpacity) == 0) {  // 透明度
-        kuikly::util::UpdateNodeOpacity(node_, prop_value->toDouble());
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kVisibility) == 0) {  // Visibility
-        kuikly::util::UpdateNodeVisibility(node_, prop_value->toInt());
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kOverflow) == 0) {  // 裁剪
-        css_overflow_ = prop_value->toInt();
-        if (!has_clip_path_) {
-            kuikly::util::UpdateNodeOverflow(node_, css_overflow_ || force_overflow_);
-        }
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kZIndex) == 0) {  // z-index
-        z_index_ = prop_value->toInt();
-        kuikly::util::UpdateNodeZIndex(node_, z_index_);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kTouchEnable) == 0) {  // 禁用手势
-        kuikly::util::UpdateNodeHitTest(node_, prop_value->toBool());
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kAccessibility) == 0) {  // 无障碍化
-        kuikly::util::UpdateNodeAccessibility(node_, prop_value->toString());
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kBoxShadow) == 0) {  // 阴影
-        kuikly::util::UpdateNodeBoxShadow(node_, prop_value->toString());
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), KAnimation) == 0) {
-        auto animationStr = prop_value->toString();
-        kuikly::util::SetNodeAnimation(weakView_, &animationStr);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kAnimationCompletion) == 0) {
-        animation_completion_callback_ = event_call_back;
-        return true;
-    }
-    
-    if (strcmp(prop_key.c_str(), kClipPath) == 0) {
-        auto pathCommand = kuikly::util::ConvertToPathCommand(prop_value->toString());
-        has_clip_path_ = !pathCommand.empty();
-        kuikly::util::UpdateNodeClipPath(node_, frame_.width, frame_.height, pathCommand);
-        if (!has_clip_path_ && (force_overflow_ || css_overflow_)) {
-            kuikly::util::UpdateNodeOverflow(node_, 1);
-        }
-        return true;
-    }
-
-    return false;
+    auto setter = PropSetters().Find(prop_key);
+    return setter != nullptr && setter(*this, prop_value, event_call_back);
 }
 
 bool KRBasePropsHandler::ResetProp(const std::string &prop_key) {
+    return ResetProp(KRPropKeyTable::GetInstance().Find(prop_key));
+}
+
+bool KRBasePropsHandler::ResetProp(KRPropKeyId prop_id) {
     if (node_ == nullptr) {
         return false;
     }
-    force_overflow_ = false;
-    if (strcmp(prop_key.c_str(), kBackgroundColor) == 0) {
-        kuikly::util::UpdateNodeBackgroundColor(node_, 0x00000000);  // 透明
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BACKGROUND_COLOR);
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kBorderRadius) == 0) {  // 圆角
-        kuikly::util::UpdateNodeBorderRadius(node_, KRBorderRadiuses());
-        kuikly::util::UpdateNodeOverflow(node_, 0);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CLIP);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_RADIUS);
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kBorder) == 0) {
-        kuikly::util::UpdateNodeBorder(node_, "0 solid 0");
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_WIDTH);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_COLOR);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_BORDER_STYLE);
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kFrame) == 0) {
-        KRRect frame;
-        kuikly::util::UpdateNodeFrame(node_, frame);
-        frame_ = frame;
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kBackgroundImage) == 0) {
-        kuikly::util::UpdateNodeBackgroundImage(node_, "8,0 0,0 1");  // 重置为不渐变，且透明
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_LINEAR_GRADIENT);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kTransform) == 0) {
-        ResetTransformIfNeed();
-        css_transform_ = "";
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_TRANSFORM_CENTER);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_TRANSFORM);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ROTATE);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kOpacity) == 0) {
-        kuikly::util::UpdateNodeOpacity(node_, 1);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_OPACITY);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kVisibility) == 0) {  // 透明度
-        kuikly::util::UpdateNodeVisibility(node_, 1);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_VISIBILITY);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kOverflow) == 0) {  // 裁剪子孩子
-        kuikly::util::UpdateNodeOverflow(node_, 0);
-        css_overflow_ = 0;
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CLIP);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kZIndex) == 0) {  // z-index
-        z_index_ = 0;
-        kuikly::util::UpdateNodeZIndex(node_, 0);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_Z_INDEX);
-        return true;
-    }
-
-    if (strcmp(prop_key.c_str(), kTouchEnable) == 0) {  // 禁用手势
-        kuikly::util::UpdateNodeHitTest(node_, true);
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ENABLED);
-        return true;
-    }
-    if (strcmp(prop_key.c_str(), kAccessibility) == 0) {  // 无障碍化
-        kuikly::util::UpdateNodeAccessibility(node_, "");
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_ACCESSIBILITY_TEXT);
-        return true;
-    }
+    auto resetter = PropResetters().Find(prop_id);
+    return resetter != nullptr && resetter(*this);
+}
 
-    if (strcmp(prop_key.c_str(), kBoxShadow) == 0) {  // 阴影
-        kuikly::util::UpdateNodeBoxShadow(node_, "0 0 0 0 1");
-        kuikly::util::GetNodeApi()->resetAttribute(node_, NODE_CUSTOM_SHADOW);
-    }
+bool KRBasePropsHandler::IsSelfContainedReset(KRPropKeyId prop_id) {
+    static const KRPropKeySet gSelfContained = [] {
+        KRPropKeySet set;
+        for (auto key : {kBackgroundColor, kFrame, kBorder, kBackgroundImage, kOpacity, kVisibility, kZIndex,
+                         kTouchEnable, kAccessibility}) {
+            set.Insert(KRPropKeyTable::GetInstance().Intern(key));
+        }
+        return set;
+    }();
+    return gSelfContained.Contains(prop_id);
+}
 
-    if (strcmp(prop_key.c_str(), KAnimation) == 0) {
-        kuikly::util::SetNodeAnimation(weakView_, nullptr);
-        return true;
-    }
-    
-    if (strcmp(prop_key.c_str(), kClipPath) == 0) {
-        has_clip_path_ = false;
-        kuikly::util::UpdateNodeClipPath(node_, 0, 0, "");
-        return true;
-    }
+const KRPropKeyJumpTable<KRBasePropsHandler::PropSetter> &KRBasePropsHandler::PropSetters() {
+    static const KRPropKeyJumpTable<PropSetter> gSetters({
+        {kBackgroundColor,  // 背景色
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             kuikly::util::UpdateNodeBackgroundColor(self.node_,
+                                                     kuikly::util::ConvertToHexColor(prop_value->toString()));
+             return true;
+         }},
+        {kBorderRadius,  // 圆角
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             auto borderRadiuses = kuikly::util::ConverToBorderRadiuses(prop_value->toString());
+             kuikly::util::UpdateNodeBorderRadius(self.node_, borderRadiuses);
+             // 圆角不为0，需要强制clip 子孩子，避免超出自身边界
+             self.force_overflow_ = !borderRadiuses.isAllZero();
+             if (!self.has_clip_path_) {
+                 kuikly::util::UpdateNodeOverflow(self.node_, self.css_overflow_ || self.force_overflow_);
+             }
+             return true;
+         }},
+        {kBorder,  // 边框样式
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             kuikly::util::UpdateNodeBorder(self.node_, prop_value->toString());
+             return true;
+         }},
+        {kFrame,
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             if (!prop_value->isString()) {
+                 return false;
+             }
+             KRRect frame;
+             const std::string &s = prop_value->toString();
+             memcpy(&frame, s.data(), s.size());
+             self.ResetTransformIfNeed();
+             kuikly::util::UpdateNodeFrame(self.node_, frame);
+             self.frame_ = frame;
+             if (self.css_transform_.length()) {
+                 self.UpdateTransform(self.css_transform_);
+             }
+             return true;
+         }},
+        {kBackgroundImage,  // 背景渐变
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             kuikly::util::UpdateNodeBackgroundImage(self.node_, prop_value->toString());
+             return true;
+         }},
+        {kTransform,  // transform(旋转，位移，缩放，倾斜) （+anchor）
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             self.css_transform_ = prop_value->toString();
+             self.UpdateTransform(self.css_transform_);
+             return true;
+         }},
+        {kOpacity,  // 透明度
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             kuikly::util::UpdateNodeOpacity(self.node_, prop_value->toDouble());
+             return true;
+         }},
+        {kVisibility,  // Visibility
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             kuikly::util::UpdateNodeVisibility(self.node_, prop_value->toInt());
+             return true;
+         }},
+        {kOverflow,  // 裁剪
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             self.css_overflow_ = prop_value->toInt();
+             if (!self.has_clip_path_) {
+                 kuikly::util::UpdateNodeOverflow(self.node_, self.css_overflow_ || self.force_overflow_);
+             }
+             return true;
+         }},
+        {kZIndex,  // z-index
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             self.z_index_ = prop_value->toInt();
+             kuikly::util::UpdateNodeZIndex(self.node_, self.z_index_);
+             return true;
+         }},
+        {kTouchEnable,  // 禁用手势
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             kuikly::util::UpdateNodeHitTest(self.node_, prop_value->toBool());
+             return true;
+         }},
+        {kAccessibility,  // 无障碍化
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             kuikly::util::UpdateNodeAccessibility(self.node_, prop_value->toString());
+             return true;
+         }},
+        {kBoxShadow,  // 阴影
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             kuikly::util::UpdateNodeBoxShadow(self.node_, prop_value->toString());
+             return true;
+         }},
+        {KAnimation,
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             auto animationStr = prop_value->toString();
+             kuikly::util::SetNodeAnimation(self.weakView_, &animationStr);
+             return true;
+         }},
+        {kAnimationCompletion,
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             self.animation_completion_callback_ = event_call_back;
+             return true;
+         }},
+        {kClipPath,
+         [](KRBasePropsHandler &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             auto pathCommand = kuikly::util::ConvertToPathCommand(prop_value->toString());
+             self.has_clip_path_ = !pathCommand.empty();
+             kuikly::util::UpdateNodeClipPath(self.node_, self.frame_.width, self.frame_.height, pathCommand);
+             if (!self.has_clip_path_ && (self.force_overflow_ || self.css_overflow_)) {
+                 kuikly::util::UpdateNodeOverflow(self.node_, 1);
+             }
+             return true;
+         }},
+    });
+    return gSetters;
+}
 
-    return false;
+const KRPropKeyJumpTable<KRBasePropsHandler::PropResetter> &KRBasePropsHandler::PropResetters() {
+    static const KRPropKeyJumpTable<PropResetter> gResetters({
+        {kBackgroundColor,
+         [](KRBasePropsHandler &self) {
+             kuikly::util::UpdateNodeBackgroundColor(self.node_, 0x00000000);  // 透明
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_BACKGROUND_COLOR);
+             return true;
+         }},
+        {kBorderRadius,  // 圆角
+         [](KRBasePropsHandler &self) {
+             self.force_overflow_ = false;
+             kuikly::util::UpdateNodeBorderRadius(self.node_, KRBorderRadiuses());
+             kuikly::util::UpdateNodeOverflow(self.node_, 0);
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_CLIP);
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_BORDER_RADIUS);
+             return true;
+         }},
+        {kBorder,
+         [](KRBasePropsHandler &self) {
+             kuikly::util::UpdateNodeBorder(self.node_, "0 solid 0");
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_BORDER_WIDTH);
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_BORDER_COLOR);
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_BORDER_STYLE);
+             return true;
+         }},
+        {kFrame,
+         [](KRBasePropsHandler &self) {
+             KRRect frame;
+             kuikly::util::UpdateNodeFrame(self.node_, frame);
+             self.frame_ = frame;
+             return true;
+         }},
+        {kBackgroundImage,
+         [](KRBasePropsHandler &self) {
+             kuikly::util::UpdateNodeBackgroundImage(self.node_, "8,0 0,0 1");  // 重置为不渐变，且透明
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_LINEAR_GRADIENT);
+             return true;
+         }},
+        {kTransform,
+         [](KRBasePropsHandler &self) {
+             self.ResetTransformIfNeed();
+             self.css_transform_ = "";
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_TRANSFORM_CENTER);
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_TRANSFORM);
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_ROTATE);
+             return true;
+         }},
+        {kOpacity,
+         [](KRBasePropsHandler &self) {
+             kuikly::util::UpdateNodeOpacity(self.node_, 1);
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_OPACITY);
+             return true;
+         }},
+        {kVisibility,
+         [](KRBasePropsHandler &self) {
+             kuikly::util::UpdateNodeVisibility(self.node_, 1);
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_VISIBILITY);
+             return true;
+         }},
+        {kOverflow,  // 裁剪子孩子
+         [](KRBasePropsHandler &self) {
+             kuikly::util::UpdateNodeOverflow(self.node_, 0);
+             self.css_overflow_ = 0;
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_CLIP);
+             return true;
+         }},
+        {kZIndex,  // z-index
+         [](KRBasePropsHandler &self) {
+             self.z_index_ = 0;
+             kuikly::util::UpdateNodeZIndex(self.node_, 0);
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_Z_INDEX);
+             return true;
+         }},
+        {kTouchEnable,  // 禁用手势
+         [](KRBasePropsHandler &self) {
+             kuikly::util::UpdateNodeHitTest(self.node_, true);
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_ENABLED);
+             return true;
+         }},
+        {kAccessibility,  // 无障碍化
+         [](KRBasePropsHandler &self) {
+             kuikly::util::UpdateNodeAccessibility(self.node_, "");
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_ACCESSIBILITY_TEXT);
+             return true;
+         }},
+        {kBoxShadow,  // 阴影，继续交给后续handler处理（与原有行为一致）
+         [](KRBasePropsHandler &self) {
+             kuikly::util::UpdateNodeBoxShadow(self.node_, "0 0 0 0 1");
+             kuikly::util::GetNodeApi()->resetAttribute(self.node_, NODE_CUSTOM_SHADOW);
+             return false;
+         }},
+        {KAnimation,
+         [](KRBasePropsHandler &self) {
+             kuikly::util::SetNodeAnimation(self.weakView_, nullptr);
+             return true;
+         }},
+        {kClipPath,
+         [](KRBasePropsHandler &self) {
+             self.has_clip_path_ = false;
+             kuikly::util::UpdateNodeClipPath(self.node_, 0, 0, "");
+             return true;
+         }},
+    });
+    return gResetters;
 }
 
 void KRBasePropsHandler::ResetTransformIfNeed() {
@@ -21,6 +21,7 @@
 #include <string>
 #include "libohos_render/expand/components/base/animation/IKRNodeAnimation.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKeyTable.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/view/IKRRenderView.h"
 
@@ -40,6 +41,13 @@ class KRBasePropsHandler : public std::enable_shared_from_this<KRBasePropsHandle
                                  const KRRenderCallback event_call_back);
 
     virtual bool ResetProp(const std::string &prop_key);
+    virtual bool ResetProp(KRPropKeyId prop_id);
+
+    /**
+     * 复用时是否可以延迟重置：重置只影响该属性自身对应的节点属性，与其它属性无耦合
+     * （如 borderRadius 会改动 clip，不属于此类）。新 cell 会再次设置的此类属性无需重置
+     */
+    static bool IsSelfContainedReset(KRPropKeyId prop_id);
 
     virtual void OnDestroy();
 
@@ -74,6 +82,13 @@ class KRBasePropsHandler : public std::enable_shared_from_this<KRBasePropsHandle
     }
 
  private:
+    using PropSetter = bool (*)(KRBasePropsHandler &self, const KRAnyValue &prop_value,
+                                const KRRenderCallback &event_call_back);
+    using PropResetter = bool (*)(KRBasePropsHandler &self);
+    // 基础属性分发表，按属性id索引
+    static const KRPropKeyJumpTable<PropSetter> &PropSetters();
+    static const KRPropKeyJumpTable<PropResetter> &PropResetters();
+
     void ResetTransformIfNeed();
     void UpdateTransform(const std::string &css_transform);
 
@@ -120,6 +135,9 @@ class KRArkTSViewBasePropsHandler : public KRBasePropsHandler{
     bool ResetProp(const std::string &prop_key) override {
         return false;
     }
+    bool ResetProp(KRPropKeyId prop_id) override {
+        return false;
+    }
 
     void OnDestroy() override {
         // blank
@@ -0,0 +1,352 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KRCanvasDisplayList.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string_view>
+
+#include "libohos_render/utils/KRJSONObject.h"
+
+namespace {
+
+enum class Method {
+    kLineCap,
+    kLineWidth,
+    kLineDash,
+    kStrokeStyle,
+    kFillStyle,
+    kBeginPath,
+    kMoveTo,
+    kLineTo,
+    kArc,
+    kClosePath,
+    kStroke,
+    kFill,
+    kCreateLinearGradient,
+    kQuadraticCurveTo,
+    kTextAlign,
+    kFont,
+    kFillText,
+    kStrokeText,
+    kBezierCurveTo,
+    kSave,
+    kSaveLayer,
+    kRestore,
+    kClip,
+    kTranslate,
+    kScale,
+    kRotate,
+    kSkew,
+    kTransform,
+    kDrawImage,
+};
+
+const std::unordered_map<std::string_view, Method> &MethodTable() {
+    static const auto *table = new std::unordered_map<std::string_view, Method>({
+        {"lineCap", Method::kLineCap},
+        {"lineWidth", Method::kLineWidth},
+        {"lineDash", Method::kLineDash},
+        {"strokeStyle", Method::kStrokeStyle},
+        {"fillStyle", Method::kFillStyle},
+        {"beginPath", Method::kBeginPath},
+        {"moveTo", Method::kMoveTo},
+        {"lineTo", Method::kLineTo},
+        {"arc", Method::kArc},
+        {"closePath", Method::kClosePath},
+        {"stroke", Method::kStroke},
+        {"fill", Method::kFill},
+        {"createLinearGradient", Method::kCreateLinearGradient},
+        {"quadraticCurveTo", Method::kQuadraticCurveTo},
+        {"textAlign", Method::kTextAlign},
+        {"font", Method::kFont},
+        {"fillText", Method::kFillText},
+        {"strokeText", Method::kStrokeText},
+        {"bezierCurveTo", Method::kBezierCurveTo},
+        {"save", Method::kSave},
+        {"saveLayer", Method::kSaveLayer},
+        {"restore", Method::kRestore},
+        {"clip", Method::kClip},
+        {"translate", Method::kTranslate},
+        {"scale", Method::kScale},
+        {"rotate", Method::kRotate},
+        {"skew", Method::kSkew},
+        {"transform", Method::kTransform},
+        {"drawImage", Method::kDrawImage},
+    });
+    return *table;
+}
+
+int ParseFontWeight(const std::string &weight) {
+    try {
+        return std::stoi(weight);
+    } catch (...) {
+        return 400;
+    }
+}
+
+}  // namespace
+
+bool KRCanvasDisplayList::Append(const std::string &method, const std::string &params) {
+    auto &table = MethodTable();
+    auto it = table.find(method);
+    if (it == table.end() || it->second == Method::kCreateLinearGradient) {
+        return false;
+    }
+    if (it->second == Method::kTextAlign) {
+        // textAlign 的参数是裸字符串而非 JSON
+        uint32_t align = 0;
+        if (params == "left") {
+            align = 0;
+        } else if (params == "center") {
+            align = 1;
+        } else if (params == "right") {
+            align = 2;
+        } else {
+            return false;
+        }
+        Emit(KRCanvasOpCode::kTextAlign, align);
+        return true;
+    }
+
+    auto obj = kuikly::util::JSONObject::Parse(params);
+    auto number = [&obj](const char *key, double default_value = 0) {
+        return obj ? obj->GetNumber(key, default_value) : default_value;
+    };
+    auto string = [&obj](const char *key) { return obj ? obj->GetString(key) : std::string(); };
+
+    switch (it->second) {
+    case Method::kLineCap: {
+        auto style = string("style");
+        Emit(KRCanvasOpCode::kLineCap, style == "round" ? 1 : (style == "square" ? 2 : 0));
+        break;
+    }
+    case Method::kLineWidth:
+        Emit(KRCanvasOpCode::kLineWidth, 0, {static_cast<float>(number("width"))});
+        break;
+    case Method::kLineDash: {
+        std::vector<float> intervals;
+        if (obj) {
+            auto values = obj->GetNumberArray("intervals");
+            intervals.assign(values.begin(), values.end());
+        }
+        Emit(KRCanvasOpCode::kLineDash, intervals.empty() ? kInvalidRef : InternDash(std::move(intervals)));
+        break;
+    }
+    case Method::kStrokeStyle:
+    case Method::kFillStyle:
+        if (!obj) {
+            return false;
+        }
+        Emit(it->second == Method::kStrokeStyle ? KRCanvasOpCode::kStrokeStyle : KRCanvasOpCode::kFillStyle,
+             InternString(string("style")));
+        break;
+    case Method::kBeginPath:
+        open_path_run_ = static_cast<uint32_t>(path_runs_.size());
+        path_runs_.push_back({static_cast<uint32_t>(path_ops_.size()), 0});
+        Emit(KRCanvasOpCode::kPath, open_path_run_);
+        break;
+    case Method::kMoveTo:
+    case Method::kLineTo: {
+        auto code = it->second == Method::kMoveTo ? KRCanvasOpCode::kMoveTo : KRCanvasOpCode::kLineTo;
+        EmitPathOp(code, {static_cast<float>(number("x")), static_cast<float>(number("y"))});
+        break;
+    }
+    case Method::kArc: {
+        if (!obj) {
+            return false;
+        }
+        float x = number("x");
+        float y = number("y");
+        float r = number("r");
+        float startAngle = number("sAngle") * 180 / M_PI;
+        float endAngle = number("eAngle") * 180 / M_PI;
+        bool ccw = number("counterclockwise");
+        float sweepAngle = endAngle - startAngle;
+        // 与逐帧解析时的规整规则一致：逆时针规整到 (-720, 0]，顺时针规整到 [0, 720)
+        if (ccw) {
+            if (sweepAngle > 0 || sweepAngle <= -720) {
+                sweepAngle = std::fmod(sweepAngle, 360) - 360;
+            }
+        } else {
+            if (sweepAngle < 0 || sweepAngle >= 720) {
+                sweepAngle = std::fmod(sweepAngle, 360) + 360;
+            }
+        }
+        if (std::fabs(sweepAngle) < 360) {
+            EmitPathOp(KRCanvasOpCode::kArc, {x - r, y - r, x + r, y + r, startAngle, sweepAngle});
+        } else {
+            // 大于等于 2π 的圆弧拆成两段
+            float halfSweepAngle = sweepAngle * 0.5;
+            EmitPathOp(KRCanvasOpCode::kArc, {x - r, y - r, x + r, y + r, startAngle, halfSweepAngle});
+            EmitPathOp(KRCanvasOpCode::kArc,
+                       {x - r, y - r, x + r, y + r, startAngle + halfSweepAngle, halfSweepAngle});
+        }
+        break;
+    }
+    case Method::kClosePath:
+        EmitPathOp(KRCanvasOpCode::kClosePath);
+        break;
+    case Method::kQuadraticCurveTo:
+        EmitPathOp(KRCanvasOpCode::kQuadTo, {static_cast<float>(number("cpx")), static_cast<float>(number("cpy")),
+                                             static_cast<float>(number("x")), static_cast<float>(number("y"))});
+        break;
+    case Method::kBezierCurveTo:
+        EmitPathOp(KRCanvasOpCode::kCubicTo,
+                   {static_cast<float>(number("cp1x")), static_cast<float>(number("cp1y")),
+                    static_cast<float>(number("cp2x")), static_cast<float>(number("cp2y")),
+                    static_cast<float>(number("x")), static_cast<float>(number("y"))});
+        break;
+    case Method::kStroke:
+    case Method::kFill:
+        open_path_run_ = kInvalidRef;
+        Emit(it->second == Method::kStroke ? KRCanvasOpCode::kStroke : KRCanvasOpCode::kFill);
+        break;
+    case Method::kClip:
+        open_path_run_ = kInvalidRef;
+        Emit(KRCanvasOpCode::kClip, number("intersect") ? 1 : 0);
+        break;
+    case Method::kFont: {
+        if (!obj) {
+            return false;
+        }
+        float italic = string("style") == "italic" ? 1 : 0;
+        float weight = ParseFontWeight(string("weight"));
+        Emit(KRCanvasOpCode::kFont, InternString(string("family")),
+             {static_cast<float>(number("size")), italic, weight});
+        break;
+    }
+    case Method::kFillText:
+    case Method::kStrokeText:
+        if (!obj) {
+            return false;
+        }
+        Emit(it->second == Method::kFillText ? KRCanvasOpCode::kFillText : KRCanvasOpCode::kStrokeText,
+             InternString(string("text")), {static_cast<float>(number("x")), static_cast<float>(number("y"))});
+        break;
+    case Method::kSave:
+        Emit(KRCanvasOpCode::kSave);
+        break;
+    case Method::kSaveLayer: {
+        float x = number("x");
+        float y = number("y");
+        float width = number("width");
+        float height = number("height");
+        Emit(KRCanvasOpCode::kSaveLayer, 0, {x, y, x + width, y + height});
+        break;
+    }
+    case Method::kRestore:
+        Emit(KRCanvasOpCode::kRestore);
+        break;
+    case Method::kTranslate:
+    case Method::kScale:
+    case Method::kSkew: {
+        auto code = it->second == Method::kTranslate
+                        ? KRCanvasOpCode::kTranslate
+                        : (it->second == Method::kScale ? KRCanvasOpCode::kScale : KRCanvasOpCode::kSkew);
+        Emit(code, 0, {static_cast<float>(number("x")), static_cast<float>(number("y"))});
+        break;
+    }
+    case Method::kRotate:
+        Emit(KRCanvasOpCode::kRotate, 0, {static_cast<float>(number("angle") * 180 / M_PI)});
+        break;
+    case Method::kTransform: {
+        if (!obj) {
+            return false;
+        }
+        auto v = obj->GetNumberArray("values");
+        if (v.size() < 9) {
+            return false;
+        }
+        Emit(KRCanvasOpCode::kTransform, 0,
+             {static_cast<float>(v[0]), static_cast<float>(v[1]), static_cast<float>(v[2]),
+              static_cast<float>(v[3]), static_cast<float>(v[4]), static_cast<float>(v[5]),
+              static_cast<float>(v[6]), static_cast<float>(v[7]), static_cast<float>(v[8])});
+        break;
+    }
+    case Method::kDrawImage: {
+        if (!obj) {
+            return false;
+        }
+        // sWidth/sHeight 为负数表示取图片尺寸，dWidth/dHeight 缺省（NaN）时取 sWidth/sHeight
+        constexpr double kAbsent = std::numeric_limits<double>::quiet_NaN();
+        Emit(KRCanvasOpCode::kDrawImage, InternString(string("cacheKey")),
+             {static_cast<float>(number("sx")), static_cast<float>(number("sy")),
+              static_cast<float>(number("sWidth", -1)), static_cast<float>(number("sHeight", -1)),
+              static_cast<float>(number("dx")), static_cast<float>(number("dy")),
+              static_cast<float>(number("dWidth", kAbsent)), static_cast<float>(number("dHeight", kAbsent))});
+        break;
+    }
+    default:
+        return false;
+    }
+    return true;
+}
+
+void KRCanvasDisplayList::Clear() {
+    ops_.clear();
+    path_ops_.clear();
+    path_runs_.clear();
+    floats_.clear();
+    strings_.clear();
+    string_index_.clear();
+    dashes_.clear();
+    dash_index_.clear();
+    open_path_run_ = kInvalidRef;
+}
+
+void KRCanvasDisplayList::Emit(KRCanvasOpCode code, uint32_t ref, std::initializer_list<float> args) {
+    ops_.push_back({code, ref, PushArgs(args)});
+}
+
+void KRCanvasDisplayList::EmitPathOp(KRCanvasOpCode code, std::initializer_list<float> args) {
+    if (open_path_run_ == kInvalidRef) {
+        // 没有 beginPath 的路径命令（如 stroke 之后继续 lineTo）追加到上一条路径，保持原位回放
+        Emit(code, 0, args);
+        return;
+    }
+    path_ops_.push_back({code, 0, PushArgs(args)});
+    path_runs_[open_path_run_].count++;
+}
+
+uint32_t KRCanvasDisplayList::PushArgs(std::initializer_list<float> args) {
+    auto offset = static_cast<uint32_t>(floats_.size());
+    floats_.insert(floats_.end(), args.begin(), args.end());
+    return offset;
+}
+
+uint32_t KRCanvasDisplayList::InternString(const std::string &str) {
+    auto it = string_index_.find(str);
+    if (it != string_index_.end()) {
+        return it->second;
+    }
+    auto index = static_cast<uint32_t>(strings_.size());
+    strings_.push_back(str);
+    string_index_.emplace(str, index);
+    return index;
+}
+
+uint32_t KRCanvasDisplayList::InternDash(std::vector<float> &&intervals) {
+    auto it = dash_index_.find(intervals);
+    if (it != dash_index_.end()) {
+        return it->second;
+    }
+    auto index = static_cast<uint32_t>(dashes_.size());
+    dash_index_.emplace(intervals, index);
+    dashes_.push_back(std::move(intervals));
+    return index;
+}
@@ -0,0 +1,155 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRCANVASDISPLAYLIST_H
+#define CORE_RENDER_OHOS_KRCANVASDISPLAYLIST_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Canvas 绘制命令操作码
+ */
+enum class KRCanvasOpCode : uint8_t {
+    kLineCap,       // ref: 0 flat / 1 round / 2 square
+    kLineWidth,     // args: width
+    kLineDash,      // ref: 虚线间隔下标，kInvalidRef 表示取消虚线
+    kStrokeStyle,   // ref: 样式字符串下标
+    kFillStyle,     // ref: 样式字符串下标
+    kPath,          // ref: 路径段下标（beginPath 及其后连续的路径构建命令）
+    kMoveTo,        // args: x, y
+    kLineTo,        // args: x, y
+    kArc,           // args: left, top, right, bottom, startAngle, sweepAngle（角度制，已规整）
+    kClosePath,
+    kQuadTo,        // args: cpx, cpy, x, y
+    kCubicTo,       // args: cp1x, cp1y, cp2x, cp2y, x, y
+    kStroke,
+    kFill,
+    kTextAlign,     // ref: 0 left / 1 center / 2 right
+    kFont,          // args: size, italic, weight; ref: 字体族字符串下标
+    kFillText,      // args: x, y; ref: 文本字符串下标
+    kStrokeText,    // args: x, y; ref: 文本字符串下标
+    kSave,
+    kSaveLayer,     // args: left, top, right, bottom
+    kRestore,
+    kClip,          // ref: 1 intersect / 0 difference
+    kTranslate,     // args: x, y
+    kScale,         // args: x, y
+    kRotate,        // args: degrees
+    kSkew,          // args: x, y
+    kTransform,     // args: 9 个矩阵元素
+    kDrawImage,     // args: sx, sy, sWidth, sHeight, dx, dy, dWidth, dHeight; ref: cacheKey 字符串下标
+};
+
+struct KRCanvasOp {
+    KRCanvasOpCode code;
+    uint32_t ref;   // 资源下标，含义见 KRCanvasOpCode
+    uint32_t args;  // 参数在 floats 中的起始下标
+};
+
+/**
+ * 路径段：beginPath 与其后的路径构建命令（moveTo/lineTo/arc/...）
+ * 路径构建命令只修改路径本身，与中间穿插的画笔、变换等命令无关，因此一直归入同一段，
+ * 直到 stroke/fill/clip 读取路径或下一个 beginPath 为止。回放时整段可以使用预先构建好的路径对象。
+ */
+struct KRCanvasPathRun {
+    uint32_t first = 0;  // path ops 起始下标
+    uint32_t count = 0;  // 路径构建命令数，路径段未结束时可能随新命令增长
+};
+
+/**
+ * Canvas 显示列表
+ * 1. 命令到达时（AddOp/BatchDraw）解析一次 JSON 参数，编译为 操作码 + 紧凑浮点参数 + 资源下标；
+ * 2. 文本、样式、字体族等字符串以及虚线间隔去重后按下标引用，平台对象（着色器、路径效果、路径）
+ *    由使用方按下标懒创建并缓存；
+ * 3. 只追加不修改：新命令到达只编译新命令，已编译部分及其平台对象保持有效，reset 时整体清空。
+ *
+ * 只依赖标准库与 KRJSONObject，不依赖绘制 API。
+ */
+class KRCanvasDisplayList {
+ public:
+    static constexpr uint32_t kInvalidRef = UINT32_MAX;
+
+    /**
+     * 编译一条命令并追加到列表末尾
+     * @return 命令被识别且需要回放时返回true（无需回放的命令如 createLinearGradient 返回false）
+     */
+    bool Append(const std::string &method, const std::string &params);
+
+    void Clear();
+
+    bool Empty() const {
+        return ops_.empty();
+    }
+
+    const std::vector<KRCanvasOp> &Ops() const {
+        return ops_;
+    }
+
+    const float *Args(const KRCanvasOp &op) const {
+        return floats_.data() + op.args;
+    }
+
+    const KRCanvasPathRun &PathRun(uint32_t index) const {
+        return path_runs_[index];
+    }
+
+    const KRCanvasOp &PathOp(uint32_t index) const {
+        return path_ops_[index];
+    }
+
+    size_t PathRunCount() const {
+        return path_runs_.size();
+    }
+
+    const std::string &String(uint32_t index) const {
+        return strings_[index];
+    }
+
+    size_t StringCount() const {
+        return strings_.size();
+    }
+
+    const std::vector<float> &Dash(uint32_t index) const {
+        return dashes_[index];
+    }
+
+    size_t DashCount() const {
+        return dashes_.size();
+    }
+
+ private:
+    void Emit(KRCanvasOpCode code, uint32_t ref = 0, std::initializer_list<float> args = {});
+    void EmitPathOp(KRCanvasOpCode code, std::initializer_list<float> args = {});
+    uint32_t PushArgs(std::initializer_list<float> args);
+    uint32_t InternString(const std::string &str);
+    uint32_t InternDash(std::vector<float> &&intervals);
+
+    std::vector<KRCanvasOp> ops_;
+    std::vector<KRCanvasOp> path_ops_;
+    std::vector<KRCanvasPathRun> path_runs_;
+    std::vector<float> floats_;
+    std::vector<std::string> strings_;
+    std::unordered_map<std::string, uint32_t> string_index_;
+    std::vector<std::vector<float>> dashes_;
+    std::map<std::vector<float>, uint32_t> dash_index_;
+    uint32_t open_path_run_ = kInvalidRef;  // 尚未结束的路径段
+};
+
+#endif  // CORE_RENDER_OHOS_KRCANVASDISPLAYLIST_H
@@ -15,6 +15,8 @@
 
 #include "KRCanvasView.h"
 
+#include <cmath>
+
 #include <multimedia/image_framework/image/pixelmap_native.h>
 #include <native_drawing/drawing_bitmap.h>
 #include <native_drawing/drawing_brush.h>
@@ -90,6 +92,10 @@ void KRCanvasView::DidInit() {
     IKRRenderViewExport::DidInit();
 }
 
+void KRCanvasView::OnDestroy() {
+    Reset();
+}
+
 bool KRCanvasView::ShouldCacheOp(const std::string &method) {
     return cachable_methods_.find(method) != cachable_methods_.end();
 }
@@ -127,7 +133,7 @@ void KRCanvasView::BatchDraw(const KRAnyValue &params) {
         auto paramsIt = m.find("p");
         std::string p = (paramsIt != m.end()) ? paramsIt->second->toString() : "";
         if (ShouldCacheOp(method)) {
-            ops_.push_back(std::pair{method, p});
+            display_list_.Append(method, p);
         }
     }
     // 整批命令全部入队后，只触发一次重绘，避免每条命令各触发一次 markDirty
@@ -143,42 +149,6 @@ void KRCanvasView::OnCustomEvent(ArkUI_NodeCustomEvent *event, const ArkUI_NodeC
     }
 }
 
-void KRCanvasView::SetLineCap(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    std::string str = obj->GetString("style");
-    OH_Drawing_PenLineCapStyle style = LINE_FLAT_CAP;
-    if (str == "round") {
-        style = LINE_ROUND_CAP;
-    } else if (str == "square") {
-        style = LINE_SQUARE_CAP;
-    }
-    CreatePenIfNeeded();
-    OH_Drawing_PenSetCap(pen_, style);
-}
-
-void KRCanvasView::SetLineWidth(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float width = obj->GetNumber("width");
-
-    CreatePenIfNeeded();
-    OH_Drawing_PenSetWidth(pen_, width);
-}
-
-void KRCanvasView::SetLineDash(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    auto intervalsVector = obj->GetNumberArray("intervals");
-    int count = intervalsVector.size();
-    CreatePenIfNeeded();
-    if (count == 0) {
-        OH_Drawing_PenSetPathEffect(pen_, nullptr);
-        return;
-    }
-    std::vector<float> intervals(intervalsVector.begin(), intervalsVector.end());
-    auto pathEffect = OH_Drawing_CreateDashPathEffect(intervals.data(), count, 0);
-    OH_Drawing_PenSetPathEffect(pen_, pathEffect);
-    OH_Drawing_PathEffectDestroy(pathEffect);
-}
-
 void processColorStops(const std::string &colorStopsStr, std::vector<uint32_t> &colors, std::vector<float> &locations) {
     std::vector<std::string> splits = kuikly::util::ConvertSplit(colorStopsStr, ",");
 
@@ -222,112 +192,148 @@ OH_Drawing_ShaderEffect *parseGradientStyle(const std::string &style) {
     return colorShaderEffect;
 }
 
-void KRCanvasView::SetStrokeStyle(const std::string &params) {
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        const std::string style = paramObj->GetString("style");
-        CreatePenIfNeeded();
-        if (style.substr(0, LINEAR_GRADIENT.size()) == LINEAR_GRADIENT) {
-            OH_Drawing_ShaderEffect *colorShaderEffect = parseGradientStyle(style);
-            OH_Drawing_PenSetShaderEffect(pen_, colorShaderEffect);
+const KRCanvasView::StyleEntry &KRCanvasView::ResolveStyle(std::vector<StyleEntry> &styles, uint32_t style,
+                                                           bool stroke) {
+    if (styles.size() < display_list_.StringCount()) {
+        styles.resize(display_list_.StringCount());
+    }
+    auto &entry = styles[style];
+    if (!entry.resolved) {
+        entry.resolved = true;
+        const std::string &str = display_list_.String(style);
+        if (str.substr(0, LINEAR_GRADIENT.size()) == LINEAR_GRADIENT) {
+            entry.gradient = true;
+            entry.shader = parseGradientStyle(str);
+        } else if (stroke) {
+            entry.color = kuikly::util::ConvertToHexColor(str);
         } else {
-            OH_Drawing_PenSetShaderEffect(pen_, nullptr);
-            OH_Drawing_PenSetColor(pen_, kuikly::util::ConvertToHexColor(style));
+            entry.color = kuikly::graphics::Color::FromString(str).value;
         }
     }
+    return entry;
 }
-void KRCanvasView::SetFillStyle(const std::string &params) {
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        const std::string style = paramObj->GetString("style");
-        CreateBrushIfNeeded();
-        if (style.substr(0, LINEAR_GRADIENT.size()) == LINEAR_GRADIENT) {
-            OH_Drawing_ShaderEffect *colorShaderEffect = parseGradientStyle(style);
-            OH_Drawing_BrushSetShaderEffect(brush_, colorShaderEffect);
-        } else {
-            OH_Drawing_BrushSetShaderEffect(brush_, nullptr);
-            kuikly::graphics::Color color = kuikly::graphics::Color::FromString(style);
-            OH_Drawing_BrushSetColor(brush_, color.value);
-        }
+
+void KRCanvasView::SetLineCap(uint32_t cap) {
+    OH_Drawing_PenLineCapStyle style = LINE_FLAT_CAP;
+    if (cap == 1) {
+        style = LINE_ROUND_CAP;
+    } else if (cap == 2) {
+        style = LINE_SQUARE_CAP;
     }
+    CreatePenIfNeeded();
+    OH_Drawing_PenSetCap(pen_, style);
 }
 
-void KRCanvasView::BeginPath() {
-    if (drawingPath_) {
-        OH_Drawing_PathDestroy(drawingPath_);
-    }
-    drawingPath_ = OH_Drawing_PathCreate();
+void KRCanvasView::SetLineWidth(float width) {
+    CreatePenIfNeeded();
+    OH_Drawing_PenSetWidth(pen_, width);
 }
 
-void KRCanvasView::MoveTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
+void KRCanvasView::SetLineDash(uint32_t dash) {
+    CreatePenIfNeeded();
+    if (dash == KRCanvasDisplayList::kInvalidRef) {
+        OH_Drawing_PenSetPathEffect(pen_, nullptr);
         return;
     }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
+    if (dash_effects_.size() < display_list_.DashCount()) {
+        dash_effects_.resize(display_list_.DashCount(), nullptr);
+    }
+    if (dash_effects_[dash] == nullptr) {
+        const auto &intervals = display_list_.Dash(dash);
+        dash_effects_[dash] =
+            OH_Drawing_CreateDashPathEffect(const_cast<float *>(intervals.data()), intervals.size(), 0);
+    }
+    OH_Drawing_PenSetPathEffect(pen_, dash_effects_[dash]);
+}
 
-    OH_Drawing_PathMoveTo(drawingPath_, x, y);
+void KRCanvasView::SetStrokeStyle(uint32_t style) {
+    const auto &entry = ResolveStyle(stroke_styles_, style, true);
+    CreatePenIfNeeded();
+    if (entry.gradient) {
+        OH_Drawing_PenSetShaderEffect(pen_, entry.shader);
+    } else {
+        OH_Drawing_PenSetShaderEffect(pen_, nullptr);
+        OH_Drawing_PenSetColor(pen_, entry.color);
+    }
 }
 
-void KRCanvasView::LineTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
-        return;
+void KRCanvasView::SetFillStyle(uint32_t style) {
+    const auto &entry = ResolveStyle(fill_styles_, style, false);
+    CreateBrushIfNeeded();
+    if (entry.gradient) {
+        OH_Drawing_BrushSetShaderEffect(brush_, entry.shader);
+    } else {
+        OH_Drawing_BrushSetShaderEffect(brush_, nullptr);
+        OH_Drawing_BrushSetColor(brush_, entry.color);
     }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
-    OH_Drawing_PathLineTo(drawingPath_, x, y);
 }
 
-void KRCanvasView::Arc(const std::string &params) {
+OH_Drawing_Path *KRCanvasView::GetPathRun(uint32_t path_run) {
+    if (path_runs_.size() < display_list_.PathRunCount()) {
+        path_runs_.resize(display_list_.PathRunCount());
+    }
+    auto &entry = path_runs_[path_run];
+    if (entry.path == nullptr) {
+        entry.path = OH_Drawing_PathCreate();
+    }
+    // 路径段只会在末尾追加命令，已写入的部分无需重建
+    const auto &run = display_list_.PathRun(path_run);
+    for (; entry.built_count < run.count; entry.built_count++) {
+        ApplyPathOp(entry.path, display_list_.PathOp(run.first + entry.built_count));
+    }
+    return entry.path;
+}
+
+void KRCanvasView::ApplyPathOp(OH_Drawing_Path *path, const KRCanvasOp &op) {
+    const float *args = display_list_.Args(op);
+    switch (op.code) {
+    case KRCanvasOpCode::kMoveTo:
+        OH_Drawing_PathMoveTo(path, args[0], args[1]);
+        break;
+    case KRCanvasOpCode::kLineTo:
+        OH_Drawing_PathLineTo(path, args[0], args[1]);
+        break;
+    case KRCanvasOpCode::kArc:
+        OH_Drawing_PathArcTo(path, args[0], args[1], args[2], args[3], args[4], args[5]);
+        break;
+    case KRCanvasOpCode::kClosePath:
+        OH_Drawing_PathClose(path);
+        break;
+    case KRCanvasOpCode::kQuadTo:
+        OH_Drawing_PathQuadTo(path, args[0], args[1], args[2], args[3]);
+        break;
+    case KRCanvasOpCode::kCubicTo:
+        OH_Drawing_PathCubicTo(path, args[0], args[1], args[2], args[3], args[4], args[5]);
+        break;
+    default:
+        break;
+    }
+}
+
+void KRCanvasView::BeginPath(uint32_t path_run) {
+    ReleaseDrawingPath();
+    drawingPath_ = GetPathRun(path_run);
+    owns_drawing_path_ = false;
+}
+
+void KRCanvasView::AppendPathOp(const KRCanvasOp &op) {
     if (drawingPath_ == nullptr) {
         return;
     }
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        float x = paramObj->GetNumber("x");
-        float y = paramObj->GetNumber("y");
-        float r = paramObj->GetNumber("r");
-        float startAngle = paramObj->GetNumber("sAngle") * 180 / M_PI;
-        float endAngle = paramObj->GetNumber("eAngle") * 180 / M_PI;
-        bool ccw = paramObj->GetNumber("counterclockwise");
-        float sweepAngle = endAngle - startAngle;
-        if (ccw) {
-            // Preprocessing for counter-clockwise drawing:
-            // 0. Angles in (-720, 0] require no processing
-            // 1. sweepAngle > 0, startAngle and endAngle represent absolute angles, convert to [-360, 0)
-            // 2. sweepAngle <= -720, drawing exceeds 2 turns, convert to (-720, -360]
-            // Rules 2 and 3 share the same formula; In summary, final sweepAngle is in (-720, 0]
-            if (sweepAngle > 0 || sweepAngle <= -720) {
-                sweepAngle = std::fmod(sweepAngle, 360) - 360;
-            }
-        } else {
-            // Preprocessing for clockwise drawing:
-            // 0. Angles in [0, 720) require no processing
-            // 1. sweepAngle < 0, startAngle and endAngle represent absolute angles, convert to (0, 360]
-            // 2. sweepAngle >= 720, drawing exceeds 2 turns, convert to [360, 720)
-            // Rules 2 and 3 share the same formula; In summary, final sweepAngle is in [0, 720)
-            if (sweepAngle < 0 || sweepAngle >= 720) {
-                sweepAngle = std::fmod(sweepAngle, 360) + 360;
-            }
-        }
-        if (std::fabs(sweepAngle) < 360) {
-            // Deal with arc less than 2π
-            OH_Drawing_PathArcTo(drawingPath_, x - r, y - r, x + r, y + r, startAngle, sweepAngle);
-        } else {
-            // Deal with arc greater than or equal to 2π
-            float halfSweepAngle = sweepAngle * 0.5;
-            OH_Drawing_PathArcTo(drawingPath_, x - r, y - r, x + r, y + r, startAngle, halfSweepAngle);
-            OH_Drawing_PathArcTo(drawingPath_, x - r, y - r, x + r, y + r, startAngle + halfSweepAngle, halfSweepAngle);
-        }
+    if (!owns_drawing_path_) {
+        // 预构建路径被多帧共享，追加命令前先复制
+        drawingPath_ = OH_Drawing_PathCopy(drawingPath_);
+        owns_drawing_path_ = true;
     }
+    ApplyPathOp(drawingPath_, op);
 }
 
-void KRCanvasView::ClosePath() {
-    if (drawingPath_) {
-        OH_Drawing_PathClose(drawingPath_);
+void KRCanvasView::ReleaseDrawingPath() {
+    if (drawingPath_ && owns_drawing_path_) {
+        OH_Drawing_PathDestroy(drawingPath_);
     }
+    drawingPath_ = nullptr;
+    owns_drawing_path_ = false;
 }
 
 void KRCanvasView::Stroke() {
@@ -354,47 +360,32 @@ void KRCanvasView::Fill() {
     }
 }
 
-void KRCanvasView::SetTextAlign(const std::string &params) {
-    if (params == "left") {
+void KRCanvasView::SetTextAlign(uint32_t align) {
+    if (align == 0) {
         text_feature_.textAlign = TEXT_ALIGN_LEFT;
-    } else if (params == "center") {
+    } else if (align == 1) {
         text_feature_.textAlign = TEXT_ALIGN_CENTER;
-    } else if (params == "right") {
+    } else if (align == 2) {
         text_feature_.textAlign = TEXT_ALIGN_RIGHT;
     }
 }
 
-void KRCanvasView::SetFont(const std::string &params) {
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    auto size = paramObj->GetNumber("size");
-    auto style = paramObj->GetString("style");
-    auto weight = std::stoi(paramObj->GetString("weight"));
-    auto family = paramObj->GetString("family");
-    
+void KRCanvasView::SetFont(const KRCanvasOp &op, const float *args) {
     float scale = 1.0;
     if (auto root = GetRootView().lock()) {
         scale = root->GetContext()->Config()->GetFontWeightScale();
     }
 
-    text_feature_.fontSize = size;
-    text_feature_.fontStyle = kuikly::util::ConvertToFontStyle(style);
-    text_feature_.fontWeight = kuikly::util::ConvertFontWeight(weight, scale);
-    text_feature_.fontFamily = family;
-}
-
-void KRCanvasView::FillText(const std::string &params) {
-    if (canvas_) {
-        DrawText(params, FILL_TEXT);
-    }
+    text_feature_.fontSize = args[0];
+    text_feature_.fontStyle = args[1] != 0 ? FONT_STYLE_ITALIC : FONT_STYLE_NORMAL;
+    text_feature_.fontWeight = kuikly::util::ConvertFontWeight(static_cast<int>(args[2]), scale);
+    text_feature_.fontFamily = display_list_.String(op.ref);
 }
 
-void KRCanvasView::StrokeText(const std::string &params) {
-    if (canvas_) {
-        DrawText(params, STROKE_TEXT);
+void KRCanvasView::DrawText(const KRCanvasOp &op, const float *args) {
+    if (canvas_ == nullptr) {
+        return;
     }
-}
-
-void KRCanvasView::DrawText(std::string params, std::string_view type) {
     OH_Drawing_TextStyle *txtStyle = OH_Drawing_CreateTextStyle();
     // 设置文字大小、字重等属性
     float fontSizeScale = 1;
@@ -428,18 +419,17 @@ void KRCanvasView::DrawText(std::string params, std::string_view type) {
     // 使用左对齐
     OH_Drawing_SetTypographyTextAlign(typoStyle, TEXT_ALIGN_LEFT);
 
-    if (type == FILL_TEXT) {
+    if (op.code == KRCanvasOpCode::kFillText) {
         CreateBrushIfNeeded();
         OH_Drawing_SetTextStyleForegroundBrush(txtStyle, brush_);
-    } else if (type == STROKE_TEXT) {
+    } else if (op.code == KRCanvasOpCode::kStrokeText) {
         CreatePenIfNeeded();
         OH_Drawing_SetTextStyleForegroundPen(txtStyle, pen_);
     }
 
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    auto text = paramObj->GetString("text");
-    auto x = paramObj->GetNumber("x");
-    auto y = paramObj->GetNumber("y");
+    const std::string &text = display_list_.String(op.ref);
+    double x = args[0];
+    double y = args[1];
 
     OH_Drawing_TypographyCreate *handler = CreateTypographyHandler(typoStyle);
     OH_Drawing_TypographyHandlerPushTextStyle(handler, txtStyle);
@@ -477,46 +467,15 @@ void KRCanvasView::DrawText(std::string params, std::string_view type) {
     OH_Drawing_DestroyTextStyle(txtStyle);
 }
 
-void KRCanvasView::QuadraticCurveTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
-        return;
-    }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float cpx = obj->GetNumber("cpx");
-    float cpy = obj->GetNumber("cpy");
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
-    OH_Drawing_PathQuadTo(drawingPath_, cpx, cpy, x, y);
-}
-
-void KRCanvasView::BezierCurveTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
-        return;
-    }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float cp1x = obj->GetNumber("cp1x");
-    float cp1y = obj->GetNumber("cp1y");
-    float cp2x = obj->GetNumber("cp2x");
-    float cp2y = obj->GetNumber("cp2y");
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
-    OH_Drawing_PathCubicTo(drawingPath_, cp1x, cp1y, cp2x, cp2y, x, y);
-}
-
 void KRCanvasView::Save() {
     if (canvas_) {
         OH_Drawing_CanvasSave(canvas_);
     }
 }
 
-void KRCanvasView::SaveLayer(const std::string &params) {
+void KRCanvasView::SaveLayer(const float *args) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
-        float width = obj->GetNumber("width");
-        float height = obj->GetNumber("height");
-        OH_Drawing_Rect *rect = OH_Drawing_RectCreate(x, y, x + width, y + height);
+        OH_Drawing_Rect *rect = OH_Drawing_RectCreate(args[0], args[1], args[2], args[3]);
         OH_Drawing_CanvasSaveLayer(canvas_, rect, brush_);
         OH_Drawing_RectDestroy(rect);
     }
@@ -528,80 +487,60 @@ void KRCanvasView::Restore() {
     }
 }
 
-void KRCanvasView::clip(const std::string &params) {
+void KRCanvasView::clip(uint32_t intersect) {
     if (canvas_ && drawingPath_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        auto op = obj->GetNumber("intersect") ? OH_Drawing_CanvasClipOp::INTERSECT
-                                              : OH_Drawing_CanvasClipOp::DIFFERENCE;
+        auto op = intersect ? OH_Drawing_CanvasClipOp::INTERSECT : OH_Drawing_CanvasClipOp::DIFFERENCE;
         OH_Drawing_CanvasClipPath(canvas_, drawingPath_, op, true);
     }
 }
 
-void KRCanvasView::Translate(const std::string &params) {
+void KRCanvasView::Translate(const float *args) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
-        OH_Drawing_CanvasTranslate(canvas_, x, y);
+        OH_Drawing_CanvasTranslate(canvas_, args[0], args[1]);
     }
 }
 
-void KRCanvasView::Scale(const std::string &params) {
+void KRCanvasView::Scale(const float *args) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
-        OH_Drawing_CanvasScale(canvas_, x, y);
+        OH_Drawing_CanvasScale(canvas_, args[0], args[1]);
     }
 }
 
-void KRCanvasView::Rotate(const std::string &params) {
+void KRCanvasView::Rotate(const float *args) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float degrees = obj->GetNumber("angle") * 180 / M_PI;
-        OH_Drawing_CanvasRotate(canvas_, degrees, 0, 0);
+        OH_Drawing_CanvasRotate(canvas_, args[0], 0, 0);
     }
 }
 
-void KRCanvasView::Skew(const std::string &params) {
+void KRCanvasView::Skew(const float *args) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
-        OH_Drawing_CanvasSkew(canvas_, x, y);
+        OH_Drawing_CanvasSkew(canvas_, args[0], args[1]);
     }
 }
 
-void KRCanvasView::Transform(const std::string &params) {
+void KRCanvasView::Transform(const float *args) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        auto values = obj->GetNumberArray("values");
-        if (values.size() < 9) {
-            return;
-        }
         auto matrix = OH_Drawing_MatrixCreate();
         OH_Drawing_MatrixSetMatrix(matrix,
-                                   values[0], values[1], values[2],
-                                   values[3], values[4], values[5],
-                                   values[6], values[7], values[8]);
+                                   args[0], args[1], args[2],
+                                   args[3], args[4], args[5],
+                                   args[6], args[7], args[8]);
         OH_Drawing_CanvasConcatMatrix(canvas_, matrix);
         OH_Drawing_MatrixDestroy(matrix);
     }
 }
 
-void KRCanvasView::DrawImage(const std::string &params) {
+void KRCanvasView::DrawImage(const KRCanvasOp &op, const float *args) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        std::string cacheKey = obj->GetString("cacheKey");
         auto module = std::dynamic_pointer_cast<KRMemoryCacheModule>(GetModule(kMemoryCacheModuleName));
-        auto pixelmap = module->GetImage(cacheKey);
+        auto pixelmap = module->GetImage(display_list_.String(op.ref));
         if (!pixelmap) {
             return;
         }
-        float sx = obj->GetNumber("sx");
-        float sy = obj->GetNumber("sy");
-        float sWidth = obj->GetNumber("sWidth", -1);
-        float sHeight = obj->GetNumber("sHeight", -1);
+        float sx = args[0];
+        float sy = args[1];
+        float sWidth = args[2];
+        float sHeight = args[3];
         if (sWidth < 0 || sHeight < 0) {
             OH_Pixelmap_ImageInfo *info;
             OH_PixelmapImageInfo_Create(&info);
@@ -614,10 +553,10 @@ void KRCanvasView::DrawImage(const std::string &params) {
             sWidth = width;
             sHeight = height;
         }
-        float dx = obj->GetNumber("dx");
-        float dy = obj->GetNumber("dy");
-        float dWidth = obj->GetNumber("dWidth", sWidth);
-        float dHeight = obj->GetNumber("dHeight", sHeight);
+        float dx = args[4];
+        float dy = args[5];
+        float dWidth = std::isnan(args[6]) ? sWidth : args[6];
+        float dHeight = std::isnan(args[7]) ? sHeight : args[7];
 
         OH_Drawing_PixelMap *drawingPixelMap = OH_Drawing_PixelMapGetFromOhPixelMapNative(pixelmap);
         OH_Drawing_Rect *srcRect = OH_Drawing_RectCreate(sx, sy, sx + sWidth, sy + sHeight);
@@ -642,13 +581,34 @@ void KRCanvasView::CreateBrushIfNeeded() {
     }
 }
 
+void KRCanvasView::ReleaseDisplayListResources() {
+    ReleaseDrawingPath();
+    for (auto *styles : {&stroke_styles_, &fill_styles_}) {
+        for (auto &entry : *styles) {
+            if (entry.shader) {
+                OH_Drawing_ShaderEffectDestroy(entry.shader);
+            }
+        }
+        styles->clear();
+    }
+    for (auto effect : dash_effects_) {
+        if (effect) {
+            OH_Drawing_PathEffectDestroy(effect);
+        }
+    }
+    dash_effects_.clear();
+    for (auto &entry : path_runs_) {
+        if (entry.path) {
+            OH_Drawing_PathDestroy(entry.path);
+        }
+    }
+    path_runs_.clear();
+}
+
 void KRCanvasView::Reset() {
-    ops_.clear();
+    display_list_.Clear();
+    ReleaseDisplayListResources();
 
-    if (drawingPath_) {
-        OH_Drawing_PathDestroy(drawingPath_);
-        drawingPath_ = nullptr;
-    }
     if (pen_) {
         OH_Drawing_PenDestroy(pen_);
         pen_ = nullptr;
@@ -660,7 +620,8 @@ void KRCanvasView::Reset() {
 }
 
 void KRCanvasView::AddOp(const std::string &method, const KRAnyValue &params) {
-    ops_.push_back(std::pair{method, params->toString()});
+    // 命令到达时编译一次，之后每帧回放不再解析字符串
+    display_list_.Append(method, params->toString());
 }
 
 void KRCanvasView::OnDraw(ArkUI_NodeCustomEvent *event) {
@@ -681,69 +642,85 @@ void KRCanvasView::OnDraw(ArkUI_NodeCustomEvent *event) {
     OH_Drawing_CanvasClipRect(canvas_, rect, OH_Drawing_CanvasClipOp::INTERSECT, false);
     OH_Drawing_RectDestroy(rect);
 
-    std::for_each(ops_.begin(), ops_.end(), [this](auto item) {
-        const std::string &method = item.first;
-        const std::string &params = item.second;
-        if (method == LINE_CAP) {
-            SetLineCap(params);
-        } else if (method == LINE_WIDTH) {
-            SetLineWidth(params);
-        } else if (method == LINE_DASH) {
-            SetLineDash(params);
-        } else if (method == STROKE_STYLE) {
-            SetStrokeStyle(params);
-        } else if (method == FILL_STYLE) {
-            SetFillStyle(params);
-        } else if (method == BEGIN_PATH) {
-            BeginPath();
-        } else if (method == MOVE_TO) {
-            MoveTo(params);
-        } else if (method == LINE_TO) {
-            LineTo(params);
-        } else if (method == ARC) {
-            Arc(params);
-        } else if (method == CLOSE_PATH) {
-            ClosePath();
-        } else if (method == STROKE) {
-            Stroke();
-        } else if (method == FILL) {
-            Fill();
-        } else if (method == CREATE_LINEAR_GRADIENT) {
-            //
-        } else if (method == QUADRATIC_CURVE_TO) {
-            QuadraticCurveTo(params);
-        } else if (method == TEXT_ALIGN) {
-            SetTextAlign(params);
-        } else if (method == FONT) {
-            SetFont(params);
-        } else if (method == FILL_TEXT) {
-            FillText(params);
-        } else if (method == STROKE_TEXT) {
-            StrokeText(params);
-        } else if (method == BEZIER_CURVE_TO) {
-            BezierCurveTo(params);
-        } else if (method == RESET) {
-            Reset();
-        } else if (method == SAVE) {
-            Save();
-        } else if (method == SAVE_LAYER) {
-            SaveLayer(params);
-        } else if (method == RESTORE) {
-            Restore();
-        } else if (method == CLIP) {
-            clip(params);
-        } else if (method == TRANSLATE) {
-            Translate(params);
-        } else if (method == SCALE) {
-            Scale(params);
-        } else if (method == ROTATE) {
-            Rotate(params);
-        } else if (method == SKEW) {
-            Skew(params);
-        } else if (method == TRANSFORM) {
-            Transform(params);
-        } else if (method == DRAW_IMAGE) {
-            DrawImage(params);
-        }
-    });
+    for (const auto &op : display_list_.Ops()) {
+        Replay(op);
+    }
+}
+
+void KRCanvasView::Replay(const KRCanvasOp &op) {
+    const float *args = display_list_.Args(op);
+    switch (op.code) {
+    case KRCanvasOpCode::kLineCap:
+        SetLineCap(op.ref);
+        break;
+    case KRCanvasOpCode::kLineWidth:
+        SetLineWidth(args[0]);
+        break;
+    case KRCanvasOpCode::kLineDash:
+        SetLineDash(op.ref);
+        break;
+    case KRCanvasOpCode::kStrokeStyle:
+        SetStrokeStyle(op.ref);
+        break;
+    case KRCanvasOpCode::kFillStyle:
+        SetFillStyle(op.ref);
+        break;
+    case KRCanvasOpCode::kPath:
+        BeginPath(op.ref);
+        break;
+    case KRCanvasOpCode::kMoveTo:
+    case KRCanvasOpCode::kLineTo:
+    case KRCanvasOpCode::kArc:
+    case KRCanvasOpCode::kClosePath:
+    case KRCanvasOpCode::kQuadTo:
+    case KRCanvasOpCode::kCubicTo:
+        AppendPathOp(op);
+        break;
+    case KRCanvasOpCode::kStroke:
+        Stroke();
+        break;
+    case KRCanvasOpCode::kFill:
+        Fill();
+        break;
+    case KRCanvasOpCode::kTextAlign:
+        SetTextAlign(op.ref);
+        break;
+    case KRCanvasOpCode::kFont:
+        SetFont(op, args);
+        break;
+    case KRCanvasOpCode::kFillText:
+    case KRCanvasOpCode::kStrokeText:
+        DrawText(op, args);
+        break;
+    case KRCanvasOpCode::kSave:
+        Save();
+        break;
+    case KRCanvasOpCode::kSaveLayer:
+        SaveLayer(args);
+        break;
+    case KRCanvasOpCode::kRestore:
+        Restore();
+        break;
+    case KRCanvasOpCode::kClip:
+        clip(op.ref);
+        break;
+    case KRCanvasOpCode::kTranslate:
+        Translate(args);
+        break;
+    case KRCanvasOpCode::kScale:
+        Scale(args);
+        break;
+    case KRCanvasOpCode::kRotate:
+        Rotate(args);
+        break;
+    case KRCanvasOpCode::kSkew:
+        Skew(args);
+        break;
+    case KRCanvasOpCode::kTransform:
+        Transform(args);
+        break;
+    case KRCanvasOpCode::kDrawImage:
+        DrawImage(op, args);
+        break;
+    }
 }
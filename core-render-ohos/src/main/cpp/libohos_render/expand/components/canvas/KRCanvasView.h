@@ -18,6 +18,7 @@
 
 #include <unordered_set>
 
+#include "libohos_render/expand/components/canvas/KRCanvasDisplayList.h"
 #include "libohos_render/expand/components/richtext/KRRichTextShadow.h"
 #include "libohos_render/expand/components/view/KRView.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
@@ -46,54 +47,71 @@ class KRCanvasView : public KRView {
 
     void DidInit() override;
     void DidMoveToParentView() override;
+    void OnDestroy() override;
 
  private:
-    void SetLineCap(const std::string &params);
-    void SetLineWidth(const std::string &params);
-    void SetLineDash(const std::string &params);
-    void SetStrokeStyle(const std::string &params);
-    void SetFillStyle(const std::string &params);
-    void BeginPath();
-    void MoveTo(const std::string &params);
-    void LineTo(const std::string &params);
-    void Arc(const std::string &params);
-    void ClosePath();
+    struct StyleEntry {
+        bool resolved = false;
+        bool gradient = false;
+        uint32_t color = 0;
+        OH_Drawing_ShaderEffect *shader = nullptr;
+    };
+    struct PathEntry {
+        OH_Drawing_Path *path = nullptr;
+        uint32_t built_count = 0;  // 已写入 path 的路径段命令数
+    };
+
+    void SetLineCap(uint32_t cap);
+    void SetLineWidth(float width);
+    void SetLineDash(uint32_t dash);
+    void SetStrokeStyle(uint32_t style);
+    void SetFillStyle(uint32_t style);
+    void BeginPath(uint32_t path_run);
+    void AppendPathOp(const KRCanvasOp &op);
     void Stroke();
     void Fill();
-    void FillText(const std::string &params);
-    void StrokeText(const std::string &params);
-    void SetTextAlign(const std::string &params);
-    void SetFont(const std::string &params);
-    void QuadraticCurveTo(const std::string &params);
-    void BezierCurveTo(const std::string &params);
+    void SetTextAlign(uint32_t align);
+    void SetFont(const KRCanvasOp &op, const float *args);
     void Save();
-    void SaveLayer(const std::string &params);
+    void SaveLayer(const float *args);
     void Restore();
-    void clip(const std::string &params);
-    void Translate(const std::string &params);
-    void Scale(const std::string &params);
-    void Rotate(const std::string &params);
-    void Skew(const std::string &params);
-    void Transform(const std::string &params);
-    void DrawImage(const std::string &params);
+    void clip(uint32_t intersect);
+    void Translate(const float *args);
+    void Scale(const float *args);
+    void Rotate(const float *args);
+    void Skew(const float *args);
+    void Transform(const float *args);
+    void DrawImage(const KRCanvasOp &op, const float *args);
     void Reset();
-    void DrawText(std::string params, std::string_view type);
+    void DrawText(const KRCanvasOp &op, const float *args);
 
     void AddOp(const std::string &method, const KRAnyValue &params);
     void BatchDraw(const KRAnyValue &params);
     void OnDraw(ArkUI_NodeCustomEvent *event);
+    void Replay(const KRCanvasOp &op);
 
     bool ShouldCacheOp(const std::string &method);
     bool MarkDirtyIfNeeded(const std::string &method);
     void CreatePenIfNeeded();
     void CreateBrushIfNeeded();
+    const StyleEntry &ResolveStyle(std::vector<StyleEntry> &styles, uint32_t style, bool stroke);
+    OH_Drawing_Path *GetPathRun(uint32_t path_run);
+    void ApplyPathOp(OH_Drawing_Path *path, const KRCanvasOp &op);
+    void ReleaseDrawingPath();
+    void ReleaseDisplayListResources();
 
  private:
     OH_Drawing_Canvas *canvas_ = nullptr;
     OH_Drawing_Path *drawingPath_ = nullptr;
+    bool owns_drawing_path_ = false;  // drawingPath_ 为 path_runs_ 中的预构建路径时为false
     OH_Drawing_Brush *brush_ = nullptr;
     OH_Drawing_Pen *pen_ = nullptr;
-    std::vector<std::pair<std::string, std::string>> ops_;
+    KRCanvasDisplayList display_list_;
+    // 以下平台对象按显示列表中的资源下标懒创建，reset 时统一释放
+    std::vector<StyleEntry> stroke_styles_;
+    std::vector<StyleEntry> fill_styles_;
+    std::vector<OH_Drawing_PathEffect *> dash_effects_;
+    std::vector<PathEntry> path_runs_;
     std::unordered_set<std::string_view> cachable_methods_;
     TextFeature text_feature_;
 };
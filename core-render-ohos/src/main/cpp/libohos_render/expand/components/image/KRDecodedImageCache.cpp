@@ -0,0 +1,168 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/image/KRDecodedImageCache.h"
+
+#include <multimedia/image_framework/image/image_source_native.h>
+#include <multimedia/image_framework/image/pixelmap_native.h>
+
+#include "libohos_render/foundation/KRCacheBudgetCoordinator.h"
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// Remove this declaration if compatable api is raised to 18 and above
+extern Image_ErrorCode OH_PixelmapNative_Destroy(OH_PixelmapNative **pixelmap) __attribute__((weak));
+// Remove this declaration if compatable api is raised to 13 and above
+extern Image_ErrorCode OH_ImageSourceInfo_GetMimeType(OH_ImageSource_Info *info, Image_MimeType *mimetype)
+    __attribute__((weak));
+#ifdef __cplusplus
+};
+#endif
+
+// 解码图片缓存字节预算
+constexpr size_t kDecodedImageCacheBytes = 32 * 1024 * 1024;
+
+namespace {
+std::shared_ptr<OH_PixelmapNative> WrapPixelmap(OH_PixelmapNative *raw) {
+    return std::shared_ptr<OH_PixelmapNative>(raw, [](OH_PixelmapNative *pixelmap) {
+        if (OH_PixelmapNative_Destroy) {
+            OH_PixelmapNative_Destroy(&pixelmap);
+        } else {
+            OH_PixelmapNative_Release(pixelmap);
+        }
+    });
+}
+
+bool GetSourceInfo(OH_ImageSourceNative *source, uint32_t &width, uint32_t &height, uint32_t &frame_count,
+                   bool &is_vector) {
+    OH_ImageSource_Info *info = nullptr;
+    if (OH_ImageSource_Info_Create(&info) != IMAGE_SUCCESS) {
+        return false;
+    }
+    bool ok = OH_ImageSourceNative_GetImageInfo(source, 0, info) == IMAGE_SUCCESS &&
+              OH_ImageSource_Info_GetWidth(info, &width) == IMAGE_SUCCESS &&
+              OH_ImageSource_Info_GetHeight(info, &height) == IMAGE_SUCCESS;
+    Image_MimeType mime_type = {nullptr, 0};
+    if (ok && OH_ImageSourceInfo_GetMimeType &&
+        OH_ImageSourceInfo_GetMimeType(info, &mime_type) == IMAGE_SUCCESS && mime_type.data) {
+        // image/svg+xml
+        is_vector = std::string(mime_type.data, mime_type.size).find("svg") != std::string::npos;
+    }
+    OH_ImageSource_Info_Release(info);
+    if (OH_ImageSourceNative_GetFrameCount(source, &frame_count) != IMAGE_SUCCESS) {
+        frame_count = 1;
+    }
+    return ok;
+}
+
+bool GetPixelmapInfo(OH_PixelmapNative *pixelmap, uint32_t &width, uint32_t &height, uint32_t &row_stride) {
+    OH_Pixelmap_ImageInfo *info = nullptr;
+    if (OH_PixelmapImageInfo_Create(&info) != IMAGE_SUCCESS) {
+        return false;
+    }
+    bool ok = OH_PixelmapNative_GetImageInfo(pixelmap, info) == IMAGE_SUCCESS &&
+              OH_PixelmapImageInfo_GetWidth(info, &width) == IMAGE_SUCCESS &&
+              OH_PixelmapImageInfo_GetHeight(info, &height) == IMAGE_SUCCESS &&
+              OH_PixelmapImageInfo_GetRowStride(info, &row_stride) == IMAGE_SUCCESS;
+    OH_PixelmapImageInfo_Release(info);
+    return ok;
+}
+
+/**
+ * 解码 uri 指向的本地图片。指定目标尺寸时只处理静态位图（动图交由 ArkUI 播放，矢量图交由 ArkUI 按视图尺寸绘制），
+ * 并降采样到覆盖目标尺寸
+ */
+KRDecodedImageCache::ImagePtr DecodeFromUri(const std::string &uri, int32_t target_width, int32_t target_height,
+                                            int32_t pixel_format) {
+    bool downsample = target_width > 0 && target_height > 0;
+    if (downsample && KRDecodedImageCache::IsVectorImageUri(uri)) {
+        return nullptr;
+    }
+    std::string uri_copy = uri;
+    OH_ImageSourceNative *source = nullptr;
+    auto code = OH_ImageSourceNative_CreateFromUri(uri_copy.data(), uri_copy.length(), &source);
+    if (code != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "failed to create image source from uri: " << uri << ", error code: " << code;
+        return nullptr;
+    }
+    uint32_t source_width = 0;
+    uint32_t source_height = 0;
+    uint32_t frame_count = 1;
+    bool is_vector = false;
+    bool has_info = GetSourceInfo(source, source_width, source_height, frame_count, is_vector);
+    if (downsample && (!has_info || frame_count > 1 || is_vector)) {
+        OH_ImageSourceNative_Release(source);
+        return nullptr;
+    }
+
+    OH_PixelmapNative *pixelmap = nullptr;
+    OH_DecodingOptions *ops = nullptr;
+    if (OH_DecodingOptions_Create(&ops) == IMAGE_SUCCESS) {
+        if (pixel_format == KRDecodedImageCache::kPixelFormatAuto) {
+            // 设置为AUTO会根据图片资源格式解码，如果图片资源为HDR资源则会解码为HDR的pixelmap。
+            OH_DecodingOptions_SetDesiredDynamicRange(ops, IMAGE_DYNAMIC_RANGE_AUTO);
+        } else {
+            OH_DecodingOptions_SetPixelFormat(ops, pixel_format);
+        }
+        if (downsample) {
+            auto size = KRDecodedImageCache::ComputeDecodeSize(source_width, source_height, target_width,
+                                                               target_height);
+            if (size.width < static_cast<int32_t>(source_width)) {
+                Image_Size desired_size = {static_cast<uint32_t>(size.width), static_cast<uint32_t>(size.height)};
+                OH_DecodingOptions_SetDesiredSize(ops, &desired_size);
+            }
+        }
+        OH_ImageSourceNative_CreatePixelmap(source, ops, &pixelmap);
+        OH_DecodingOptions_Release(ops);
+    }
+    OH_ImageSourceNative_Release(source);
+    if (!pixelmap) {
+        return nullptr;
+    }
+
+    auto image = std::make_shared<KRDecodedImage>();
+    image->pixelmap = WrapPixelmap(pixelmap);
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t row_stride = 0;
+    if (GetPixelmapInfo(pixelmap, width, height, row_stride)) {
+        image->width = static_cast<int32_t>(width);
+        image->height = static_cast<int32_t>(height);
+        image->byte_count = static_cast<size_t>(row_stride) * height;
+    }
+    image->source_width = has_info ? static_cast<int32_t>(source_width) : image->width;
+    image->source_height = has_info ? static_cast<int32_t>(source_height) : image->height;
+    return image;
+}
+}  // namespace
+
+KRDecodedImageCache &KRDecodedImageCache::GetInstance() {
+    static auto *cache = new KRDecodedImageCache(
+        kDecodedImageCacheBytes, DecodeFromUri,
+        [](std::function<void()> task) {
+            auto &queue = kuikly::dispatch::KRExecutor::GetInstance().Global(kuikly::dispatch::QoS::Utility);
+            queue.Async(std::move(task));
+        },
+        [](std::function<void()> task) { KRMainThread::RunOnMainThread(std::move(task)); });
+    static auto budget_id = KRCacheBudgetCoordinator::GetInstance().Register(
+        "decoded_image", KRCacheBudgetCoordinator::kPriorityDecodedImage, [] { return cache->GetStats().bytes; },
+        [](size_t target_bytes) { cache->TrimToBytes(target_bytes); });
+    (void)budget_id;
+    return *cache;
+}
@@ -0,0 +1,213 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRDECODEDIMAGECACHE_H
+#define CORE_RENDER_OHOS_KRDECODEDIMAGECACHE_H
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "libohos_render/foundation/KRAssetCache.h"
+
+struct OH_PixelmapNative;
+
+/**
+ * 解码后的位图。pixelmap 由自定义 deleter 释放，持有期间即使被缓存淘汰也保持有效
+ */
+struct KRDecodedImage {
+    std::shared_ptr<OH_PixelmapNative> pixelmap;
+    int32_t width = 0;          // 解码尺寸 (px)
+    int32_t height = 0;
+    int32_t source_width = 0;   // 原图尺寸 (px)
+    int32_t source_height = 0;
+    size_t byte_count = 0;
+    std::string cache_key;      // 写入 KRDecodedImageCache 时的 key
+    bool passthrough = false;   // 动图或解码失败的占位条目，没有 pixelmap，由视图按 uri 交给 ArkUI 加载
+};
+
+/**
+ * 进程级解码图片缓存，key 为 (uri, 目标尺寸, 像素格式)。
+ * 按视图像素尺寸降采样解码，同 key 的并发解码合并为一次，按字节预算 LRU 淘汰。
+ * 目标尺寸为 0 时按原图尺寸解码（KRMemoryCacheModule 预加载使用）。
+ * Fetch 解码失败（含动图）时缓存一个 passthrough 占位条目，同 key 再次请求直接回调空，不重复解码。
+ */
+class KRDecodedImageCache {
+ public:
+    using ImagePtr = std::shared_ptr<KRDecodedImage>;
+    using Completion = std::function<void(ImagePtr)>;
+    using Executor = KRAssetCache<KRDecodedImage>::Executor;
+    using Stats = KRAssetCache<KRDecodedImage>::Stats;
+    /**
+     * 解码函数（在 load_executor 上执行），失败返回空
+     */
+    using Decoder = std::function<ImagePtr(const std::string &uri, int32_t target_width, int32_t target_height,
+                                           int32_t pixel_format)>;
+
+    static constexpr int32_t kPixelFormatAuto = 0;      // 解码器默认格式，HDR 资源自适应
+    static constexpr int32_t kPixelFormatRGBA8888 = 3;  // 与 PIXEL_FORMAT_RGBA_8888 一致
+
+    struct PixelSize {
+        int32_t width = 0;
+        int32_t height = 0;
+    };
+
+    static KRDecodedImageCache &GetInstance();
+
+    KRDecodedImageCache(size_t capacity_bytes, Decoder decoder, Executor load_executor, Executor callback_executor)
+        : decoder_(std::move(decoder)),
+          cache_(capacity_bytes, std::move(load_executor), std::move(callback_executor)) {}
+
+    KRDecodedImageCache(const KRDecodedImageCache &) = delete;
+    KRDecodedImageCache &operator=(const KRDecodedImageCache &) = delete;
+
+    /**
+     * 异步获取，命中时同步回调；动图或解码失败时回调空
+     * @return 请求 id，用于 Cancel；命中时返回 0
+     */
+    uint64_t Fetch(const std::string &uri, int32_t target_width, int32_t target_height, int32_t pixel_format,
+                   Completion completion) {
+        auto decoder = decoder_;
+        auto loader = [decoder, uri, target_width, target_height, pixel_format](
+                          const std::function<bool()> &cancelled, size_t &cost) -> ImagePtr {
+            if (cancelled()) {
+                return nullptr;
+            }
+            auto image = decoder(uri, target_width, target_height, pixel_format);
+            if (!image) {
+                image = std::make_shared<KRDecodedImage>();
+                image->passthrough = true;
+            }
+            image->cache_key = MakeCacheKey(uri, target_width, target_height, pixel_format);
+            cost = image->passthrough ? sizeof(KRDecodedImage) + image->cache_key.size() : image->byte_count;
+            return image;
+        };
+        return cache_.Fetch(MakeCacheKey(uri, target_width, target_height, pixel_format), std::move(loader),
+                            [completion = std::move(completion)](ImagePtr image) {
+                                completion(image && !image->passthrough ? std::move(image) : nullptr);
+                            });
+    }
+
+    void Cancel(uint64_t request_id) {
+        cache_.Cancel(request_id);
+    }
+
+    /**
+     * 在调用线程同步获取，未命中时直接解码并写入缓存。passthrough 条目视为未命中，失败结果不写入缓存
+     */
+    ImagePtr DecodeSync(const std::string &uri, int32_t target_width, int32_t target_height, int32_t pixel_format) {
+        auto key = MakeCacheKey(uri, target_width, target_height, pixel_format);
+        auto cached = cache_.Get(key);
+        if (cached && !cached->passthrough) {
+            return cached;
+        }
+        auto image = decoder_(uri, target_width, target_height, pixel_format);
+        if (image) {
+            image->cache_key = key;
+            cache_.Put(key, image, image->byte_count);
+        }
+        return image;
+    }
+
+    /**
+     * image 是否仍在缓存中（计入本缓存的字节数）。已被淘汰但仍被外部持有的位图由持有者自行统计
+     */
+    bool IsCached(const ImagePtr &image) {
+        return image && cache_.Contains(image->cache_key, image);
+    }
+
+    void SetCapacityBytes(size_t capacity_bytes) {
+        cache_.SetCapacityBytes(capacity_bytes);
+    }
+
+    void Clear() {
+        cache_.Clear();
+    }
+
+    void TrimToBytes(size_t target_bytes) {
+        cache_.TrimToBytes(target_bytes);
+    }
+
+    Stats GetStats() {
+        return cache_.GetStats();
+    }
+
+    static std::string MakeCacheKey(const std::string &uri, int32_t target_width, int32_t target_height,
+                                    int32_t pixel_format) {
+        std::string key;
+        key.reserve(uri.size() + 24);
+        key.append(std::to_string(target_width)).append("x").append(std::to_string(target_height));
+        key.append("@").append(std::to_string(pixel_format)).append("|").append(uri);
+        return key;
+    }
+
+    /**
+     * uri 是否指向矢量图（svg）。矢量图按位图解码后放大会模糊，应交由 ArkUI 按 uri 渲染；忽略 query/fragment 与大小写
+     */
+    static bool IsVectorImageUri(const std::string &uri) {
+        static constexpr char kSvgSuffix[] = ".svg";
+        constexpr size_t kSuffixLength = sizeof(kSvgSuffix) - 1;
+        auto end = uri.find_first_of("?#");
+        if (end == std::string::npos) {
+            end = uri.size();
+        }
+        if (end < kSuffixLength) {
+            return false;
+        }
+        for (size_t i = 0; i < kSuffixLength; ++i) {
+            if (std::tolower(static_cast<unsigned char>(uri[end - kSuffixLength + i])) != kSvgSuffix[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * 视图尺寸 (vp) 转目标像素尺寸
+     */
+    static int32_t ToPixelSize(double vp, double dpi) {
+        return vp > 0 ? static_cast<int32_t>(std::ceil(vp * dpi - 1e-6)) : 0;
+    }
+
+    /**
+     * 按目标尺寸计算解码尺寸：等比缩放到恰好覆盖目标区域（cover/contain/stretch 均不损失清晰度），不放大
+     */
+    static PixelSize ComputeDecodeSize(int32_t source_width, int32_t source_height, int32_t target_width,
+                                       int32_t target_height) {
+        PixelSize size{source_width, source_height};
+        if (source_width <= 0 || source_height <= 0 || target_width <= 0 || target_height <= 0) {
+            return size;
+        }
+        double scale = std::max(static_cast<double>(target_width) / source_width,
+                                static_cast<double>(target_height) / source_height);
+        if (scale >= 1.0) {
+            return size;
+        }
+        size.width = std::max(1, static_cast<int32_t>(std::ceil(source_width * scale - 1e-6)));
+        size.height = std::max(1, static_cast<int32_t>(std::ceil(source_height * scale - 1e-6)));
+        return size;
+    }
+
+ private:
+    Decoder decoder_;
+    KRAssetCache<KRDecodedImage> cache_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRDECODEDIMAGECACHE_H
@@ -22,6 +22,7 @@
 #include "libohos_render/api/src/KRAnyDataInternal.h"
 #include "libohos_render/expand/components/image/KRImageAdapterManager.h"
 #include "libohos_render/expand/modules/cache/KRMemoryCacheModule.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/manager/KRRenderManager.h"
 #include "libohos_render/manager/KRSnapshotManager.h"
 #include "libohos_render/utils/KRThreadChecker.h"
@@ -98,6 +99,7 @@ bool KRImageView::ReuseEnable() {
 
 void KRImageView::OnDestroy() {
     ResetMaskLinearGradientNode();
+    ResetDecodedImage();
 }
 
 bool KRImageView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
@@ -140,6 +142,7 @@ bool KRImageView::ResetProp(const std::string &prop_key) {
         has_loaded_image_ = false;
         loaded_image_size_ = {};
         kuikly::util::ResetArkUIImageSrc(GetNode());
+        ResetDecodedImage();
         didHanded = true;
     } else if (kuikly::util::isEqual(prop_key, kPropNameResize)) {
         SetResizeMode(NewKRRenderValue(kResizeModeCover));
@@ -154,6 +157,7 @@ bool KRImageView::ResetProp(const std::string &prop_key) {
         didHanded = ResetColorFilter();
     } else if (kuikly::util::isEqual(prop_key, kPropNameCapInsets)) {
         kuikly::util::ResetArkUIImageCapInsets(GetNode());
+        has_cap_insets_ = false;
         didHanded = true;
     } else if (kuikly::util::isEqual(prop_key, kPropNameDotNineImage)) {
         this->is_dot_nine_image_ = false;
@@ -223,6 +227,7 @@ bool KRImageView::SetImageSrc(const KRAnyValue &value) {
     }
 
     kuikly::util::ResetArkUIImageSrc(GetNode());
+    ResetDecodedImage();
     image_src_ = src;
     has_loaded_image_ = false;
     loaded_image_size_ = {};
@@ -397,10 +402,14 @@ bool KRImageView::SetCapInsets(const KRAnyValue &value) {
     auto valueStr = value->toString();
     if (valueStr.empty()) {
         kuikly::util::ResetArkUIImageCapInsets(GetNode());
+        has_cap_insets_ = false;
         return true;
     }
     std::vector<std::string> items = kuikly::util::ConvertSplit(valueStr, " ");
     if (items.size() >= 4) {
+        // capInsets 以原图像素为单位，不能作用在降采样后的图片上
+        has_cap_insets_ = true;
+        FallbackToLocalImageUri();
         double dpi = KRConfig::GetDpi();
         float top = std::stof(items[0]) / dpi;
         float left = std::stof(items[1]) / dpi;
@@ -415,6 +424,7 @@ bool KRImageView::SetDotNineImage(const KRAnyValue &value) {
     this->is_dot_nine_image_ = value->toBool();
     if (this->is_dot_nine_image_) {
         EnsureLoadCompleteEventRegistered();
+        FallbackToLocalImageUri();
     }
     return true;
 }
@@ -473,7 +483,12 @@ void KRImageView::FireOnImageCompleteEvent(ArkUI_NodeEvent *event) {
         return;
     }
 
-    loaded_image_size_ = kuikly::util::GetArkUINodeImagePicSize(event);
+    if (decoded_image_) {
+        // 降采样解码时仍回调原图尺寸
+        loaded_image_size_ = KRSize(decoded_image_->source_width, decoded_image_->source_height);
+    } else {
+        loaded_image_size_ = kuikly::util::GetArkUINodeImagePicSize(event);
+    }
     has_loaded_image_ = true;
 
     if (this->is_dot_nine_image_) {
@@ -562,7 +577,7 @@ void KRImageView::LoadFromBase64(const std::shared_ptr<KRImageLoadOption> image_
 }
 
 void KRImageView::LoadFromFile(const std::shared_ptr<KRImageLoadOption> image_option) {
-    kuikly::util::SetArkUIImageSrc(GetNode(), image_option->src_);
+    LoadLocalImage(image_option->src_);
 }
 
 void KRImageView::LoadFromNetwork(const std::shared_ptr<KRImageLoadOption> image_option) {
@@ -600,8 +615,126 @@ void KRImageView::LoadFromAssets(const std::shared_ptr<KRImageLoadOption> image_
         if (!assetsDir.empty()) {
             std::string uri =
                 KRURIHelper::GetInstance()->URIForResFile(image_src_.substr(KR_ASSET_PREFIX.size()), assetsDir);
-            kuikly::util::SetArkUIImageSrc(GetNode(), uri);
+            LoadLocalImage(uri);
             return;
         }
     }
 }
+
+void KRImageView::SetRenderViewFrame(const KRRect &frame) {
+    view_size_ = KRSize(frame.width, frame.height);
+    if (!decoded_image_ || decode_request_id_) {
+        return;
+    }
+    // 视图变大后按新尺寸重新解码，避免降采样后的图片被放大模糊
+    auto dpi = KRConfig::GetDpi();
+    auto size = KRDecodedImageCache::ComputeDecodeSize(decoded_image_->source_width, decoded_image_->source_height,
+                                                       KRDecodedImageCache::ToPixelSize(view_size_.width, dpi),
+                                                       KRDecodedImageCache::ToPixelSize(view_size_.height, dpi));
+    if (size.width > decoded_image_->width || size.height > decoded_image_->height) {
+        FetchDecodedImage();
+    }
+}
+
+bool KRImageView::DecodedImageEnable() const {
+    // 矢量图按位图解码后会模糊，与动图一样交由 ArkUI 按 uri 加载
+    return !is_dot_nine_image_ && !has_cap_insets_ && !KRDecodedImageCache::IsVectorImageUri(local_image_uri_);
+}
+
+void KRImageView::LoadLocalImage(const std::string &uri) {
+    CancelDecodeRequest();
+    if (uri != local_image_uri_) {
+        decoded_image_ = nullptr;  // 旧图的 drawable 保留到新图设置后再释放
+    }
+    local_image_uri_ = uri;
+    if (!DecodedImageEnable()) {
+        ShowLocalImageUri();
+        return;
+    }
+    if (view_size_.width > 0 && view_size_.height > 0) {
+        FetchDecodedImage();
+        return;
+    }
+    // 首次创建时 src 先于 frame 下发，等本轮属性设置完成、拿到视图尺寸后再解码
+    KRMainThread::RunOnMainThread([weak_self = weak_from_this(), uri] {
+        auto self = std::dynamic_pointer_cast<KRImageView>(weak_self.lock());
+        if (!self || self->local_image_uri_ != uri || self->decoded_image_ || self->decode_request_id_) {
+            return;
+        }
+        self->FetchDecodedImage();
+    });
+}
+
+void KRImageView::FetchDecodedImage() {
+    auto dpi = KRConfig::GetDpi();
+    auto target_width = KRDecodedImageCache::ToPixelSize(view_size_.width, dpi);
+    auto target_height = KRDecodedImageCache::ToPixelSize(view_size_.height, dpi);
+    if (target_width <= 0 || target_height <= 0 || !DecodedImageEnable()) {
+        ShowLocalImageUri();
+        return;
+    }
+    CancelDecodeRequest();
+    auto uri = local_image_uri_;
+    // 命中缓存时同步回调并返回 0；像素格式与 ArkUI 按 uri 加载时一致，HDR 资源仍解码为 HDR
+    decode_request_id_ = KRDecodedImageCache::GetInstance().Fetch(
+        uri, target_width, target_height, KRDecodedImageCache::kPixelFormatAuto,
+        [weak_self = weak_from_this(), uri](KRDecodedImageCache::ImagePtr image) {
+            auto self = std::dynamic_pointer_cast<KRImageView>(weak_self.lock());
+            if (!self || self->local_image_uri_ != uri) {
+                return;
+            }
+            self->decode_request_id_ = 0;
+            if (image) {
+                self->SetDecodedImage(image);
+            } else if (!self->decoded_image_) {
+                // 动图或解码失败（缓存中为 passthrough 条目，再次绑定不会重复解码），交由 ArkUI 按 uri 加载
+                self->ShowLocalImageUri();
+            }
+        });
+}
+
+void KRImageView::SetDecodedImage(const KRDecodedImageCache::ImagePtr &image) {
+    if (decoded_image_ == image) {
+        return;
+    }
+    auto drawable = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(image->pixelmap.get());
+    kuikly::util::SetArkUIImageSrc(GetNode(), drawable);
+    if (decoded_drawable_) {
+        OH_ArkUI_DrawableDescriptor_Dispose(decoded_drawable_);
+    }
+    decoded_drawable_ = drawable;
+    decoded_image_ = image;
+}
+
+void KRImageView::ShowLocalImageUri() {
+    kuikly::util::SetArkUIImageSrc(GetNode(), local_image_uri_);
+    if (decoded_drawable_) {
+        OH_ArkUI_DrawableDescriptor_Dispose(decoded_drawable_);
+        decoded_drawable_ = nullptr;
+    }
+    decoded_image_ = nullptr;
+}
+
+void KRImageView::FallbackToLocalImageUri() {
+    if (!local_image_uri_.empty() && (decoded_image_ || decode_request_id_)) {
+        CancelDecodeRequest();
+        ShowLocalImageUri();
+    }
+}
+
+void KRImageView::CancelDecodeRequest() {
+    if (decode_request_id_) {
+        KRDecodedImageCache::GetInstance().Cancel(decode_request_id_);
+        decode_request_id_ = 0;
+    }
+}
+
+void KRImageView::ResetDecodedImage() {
+    CancelDecodeRequest();
+    if (decoded_drawable_) {
+        OH_ArkUI_DrawableDescriptor_Dispose(decoded_drawable_);
+        decoded_drawable_ = nullptr;
+    }
+    decoded_image_ = nullptr;
+    local_image_uri_.clear();
+}
@@ -16,6 +16,7 @@
 #ifndef CORE_RENDER_OHOS_KRIMAGEVIEW_H
 #define CORE_RENDER_OHOS_KRIMAGEVIEW_H
 
+#include "libohos_render/expand/components/image/KRDecodedImageCache.h"
 #include "libohos_render/expand/components/image/KRImageLoadOption.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
 #include "libohos_render/foundation/KRSize.h"
@@ -38,6 +39,7 @@ class KRImageView : public IKRRenderViewExport {
                  const KRRenderCallback event_call_back = nullptr) override;
     bool ResetProp(const std::string &prop_key) override;
     void OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_type) override;
+    void SetRenderViewFrame(const KRRect &frame) override;
     void OnDestroy() override;
 
  private:
@@ -66,6 +68,14 @@ class KRImageView : public IKRRenderViewExport {
     void LoadFromFile(const std::shared_ptr<KRImageLoadOption> image_option);
     void LoadFromResourceMedia(const std::shared_ptr<KRImageLoadOption> image_option);
     void LoadFromAssets(const std::shared_ptr<KRImageLoadOption> image_option);
+    void LoadLocalImage(const std::string &uri);
+    void FetchDecodedImage();
+    void SetDecodedImage(const KRDecodedImageCache::ImagePtr &image);
+    void ShowLocalImageUri();
+    void FallbackToLocalImageUri();
+    void CancelDecodeRequest();
+    void ResetDecodedImage();
+    bool DecodedImageEnable() const;
 
  private:
     std::string image_src_;
@@ -78,8 +88,15 @@ class KRImageView : public IKRRenderViewExport {
     bool had_register_on_complete_event_ = false;
     bool had_register_on_error_event_ = false;
     bool is_dot_nine_image_ = false;
+    bool has_cap_insets_ = false;
     ArkUI_NodeHandle mask_linear_gradient_node_ = nullptr;
     KRAnyValue image_params_ = nullptr;
+    // 本地图片（file/assets）按视图像素尺寸解码并进程级缓存，见 KRDecodedImageCache
+    KRSize view_size_;
+    std::string local_image_uri_;
+    KRDecodedImageCache::ImagePtr decoded_image_ = nullptr;
+    ArkUI_DrawableDescriptor *decoded_drawable_ = nullptr;
+    uint64_t decode_request_id_ = 0;
     
     static void AdapterSetImageCallback(const void* context,
                                    const char *src,
@@ -26,6 +26,13 @@ void KRImageViewWrapper::DidInit() {
     InitImageView(image_view_);
 }
 
+void KRImageViewWrapper::DidAdopt() {
+    IKRRenderViewExport::DidAdopt();
+    // 内部图片视图不经过复用池，随外层 view 换绑到新页面
+    place_holder_image_view_->RebindRootView(GetRootView(), GetInstanceId());
+    image_view_->RebindRootView(GetRootView(), GetInstanceId());
+}
+
 void KRImageViewWrapper::InitImageView(std::shared_ptr<KRImageView> image_view) {
     image_view->SetRootView(GetRootView(), GetInstanceId());
     image_view->SetViewName(GetViewName());
@@ -83,4 +90,7 @@ void KRImageViewWrapper::SetRenderViewFrame(const KRRect &frame) {
     IKRRenderViewExport::SetRenderViewFrame(frame);
     kuikly::util::UpdateNodeFrame(image_view_->GetNode(), KRRect(0, 0, frame.width, frame.height));
     kuikly::util::UpdateNodeFrame(place_holder_image_view_->GetNode(), KRRect(0, 0, frame.width, frame.height));
+    // 内部图片视图按该尺寸解码本地图片
+    image_view_->SetRenderViewFrame(KRRect(0, 0, frame.width, frame.height));
+    place_holder_image_view_->SetRenderViewFrame(KRRect(0, 0, frame.width, frame.height));
 }
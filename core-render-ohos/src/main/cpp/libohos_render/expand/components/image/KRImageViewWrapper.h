@@ -29,6 +29,7 @@ class KRImageViewWrapper : public IKRRenderViewExport {
     bool ReuseEnable() override;
     void DidMoveToParentView() override;
     void DidInit() override;
+    void DidAdopt() override;
     void SetRenderViewFrame(const KRRect &frame) override;
     bool SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                  const KRRenderCallback event_call_back = nullptr) override;
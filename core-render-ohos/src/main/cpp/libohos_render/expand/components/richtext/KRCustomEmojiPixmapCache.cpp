@@ -19,6 +19,7 @@
 
 #include <utility>
 
+#include "libohos_render/foundation/KRCacheBudgetCoordinator.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 
@@ -47,14 +48,19 @@ KRCustomEmojiPixmapCache::KRCustomEmojiPixmapCache()
     : decode_queue_(std::make_unique<kuikly::dispatch::KRDispatchQueue>(
           "kr.emoji.pixmap.decode",
           kuikly::dispatch::QueueType::Serial,
-          kuikly::dispatch::QoS::Utility)) {}
+          kuikly::dispatch::QoS::Utility)) {
+    budget_id_ = KRCacheBudgetCoordinator::GetInstance().Register(
+        "emoji_pixmap", KRCacheBudgetCoordinator::kPriorityEmojiPixmap, [this] { return GetBytes(); },
+        [this](size_t target_bytes) { TrimToBytes(target_bytes); });
+}
 
 KRCustomEmojiPixmapCache::~KRCustomEmojiPixmapCache() {
     // 进程级单例理论上不会析构（与 KRFontCollectionWrapper 同），但提供清理逻辑保险。
-    // decode_queue_ 是 unique_ptr<KRDispatchQueue>：reset() 触发 ffrt_queue_destroy，
-    // 已经在跑的解码 task 会跑完，未执行的 task 被 cancel 并通过 TaskCleanup 释放。
+    // decode_queue_ 是 unique_ptr<KRDispatchQueue>：reset() 关闭队列，
+    // 已经在跑的解码 task 会跑完，未执行的 task 被 cancel 并释放。
     // 释放顺序：先停队列、再清缓存——避免极端竞态下"队列里的 task 在 Clear 之后又
     // 写回 cache_"。
+    KRCacheBudgetCoordinator::GetInstance().Unregister(budget_id_);
     decode_queue_.reset();
     Clear();
 }
@@ -116,14 +122,14 @@ void KRCustomEmojiPixmapCache::Prefetch(const std::string &uri, LoadedCallback o
     }
 
     // 把解码作业提交给 KRDispatchQueue (serial)。等价于 GCD dispatch_async，
-    // 底层是 ffrt_queue_serial：所有任务严格 FIFO，由 ffrt 全局 worker 池按需
+    // 串行队列：所有任务严格 FIFO，由 KRExecutor 的共享后端按需
     // 调度执行——不再独占任何 OS 线程。decode_queue_ 在构造时创建；提交本身
     // （Async）在 KRDispatchQueue 内部已是线程安全，因此可在锁外调用，缩短临界区。
     decode_queue_->Async([uri]() {
-        // ---- 在 ffrt worker 上下文中解码 ----
+        // ---- 在执行器 worker 上下文中解码 ----
         // 关键：DecodeFromUri 已经把裸指针包成 shared_ptr 返回，捕获到主线程 lambda
         // 的整个传递路径中**不再有任何裸 OH_PixelmapNative***——任意中间环节抛异常 /
-        // 提前 return，shared_ptr 都会自动释放。KRDispatchQueue::TaskExecutor 已经
+        // 提前 return，shared_ptr 都会自动释放。KRDispatchQueue::RunItem 已经
         // 包了 try-catch 兜底，本 lambda 无需再额外捕获。
         PixmapPtr pm = DecodeFromUri(uri);
 
@@ -139,6 +145,7 @@ void KRCustomEmojiPixmapCache::Prefetch(const std::string &uri, LoadedCallback o
                     self.waiters_.erase(wit);
                 }
                 if (pm) {
+                    size_t pm_bytes = PixmapBytes(pm.get());
                     // 写入缓存（极端竞争：另一路径已塞过同 key，覆盖前先释放老的，
                     // 保证幂等）。shared_ptr 赋值会自动 release 旧的强引用——若此时
                     // 旧 pixmap 还有其它 caller 持有，底层资源会延迟到那份引用析构
@@ -148,13 +155,17 @@ void KRCustomEmojiPixmapCache::Prefetch(const std::string &uri, LoadedCallback o
                         // 复用 lru 节点：先移到头部
                         self.lru_.erase(cit->second.lru_it);
                         self.lru_.push_front(uri);
+                        self.bytes_ = self.bytes_ - cit->second.bytes + pm_bytes;
                         cit->second.pixmap = pm;
                         cit->second.lru_it = self.lru_.begin();
+                        cit->second.bytes = pm_bytes;
                     } else {
                         self.lru_.push_front(uri);
                         Entry e;
                         e.pixmap = pm;
                         e.lru_it = self.lru_.begin();
+                        e.bytes = pm_bytes;
+                        self.bytes_ += pm_bytes;
                         self.cache_.emplace(uri, std::move(e));
                     }
                     self.TrimLocked();
@@ -182,6 +193,7 @@ void KRCustomEmojiPixmapCache::Evict(const std::string &uri) {
         return;
     }
     lru_.erase(it->second.lru_it);
+    bytes_ -= it->second.bytes;
     cache_.erase(it);  // 此处释放 cache 这一份强引用；caller 仍持有的引用不受影响。
 }
 
@@ -189,9 +201,20 @@ void KRCustomEmojiPixmapCache::Clear() {
     std::lock_guard<std::mutex> lk(mu_);
     cache_.clear();  // shared_ptr 析构链自动 Release 那些没有外部引用的 pixmap。
     lru_.clear();
+    bytes_ = 0;
     // waiters_ 不清理：飞行中的解码完成后会发现 cache_ 没自己，自然结束（不会泄漏）。
 }
 
+void KRCustomEmojiPixmapCache::TrimToBytes(size_t target_bytes) {
+    std::lock_guard<std::mutex> lk(mu_);
+    EvictToBytesLocked(target_bytes);
+}
+
+size_t KRCustomEmojiPixmapCache::GetBytes() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return bytes_;
+}
+
 void KRCustomEmojiPixmapCache::TouchLocked(const std::string &uri) {
     auto it = cache_.find(uri);
     if (it == cache_.end()) {
@@ -207,12 +230,41 @@ void KRCustomEmojiPixmapCache::TrimLocked() {
         const std::string &oldest = lru_.back();
         auto it = cache_.find(oldest);
         if (it != cache_.end()) {
+            bytes_ -= it->second.bytes;
             cache_.erase(it);  // 释放 cache 这一份强引用；caller 持有的引用仍保活底层 pixmap。
         }
         lru_.pop_back();
     }
 }
 
+void KRCustomEmojiPixmapCache::EvictToBytesLocked(size_t target_bytes) {
+    while (bytes_ > target_bytes && !lru_.empty()) {
+        auto it = cache_.find(lru_.back());
+        if (it != cache_.end()) {
+            bytes_ -= it->second.bytes;
+            cache_.erase(it);
+        }
+        lru_.pop_back();
+    }
+}
+
+size_t KRCustomEmojiPixmapCache::PixmapBytes(OH_PixelmapNative *pixmap) {
+    OH_Pixelmap_ImageInfo *info = nullptr;
+    if (!pixmap || OH_PixelmapImageInfo_Create(&info) != IMAGE_SUCCESS) {
+        return 0;
+    }
+    uint32_t height = 0;
+    uint32_t row_stride = 0;
+    size_t bytes = 0;
+    if (OH_PixelmapNative_GetImageInfo(pixmap, info) == IMAGE_SUCCESS &&
+        OH_PixelmapImageInfo_GetHeight(info, &height) == IMAGE_SUCCESS &&
+        OH_PixelmapImageInfo_GetRowStride(info, &row_stride) == IMAGE_SUCCESS) {
+        bytes = static_cast<size_t>(row_stride) * height;
+    }
+    OH_PixelmapImageInfo_Release(info);
+    return bytes;
+}
+
 KRCustomEmojiPixmapCache::PixmapPtr KRCustomEmojiPixmapCache::DecodeFromUri(const std::string &uri) {
     if (uri.empty()) return {};
     OH_PixelmapNative *pixelmap = nullptr;
@@ -27,7 +27,7 @@
 #include <unordered_set>
 #include <vector>
 
-#include "libohos_render/foundation/ffrt/KRDispatchQueue.h"
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
 
 /**
  * 自定义表情 pixmap 进程级缓存（专用于 PostProcessor 拆段产生的 image span）。
@@ -37,13 +37,15 @@
  *    与 KRFontCollectionWrapper::GetInstance() 同范式。
  * 2) LRU 容量上限 128：emoji 数量上限可控，超出按最久未访问淘汰；淘汰时同步释放
  *    OH_PixelmapNative。
+ * 2.1) 同时按字节统计占用并注册到 KRCacheBudgetCoordinator，全局预算超限或内存压力时
+ *    由协调器按 LRU 顺序裁剪。
  * 3) 异步去重：同一个 uri 多个 caller 同时 Prefetch 时，只发起一次解码，其它
  *    caller 加入 waiters_ 队列；解码完成后一次性回调全部 waiters。
- * 3.1) 解码串行化经由 KRDispatchQueue（基于 OHOS libffrt 的 ffrt_queue_serial）。
+ * 3.1) 解码串行化经由 KRDispatchQueue（运行在 KRExecutor 上的串行队列）。
  *    替代了原本"每个未缓存 uri 都 std::thread(...).detach()"模式——后者在富文本
  *    50 个 emoji 同屏时会瞬间起 50 个线程（栈内存 + 切换 + UB 退出风险）。
- *    KRDispatchQueue 不持有独占 OS 线程：底层 ffrt 调度复用全局 worker 池，idle
- *    时零线程占用；密集时由 ffrt 决定何时拉起 worker。串行语义保证了同一时刻
+ *    KRDispatchQueue 不持有独占 OS 线程：作业投递到 KRExecutor 的共享后端，idle
+ *    时零线程占用；密集时由后端决定何时拉起 worker。串行语义保证了同一时刻
  *    最多一条解码在跑，与"图像 IO-bound + SDK 内部互斥"特性匹配。
  * 4) 接口最小化：Get（命中即返回 PixmapPtr 强引用句柄）、Prefetch（异步预解码 +
  *    回调）、Evict（暴露给 trim memory 场景）。底层 OH_PixelmapNative_Release 由
@@ -111,6 +113,16 @@ class KRCustomEmojiPixmapCache {
      */
     void Clear();
 
+    /**
+     * 从最久未访问的条目开始释放，直到缓存持有的 pixmap 字节数不超过 target_bytes（内存压力裁剪）。
+     */
+    void TrimToBytes(size_t target_bytes);
+
+    /**
+     * 缓存持有的 pixmap 字节数（按行跨度 × 高度计算）。
+     */
+    size_t GetBytes();
+
  private:
     KRCustomEmojiPixmapCache();
     ~KRCustomEmojiPixmapCache();
@@ -125,10 +137,12 @@ class KRCustomEmojiPixmapCache {
      * 路径中失控。
      */
     static PixmapPtr DecodeFromUri(const std::string &uri);
+    static size_t PixmapBytes(OH_PixelmapNative *pixmap);
 
     // 调用方必须持锁。LRU：按访问 / 写入提到 list 头部；淘汰从 list 末尾开始。
     void TouchLocked(const std::string &uri);
     void TrimLocked();
+    void EvictToBytesLocked(size_t target_bytes);
 
     static constexpr size_t kCapacity = 128;
 
@@ -141,20 +155,23 @@ class KRCustomEmojiPixmapCache {
         // 任一路径先释放都不会导致另一路径访问到野指针。
         PixmapPtr pixmap;
         std::list<std::string>::iterator lru_it;
+        size_t bytes = 0;
     };
     std::unordered_map<std::string, Entry> cache_;
+    size_t bytes_ = 0;
+    uint64_t budget_id_ = 0;
     // 飞行中：uri -> 等待回调列表。
     std::unordered_map<std::string, std::vector<LoadedCallback>> waiters_;
 
     // ---- 解码串行化：基于 KRDispatchQueue（P2-2 第二次重构）----
     //
     // 设计要点：
-    //   * 用 ffrt 的 serial queue 替代手写 "std::thread + condvar + queue" worker：
-    //     - 不再独占 OS 线程：idle 时零内存 / 零调度成本；ffrt 内部按需拉起 worker；
-    //     - 不需要 stop / join 协议：析构 KRDispatchQueue 即触发 ffrt_queue_destroy，
-    //       已在跑的任务跑完，未执行的任务被 cancel 并通过 TaskCleanup 释放堆 task；
-    //     - QoS 标记为 Utility（图片解码 = 用户感知但不阻塞主交互），让 ffrt 调度
-    //       器在主线程繁忙时把解码挪后；
+    //   * 用 KRExecutor 上的 serial queue 替代手写 "std::thread + condvar + queue" worker：
+    //     - 不再独占 OS 线程：idle 时零内存 / 零调度成本；后端按需拉起 worker；
+    //     - 不需要 stop / join 协议：析构 KRDispatchQueue 即关闭队列，
+    //       已在跑的任务跑完，未执行的任务被 cancel 并在队列内释放；
+    //     - QoS 标记为 Utility（图片解码 = 用户感知但不阻塞主交互），后端在
+    //       高 QoS 作业繁忙时把解码挪后；
     //   * 构造时创建：KRDispatchQueue 不独占 OS 线程，idle 时不消耗 worker；提前创建
     //     可避免每次新 uri 解码提交前额外获取 mu_ 做懒初始化检查。
     std::unique_ptr<kuikly::dispatch::KRDispatchQueue> decode_queue_;
@@ -387,7 +387,7 @@ ArkUI_StyledString *KRParagraph::BuildStyledString(float width, float height) {
 
     // add text spans
     std::for_each(spans_.begin(), spans_.end(),
-                  [this, styled_string](auto span) { AddSpanToStyledString(span->toMap(), styled_string); });
+                  [this, styled_string](auto span) { AddSpanToStyledString(span->toMapRef(), styled_string); });
 
     // clean up
     OH_Drawing_DestroyTypographyStyle(typography_style);
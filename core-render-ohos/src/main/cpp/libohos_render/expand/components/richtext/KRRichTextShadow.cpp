@@ -28,6 +28,8 @@
 #include <multimedia/image_framework/image/image_source_native.h>
 #include <multimedia/image_framework/image/pixelmap_native.h>
 
+#include <algorithm>
+#include <atomic>
 #include <codecvt>
 #include <thread>
 #include <unordered_set>
@@ -36,6 +38,8 @@
 #include "libohos_render/expand/components/richtext/KRCustomEmojiPixmapCache.h"
 #include "libohos_render/expand/components/richtext/KRParagraph.h"
 #include "libohos_render/expand/components/richtext/KRRichTextShadow.h"
+#include "libohos_render/foundation/KRCacheBudgetCoordinator.h"
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/utils/KRConvertUtil.h"
 #include "libohos_render/utils/KRLinearGradientParser.h"
@@ -68,6 +72,27 @@ template <class Facet> struct deletable_facet : Facet {
 };
 
 constexpr char kRawFilePrefix[] = "rawfile:";
+// 测量缓存字节预算，typography 内存不可查询，按文本长度估算
+constexpr size_t kMeasureCacheCapacityBytes = 4 * 1024 * 1024;
+constexpr size_t kMeasureCacheEntryBaseCost = 1024;
+constexpr size_t kMeasureCacheTypographyCostPerByte = 32;
+
+struct RootViewThreadingDispatcher {
+    RootViewThreadingDispatcher(std::shared_ptr<IKRRenderView> r) : rootView_(r) {
+        // blank
+    }
+    ~RootViewThreadingDispatcher() {
+        if (auto theRootView = rootView_) {
+            //
+            // We need to dispatch it back to main thread to avoid destructing it on context thread,
+            // in case `rootView` variable is the last holding onto the root render view.
+            //
+            KRMainThread::RunOnMainThread([theRootView] { theRootView.get(); });
+        }
+    }
+
+    std::shared_ptr<IKRRenderView> rootView_;
+};
 
 static bool isRawFilePath(const std::string &src) {
     return src.find(kRawFilePrefix) == 0;
@@ -96,6 +121,8 @@ KRRichTextShadow::~KRRichTextShadow() {
  * @param prop_value 属性数据
  */
 void KRRichTextShadow::SetProp(const std::string &prop_key, const KRAnyValue &prop_value) {
+    JoinSpeculativeLayout();
+    speculative_size_valid_ = false;
     if (prop_key == "values") {
         values_ = prop_value->toArray();
         return;
@@ -110,6 +137,7 @@ void KRRichTextShadow::SetProp(const std::string &prop_key, const KRAnyValue &pr
  * @return
  */
 KRAnyValue KRRichTextShadow::Call(const std::string &method_name, const std::string &params) {
+    JoinSpeculativeLayout();
     if (kuikly::util::isEqual(method_name, "spanRect")) {  // 调用获取placeholder span位置方法
         return SpanRect(NewKRRenderValue(params)->toInt());
     } else if(method_name == "isLineBreakMargin"){
@@ -125,6 +153,63 @@ KRAnyValue KRRichTextShadow::Call(const std::string &method_name, const std::str
  * @return
  */
 KRSize KRRichTextShadow::CalculateRenderViewSize(double constraint_width, double constraint_height) {
+    JoinSpeculativeLayout();
+    if (speculative_size_valid_) {
+        speculative_size_valid_ = false;
+        if (constraint_width == speculative_constraint_width_ && constraint_height == speculative_constraint_height_) {
+            return speculative_size_;
+        }
+    }
+    return MeasureRenderViewSize(constraint_width, constraint_height);
+}
+
+// 预测性文本布局线程池（并发队列，复用 KRExecutor 后端）
+static kuikly::dispatch::KRDispatchQueue &SpeculativeLayoutQueue() {
+    static auto *gSpeculativeLayoutQueue = new kuikly::dispatch::KRDispatchQueue(
+        "kr.text.layout", kuikly::dispatch::QueueType::Concurrent, kuikly::dispatch::QoS::UserInitiated);
+    return *gSpeculativeLayoutQueue;
+}
+
+void KRRichTextShadow::StartSpeculativeLayout(double constraint_width, double constraint_height) {
+    JoinSpeculativeLayout();
+    // V2 styled string 路径与业务 PostProcessor 回调不保证可在多线程并发执行，只在 context 线程测量
+    if (!MeasureCacheEnabled() || StyledStringEnabled() || props_.count("textPostProcessor")) {
+        return;
+    }
+    if (has_last_constraint_) {
+        // 属性更新后的重新测量通常沿用上次的约束
+        constraint_width = last_constraint_width_;
+        constraint_height = last_constraint_height_;
+    }
+    speculative_size_valid_ = false;
+    speculative_constraint_width_ = constraint_width;
+    speculative_constraint_height_ = constraint_height;
+    std::weak_ptr<IKRRenderShadowExport> weak_self = shared_from_this();
+    auto task = std::make_shared<KRSpeculativeTask>([weak_self, constraint_width, constraint_height] {
+        // shadow 已被移除时放弃；持有强引用期间 shadow 不会在 context 线程析构
+        if (auto strong_self = weak_self.lock()) {
+            auto *self = static_cast<KRRichTextShadow *>(strong_self.get());
+            self->speculative_size_ = self->MeasureRenderViewSize(constraint_width, constraint_height);
+            self->speculative_size_valid_ = true;
+        }
+    });
+    speculative_layout_ = task;
+    SpeculativeLayoutQueue().Async([task] { task->Run(); });
+}
+
+void KRRichTextShadow::JoinSpeculativeLayout() {
+    if (speculative_layout_ == nullptr) {
+        return;
+    }
+    // 尚未开始时直接取消（随后由 context 线程同步测量），不等待排队中的任务
+    auto task = std::move(speculative_layout_);
+    task->CancelOrWait();
+}
+
+KRSize KRRichTextShadow::MeasureRenderViewSize(double constraint_width, double constraint_height) {
+    has_last_constraint_ = true;
+    last_constraint_width_ = constraint_width;
+    last_constraint_height_ = constraint_height;
     if(StyledStringEnabled()){
         KRSize sz = CalculateRenderViewSizeWithStyledString(constraint_width, constraint_height);
         return sz;
@@ -132,34 +217,175 @@ KRSize KRRichTextShadow::CalculateRenderViewSize(double constraint_width, double
         SetParagraph(nullptr);
     }
     ReleaseLastTypography();
+    auto key = BuildMeasureCacheKey(constraint_width, constraint_height);
+    if (!key.empty() && RestoreFromMeasureCache(key)) {
+        measure_cache_key_ = std::move(key);
+        typography_pending_ = true;
+        pending_constraint_width_ = constraint_width;
+        pending_constraint_height_ = constraint_height;
+        return context_measure_size_;
+    }
     BuildTextTypography(constraint_width, constraint_height);
+    if (!key.empty()) {
+        StoreToMeasureCache(key, constraint_width);
+        measure_cache_key_ = std::move(key);
+    }
     return context_measure_size_;
 }
 
-KRSize KRRichTextShadow::CalculateRenderViewSizeWithStyledString(double constraint_width, double constraint_height) {
+KRTextMeasureCache<KRRichTextShadow::MeasureResult> &KRRichTextShadow::MeasureCache() {
+    static auto *gMeasureCache = new KRTextMeasureCache<MeasureResult>(kMeasureCacheCapacityBytes);
+    static auto budget_id = KRCacheBudgetCoordinator::GetInstance().Register(
+        "text_measure", KRCacheBudgetCoordinator::kPriorityTextMeasure,
+        [] { return gMeasureCache->GetStats().bytes; },
+        [](size_t target_bytes) { gMeasureCache->TrimToBytes(target_bytes); });
+    (void)budget_id;
+    return *gMeasureCache;
+}
+
+// 按 key 排序序列化（Map 为 unordered_map，遍历顺序不稳定），字符串带长度前缀避免拼接歧义
+static void AppendMeasureCacheKey(std::string &key, const KRAnyValue &value);
+
+static void AppendMeasureCacheKey(std::string &key, const KRRenderValue::Map &map) {
+    std::vector<const KRRenderValue::Map::value_type *> entries;
+    entries.reserve(map.size());
+    for (const auto &entry : map) {
+        entries.push_back(&entry);
+    }
+    std::sort(entries.begin(), entries.end(), [](auto *a, auto *b) { return a->first < b->first; });
+    key.append("{");
+    for (auto *entry : entries) {
+        key.append(std::to_string(entry->first.size())).append(":").append(entry->first);
+        AppendMeasureCacheKey(key, entry->second);
+    }
+    key.append("}");
+}
+
+static void AppendMeasureCacheKey(std::string &key, const KRAnyValue &value) {
+    if (value->isMap()) {
+        AppendMeasureCacheKey(key, value->toMapRef());
+    } else if (value->isArray()) {
+        key.append("[");
+        for (const auto &item : value->toArrayRef()) {
+            AppendMeasureCacheKey(key, item);
+        }
+        key.append("]");
+    } else {
+        auto string = value->toString();
+        key.append(std::to_string(string.size())).append(":").append(string);
+    }
+}
+
+static bool HasBackgroundImage(const KRRenderValue::Map &map) {
+    auto it = map.find("backgroundImage");
+    return it != map.end() && !it->second->toString().empty();
+}
+
+std::string KRRichTextShadow::BuildMeasureCacheKey(double constraint_width, double constraint_height) {
+    // 渐变色会额外走 CalculateRenderViewSizeWithStyledString（产生 paragraph 副作用），不缓存
+    if (!MeasureCacheEnabled() || HasBackgroundImage(props_)) {
+        return std::string();
+    }
+    for (const auto &span : values_) {
+        if (span->isMap() && HasBackgroundImage(span->toMapRef())) {
+            return std::string();
+        }
+    }
     auto rootView = GetRootView().lock();
     if (rootView == nullptr) {
-        return KRSize(0,0);
+        return std::string();
+    }
+    RootViewThreadingDispatcher rootViewThreadingDispatcher(rootView);
+    auto config = rootView->GetContext()->Config();
+    char buffer[128] = {0};
+    std::snprintf(buffer, sizeof(buffer), "%.4f|%.4f|%.4f|%.4f|%.4f|", constraint_width, constraint_height,
+                  KRConfig::GetDpi(), config->GetFontSizeScale(), config->GetFontWeightScale());
+    std::string key(buffer);
+    AppendMeasureCacheKey(key, props_);
+    key.append("|");
+    for (const auto &span : values_) {
+        AppendMeasureCacheKey(key, span);
     }
+    return key;
+}
 
-    struct RootViewThreadingDispatcher{
-        RootViewThreadingDispatcher(std::shared_ptr<IKRRenderView> r): rootView_(r){
-            // blank
+bool KRRichTextShadow::RestoreFromMeasureCache(const std::string &key) {
+    auto result = MeasureCache().Get(key, KRConfig::GetFontGeneration());
+    if (result == nullptr) {
+        return false;
+    }
+    // 除 typography 外的字段在写入缓存后不再修改，可在锁外读取
+    context_measure_size_ = result->size;
+    context_thread_text_align_ = result->text_align;
+    context_thread_drawOffsetY_ = result->draw_offset_y;
+    did_exceed_max_lines_ = result->did_exceed_max_lines;
+    text_content_ = result->text_content;
+    placeholder_index_map_ = result->placeholder_index_map;
+    span_offsets_ = result->span_offsets;
+    image_draw_records_ = result->image_draw_records;
+    TriggerImagePrefetchIfNeed();
+    return true;
+}
+
+void KRRichTextShadow::StoreToMeasureCache(const std::string &key, double constraint_width) {
+    if (context_thread_typography_ == nullptr) {
+        return;
+    }
+    auto result = std::make_shared<MeasureResult>();
+    result->size = context_measure_size_;
+    result->text_align = context_thread_text_align_;
+    result->draw_offset_y = context_thread_drawOffsetY_;
+    result->did_exceed_max_lines = did_exceed_max_lines_;
+    result->text_content = text_content_;
+    result->placeholder_index_map = placeholder_index_map_;
+    result->span_offsets = span_offsets_;
+    result->image_draw_records = image_draw_records_;
+    result->typography = context_thread_typography_;
+    result->layout_width = (constraint_width == 0 ? 10000000 : constraint_width) * KRConfig::GetDpi();
+    auto cost = kMeasureCacheEntryBaseCost + key.size() +
+                text_content_.size() * (1 + kMeasureCacheTypographyCostPerByte) +
+                span_offsets_.size() * sizeof(std::tuple<int, int, int>);
+    MeasureCache().Put(key, std::move(result), cost, KRConfig::GetFontGeneration());
+}
+
+void KRRichTextShadow::EnsureContextTypography() {
+    if (!typography_pending_) {
+        return;
+    }
+    typography_pending_ = false;
+    KRTypographyHandle typography;
+    double layout_width = 0;
+    MeasureCache().Visit(measure_cache_key_, [&typography, &layout_width](MeasureResult &result) {
+        // 只有缓存本身持有时才可取用（持有者增加引用只发生在缓存锁内或已持有者自身拷贝）
+        if (result.typography && result.typography.use_count() == 1) {
+            typography = result.typography;
+            layout_width = result.layout_width;
         }
-        ~RootViewThreadingDispatcher(){
-            if(auto theRootView = rootView_) {
-                //
-                // We need to dispatch it back to main thread to avoid destructing it on context thread,
-                // in case `rootView` variable is the last holding onto the root render view.
-                //
-                KRMainThread::RunOnMainThread([theRootView]{
-                    theRootView.get();
-                });
-            }
+    });
+    if (typography) {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // 上一个持有者的 view 可能已按自身 frame 宽度重新 Layout，恢复到测量时的宽度
+        OH_Drawing_TypographyLayout(typography.get(), layout_width);
+        context_thread_typography_ = std::move(typography);
+        return;
+    }
+    // 缓存中的 typography 仍被其他 shadow 使用（或已被淘汰），重新构建一份，测量结果与缓存一致
+    BuildTextTypography(pending_constraint_width_, pending_constraint_height_);
+    auto typography_for_cache = context_thread_typography_;
+    MeasureCache().Visit(measure_cache_key_, [&typography_for_cache](MeasureResult &result) {
+        if (result.typography == nullptr || result.typography.use_count() > 1) {
+            result.typography.swap(typography_for_cache);
         }
+    });
+}
 
-        std::shared_ptr<IKRRenderView> rootView_;
-    } rootViewThreadingDispatcher(rootView);
+KRSize KRRichTextShadow::CalculateRenderViewSizeWithStyledString(double constraint_width, double constraint_height) {
+    auto rootView = GetRootView().lock();
+    if (rootView == nullptr) {
+        return KRSize(0,0);
+    }
+
+    RootViewThreadingDispatcher rootViewThreadingDispatcher(rootView);
 
     float fontSizeScale = rootView->GetContext()->Config()->GetFontSizeScale();
     float fontWeightScale = rootView->GetContext()->Config()->GetFontWeightScale();
@@ -194,6 +420,8 @@ bool KRRichTextShadow::StyledStringEnabled(){
  * @return
  */
 KRSchedulerTask KRRichTextShadow::TaskToMainQueueWhenWillSetShadowToView() {
+    JoinSpeculativeLayout();
+    EnsureContextTypography();
     auto self = shared_from_this();
     // 拷贝一份 shared_ptr，保证 lambda 在主线程执行期间该 typography 不会被
     // context 线程后续的 ReleaseLastTypography()/重新 BuildTextTypography()
@@ -254,10 +482,14 @@ bool KRFontCollectionWrapper::IsFontRegistered(const std::string& fontFamily) co
 
 void KRFontCollectionWrapper::MarkFontRegistered(const std::string& fontFamily) {
     registered_.emplace(fontFamily);
+    // 注册前以回退字体测量的结果已不可信
+    KRConfig::BumpFontGeneration();
 }
 
 void KRFontCollectionWrapper::RegisterCustomFont(NativeResourceManager *resMgr,
                                                   const std::string &fontFamily) {
+    // 预测性布局会在多个布局线程上并发构建 typography
+    std::lock_guard<std::mutex> lock(mutex_);
     auto fontAdapters = KRFontAdapterManager::GetInstance()->AllAdapters();
     auto adapter = fontAdapters.find(fontFamily);
     if (adapter != fontAdapters.end() && !IsFontRegistered(fontFamily)) {
@@ -311,22 +543,7 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
         return nullptr;
     }
 
-    struct RootViewThreadingDispatcher {
-        RootViewThreadingDispatcher(std::shared_ptr<IKRRenderView> r) : rootView_(r) {
-            // blank
-        }
-        ~RootViewThreadingDispatcher() {
-            if (auto theRootView = rootView_) {
-                //
-                // We need to dispatch it back to main thread to avoid destructing it on context thread,
-                // in case `rootView` variable is the last holding onto the root render view.
-                //
-                KRMainThread::RunOnMainThread([theRootView] { theRootView.get(); });
-            }
-        }
-
-        std::shared_ptr<IKRRenderView> rootView_;
-    } rootViewThreadingDispatcher(rootView);
+    RootViewThreadingDispatcher rootViewThreadingDispatcher(rootView);
 
     float fontSizeScale = rootView->GetContext()->Config()->GetFontSizeScale();
     float fontWeightScale = rootView->GetContext()->Config()->GetFontWeightScale();
@@ -359,7 +576,7 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
             KRRenderValue::Array expanded;
             expanded.reserve(spans.size());
             for (const auto &span : spans) {
-                auto m = span->toMap();
+                const auto &m = span->toMapRef();
                 // 已声明 image span（业务自己写 ImageSpan { src(...) }）：跳过 PostProcessor
                 auto declared_ph_w = GetKRValue("placeholderWidth", m, m)->toDouble();
                 // 内置 image span（前一轮 SetProp 已展开过 / 嵌套场景）：避免重复展开
@@ -437,7 +654,7 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
     int charOffset = 0;
     std::string text_content;
     for (auto span : spans) {
-        auto spanMap = span->toMap();
+        const auto &spanMap = span->toMapRef();
         auto fontSize = (GetKRValue("fontSize", spanMap, props_)->toFloat() ?: 15.0) * dpi * fontSizeScale;
         auto text = GetKRValue("value", spanMap, spanMap)->toString();
         if (text.length() == 0) {
@@ -705,6 +922,8 @@ void KRRichTextShadow::ReleaseLastTypography() {
     // 当前调用栈上起上游代码所持有，那么这些持有者会延长它的寿命，直到
     // 安全的时机（由 shared_ptr 的 deleter）才调 OH_Drawing_DestroyTypography。
     context_thread_typography_.reset();
+    typography_pending_ = false;
+    measure_cache_key_.clear();
     context_thread_drawOffsetY_ = 0;
     context_thread_drawOffsetX_ = 0;
     context_thread_text_align_ = TEXT_ALIGN_LEFT;
@@ -760,6 +979,7 @@ KRAnyValue KRRichTextShadow::SpanRect(int spanIndex) {
 
     if (placeholder_index_map_.find(spanIndex) != placeholder_index_map_.end()) {
         auto placeholderIndex = placeholder_index_map_[spanIndex];
+        EnsureContextTypography();
         // 在调用栈内拷贝一份强引用，避免其它线程同时 ReleaseLastTypography 释放。
         KRTypographyHandle typo = context_thread_typography_;
         OH_Drawing_Typography *typo_raw = typo ? typo.get() : nullptr;
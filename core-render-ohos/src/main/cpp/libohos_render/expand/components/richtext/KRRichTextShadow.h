@@ -30,6 +30,8 @@
 #include <vector>
 #include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
 #include "libohos_render/expand/components/richtext/KRParagraph.h"
+#include "libohos_render/expand/components/richtext/KRTextMeasureCache.h"
+#include "libohos_render/foundation/thread/KRSpeculativeTask.h"
 #include "libohos_render/utils/KRScopedSpinLock.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/export/IKRRenderShadowExport.h"
@@ -113,6 +115,7 @@ private:
     OH_Drawing_FontCollection* fontCollection_ = nullptr;
     bool isGlobalInstance_ = false;  // 标记是否为全局实例（全局实例不需要销毁）
     std::unordered_set<std::string> registered_;
+    std::mutex mutex_;  // 保护 registered_ 与字体注册
 };
 
 class KRRichTextShadow : public IKRRenderShadowExport {
@@ -142,6 +145,13 @@ class KRRichTextShadow : public IKRRenderShadowExport {
      */
     KRSize CalculateRenderViewSize(double constraint_width, double constraint_height) override;
 
+    /**
+     * 预测性布局：在文本布局线程池上提前测量，之后约束一致的 CalculateRenderViewSize 只需等待结果
+     * @param constraint_width 预测的约束宽度（已测量过时使用上次的约束）
+     * @param constraint_height 预测的约束高度
+     */
+    void StartSpeculativeLayout(double constraint_width, double constraint_height) override;
+
     /**
      * 完成对某个Span对应TextStyle
      * @param textStyle
@@ -149,6 +159,13 @@ class KRRichTextShadow : public IKRRenderShadowExport {
      */
     virtual void DidBuildTextStyle(OH_Drawing_TextStyle *textStyle, double dpi) {}
 
+    /**
+     * 是否允许使用跨 shadow 的测量缓存及预测性布局。测量结果依赖 DidBuildTextStyle 等额外状态的子类需返回 false
+     */
+    virtual bool MeasureCacheEnabled() {
+        return true;
+    }
+
     /**
      * 将要SetShadow调用
      * @return
@@ -258,6 +275,43 @@ class KRRichTextShadow : public IKRRenderShadowExport {
     }
 
  private:
+    // 跨 shadow 共享的测量结果（见 KRTextMeasureCache），由 BuildTextTypography 的输出组成
+    struct MeasureResult {
+        KRSize size;
+        bool did_exceed_max_lines = false;
+        OH_Drawing_TextAlign text_align = TEXT_ALIGN_LEFT;
+        float draw_offset_y = 0;
+        std::string text_content;
+        std::unordered_map<int, int> placeholder_index_map;
+        std::vector<std::tuple<int, int, int>> span_offsets;
+        std::vector<KRImageDrawRecord> image_draw_records;
+        // 测量时构建的 typography。主线程 OnForegroundDraw 会按 frame 宽度对其重新 Layout，
+        // 因此同一时刻只能被一个 shadow 持有：仅在缓存为唯一持有者时（在缓存锁内判断）才能被取用
+        KRTypographyHandle typography;
+        double layout_width = 0;  // typography 测量时的 Layout 宽度（px）
+    };
+    static KRTextMeasureCache<MeasureResult> &MeasureCache();
+
+    /**
+     * 生成本次测量的缓存 key（内容 + 样式 + 约束 + 字体缩放），不可缓存时返回空串
+     */
+    std::string BuildMeasureCacheKey(double constraint_width, double constraint_height);
+    bool RestoreFromMeasureCache(const std::string &key);
+    void StoreToMeasureCache(const std::string &key, double constraint_width);
+    /**
+     * 命中测量缓存时 typography 延迟到真正需要时（SetShadow / SpanRect）再取用或重建
+     */
+    void EnsureContextTypography();
+
+    /**
+     * 同步测量（CalculateRenderViewSize 未命中预测性布局结果时，或在布局线程池上执行预测性布局时调用）
+     */
+    KRSize MeasureRenderViewSize(double constraint_width, double constraint_height);
+    /**
+     * context 线程访问本 shadow 的测量状态前调用：取消尚未开始的预测性布局，或等待执行中的预测性布局结束
+     */
+    void JoinSpeculativeLayout();
+
     void DestroyCachedTextLines();
     KRSize CalculateRenderViewSizeWithStyledString(double constraint_width, double constraint_height);
 
@@ -293,6 +347,20 @@ class KRRichTextShadow : public IKRRenderShadowExport {
     std::vector<std::tuple<int, int, int>> span_offsets_;  // span, begin, end
     std::shared_ptr<KRParagraph> paragraph_;
     KRSpinLock paragraph_lock_;
+    // 测量缓存命中后尚未取得 typography 时记录约束，context 线程读写
+    std::string measure_cache_key_;
+    bool typography_pending_ = false;
+    double pending_constraint_width_ = 0;
+    double pending_constraint_height_ = 0;
+    // 预测性布局：speculative_layout_ 由 context 线程创建与 Join，Join 返回前其余字段只由布局线程池写入
+    std::shared_ptr<KRSpeculativeTask> speculative_layout_;
+    bool speculative_size_valid_ = false;
+    double speculative_constraint_width_ = 0;
+    double speculative_constraint_height_ = 0;
+    KRSize speculative_size_;
+    bool has_last_constraint_ = false;
+    double last_constraint_width_ = 0;
+    double last_constraint_height_ = 0;
     std::shared_ptr<kuikly::util::KRLinearGradientParser> text_linearGradient_;
 
     // ===== Phase 4: image span 绘制相关 =====
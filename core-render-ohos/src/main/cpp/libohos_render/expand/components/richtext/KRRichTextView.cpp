@@ -340,7 +340,7 @@ void KRRichTextView::ToSetProp(const std::string &prop_key, const KRAnyValue &pr
                 return;
             }
             if (res->isMap()) {
-                const auto oldParam = res->toMap();
+                const auto &oldParam = res->toMapRef();
                 const auto x = oldParam.find("x");
                 const auto y = oldParam.find("y");
 
@@ -0,0 +1,219 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTEXTMEASURECACHE_H
+#define CORE_RENDER_OHOS_KRTEXTMEASURECACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * 进程级文本测量缓存（跨 shadow 共享）。
+ *
+ * 设计要点：
+ * 1) key 为 "内容 + 样式 + 约束宽度" 序列化后的字符串，表内以其 64 位 FNV-1a 哈希索引，
+ *    条目内保存完整 key 用于校验，哈希碰撞按未命中处理；
+ * 2) 按字节预算淘汰（LRU），每个条目的开销由调用方估算（key + 结果 + typography）；
+ * 3) 带版本号：字体相关配置（注册自定义字体、字体缩放）变化时版本号递增，
+ *    下一次访问发现版本不一致即整体失效；
+ * 4) 与 KRCustomEmojiPixmapCache 相同，以 std::list + std::unordered_map 实现，
+ *    值为 shared_ptr，调用方持有期间即使被淘汰也不会失效。
+ *
+ * 只依赖标准库，Value 由使用方定义（KRRichTextShadow 的测量结果）。
+ */
+template <typename Value>
+class KRTextMeasureCache {
+ public:
+    using ValuePtr = std::shared_ptr<Value>;
+
+    struct Stats {
+        uint64_t hit_count = 0;
+        uint64_t miss_count = 0;
+        uint64_t eviction_count = 0;      // 因超出字节预算被淘汰的条目数
+        uint64_t invalidation_count = 0;  // 因字体配置变化整体失效的次数
+        size_t entry_count = 0;
+        size_t bytes = 0;
+
+        double HitRate() const {
+            auto total = hit_count + miss_count;
+            return total > 0 ? static_cast<double>(hit_count) / total : 0;
+        }
+    };
+
+    /**
+     * @param capacity_bytes 字节预算
+     */
+    explicit KRTextMeasureCache(size_t capacity_bytes) : capacity_bytes_(capacity_bytes) {}
+
+    KRTextMeasureCache(const KRTextMeasureCache &) = delete;
+    KRTextMeasureCache &operator=(const KRTextMeasureCache &) = delete;
+
+    static uint64_t Hash(const std::string &key) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (unsigned char c : key) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    /**
+     * 查询，命中时更新 LRU 顺序
+     * @param key 序列化后的测量 key
+     * @param generation 当前字体配置版本号
+     * @return 未命中返回空
+     */
+    ValuePtr Get(const std::string &key, uint32_t generation) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        CheckGenerationLocked(generation);
+        auto it = entries_.find(Hash(key));
+        if (it == entries_.end() || it->second.key != key) {
+            miss_count_++;
+            return nullptr;
+        }
+        hit_count_++;
+        lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+        return it->second.value;
+    }
+
+    /**
+     * 写入（同 key 覆盖），超出预算时从最久未访问的条目开始淘汰
+     * @param cost 条目估算字节数
+     */
+    void Put(const std::string &key, ValuePtr value, size_t cost, uint32_t generation) {
+        ValuePtr replaced;  // 在锁外释放被覆盖/淘汰的值
+        std::list<ValuePtr> evicted;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            CheckGenerationLocked(generation);
+            if (cost > capacity_bytes_) {
+                return;
+            }
+            auto hash = Hash(key);
+            auto it = entries_.find(hash);
+            if (it != entries_.end()) {
+                replaced = std::move(it->second.value);
+                bytes_ -= it->second.cost;
+                lru_.erase(it->second.lru_it);
+                entries_.erase(it);
+            }
+            lru_.push_front(hash);
+            entries_.emplace(hash, Entry{key, std::move(value), cost, lru_.begin()});
+            bytes_ += cost;
+            EvictLocked(evicted, capacity_bytes_);
+        }
+    }
+
+    /**
+     * 从最久未访问的条目开始淘汰，直到占用不超过 target_bytes（不改变预算，用于内存压力裁剪）
+     */
+    void TrimToBytes(size_t target_bytes) {
+        std::list<ValuePtr> evicted;  // 在锁外释放
+        std::lock_guard<std::mutex> lock(mutex_);
+        EvictLocked(evicted, target_bytes);
+    }
+
+    /**
+     * 在锁内访问条目（用于需要与其他 shadow 互斥的操作，如独占取用 typography）
+     * @return key 不存在时返回false
+     */
+    template <typename Fn>
+    bool Visit(const std::string &key, Fn &&fn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(Hash(key));
+        if (it == entries_.end() || it->second.key != key) {
+            return false;
+        }
+        fn(*it->second.value);
+        return true;
+    }
+
+    void Clear() {
+        std::unordered_map<uint64_t, Entry> entries;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            entries.swap(entries_);
+            lru_.clear();
+            bytes_ = 0;
+        }
+    }
+
+    void SetCapacityBytes(size_t capacity_bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_bytes_ = capacity_bytes;
+    }
+
+    Stats GetStats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stats stats;
+        stats.hit_count = hit_count_;
+        stats.miss_count = miss_count_;
+        stats.eviction_count = eviction_count_;
+        stats.invalidation_count = invalidation_count_;
+        stats.entry_count = entries_.size();
+        stats.bytes = bytes_;
+        return stats;
+    }
+
+ private:
+    struct Entry {
+        std::string key;
+        ValuePtr value;
+        size_t cost;
+        std::list<uint64_t>::iterator lru_it;
+    };
+
+    void EvictLocked(std::list<ValuePtr> &evicted, size_t limit_bytes) {
+        while (bytes_ > limit_bytes && !lru_.empty()) {
+            auto victim = entries_.find(lru_.back());
+            bytes_ -= victim->second.cost;
+            evicted.push_back(std::move(victim->second.value));
+            entries_.erase(victim);
+            lru_.pop_back();
+            eviction_count_++;
+        }
+    }
+
+    void CheckGenerationLocked(uint32_t generation) {
+        if (generation == generation_) {
+            return;
+        }
+        generation_ = generation;
+        if (!entries_.empty()) {
+            entries_.clear();
+            lru_.clear();
+            bytes_ = 0;
+            invalidation_count_++;
+        }
+    }
+
+    std::mutex mutex_;
+    size_t capacity_bytes_;
+    size_t bytes_ = 0;
+    uint32_t generation_ = 0;
+    std::list<uint64_t> lru_;  // front 为最近访问
+    std::unordered_map<uint64_t, Entry> entries_;
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+    uint64_t eviction_count_ = 0;
+    uint64_t invalidation_count_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTEXTMEASURECACHE_H
@@ -38,6 +38,12 @@ class KRGradientRichTextShadow : public KRRichTextShadow {
      * @param dpi 屏幕密度 即ppi和dp换算比例，如3.0
      */
     void DidBuildTextStyle(OH_Drawing_TextStyle *textStyle, double dpi) override;
+    /**
+     * 渐变色依赖上一次测量的尺寸，不使用测量缓存
+     */
+    bool MeasureCacheEnabled() override {
+        return false;
+    }
 
  private:
     double calculate_width_ = 0.0;
@@ -0,0 +1,189 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRSCROLLEVENTCOALESCER_H
+#define CORE_RENDER_OHOS_KRSCROLLEVENTCOALESCER_H
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * 滚动事件快照，定长布局，在事件发生时采集，投递时才转换为回调参数
+ */
+struct KRScrollEventFrame {
+    float offset_x = 0;
+    float offset_y = 0;
+    float view_width = 0;
+    float view_height = 0;
+    float content_width = 0;
+    float content_height = 0;
+    float velocity_x = 0;
+    float velocity_y = 0;
+    bool has_content = false;
+    bool is_dragging = false;
+};
+static_assert(std::is_trivially_copyable<KRScrollEventFrame>::value, "KRScrollEventFrame must stay POD");
+
+enum class KRScrollEventType : uint8_t {
+    kScroll = 0,
+    kDragBegin,
+    kWillDragEnd,
+    kDragEnd,
+    kScrollEnd,
+};
+
+/**
+ * 滚动事件按帧合并（主线程使用）。
+ *
+ * 1) 连续的 scroll 事件只保留最新的快照，每个 VSync 最多投递一次；
+ * 2) 拖拽开始/结束、滚动结束等离散事件从不丢弃：投递前先冲刷待投递的 scroll，保证业务侧看到的顺序与发生顺序一致；
+ * 3) 进入或离开边界（偏移到达 0 或最大值）的 scroll 立即投递，保证边界偏移不被合并掉；
+ * 4) 请求 VSync 失败时退化为逐个投递。
+ *
+ * 只依赖标准库。
+ */
+class KRScrollEventCoalescer {
+ public:
+    /**
+     * 投递回调
+     */
+    using Deliver = std::function<void(KRScrollEventType type, const KRScrollEventFrame &frame)>;
+    /**
+     * 请求在下一帧回调 on_frame（需回到主线程），请求失败返回 false
+     */
+    using FrameRequester = std::function<bool(std::function<void()> on_frame)>;
+
+    struct Stats {
+        uint64_t scroll_received = 0;    // 收到的 scroll 事件数
+        uint64_t scroll_delivered = 0;   // 投递的 scroll 事件数
+        uint64_t edge_flush_count = 0;   // 因进出边界立即投递的次数
+        uint64_t discrete_delivered = 0; // 投递的离散事件数
+        uint64_t frame_request_count = 0;
+    };
+
+    KRScrollEventCoalescer(Deliver deliver, FrameRequester frame_requester)
+        : deliver_(std::move(deliver)), frame_requester_(std::move(frame_requester)) {}
+
+    KRScrollEventCoalescer(const KRScrollEventCoalescer &) = delete;
+    KRScrollEventCoalescer &operator=(const KRScrollEventCoalescer &) = delete;
+
+    void OnScroll(const KRScrollEventFrame &frame) {
+        stats_.scroll_received++;
+        pending_ = frame;
+        has_pending_ = true;
+        auto edge_mask = EdgeMask(frame);
+        if (edge_mask != delivered_edge_mask_) {
+            stats_.edge_flush_count++;
+            Flush();
+            return;
+        }
+        if (frame_requested_) {
+            return;
+        }
+        auto generation = generation_;
+        frame_requested_ = frame_requester_ && frame_requester_([this, generation] { OnFrame(generation); });
+        if (frame_requested_) {
+            stats_.frame_request_count++;
+        } else {
+            Flush();
+        }
+    }
+
+    /**
+     * 离散事件，先冲刷待投递的 scroll 再立即投递
+     */
+    void OnDiscreteEvent(KRScrollEventType type, const KRScrollEventFrame &frame) {
+        Flush();
+        stats_.discrete_delivered++;
+        deliver_(type, frame);
+    }
+
+    /**
+     * 立即投递待投递的 scroll
+     */
+    void Flush() {
+        if (!has_pending_) {
+            return;
+        }
+        has_pending_ = false;
+        delivered_edge_mask_ = EdgeMask(pending_);
+        stats_.scroll_delivered++;
+        deliver_(KRScrollEventType::kScroll, pending_);
+    }
+
+    /**
+     * 丢弃待投递的 scroll（视图销毁、复用时调用），已请求的帧回调到达时忽略
+     */
+    void Reset() {
+        has_pending_ = false;
+        frame_requested_ = false;
+        delivered_edge_mask_ = kEdgeUnknown;
+        generation_++;
+    }
+
+    bool HasPending() const {
+        return has_pending_;
+    }
+
+    const Stats &GetStats() const {
+        return stats_;
+    }
+
+    /**
+     * 偏移所在边界，bit0/1 为水平起止，bit2/3 为竖直起止；内容尺寸未知时只判断起点
+     */
+    static uint32_t EdgeMask(const KRScrollEventFrame &frame) {
+        uint32_t mask = 0;
+        if (frame.offset_x <= 0) {
+            mask |= 1u;
+        }
+        if (frame.offset_y <= 0) {
+            mask |= 1u << 2;
+        }
+        if (frame.has_content) {
+            if (frame.offset_x >= frame.content_width - frame.view_width) {
+                mask |= 1u << 1;
+            }
+            if (frame.offset_y >= frame.content_height - frame.view_height) {
+                mask |= 1u << 3;
+            }
+        }
+        return mask;
+    }
+
+ private:
+    static constexpr uint32_t kEdgeUnknown = 0xffffffffu;
+
+    void OnFrame(uint64_t generation) {
+        if (generation != generation_) {
+            return;
+        }
+        frame_requested_ = false;
+        Flush();
+    }
+
+    Deliver deliver_;
+    FrameRequester frame_requester_;
+    KRScrollEventFrame pending_;
+    bool has_pending_ = false;
+    bool frame_requested_ = false;
+    uint32_t delivered_edge_mask_ = kEdgeUnknown;
+    uint64_t generation_ = 0;
+    Stats stats_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRSCROLLEVENTCOALESCER_H
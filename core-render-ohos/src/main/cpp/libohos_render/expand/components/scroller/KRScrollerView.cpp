@@ -18,7 +18,9 @@
 #include <cfloat>
 #include <cmath>
 #include "libohos_render/expand/components/view/KRView.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/foundation/type/KRRenderValue.h"
+#include "libohos_render/scheduler/KRVSyncDispatcher.h"
 #include "libohos_render/utils/KRJSONObject.h"
 
 
@@ -142,6 +144,11 @@ void KRScrollerView::SetRenderViewFrame(const KRRect &frame) {
     }
 }
 
+KRScrollerView::KRScrollerView()
+    : scroll_event_coalescer_(
+          [this](KRScrollEventType type, const KRScrollEventFrame &frame) { DeliverScrollEvent(type, frame); },
+          [this](std::function<void()> on_frame) { return RequestScrollEventFrame(std::move(on_frame)); }) {}
+
 ArkUI_NodeHandle KRScrollerView::CreateNode() {
     auto node = kuikly::util::GetNodeApi()->createNode(ARKUI_NODE_SCROLL);
     // Scroll 默认会对ContentView居中展示, 这里强制不居中
@@ -255,42 +262,78 @@ void KRScrollerView::FireOnScrollEvent(ArkUI_NodeEvent *event) {
     }
     last_fired_scroll_x_ = point.x;
     last_fired_scroll_y_ = point.y;
-    // 分发滚动事件
+    // 分发滚动事件（native 观察者逐帧同步，业务回调按帧合并）
     DispatchDidScrollToObservers(point);
     if (!on_scroll_callback_) {
         return;
     }
-    on_scroll_callback_(GetCommonScrollParams());
+    scroll_event_coalescer_.OnScroll(CaptureScrollFrame());
 }
 
 void KRScrollerView::FireBeginDragEvent(ArkUI_NodeEvent *event) {
-    if (!on_drag_begin_callback_) {
-        return;
-    }
-    on_drag_begin_callback_(GetCommonScrollParams());
+    FireDiscreteScrollEvent(KRScrollEventType::kDragBegin, on_drag_begin_callback_);
 }
 
 void KRScrollerView::FireWillDragEndEvent(ArkUI_NodeEvent *event) {
     KR_LOG_INFO << "fire will drag end";
-    if (!on_will_drag_end_callback_) {
-        return;
-    }
     // TODO(userName): 补充加速度参数
-    on_will_drag_end_callback_(GetCommonScrollParams());
+    FireDiscreteScrollEvent(KRScrollEventType::kWillDragEnd, on_will_drag_end_callback_);
 }
 
 void KRScrollerView::FireEndDragEvent(ArkUI_NodeEvent *event) {
-    if (!on_drag_end_callback_) {
-        return;
-    }
-    on_drag_end_callback_(GetCommonScrollParams());
+    FireDiscreteScrollEvent(KRScrollEventType::kDragEnd, on_drag_end_callback_);
 }
 
 void KRScrollerView::FireEndScrollEvent(ArkUI_NodeEvent *event) {
-    if (!on_scroll_end_callback_) {
+    FireDiscreteScrollEvent(KRScrollEventType::kScrollEnd, on_scroll_end_callback_);
+    auto &stats = scroll_event_coalescer_.GetStats();
+    KR_LOG_DEBUG << "scroll events received: " << stats.scroll_received << ", delivered: " << stats.scroll_delivered
+                 << ", edge flush: " << stats.edge_flush_count;
+}
+
+void KRScrollerView::FireDiscreteScrollEvent(KRScrollEventType type, const KRRenderCallback &callback) {
+    if (!callback) {
+        // 未监听该事件时也要先把合并中的 scroll 投递出去
+        scroll_event_coalescer_.Flush();
         return;
     }
-    on_scroll_end_callback_(GetCommonScrollParams());
+    scroll_event_coalescer_.OnDiscreteEvent(type, CaptureScrollFrame());
+}
+
+void KRScrollerView::DeliverScrollEvent(KRScrollEventType type, const KRScrollEventFrame &frame) {
+    const KRRenderCallback *callback = nullptr;
+    switch (type) {
+        case KRScrollEventType::kScroll:
+            callback = &on_scroll_callback_;
+            break;
+        case KRScrollEventType::kDragBegin:
+            callback = &on_drag_begin_callback_;
+            break;
+        case KRScrollEventType::kWillDragEnd:
+            callback = &on_will_drag_end_callback_;
+            break;
+        case KRScrollEventType::kDragEnd:
+            callback = &on_drag_end_callback_;
+            break;
+        case KRScrollEventType::kScrollEnd:
+            callback = &on_scroll_end_callback_;
+            break;
+    }
+    if (callback && *callback) {
+        (*callback)(ToScrollParams(frame));
+    }
+}
+
+bool KRScrollerView::RequestScrollEventFrame(std::function<void()> on_frame) {
+    std::weak_ptr<IKRRenderViewExport> weak_self = shared_from_this();
+    return KRVSyncDispatcher::GetInstance().RequestFrame([weak_self, on_frame](long long) {
+        // VSync线程，切回主线程投递
+        KRMainThread::RunOnMainThread([weak_self, on_frame] {
+            if (auto strong_self = weak_self.lock()) {
+                on_frame();
+            }
+        });
+    });
 }
 
 void KRScrollerView::DidInsertSubRenderView(const std::shared_ptr<IKRRenderViewExport> &sub_render_view, int index) {
@@ -302,6 +345,7 @@ void KRScrollerView::DidInsertSubRenderView(const std::shared_ptr<IKRRenderViewE
 }
 
 void KRScrollerView::OnDestroy() {
+    scroll_event_coalescer_.Reset();
     if (!content_view_) {
         return;
     }
@@ -627,22 +671,23 @@ bool KRScrollerView::IsDraggingStateToIdeaState(ArkUI_ScrollState new_scroll_sta
            new_scroll_state == ArkUI_ScrollState::ARKUI_SCROLL_STATE_IDLE;
 }
 
-std::shared_ptr<KRRenderValue> KRScrollerView::GetCommonScrollParams() {
-    KRRenderValueMap map;
+KRScrollEventFrame KRScrollerView::CaptureScrollFrame() {
+    KRScrollEventFrame frame;
     auto point = kuikly::util::GetArkUIScrollContentOffset(GetNode());
-    map[kEventKeyOffsetX] = NewKRRenderValue(point.x);
-    map[kEventKeyOffsetY] = NewKRRenderValue(point.y);
+    frame.offset_x = point.x;
+    frame.offset_y = point.y;
 
-    auto frame = GetFrame();
-    map[kEventKeyViewWidth] = NewKRRenderValue(frame.width);
-    map[kEventKeyViewHeight] = NewKRRenderValue(frame.height);
+    auto view_frame = GetFrame();
+    frame.view_width = view_frame.width;
+    frame.view_height = view_frame.height;
 
     if (content_view_) {
         auto content_view_frame = content_view_->GetFrame();
-        map[kEventKeyContentWidth] = NewKRRenderValue(content_view_frame.width);
-        map[kEventKeyContentHeight] = NewKRRenderValue(content_view_frame.height);
+        frame.has_content = true;
+        frame.content_width = content_view_frame.width;
+        frame.content_height = content_view_frame.height;
     }
-    map[kEventKeyIsDragging] = NewKRRenderValue(is_dragging_ ? 1 : 0);
+    frame.is_dragging = is_dragging_;
 
     // 统一计算有效速度：基于最后位移的 stale 检测 + 最小阈值过滤
     auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -663,8 +708,24 @@ std::shared_ptr<KRRenderValue> KRScrollerView::GetCommonScrollParams() {
         effective_vy = 0;
     }
 
-    map[kEventKeyVelocityX] = NewKRRenderValue(effective_vx);
-    map[kEventKeyVelocityY] = NewKRRenderValue(effective_vy);
+    frame.velocity_x = effective_vx;
+    frame.velocity_y = effective_vy;
+    return frame;
+}
+
+std::shared_ptr<KRRenderValue> KRScrollerView::ToScrollParams(const KRScrollEventFrame &frame) {
+    KRRenderValueMap map;
+    map[kEventKeyOffsetX] = NewKRRenderValue(frame.offset_x);
+    map[kEventKeyOffsetY] = NewKRRenderValue(frame.offset_y);
+    map[kEventKeyViewWidth] = NewKRRenderValue(frame.view_width);
+    map[kEventKeyViewHeight] = NewKRRenderValue(frame.view_height);
+    if (frame.has_content) {
+        map[kEventKeyContentWidth] = NewKRRenderValue(frame.content_width);
+        map[kEventKeyContentHeight] = NewKRRenderValue(frame.content_height);
+    }
+    map[kEventKeyIsDragging] = NewKRRenderValue(frame.is_dragging ? 1 : 0);
+    map[kEventKeyVelocityX] = NewKRRenderValue(frame.velocity_x);
+    map[kEventKeyVelocityY] = NewKRRenderValue(frame.velocity_y);
     return NewKRRenderValue(std::move(map));
 }
 
@@ -762,6 +823,7 @@ void KRScrollerView::TryApplyPendingFireOnScroll() {
 // Clear transient native state for Compose DSL reuse (not the native reuse pool).
 void KRScrollerView::PrepareForComposeReuse() {
     // Reset scroll event dedup cache so restored offset fires a scroll event
+    scroll_event_coalescer_.Reset();
     last_fired_scroll_x_ = -FLT_MAX;
     last_fired_scroll_y_ = -FLT_MAX;
     // Reset scroll state machine
@@ -18,6 +18,7 @@
 
 #include <unordered_set>
 #include "KRScrollerContentInset.h"
+#include "libohos_render/expand/components/scroller/KRScrollEventCoalescer.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
 #include "libohos_render/foundation/KRPoint.h"
 #include "libohos_render/foundation/KRRect.h"
@@ -68,7 +69,7 @@ class KRScrollerContentView : public IKRRenderViewExport {
 
 class KRScrollerView : public IKRRenderViewExport {
  public:
-    KRScrollerView() = default;
+    KRScrollerView();
     KRScrollerView(const KRScrollerView &) = delete;
     KRScrollerView(KRScrollerView &&) = delete;
     KRScrollerView &operator=(const KRScrollerView &) = delete;
@@ -114,6 +115,9 @@ class KRScrollerView : public IKRRenderViewExport {
     void FireEndDragEvent(ArkUI_NodeEvent *event);
     void FireEndScrollEvent(ArkUI_NodeEvent *event);
     void FireWillDragEndEvent(ArkUI_NodeEvent *event);
+    void FireDiscreteScrollEvent(KRScrollEventType type, const KRRenderCallback &callback);
+    void DeliverScrollEvent(KRScrollEventType type, const KRScrollEventFrame &frame);
+    bool RequestScrollEventFrame(std::function<void()> on_frame);
     void SetContentOffset(const KRAnyValue &value);
     void SetContentInset(const KRAnyValue &value);
     void SetContentInset(const std::shared_ptr<KRScrollerContentInset> &content_inset);
@@ -130,7 +134,8 @@ class KRScrollerView : public IKRRenderViewExport {
     bool IsFlingStateToDraggingState(ArkUI_ScrollState new_scroll_state);
     bool IsDraggingStateToFlingState(ArkUI_ScrollState new_scroll_state);
     bool IsDraggingStateToIdeaState(ArkUI_ScrollState new_scroll_state);
-    std::shared_ptr<KRRenderValue> GetCommonScrollParams();
+    KRScrollEventFrame CaptureScrollFrame();
+    static std::shared_ptr<KRRenderValue> ToScrollParams(const KRScrollEventFrame &frame);
     void ApplyContentInsetWhenDragEnd();
     void InnerSetBouncesEnable(bool enable);
     void AdjustHeaderBouncesEnableWhenWillScroll(ArkUI_NodeEvent *event);
@@ -173,6 +178,8 @@ class KRScrollerView : public IKRRenderViewExport {
     bool is_fling_enabled_ = true;
     float last_fired_scroll_x_ = 0;
     float last_fired_scroll_y_ = 0;
+    // scroll 事件按帧合并后回调给业务
+    KRScrollEventCoalescer scroll_event_coalescer_;
     bool direction_row_ = false;
 };
 
@@ -106,51 +106,80 @@ void KRView::WillReuse() {
 
 bool KRView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                      const KRRenderCallback event_call_back) {
-    auto didHand = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameTouchDown)) {
-        didHand = RegisterTouchDownEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchMove)) {
-        didHand = RegisterTouchMoveEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchUp)) {
-        didHand = RegisterTouchUpEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNamePreventTouch)) {
-        if (super_touch_handler_) {
-            super_touch_handler_->PreventTouch(prop_value->toBool());
-        }
-        didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameSuperTouch)) {
-        if (prop_value->toBool()) {
-            if (!super_touch_handler_) {
-                super_touch_handler_ = std::make_shared<SuperTouchHandler>();
-            }
-        } else {
-            if (super_touch_handler_) {
-                super_touch_handler_ = nullptr;
-            }
-        }
-        didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameHitTestModeOhos)) {
-        didHand = SetTargetHitTestMode(prop_value->toString());
-    } else if (kuikly::util::isEqual(prop_key, kPropNameStopPropagation)) {
-        stop_propagation_ = prop_value->toBool();
-        didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kTextSelectable)) {
-        selectable_option_ = static_cast<SelectableOption>(prop_value->toInt());
-        didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kTextSelectStart)) {
-        select_start_callback_ = event_call_back;
-        didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kTextSelectEnd)) {
-        select_end_callback_ = event_call_back;
-        didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kTextSelectChange)) {
-        select_change_callback_ = event_call_back;
-        didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kTextSelectCancel)) {
-        select_cancel_callback_ = event_call_back;
-        didHand = true;
-    }
-    return didHand;
+    auto setter = PropSetters().Find(prop_key);
+    return setter != nullptr && setter(*this, prop_value, event_call_back);
+}
+
+const KRPropKeyJumpTable<KRView::PropSetter> &KRView::PropSetters() {
+    static const KRPropKeyJumpTable<PropSetter> gSetters({
+        {kPropNameTouchDown,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             return self.RegisterTouchDownEvent(event_call_back);
+         }},
+        {kPropNameTouchMove,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             return self.RegisterTouchMoveEvent(event_call_back);
+         }},
+        {kPropNameTouchUp,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             return self.RegisterTouchUpEvent(event_call_back);
+         }},
+        {kPropNamePreventTouch,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             if (self.super_touch_handler_) {
+                 self.super_touch_handler_->PreventTouch(prop_value->toBool());
+             }
+             return true;
+         }},
+        {kPropNameSuperTouch,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             if (prop_value->toBool()) {
+                 if (!self.super_touch_handler_) {
+                     self.super_touch_handler_ = std::make_shared<SuperTouchHandler>();
+                 }
+             } else {
+                 if (self.super_touch_handler_) {
+                     self.super_touch_handler_ = nullptr;
+                 }
+             }
+             return true;
+         }},
+        {kPropNameHitTestModeOhos,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             return self.SetTargetHitTestMode(prop_value->toString());
+         }},
+        {kPropNameStopPropagation,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             self.stop_propagation_ = prop_value->toBool();
+             return true;
+         }},
+        {kTextSelectable,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             self.selectable_option_ = static_cast<SelectableOption>(prop_value->toInt());
+             return true;
+         }},
+        {kTextSelectStart,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             self.select_start_callback_ = event_call_back;
+             return true;
+         }},
+        {kTextSelectEnd,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             self.select_end_callback_ = event_call_back;
+             return true;
+         }},
+        {kTextSelectChange,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             self.select_change_callback_ = event_call_back;
+             return true;
+         }},
+        {kTextSelectCancel,
+         [](KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             self.select_cancel_callback_ = event_call_back;
+             return true;
+         }},
+    });
+    return gSetters;
 }
 
 void KRView::DidSetProp(const std::string &prop_key) {
@@ -380,49 +409,81 @@ void KRView::OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_ty
 }
 
 bool KRView::ResetProp(const std::string &prop_key) {
-    auto didHande = false;
     register_touch_event_ = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameTouchDown)) {
-        touch_down_callback_ = nullptr;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchMove)) {
-        touch_move_callback_ = nullptr;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchUp)) {
-        touch_up_callback_ = nullptr;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNamePreventTouch)) {
-        // reset handled by kPropNameSuperTouch, do nothing here
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameSuperTouch)) {
-        super_touch_handler_ = nullptr;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameHitTestModeOhos)) {
-        target_hit_test_mode = ARKUI_HIT_TEST_MODE_DEFAULT;
-        UpdateHitTestMode(HasBaseEvent() || HasTouchEvent());
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameStopPropagation)) {
-        stop_propagation_ = false;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kTextSelectable)) {
-        selectable_option_ = ENABLE;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kTextSelectStart)) {
-        select_start_callback_ = nullptr;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kTextSelectEnd)) {
-        select_end_callback_ = nullptr;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kTextSelectChange)) {
-        select_change_callback_ = nullptr;
-        didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kTextSelectCancel)) {
-        select_cancel_callback_ = nullptr;
-        didHande = true;
-    } else {
-        didHande = IKRRenderViewExport::ResetProp(prop_key);
-    }
-    return didHande;
+    auto resetter = PropResetters().Find(prop_key);
+    if (resetter != nullptr) {
+        return resetter(*this);
+    }
+    return IKRRenderViewExport::ResetProp(prop_key);
+}
+
+const KRPropKeyJumpTable<KRView::PropResetter> &KRView::PropResetters() {
+    static const KRPropKeyJumpTable<PropResetter> gResetters({
+        {kPropNameTouchDown,
+         [](KRView &self) {
+             self.touch_down_callback_ = nullptr;
+             return true;
+         }},
+        {kPropNameTouchMove,
+         [](KRView &self) {
+             self.touch_move_callback_ = nullptr;
+             return true;
+         }},
+        {kPropNameTouchUp,
+         [](KRView &self) {
+             self.touch_up_callback_ = nullptr;
+             return true;
+         }},
+        {kPropNamePreventTouch,
+         [](KRView &self) {
+             // reset handled by kPropNameSuperTouch, do nothing here
+             return true;
+         }},
+        {kPropNameSuperTouch,
+         [](KRView &self) {
+             self.super_touch_handler_ = nullptr;
+             return true;
+         }},
+        {kPropNameHitTestModeOhos,
+         [](KRView &self) {
+             self.target_hit_test_mode = ARKUI_HIT_TEST_MODE_DEFAULT;
+             // 强制重新下发：事件属性可能先于或晚于本属性重置，using 状态不变时旧的 target 模式会残留在节点上
+             self.using_target_hit_test_mode = -1;
+             self.UpdateHitTestMode(self.HasBaseEvent() || self.HasTouchEvent());
+             return true;
+         }},
+        {kPropNameStopPropagation,
+         [](KRView &self) {
+             self.stop_propagation_ = false;
+             return true;
+         }},
+        {kTextSelectable,
+         [](KRView &self) {
+             self.selectable_option_ = ENABLE;
+             return true;
+         }},
+        {kTextSelectStart,
+         [](KRView &self) {
+             self.select_start_callback_ = nullptr;
+             return true;
+         }},
+        {kTextSelectEnd,
+         [](KRView &self) {
+             self.select_end_callback_ = nullptr;
+             return true;
+         }},
+        {kTextSelectChange,
+         [](KRView &self) {
+             self.select_change_callback_ = nullptr;
+             return true;
+         }},
+        {kTextSelectCancel,
+         [](KRView &self) {
+             self.select_cancel_callback_ = nullptr;
+             return true;
+         }},
+    });
+    return gResetters;
 }
 
 void KRView::ProcessTouchEvent(ArkUI_NodeEvent *event) {
@@ -619,6 +680,16 @@ void KRView::WillRemoveFromParentView() {
     super_touch_type_ = UNKNOWN;
 }
 
+void KRView::DidAdopt() {
+    IKRRenderViewExport::DidAdopt();
+    // 选区记录的文本 view 属于原页面，换页面后释放并隐藏选择手柄
+    last_selected_text_views_.clear();
+    if (selection_info_.visible) {
+        selection_info_.visible = false;
+        UpdateSelectionHandles();
+    }
+}
+
 std::vector<std::shared_ptr<KRRichTextView>> KRView::GetSelectedNodes(KRPoint p0, KRPoint p1) {
     std::vector<std::shared_ptr<KRRichTextView>> result;
     auto irender_view = GetRootView().lock();
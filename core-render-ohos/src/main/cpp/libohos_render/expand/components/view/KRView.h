@@ -45,12 +45,19 @@ class KRView : public IKRRenderViewExport {
     void DidSetProp(const std::string &prop_key) override;
     void CallMethod(const std::string &method, const KRAnyValue &params, const KRRenderCallback &callback) override;
     void WillRemoveFromParentView() override;
+    void DidAdopt() override;
     std::shared_ptr<SuperTouchHandler> GetSuperTouchHandler() { return super_touch_handler_; }
 
  protected:
     bool IsSelectable() override;
 
  private:
+    using PropSetter = bool (*)(KRView &self, const KRAnyValue &prop_value, const KRRenderCallback &event_call_back);
+    using PropResetter = bool (*)(KRView &self);
+    // 组件属性分发表，按属性id索引
+    static const KRPropKeyJumpTable<PropSetter> &PropSetters();
+    static const KRPropKeyJumpTable<PropResetter> &PropResetters();
+
     void StopObservingInternalScrollViews();
     void CalculateHandleFramesAndDoUpdate();
     void OnInternalScrollViewDidScroll(float offsetX, float offsetY);
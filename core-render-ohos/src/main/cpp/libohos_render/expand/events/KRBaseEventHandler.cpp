@@ -42,23 +42,8 @@ KRBaseEventHandler::KRBaseEventHandler(const std::shared_ptr<KRConfig> &kr_confi
 
 bool KRBaseEventHandler::SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, const std::string &prop_key,
                                  const KRAnyValue &prop_value, const KRRenderCallback event_call_back) {
-    auto didHanded = false;
-    if (event_call_back != nullptr) {
-        if (kuikly::util::isEqual(prop_key, kClickEventName)) {
-            didHanded = RegisterOnClick(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kDoubleClickEventName)) {
-            didHanded = RegisterOnDoubleClick(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kLongPressEventName)) {
-            didHanded = RegisterOnLongPress(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kPanEventName)) {
-            didHanded = RegisterOnPan(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kPinchEventName)) {
-            didHanded = RegisterOnPinch(view_export, event_call_back);
-        }
-    } else if (kuikly::util::isEqual(prop_key, kCaptureAttrName)) {
-        didHanded = SetCaptureRule(view_export, prop_value->toString());
-    }
-    return didHanded;
+    auto setter = PropSetters().Find(prop_key);
+    return setter != nullptr && setter(*this, view_export, prop_value, event_call_back);
 }
 
 bool KRBaseEventHandler::OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_type) {
@@ -87,28 +72,86 @@ bool KRBaseEventHandler::OnGestureEvent(const std::shared_ptr<KRGestureEventData
 }
 
 bool KRBaseEventHandler::ResetProp(const std::string &prop_key) {
-    auto didHanded = false;
-    if (kuikly::util::isEqual(prop_key, kClickEventName)) {
-        click_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kDoubleClickEventName)) {
-        double_click_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kLongPressEventName)) {
-        long_press_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPanEventName)) {
-        pan_event_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPinchEventName)) {
-        pinch_event_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kCaptureAttrName)) {
-        // KREventDispatchCenter has reset by view_export->UnregisterEvent()
-        has_capture_rule_ = false;
-        didHanded = true;
-    }
-    return didHanded;
+    return ResetProp(KRPropKeyTable::GetInstance().Find(prop_key));
+}
+
+bool KRBaseEventHandler::ResetProp(KRPropKeyId prop_id) {
+    auto resetter = PropResetters().Find(prop_id);
+    return resetter != nullptr && resetter(*this);
+}
+
+const KRPropKeyJumpTable<KRBaseEventHandler::PropSetter> &KRBaseEventHandler::PropSetters() {
+    // 手势事件需要callback，capture属性需要值
+    static const KRPropKeyJumpTable<PropSetter> gSetters({
+        {kClickEventName,
+         [](KRBaseEventHandler &self, const std::shared_ptr<IKRRenderViewExport> &view_export,
+            const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             return event_call_back != nullptr && self.RegisterOnClick(view_export, event_call_back);
+         }},
+        {kDoubleClickEventName,
+         [](KRBaseEventHandler &self, const std::shared_ptr<IKRRenderViewExport> &view_export,
+            const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             return event_call_back != nullptr && self.RegisterOnDoubleClick(view_export, event_call_back);
+         }},
+        {kLongPressEventName,
+         [](KRBaseEventHandler &self, const std::shared_ptr<IKRRenderViewExport> &view_export,
+            const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             return event_call_back != nullptr && self.RegisterOnLongPress(view_export, event_call_back);
+         }},
+        {kPanEventName,
+         [](KRBaseEventHandler &self, const std::shared_ptr<IKRRenderViewExport> &view_export,
+            const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             return event_call_back != nullptr && self.RegisterOnPan(view_export, event_call_back);
+         }},
+        {kPinchEventName,
+         [](KRBaseEventHandler &self, const std::shared_ptr<IKRRenderViewExport> &view_export,
+            const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             return event_call_back != nullptr && self.RegisterOnPinch(view_export, event_call_back);
+         }},
+        {kCaptureAttrName,
+         [](KRBaseEventHandler &self, const std::shared_ptr<IKRRenderViewExport> &view_export,
+            const KRAnyValue &prop_value, const KRRenderCallback &event_call_back) {
+             return event_call_back == nullptr && self.SetCaptureRule(view_export, prop_value->toString());
+         }},
+    });
+    return gSetters;
+}
+
+const KRPropKeyJumpTable<KRBaseEventHandler::PropResetter> &KRBaseEventHandler::PropResetters() {
+    static const KRPropKeyJumpTable<PropResetter> gResetters({
+        {kClickEventName,
+         [](KRBaseEventHandler &self) {
+             self.click_callback_ = nullptr;
+             return true;
+         }},
+        {kDoubleClickEventName,
+         [](KRBaseEventHandler &self) {
+             self.double_click_callback_ = nullptr;
+             return true;
+         }},
+        {kLongPressEventName,
+         [](KRBaseEventHandler &self) {
+             self.long_press_callback_ = nullptr;
+             return true;
+         }},
+        {kPanEventName,
+         [](KRBaseEventHandler &self) {
+             self.pan_event_callback_ = nullptr;
+             return true;
+         }},
+        {kPinchEventName,
+         [](KRBaseEventHandler &self) {
+             self.pinch_event_callback_ = nullptr;
+             return true;
+         }},
+        {kCaptureAttrName,
+         [](KRBaseEventHandler &self) {
+             // KREventDispatchCenter has reset by view_export->UnregisterEvent()
+             self.has_capture_rule_ = false;
+             return true;
+         }},
+    });
+    return gResetters;
 }
 
 void KRBaseEventHandler::OnDestroy() {
@@ -20,6 +20,7 @@
 #include <string>
 #include "gesture/KRGestueEventType.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKeyTable.h"
 #include "libohos_render/utils/KREventUtil.h"
 #include "libohos_render/view/IKRRenderView.h"
 
@@ -39,12 +40,20 @@ class KRBaseEventHandler : public std::enable_shared_from_this<KRBaseEventHandle
     virtual bool OnGestureEvent(const std::shared_ptr<KRGestureEventData> &gesture_event_data,
                         const KRGestureEventType &event_type);
     virtual bool ResetProp(const std::string &prop_key);
+    virtual bool ResetProp(KRPropKeyId prop_id);
     virtual void OnDestroy();
     // 是否含有手势事件监听
     virtual bool HasTouchEvent();
     virtual bool HasCaptureRule();
 
  private:
+    using PropSetter = bool (*)(KRBaseEventHandler &self, const std::shared_ptr<IKRRenderViewExport> &view_export,
+                                const KRAnyValue &prop_value, const KRRenderCallback &event_call_back);
+    using PropResetter = bool (*)(KRBaseEventHandler &self);
+    // 基础事件分发表，按属性id索引
+    static const KRPropKeyJumpTable<PropSetter> &PropSetters();
+    static const KRPropKeyJumpTable<PropResetter> &PropResetters();
+
     bool RegisterOnClick(const std::shared_ptr<IKRRenderViewExport> &view_export,
                          const KRRenderCallback &event_callback);
     bool FireOnClickCallback(const std::shared_ptr<KRGestureEventData> &gesture_event_data);
@@ -99,6 +108,9 @@ class KRArkTSBaseEventHandler : public KRBaseEventHandler {
     bool ResetProp(const std::string &prop_key) override {
         return false;
     }
+    bool ResetProp(KRPropKeyId prop_id) override {
+        return false;
+    }
     void OnDestroy() override {
         KRBaseEventHandler::OnDestroy();
     }
@@ -17,20 +17,12 @@
 #include "libohos_render/expand/components/image/KRImageView.h"
 #include "libohos_render/expand/modules/codec/KRCodec.h"
 #include "libohos_render/expand/modules/network/KRNetworkModule.h"
+#include "libohos_render/foundation/KRCacheBudgetCoordinator.h"
 #include "libohos_render/utils/KRURIHelper.h"
 #include <cstdint>
-#include <multimedia/image_framework/image/image_source_native.h>
 #include <multimedia/image_framework/image/pixelmap_native.h>
 #include <shared_mutex>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-// Remove this declaration if compatable api is raised to 18 and above
-extern Image_ErrorCode OH_PixelmapNative_Destroy(OH_PixelmapNative **pixelmap) __attribute__((weak));
-#ifdef __cplusplus
-};
-#endif
+#include <unordered_set>
 
 constexpr char kMethodNameSetObject[] = "setObject";
 constexpr char kMethodNameCacheImage[] = "cacheImage";
@@ -73,7 +65,7 @@ OH_PixelmapNative *KRMemoryCacheModule::GetImage(const std::string &key) {
     if (it == image_cache_map_.end()) {
         return nullptr;
     } else {
-        return it->second;
+        return it->second->pixelmap.get();
     }
 }
 
@@ -100,42 +92,25 @@ KRAnyValue KRMemoryCacheModule::SetObject(const KRAnyValue &params) {
         found = image_cache_map_.find(key) != image_cache_map_.end();
     }
     if (found) {
-        OH_PixelmapNative *pixelmap = nullptr;
-        {
-            std::unique_lock<std::shared_mutex> lock(mtx_);
-            auto it = image_cache_map_.find(key);
-            if (it != image_cache_map_.end()) {
-                pixelmap = it->second;
-                image_cache_map_.erase(it);
-            }
-        }
-        if (pixelmap) {
-            ReleasePixelmap(pixelmap);
+        KRDecodedImageCache::ImagePtr image;  // 在锁外释放
+        std::unique_lock<std::shared_mutex> lock(mtx_);
+        auto it = image_cache_map_.find(key);
+        if (it != image_cache_map_.end()) {
+            image = std::move(it->second);
+            image_cache_map_.erase(it);
         }
     }
 
     return KREmptyValue();
 }
 
-OH_PixelmapNative *KRMemoryCacheModule::LoadPixelmapFromLocal(std::string &src) {
-    OH_PixelmapNative *pixelmap = nullptr;
-    OH_ImageSourceNative *source;
-    auto code = OH_ImageSourceNative_CreateFromUri(src.data(), src.length(), &source);
-    if (code == IMAGE_SUCCESS) {
-        // 通过图片解码参数创建PixelMap对象
-        OH_DecodingOptions *ops;
-        if (OH_DecodingOptions_Create(&ops) == IMAGE_SUCCESS) {
-            // 设置为AUTO会根据图片资源格式解码，如果图片资源为HDR资源则会解码为HDR的pixelmap。
-            OH_DecodingOptions_SetDesiredDynamicRange(ops, IMAGE_DYNAMIC_RANGE_AUTO);
-            OH_ImageSourceNative_CreatePixelmap(source, ops, &pixelmap);
-            OH_DecodingOptions_Release(ops);
-        }
-        OH_ImageSourceNative_Release(source);
-    } else {
-        KR_LOG_ERROR_WITH_TAG(kMemoryCacheModuleName) << "failed to create image source from uri: " << src
-                                                      << ", error code: " << code;
+KRDecodedImageCache::ImagePtr KRMemoryCacheModule::LoadImageFromLocal(const std::string &src) {
+    // 按原图尺寸解码，HDR 资源自适应；同一图片在各页面间共享解码结果
+    auto image = KRDecodedImageCache::GetInstance().DecodeSync(src, 0, 0, KRDecodedImageCache::kPixelFormatAuto);
+    if (!image) {
+        KR_LOG_ERROR_WITH_TAG(kMemoryCacheModuleName) << "failed to decode image from uri: " << src;
     }
-    return pixelmap;
+    return image;
 }
 
 KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRenderCallback &callback) {
@@ -143,10 +118,17 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
     auto src = map[kParamNameSrc]->toString();
     auto cache_key = GenerateCacheKey(src);
 
-    OH_PixelmapNative *pixelmap = GetImage(cache_key);
-    if (pixelmap) {
+    KRDecodedImageCache::ImagePtr image;
+    {
+        std::shared_lock<std::shared_mutex> lock(mtx_);
+        auto it = image_cache_map_.find(cache_key);
+        if (it != image_cache_map_.end()) {
+            image = it->second;
+        }
+    }
+    if (image) {
         // already cached, return directly
-        auto result = GenerateResult(cache_key, pixelmap);
+        auto result = GenerateResult(cache_key, image);
         if (callback) {
             callback(NewKRRenderValue(result));
         }
@@ -164,10 +146,10 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
         }
     }
     if (!isNetwork(src)) {
-        pixelmap = LoadPixelmapFromLocal(src);
-        if (pixelmap) {
-            SetImage(cache_key, pixelmap);
-            auto result = GenerateResult(cache_key, pixelmap);
+        image = LoadImageFromLocal(src);
+        if (image) {
+            SetImage(cache_key, image);
+            auto result = GenerateResult(cache_key, image);
             if (callback) {
                 callback(NewKRRenderValue(result));
             }
@@ -195,17 +177,17 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
                 } else {
                     return;
                 }
-                OH_PixelmapNative *pixelmap = nullptr;
+                KRDecodedImageCache::ImagePtr image;
                 if (res && !res->isNull() && res->isString()) {
                     auto filePath = res->toString();
                     if (!filePath.empty()) {
-                        pixelmap = module_self->LoadPixelmapFromLocal(filePath);
+                        image = module_self->LoadImageFromLocal(filePath);
                     }
                 }
                 KRRenderValueMap result;
-                if (pixelmap) {
-                    module_self->SetImage(cache_key, pixelmap);
-                    result = module_self->GenerateResult(cache_key, pixelmap);
+                if (image) {
+                    module_self->SetImage(cache_key, image);
+                    result = module_self->GenerateResult(cache_key, image);
                 } else {
                     result = module_self->GenerateError(-1, "fetch failed");
                 }
@@ -227,19 +209,12 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
     return NewKRRenderValue(std::move(result));
 }
 
-void KRMemoryCacheModule::SetImage(const std::string &cache_key, OH_PixelmapNative *pixelmap) {
-    OH_PixelmapNative *exist_pixelmap = nullptr;
-    {
-        std::unique_lock<std::shared_mutex> lock(mtx_);
-        auto it = image_cache_map_.find(cache_key);
-        if (it != image_cache_map_.end()) {
-            exist_pixelmap = it->second;
-        }
-        image_cache_map_[cache_key] = pixelmap;
-    }
-    if (exist_pixelmap) {
-        ReleasePixelmap(exist_pixelmap);
-    }
+void KRMemoryCacheModule::SetImage(const std::string &cache_key, KRDecodedImageCache::ImagePtr image) {
+    KRDecodedImageCache::ImagePtr exist_image;  // 在锁外释放
+    std::unique_lock<std::shared_mutex> lock(mtx_);
+    auto &slot = image_cache_map_[cache_key];
+    exist_image = std::move(slot);
+    slot = std::move(image);
 }
 
 std::string KRMemoryCacheModule::GenerateCacheKey(const std::string &src) {
@@ -253,23 +228,14 @@ std::string KRMemoryCacheModule::GenerateCacheKey(const std::string &src) {
     return oss.str();
 }
 
-KRRenderValueMap KRMemoryCacheModule::GenerateResult(const std::string &cache_key, OH_PixelmapNative *pixelmap) {
+KRRenderValueMap KRMemoryCacheModule::GenerateResult(const std::string &cache_key,
+                                                     const KRDecodedImageCache::ImagePtr &image) {
     KRRenderValueMap result;
     result[kStatusKeyState] = NewKRRenderValue(kCacheStateComplete);
     result[kStatusKeyErrorCode] = NewKRRenderValue(0);
     result[kStatusKeyCacheKey] = NewKRRenderValue(cache_key);
-    uint32_t width = 0;
-    uint32_t height = 0;
-    OH_Pixelmap_ImageInfo *info;
-    if (OH_PixelmapImageInfo_Create(&info) == IMAGE_SUCCESS) {
-        if (OH_PixelmapNative_GetImageInfo(pixelmap, info) == IMAGE_SUCCESS) {
-            OH_PixelmapImageInfo_GetWidth(info, &width);
-            OH_PixelmapImageInfo_GetHeight(info, &height);
-        }
-        OH_PixelmapImageInfo_Release(info);
-    }
-    result[kStatusKeyWidth] = NewKRRenderValue(static_cast<int32_t>(width));
-    result[kStatusKeyHeight] = NewKRRenderValue(static_cast<int32_t>(height));
+    result[kStatusKeyWidth] = NewKRRenderValue(image->width);
+    result[kStatusKeyHeight] = NewKRRenderValue(image->height);
     return std::move(result);
 }
 
@@ -281,24 +247,34 @@ KRRenderValueMap KRMemoryCacheModule::GenerateError(int32_t code, const std::str
     return std::move(result);
 }
 
-void KRMemoryCacheModule::OnDestroy() {
-    std::vector<OH_PixelmapNative *> to_destroy;
-    {
-        std::unique_lock<std::shared_mutex> lock(mtx_);
-        for (const auto &entry : image_cache_map_) {
-            to_destroy.push_back(entry.second);
+KRMemoryCacheModule::KRMemoryCacheModule() {
+    // 业务按 cacheKey 引用这些图片，不能被动淘汰，只参与统计
+    budget_id_ = KRCacheBudgetCoordinator::GetInstance().Register(
+        "memory_cache_module", KRCacheBudgetCoordinator::kPriorityPinned, [this] { return GetImageBytes(); }, nullptr);
+}
+
+KRMemoryCacheModule::~KRMemoryCacheModule() {
+    KRCacheBudgetCoordinator::GetInstance().Unregister(budget_id_);
+}
+
+size_t KRMemoryCacheModule::GetImageBytes() {
+    // 仍在 KRDecodedImageCache 中的位图已计入 decoded_image，这里只统计被淘汰后由本模块独自保活的部分
+    auto &decoded_cache = KRDecodedImageCache::GetInstance();
+    std::unordered_set<const KRDecodedImage *> counted;
+    std::shared_lock<std::shared_mutex> lock(mtx_);
+    size_t bytes = 0;
+    for (const auto &entry : image_cache_map_) {
+        const auto &image = entry.second;
+        if (image && !decoded_cache.IsCached(image) && counted.insert(image.get()).second) {
+            bytes += image->byte_count;
         }
-        image_cache_map_.clear();
-    }
-    for (OH_PixelmapNative *pixelmap : to_destroy) {
-        ReleasePixelmap(pixelmap);
     }
+    return bytes;
 }
 
-void KRMemoryCacheModule::ReleasePixelmap(OH_PixelmapNative *pixelmap) {
-    if (OH_PixelmapNative_Destroy) {
-        OH_PixelmapNative_Destroy(&pixelmap);
-    } else {
-        OH_PixelmapNative_Release(pixelmap);
-    }
+void KRMemoryCacheModule::OnDestroy() {
+    KRCacheBudgetCoordinator::GetInstance().Unregister(budget_id_);
+    std::unordered_map<std::string, KRDecodedImageCache::ImagePtr> to_release;  // 在锁外释放
+    std::unique_lock<std::shared_mutex> lock(mtx_);
+    to_release.swap(image_cache_map_);
 }
@@ -19,13 +19,15 @@
 #include <cstdint>
 #include <shared_mutex>
 
+#include "libohos_render/expand/components/image/KRDecodedImageCache.h"
 #include "libohos_render/export/IKRRenderModuleExport.h"
 
 constexpr char kMemoryCacheModuleName[] = "KRMemoryCacheModule";
 
 class KRMemoryCacheModule : public IKRRenderModuleExport {
  public:
-    KRMemoryCacheModule() = default;
+    KRMemoryCacheModule();
+    ~KRMemoryCacheModule();
     KRAnyValue CallMethod(bool sync, const std::string &method, KRAnyValue params,
                           const KRRenderCallback &callback) override;
 
@@ -37,16 +39,18 @@ class KRMemoryCacheModule : public IKRRenderModuleExport {
     KRAnyValue SetObject(const KRAnyValue &params);
     KRAnyValue CacheImage(const KRAnyValue &params, const KRRenderCallback &callback);
     std::string GenerateCacheKey(const std::string &src);
-    void SetImage(const std::string &cache_key, OH_PixelmapNative *pixelmap);
-    KRRenderValueMap GenerateResult(const std::string &cache_key, OH_PixelmapNative *pixelmap);
+    void SetImage(const std::string &cache_key, KRDecodedImageCache::ImagePtr image);
+    KRRenderValueMap GenerateResult(const std::string &cache_key, const KRDecodedImageCache::ImagePtr &image);
     KRRenderValueMap GenerateError(int32_t code, const std::string &message);
-    OH_PixelmapNative *LoadPixelmapFromLocal(std::string &src);
-    void ReleasePixelmap(OH_PixelmapNative *pixelmap);
+    KRDecodedImageCache::ImagePtr LoadImageFromLocal(const std::string &src);
+    size_t GetImageBytes();
 
  private:
     std::unordered_map<std::string, KRAnyValue> cache_map_;
-    std::unordered_map<std::string, OH_PixelmapNative *> image_cache_map_;
+    // 页面内持有的图片引用，解码结果与其他页面共享（KRDecodedImageCache）
+    std::unordered_map<std::string, KRDecodedImageCache::ImagePtr> image_cache_map_;
     std::shared_mutex mtx_;
+    uint64_t budget_id_ = 0;
 };
 
 #endif  // CORE_RENDER_OHOS_KRMEMORYCACHEMODULE_H
@@ -0,0 +1,244 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KRFileIOExecutor.h"
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
+
+namespace kuikly {
+namespace module {
+
+namespace {
+
+// 一个任务最多连续处理的批次数，之后重新投递，避免长队列的路径占住线程
+constexpr int kMaxBatchesPerTask = 4;
+
+bool WritevFully(int fd, std::vector<struct iovec> *iovs, uint64_t *writev_calls) {
+    size_t index = 0;
+    while (index < iovs->size()) {
+        auto written = writev(fd, iovs->data() + index, static_cast<int>(iovs->size() - index));
+        (*writev_calls)++;
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        // 部分写入：跳过已写完的 iovec，调整写了一半的那个
+        auto remaining = static_cast<size_t>(written);
+        while (index < iovs->size() && remaining >= (*iovs)[index].iov_len) {
+            remaining -= (*iovs)[index].iov_len;
+            index++;
+        }
+        if (remaining > 0) {
+            (*iovs)[index].iov_base = static_cast<char *>((*iovs)[index].iov_base) + remaining;
+            (*iovs)[index].iov_len -= remaining;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+KRFileIOExecutor &KRFileIOExecutor::GetInstance() {
+    static KRFileIOExecutor *instance = new KRFileIOExecutor(
+        [](std::function<void()> task) {
+            auto &queue = kuikly::dispatch::KRExecutor::GetInstance().Global(kuikly::dispatch::QoS::Background);
+            queue.Async(std::move(task));
+        },
+        Options());
+    return *instance;
+}
+
+KRFileIOExecutor::KRFileIOExecutor(Dispatcher dispatcher, const Options &options)
+    : dispatcher_(std::move(dispatcher)), options_(options) {}
+
+KRFileIOExecutor::~KRFileIOExecutor() {
+    Drain();
+}
+
+bool KRFileIOExecutor::Write(const std::string &path, std::string data, bool sync, Completion completion) {
+    Request request;
+    request.truncate = true;
+    request.sync = sync;
+    request.data = std::move(data);
+    request.completion = std::move(completion);
+    return Submit(path, std::move(request));
+}
+
+bool KRFileIOExecutor::Append(const std::string &path, std::string data, bool sync, Completion completion) {
+    Request request;
+    request.sync = sync;
+    request.data = std::move(data);
+    request.completion = std::move(completion);
+    return Submit(path, std::move(request));
+}
+
+bool KRFileIOExecutor::Submit(const std::string &path, Request request) {
+    const auto size = request.data.size();
+    auto has_space = [this, size] {
+        return pending_bytes_ == 0 || pending_bytes_ + size <= options_.max_pending_bytes;
+    };
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!has_space()) {
+        stats_.blocked++;
+        if (!space_cv_.wait_for(lock, std::chrono::milliseconds(options_.block_timeout_ms), has_space)) {
+            stats_.rejected++;
+            lock.unlock();
+            if (request.completion) {
+                request.completion(false, "queue full");
+            }
+            return false;
+        }
+    }
+    pending_bytes_ += size;
+    stats_.submitted++;
+    auto &state = paths_[path];
+    state.requests.push_back(std::move(request));
+    if (state.scheduled) {
+        // 该路径已有任务在处理，排在其后
+        return true;
+    }
+    state.scheduled = true;
+    inflight_tasks_++;
+    lock.unlock();
+    Schedule(path);
+    return true;
+}
+
+void KRFileIOExecutor::Schedule(const std::string &path) {
+    dispatcher_([this, path] { RunPath(path); });
+}
+
+void KRFileIOExecutor::RunPath(const std::string &path) {
+    for (int round = 0; round < kMaxBatchesPerTask; ++round) {
+        std::deque<Request> batch;
+        size_t batch_bytes = 0;
+        bool need_fsync = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto &state = paths_[path];
+            if (state.requests.empty()) {
+                break;
+            }
+            // 覆盖写只能开启一批；其后的追加写可以跟在同一批里
+            do {
+                batch_bytes += state.requests.front().data.size();
+                need_fsync = need_fsync || state.requests.front().sync;
+                batch.push_back(std::move(state.requests.front()));
+                state.requests.pop_front();
+            } while (!state.requests.empty() && !state.requests.front().truncate &&
+                     batch.size() < options_.max_batch_requests &&
+                     batch_bytes + state.requests.front().data.size() <= options_.max_batch_bytes);
+
+            auto now = std::chrono::steady_clock::now();
+            need_fsync = need_fsync || options_.fsync_policy == FsyncPolicy::kBatch ||
+                         (options_.fsync_policy == FsyncPolicy::kPeriodic && FsyncDue(state, now));
+            if (need_fsync) {
+                state.last_fsync = now;
+            }
+        }
+
+        std::string error;
+        uint64_t writev_calls = 0;
+        bool success = WriteBatch(path, batch, need_fsync, &error, &writev_calls);
+        for (auto &request : batch) {
+            if (request.completion) {
+                request.completion(success, error);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_bytes_ -= batch_bytes;
+        stats_.completed += batch.size();
+        stats_.failed += success ? 0 : batch.size();
+        stats_.batches++;
+        stats_.writev_calls += writev_calls;
+        stats_.fsync_calls += need_fsync && success ? 1 : 0;
+        stats_.bytes_written += success ? batch_bytes : 0;
+        space_cv_.notify_all();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = paths_.find(path);
+    if (!it->second.requests.empty()) {
+        // 还有请求：重新投递，让其它路径的任务有机会执行
+        lock.unlock();
+        Schedule(path);
+        return;
+    }
+    it->second.scheduled = false;
+    // 周期 fsync 的时间戳还有用时保留路径状态
+    if (options_.fsync_policy != FsyncPolicy::kPeriodic || FsyncDue(it->second, std::chrono::steady_clock::now())) {
+        paths_.erase(it);
+    }
+    inflight_tasks_--;
+    if (inflight_tasks_ == 0) {
+        idle_cv_.notify_all();
+    }
+}
+
+bool KRFileIOExecutor::FsyncDue(const PathState &state, std::chrono::steady_clock::time_point now) const {
+    return now - state.last_fsync >= std::chrono::milliseconds(options_.fsync_interval_ms);
+}
+
+bool KRFileIOExecutor::WriteBatch(const std::string &path, const std::deque<Request> &batch, bool need_fsync,
+                                  std::string *error, uint64_t *writev_calls) {
+    int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (batch.front().truncate ? O_TRUNC : O_APPEND);
+    int fd = open(path.c_str(), flags, 0644);
+    if (fd < 0) {
+        *error = std::string("open failed: ") + strerror(errno);
+        return false;
+    }
+    std::vector<struct iovec> iovs;
+    iovs.reserve(batch.size());
+    for (const auto &request : batch) {
+        if (!request.data.empty()) {
+            iovs.push_back({const_cast<char *>(request.data.data()), request.data.size()});
+        }
+    }
+    bool success = WritevFully(fd, &iovs, writev_calls);
+    if (!success) {
+        *error = std::string("writev failed: ") + strerror(errno);
+    } else if (need_fsync && fsync(fd) != 0) {
+        *error = std::string("fsync failed: ") + strerror(errno);
+        success = false;
+    }
+    close(fd);
+    return success;
+}
+
+void KRFileIOExecutor::Drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this] { return inflight_tasks_ == 0; });
+}
+
+KRFileIOExecutor::Stats KRFileIOExecutor::GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto stats = stats_;
+    stats.pending_bytes = pending_bytes_;
+    return stats;
+}
+
+}  // namespace module
+}  // namespace kuikly
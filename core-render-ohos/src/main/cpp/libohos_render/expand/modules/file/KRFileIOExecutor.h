@@ -0,0 +1,141 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace kuikly {
+namespace module {
+
+/**
+ * 文件写入执行器，替代每次写文件都起一条 detached 线程的做法。
+ *
+ * 1) 同一路径的请求严格按提交顺序执行，同一时刻只有一个任务在处理该路径；不同路径可在线程池上并行；
+ * 2) 同一路径上连续排队的追加写合并为一次 writev（覆盖写只能作为一批的第一个请求）；
+ * 3) 排队字节数超过上限时提交线程最多阻塞 block_timeout_ms，仍无空间则拒绝并回调错误；
+ * 4) fsync 策略：kNone 交给系统回写，kBatch 每批写完 fsync，kPeriodic 同一路径距上次 fsync 超过间隔时在批末 fsync；
+ *    单个请求可以要求 sync，所在批次写完后 fsync。
+ *
+ * 完成回调在 I/O 线程上执行，回调方自行切线程。路径空闲且不在 fsync 间隔内时释放其状态。
+ */
+class KRFileIOExecutor {
+ public:
+    /**
+     * 把任务投递到后台线程执行
+     */
+    using Dispatcher = std::function<void(std::function<void()> task)>;
+    /**
+     * 完成回调，失败时 error 非空
+     */
+    using Completion = std::function<void(bool success, const std::string &error)>;
+
+    enum class FsyncPolicy {
+        kNone,
+        kBatch,
+        kPeriodic,
+    };
+
+    struct Options {
+        size_t max_pending_bytes = 8 * 1024 * 1024;  // 所有路径排队中的总字节数上限
+        size_t max_batch_bytes = 1024 * 1024;        // 一次 writev 合并的字节数上限
+        size_t max_batch_requests = 64;              // 一次 writev 合并的请求数上限
+        int block_timeout_ms = 50;                   // 队列满时提交线程最多等待的时间
+        FsyncPolicy fsync_policy = FsyncPolicy::kPeriodic;
+        int fsync_interval_ms = 1000;
+    };
+
+    struct Stats {
+        uint64_t submitted = 0;       // 接受的请求数
+        uint64_t completed = 0;       // 已回调的请求数（含失败）
+        uint64_t failed = 0;          // 写入失败的请求数
+        uint64_t rejected = 0;        // 因队列满被拒绝的请求数
+        uint64_t blocked = 0;         // 提交时因队列满而等待的次数
+        uint64_t batches = 0;         // 写入批次数
+        uint64_t writev_calls = 0;    // writev 系统调用次数
+        uint64_t fsync_calls = 0;     // fsync 系统调用次数
+        uint64_t bytes_written = 0;   // 写入的字节数
+        size_t pending_bytes = 0;     // 当前排队中的字节数
+    };
+
+    static KRFileIOExecutor &GetInstance();
+
+    KRFileIOExecutor(Dispatcher dispatcher, const Options &options);
+    ~KRFileIOExecutor();
+
+    KRFileIOExecutor(const KRFileIOExecutor &) = delete;
+    KRFileIOExecutor &operator=(const KRFileIOExecutor &) = delete;
+
+    /**
+     * 覆盖写 path，文件不存在时创建
+     * @return 被拒绝时返回 false，completion 已在调用线程上以失败回调
+     */
+    bool Write(const std::string &path, std::string data, bool sync, Completion completion);
+
+    /**
+     * 追加写 path，文件不存在时创建
+     * @return 被拒绝时返回 false，completion 已在调用线程上以失败回调
+     */
+    bool Append(const std::string &path, std::string data, bool sync, Completion completion);
+
+    /**
+     * 等待已提交的请求全部完成
+     */
+    void Drain();
+
+    Stats GetStats();
+
+ private:
+    struct Request {
+        bool truncate = false;
+        bool sync = false;
+        std::string data;
+        Completion completion;
+    };
+
+    struct PathState {
+        std::deque<Request> requests;
+        bool scheduled = false;
+        std::chrono::steady_clock::time_point last_fsync;
+    };
+
+    bool Submit(const std::string &path, Request request);
+    void Schedule(const std::string &path);
+    void RunPath(const std::string &path);
+    bool FsyncDue(const PathState &state, std::chrono::steady_clock::time_point now) const;
+    static bool WriteBatch(const std::string &path, const std::deque<Request> &batch, bool need_fsync,
+                           std::string *error, uint64_t *writev_calls);
+
+    const Dispatcher dispatcher_;
+    const Options options_;
+
+    std::mutex mutex_;
+    std::condition_variable space_cv_;
+    std::condition_variable idle_cv_;
+    std::unordered_map<std::string, PathState> paths_;
+    size_t pending_bytes_ = 0;
+    int inflight_tasks_ = 0;
+    Stats stats_;
+};
+
+}  // namespace module
+}  // namespace kuikly
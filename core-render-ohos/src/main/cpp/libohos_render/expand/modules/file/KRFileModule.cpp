@@ -20,8 +20,8 @@
 #include <cstdio>
 #include <cstring>
 #include <string>
-#include <thread>
 
+#include "libohos_render/expand/modules/file/KRFileIOExecutor.h"
 #include "libohos_render/utils/KRJSONObject.h"
 
 namespace kuikly {
@@ -51,6 +51,18 @@ static KRAnyValue MakeResult(const std::string &key, const std::string &value) {
     return KRRenderValue::Make(result);
 }
 
+// ---------------------------------------------------------------------------
+// 工具：把 I/O 完成结果转成回调结果（在 I/O 线程上回调，callback 自身会切到 context 线程）
+// ---------------------------------------------------------------------------
+static KRFileIOExecutor::Completion MakeCompletion(const std::string &filePath, const KRRenderCallback &callback) {
+    if (!callback) {
+        return nullptr;
+    }
+    return [filePath, callback](bool success, const std::string &error) {
+        callback(success ? MakeResult("path", filePath) : MakeResult("error", error));
+    };
+}
+
 // ---------------------------------------------------------------------------
 // 获取 profiler 写入目录（filesDir/KuiklyProfiler/）
 // ---------------------------------------------------------------------------
@@ -69,7 +81,7 @@ std::string KRFileModule::GetProfilerDir() {
 }
 
 // ---------------------------------------------------------------------------
-// writeFile：覆盖写，在后台线程执行
+// writeFile：覆盖写，由 KRFileIOExecutor 在后台执行
 // ---------------------------------------------------------------------------
 void KRFileModule::WriteFile(const KRAnyValue &params, const KRRenderCallback &callback) {
     auto jsonObj = util::JSONObject::Parse(params->toString());
@@ -89,20 +101,12 @@ void KRFileModule::WriteFile(const KRAnyValue &params, const KRRenderCallback &c
 
     const std::string filePath = dir + "/" + filename;
 
-    std::thread([filePath, content, callback]() {
-        FILE *fp = fopen(filePath.c_str(), "w");
-        if (!fp) {
-            if (callback) callback(MakeResult("error", "fopen failed"));
-            return;
-        }
-        fwrite(content.c_str(), 1, content.size(), fp);
-        fclose(fp);
-        if (callback) callback(MakeResult("path", filePath));
-    }).detach();
+    // 报告类的整文件写入，完成回调前 fsync
+    KRFileIOExecutor::GetInstance().Write(filePath, content, true, MakeCompletion(filePath, callback));
 }
 
 // ---------------------------------------------------------------------------
-// appendFile：追加写，末尾加换行（适合 JSONL），在后台线程执行
+// appendFile：追加写，末尾加换行（适合 JSONL），由 KRFileIOExecutor 在后台执行
 // ---------------------------------------------------------------------------
 void KRFileModule::AppendFile(const KRAnyValue &params, const KRRenderCallback &callback) {
     auto jsonObj = util::JSONObject::Parse(params->toString());
@@ -122,18 +126,8 @@ void KRFileModule::AppendFile(const KRAnyValue &params, const KRRenderCallback &
 
     const std::string filePath = dir + "/" + filename;
 
-    std::thread([filePath, content, callback]() {
-        FILE *fp = fopen(filePath.c_str(), "a");
-        if (!fp) {
-            if (callback) callback(MakeResult("error", "fopen failed"));
-            return;
-        }
-        // 追加内容 + 换行，适合 JSONL 格式
-        fwrite(content.c_str(), 1, content.size(), fp);
-        fwrite("\n", 1, 1, fp);
-        fclose(fp);
-        if (callback) callback(MakeResult("path", filePath));
-    }).detach();
+    // 追加内容 + 换行，适合 JSONL 格式；同一文件的追加按调用顺序落盘
+    KRFileIOExecutor::GetInstance().Append(filePath, content + "\n", false, MakeCompletion(filePath, callback));
 }
 
 // ---------------------------------------------------------------------------
@@ -18,8 +18,8 @@
 KRAnyValue KRForwardArkTSModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
                                             const KRRenderCallback &callback, bool callback_keep_alive) {
     if (sync) {
-        return SyncCallArkTSMethod(method, params, callback, callback_keep_alive);
+        return SyncCallArkTSMethod(method, std::move(params), callback, callback_keep_alive);
     } else {
-        return CallArkTSMethod(method, params, callback, callback_keep_alive);
+        return CallArkTSMethod(method, std::move(params), callback, callback_keep_alive);
     }
 }
@@ -24,6 +24,10 @@ constexpr char kMethodNameLogError[] = "logError";
 
 KRAnyValue KRLogModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
                                    const KRRenderCallback &callback) {
+    // 级别关闭时直接丢弃，不再转字符串、切线程
+    if (!IsMethodEnabled(method)) {
+        return KREmptyValue();
+    }
     // if use has set a C/C++ adapter, then redirect it directly throw it,
     // otherwise redirect logs to the arkts version.
     if (KRRenderAdapterManager::GetInstance().HasCustomLogAdapter()) {
@@ -35,19 +39,52 @@ KRAnyValue KRLogModule::CallMethod(bool sync, const std::string &method, KRAnyVa
             LogError(params);
         }
     } else {
-        auto instance_id = GetInstanceId();
-        auto method_name = method;
-        KRContextScheduler::ScheduleTaskOnMainThread(false, [instance_id, method_name, params] {
-            auto module_name = NewKRRenderValue("KRLogModuleArkTS");
-
-            KRArkTSManager::GetInstance().CallArkTSMethod(instance_id, KRNativeCallArkTSMethod::CallModuleMethod,
-                                                          module_name, NewKRRenderValue(method_name), params, nullptr,
-                                                          nullptr, nullptr);
-        });
+        PostToArkTS(method, params);
     }
     return KREmptyValue();
 }
 
+bool KRLogModule::IsMethodEnabled(const std::string &method) {
+    if (kuikly::util::isEqual(method, kMethodNameLogInfo)) {
+        return KRRenderLog::IsEnabled(LOG_INFO);
+    }
+    if (kuikly::util::isEqual(method, kMethodNameLogDebug)) {
+        return KRRenderLog::IsEnabled(LOG_DEBUG);
+    }
+    if (kuikly::util::isEqual(method, kMethodNameLogError)) {
+        return KRRenderLog::IsEnabled(LOG_ERROR);
+    }
+    return true;
+}
+
+void KRLogModule::PostToArkTS(const std::string &method, const KRAnyValue &params) {
+    // 同一批日志只切一次主线程，主线程任务执行前到达的日志追加到同一批
+    bool need_schedule = false;
+    {
+        std::lock_guard<std::mutex> lock(pending_arkts_logs_->mutex);
+        need_schedule = pending_arkts_logs_->logs.empty();
+        pending_arkts_logs_->logs.emplace_back(method, params);
+    }
+    if (!need_schedule) {
+        return;
+    }
+    auto instance_id = GetInstanceId();
+    auto pending_logs = pending_arkts_logs_;
+    KRContextScheduler::ScheduleTaskOnMainThread(false, [instance_id, pending_logs] {
+        std::vector<std::pair<std::string, KRAnyValue>> logs;
+        {
+            std::lock_guard<std::mutex> lock(pending_logs->mutex);
+            logs.swap(pending_logs->logs);
+        }
+        auto module_name = NewKRRenderValue("KRLogModuleArkTS");
+        for (auto &log : logs) {
+            KRArkTSManager::GetInstance().CallArkTSMethod(instance_id, KRNativeCallArkTSMethod::CallModuleMethod,
+                                                          module_name, NewKRRenderValue(log.first), log.second,
+                                                          nullptr, nullptr, nullptr);
+        }
+    });
+}
+
 void KRLogModule::LogInfo(const KRAnyValue &params) {
     auto msg = params->toString();
     auto tag = FindTag(msg);
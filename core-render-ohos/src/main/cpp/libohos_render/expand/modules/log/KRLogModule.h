@@ -16,6 +16,10 @@
 #ifndef CORE_RENDER_OHOS_KRLOGMODULE_H
 #define CORE_RENDER_OHOS_KRLOGMODULE_H
 
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 #include "libohos_render/export/IKRRenderModuleExport.h"
 
 constexpr char kLogModuleName[] = "KRLogModule";
@@ -28,10 +32,20 @@ class KRLogModule : public IKRRenderModuleExport {
                           const KRRenderCallback &callback) override;
 
  private:
+    struct PendingArkTSLogs {
+        std::mutex mutex;
+        std::vector<std::pair<std::string, KRAnyValue>> logs;
+    };
+
+    bool IsMethodEnabled(const std::string &method);
+    void PostToArkTS(const std::string &method, const KRAnyValue &params);
     void LogInfo(const KRAnyValue &params);
     void LogDebug(const KRAnyValue &params);
     void LogError(const KRAnyValue &params);
     std::string FindTag(const std::string &msg);
+
+    // 待转发到 ArkTS 的日志，主线程任务持有共享引用，模块销毁后仍可安全读取
+    std::shared_ptr<PendingArkTSLogs> pending_arkts_logs_ = std::make_shared<PendingArkTSLogs>();
 };
 
 #endif  // CORE_RENDER_OHOS_KRLOGMODULE_H
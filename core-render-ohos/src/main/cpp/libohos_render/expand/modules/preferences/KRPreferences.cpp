@@ -16,8 +16,9 @@
 #include "KRPreferences.h"
 
 #include <fcntl.h>
+#include <filesystem>
 #include <fstream>
-#include <thread>
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
 #include "thirdparty/tinyXml/tinyxml2.h"
 
 namespace kuikly {
@@ -82,10 +83,40 @@ DataPreferences::DataPreferences(const std::string &filesDir, const std::string
     std::filesystem::path preferencesName = filesName;
     std::filesystem::path fullPath = preferencesPath / preferencesName;
     this->preferencesFullPath_ = fullPath;
+    // 提交任务同一时刻最多只有一个在排队，放到后台线程池即可保证串行
+    store_ = std::make_unique<KRPreferencesLogStore>(
+        preferencesFullPath_ + ".krkv",
+        [](std::function<void()> task) {
+            auto &queue = kuikly::dispatch::KRExecutor::GetInstance().Global(kuikly::dispatch::QoS::Background);
+            queue.Async(std::move(task));
+        });
+    store_->Open();
+    this->MigrateFromXmlIfNeeded();
+}
+
+DataPreferences::~DataPreferences() = default;
+
+void DataPreferences::MigrateFromXmlIfNeeded() {
+    std::error_code ec;
+    if (!std::filesystem::exists(this->preferencesFullPath_, ec)) {
+        return;
+    }
     try {
-        keyValueMap_ = this->LoadFileToMap(this->preferencesFullPath_);
+        auto keyValueMap = this->LoadFileToMap(this->preferencesFullPath_);
+        for (const auto &pair : keyValueMap) {
+            // 迁移前已有的新数据优先
+            std::string value;
+            if (!store_->Get(pair.first, &value)) {
+                store_->Put(pair.first, pair.second);
+            }
+        }
     } catch (const std::exception &e) {
         // KLOG_ERROR(TAG) << "Failed to load keyValueMap_ via file";
+        return;
+    }
+    // 落盘成功后才移走旧文件，失败时下次启动重新迁移
+    if (store_->FlushSync()) {
+        std::filesystem::rename(this->preferencesFullPath_, this->preferencesFullPath_ + ".migrated", ec);
     }
 }
 
@@ -95,65 +126,20 @@ DataPreferences& DataPreferences::GetInstance(const std::string &filesDir, const
 }
 
 void DataPreferences::SetSync(const std::string &key, const std::string &value) {
-    std::unique_lock<std::mutex> lock(this->mtx_);
-    this->keyValueMap_[key] = value;
-    lock.unlock();
+    store_->Put(key, value);
 }
 
 std::string DataPreferences::GetSync(const std::string &key, const std::string &defaultValue) {
-    std::unique_lock<std::mutex> lock(this->mtx_);
-    auto it = this->keyValueMap_.find(key);
-    auto value = it != this->keyValueMap_.end() ? it->second : defaultValue;
-    lock.unlock();
-    return value;
+    std::string value;
+    return store_->Get(key, &value) ? value : defaultValue;
 }
 
 void DataPreferences::Flush() {
-    std::thread([this]() { this->FlushSync(); }).detach();
+    store_->Flush();
 }
 
 void DataPreferences::FlushSync() {
-    std::filesystem::path preferencesFullPath = this->preferencesFullPath_;
-    tinyxml2::XMLDocument doc;
-    tinyxml2::XMLDeclaration *decl = doc.NewDeclaration();
-    doc.InsertFirstChild(decl);
-
-    tinyxml2::XMLElement *root = doc.NewElement("preferences");
-    root->SetAttribute("version", "1.0");
-    doc.InsertEndChild(root);
-    std::unique_lock<std::mutex> lock(this->mtx_);
-    auto copyMap = this->keyValueMap_;
-    lock.unlock();
-    for (const auto &pair : copyMap) {
-        tinyxml2::XMLElement *element = doc.NewElement("string");
-        element->SetAttribute("key", pair.first.c_str());
-        element->SetText(pair.second.c_str());
-        root->InsertEndChild(element);
-    }
-    FILE *fp = fopen(preferencesFullPath.c_str(), "w");
-    if (fp == nullptr) {
-        // KLOG_ERROR(TAG) << "Error opening file: " << preferencesFullPath;
-        return;
-    }
-    // 文件加锁
-    int fd = fileno(fp);
-    struct flock fileLock;
-    fileLock.l_type = F_WRLCK;
-    fileLock.l_whence = SEEK_SET;
-    fileLock.l_start = 0;
-    fileLock.l_len = 0;
-    fcntl(fd, F_SETLKW, &fileLock);  // F_SETLKW:阻塞模式
-
-    if (doc.SaveFile(fp) == tinyxml2::XML_SUCCESS) {
-        // KLOG_INFO(TAG) << "Preferences Flush success";
-    } else {
-        // KLOG_ERROR(TAG) << "Preferences Flush: tinyxml2 save error";
-    }
-
-    // 文件解锁
-    fileLock.l_type = F_UNLCK;
-    fcntl(fd, F_SETLKW, &fileLock);
-    fclose(fp);
+    store_->FlushSync();
 }
 
 }  //  namespace util
@@ -13,9 +13,11 @@
  * limitations under the License.
  */
 #pragma once
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <unordered_map>
+#include "libohos_render/expand/modules/preferences/KRPreferencesLogStore.h"
 
 namespace kuikly {
 namespace util {
@@ -28,9 +30,13 @@ namespace util {
 // #define PREFERENCES_PATH "/data/storage/el2/base/haps/entry/CAPIpreferences/"
 static const char *TAG = __FILE_NAME__;
 
+/**
+ * 数据由 KRPreferencesLogStore 追加写到 <filesName>.krkv；旧版本整文件重写的 XML 文件在首次打开时迁移一次
+ */
 class DataPreferences {
  public:
     DataPreferences(const std::string &filesDir, const std::string &filesName);
+    ~DataPreferences();
     void SetSync(const std::string &key, const std::string &value);
     std::string GetSync(const std::string &key, const std::string &defaultValue);
     void Flush();
@@ -39,9 +45,9 @@ class DataPreferences {
 
  private:
     std::string preferencesFullPath_;
-    std::unordered_map<std::string, std::string> keyValueMap_;
-    std::mutex mtx_;
+    std::unique_ptr<KRPreferencesLogStore> store_;
     std::unordered_map<std::string, std::string> LoadFileToMap(const std::string &preferencesFullPath);
+    void MigrateFromXmlIfNeeded();
     void CreatePreferencesDirectoryIfNeeded(const std::string &filePath);
 };
 }  //  namespace util
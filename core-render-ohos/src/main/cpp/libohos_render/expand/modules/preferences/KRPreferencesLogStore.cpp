@@ -0,0 +1,458 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KRPreferencesLogStore.h"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include "libohos_render/utils/KRPixelKernels.h"
+
+namespace kuikly {
+namespace util {
+
+namespace {
+
+void WriteU32(uint8_t *dst, uint32_t value) {
+    memcpy(dst, &value, sizeof(value));
+}
+
+uint32_t ReadU32(const uint8_t *src) {
+    uint32_t value;
+    memcpy(&value, src, sizeof(value));
+    return value;
+}
+
+void WriteHeader(uint8_t *dst) {
+    memset(dst, 0, KRPreferencesLogStore::kHeaderSize);
+    WriteU32(dst, KRPreferencesLogStore::kMagic);
+    WriteU32(dst + 4, KRPreferencesLogStore::kVersion);
+}
+
+bool IsValidHeader(const uint8_t *src) {
+    return ReadU32(src) == KRPreferencesLogStore::kMagic && ReadU32(src + 4) == KRPreferencesLogStore::kVersion;
+}
+
+size_t CapacityFor(size_t used) {
+    size_t capacity = KRPreferencesLogStore::kInitialCapacity;
+    while (capacity < used * 2) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+bool WriteFully(int fd, const uint8_t *data, size_t length, off_t offset) {
+    while (length > 0) {
+        auto written = pwrite(fd, data, length, offset);
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        length -= written;
+        offset += written;
+    }
+    return true;
+}
+
+/**
+ * 打开文件并加独占锁，锁在 fd 关闭前一直持有；已被其它进程（或本进程另一个 store）持有时返回 -1。
+ * 持锁方压缩时会用新文件 rename 覆盖 path，加锁后需确认锁住的仍是 path 当前指向的文件
+ */
+int OpenAndLock(const std::string &path) {
+    for (int attempt = 0; attempt < 3; ++attempt) {
+        int fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0660);
+        if (fd < 0) {
+            return -1;
+        }
+        if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+            close(fd);
+            return -1;
+        }
+        struct stat fd_stat;
+        struct stat path_stat;
+        if (fstat(fd, &fd_stat) == 0 && stat(path.c_str(), &path_stat) == 0 && fd_stat.st_dev == path_stat.st_dev &&
+            fd_stat.st_ino == path_stat.st_ino) {
+            return fd;
+        }
+        close(fd);
+    }
+    return -1;
+}
+
+}  // namespace
+
+KRPreferencesLogStore::KRPreferencesLogStore(const std::string &path, Dispatcher io_dispatcher)
+    : path_(path), io_dispatcher_(std::move(io_dispatcher)) {}
+
+KRPreferencesLogStore::~KRPreferencesLogStore() {
+    {
+        // 排队中的提交任务持有 this，等它们执行完
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_cv_.wait(lock, [this] { return inflight_tasks_ == 0; });
+    }
+    FlushSync();
+    std::lock_guard<std::mutex> io_lock(io_mutex_);
+    CloseLocked();
+}
+
+bool KRPreferencesLogStore::Open() {
+    std::lock_guard<std::mutex> io_lock(io_mutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    fd_ = OpenAndLock(path_);
+    if (fd_ < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd_, &st) != 0) {
+        CloseLocked();
+        return false;
+    }
+    auto file_size = static_cast<size_t>(st.st_size);
+    if (file_size < kHeaderSize) {
+        // 新文件，或创建时文件头未写完
+        return InitializeLocked();
+    }
+    if (!MapLocked(file_size)) {
+        // 映射失败（如地址空间不足）不代表文件损坏，保留文件，本次只在内存中读写
+        CloseLocked();
+        return false;
+    }
+    if (IsValidHeader(map_)) {
+        ReplayLocked(file_size);
+        return true;
+    }
+    // 文件头不可识别（非本格式或已损坏），保留原文件后重建
+    UnmapLocked();
+    rename(path_.c_str(), (path_ + ".corrupt").c_str());
+    close(fd_);
+    fd_ = OpenAndLock(path_);
+    if (fd_ < 0) {
+        return false;
+    }
+    return InitializeLocked();
+}
+
+bool KRPreferencesLogStore::InitializeLocked() {
+    UnmapLocked();
+    if (ftruncate(fd_, 0) != 0 || ftruncate(fd_, kInitialCapacity) != 0 || !MapLocked(kInitialCapacity)) {
+        CloseLocked();
+        return false;
+    }
+    WriteHeader(map_);
+    log_end_ = kHeaderSize;
+    stats_.log_bytes = log_end_;
+    return SyncRangeLocked(0, kHeaderSize);
+}
+
+void KRPreferencesLogStore::ReplayLocked(size_t file_size) {
+    size_t offset = kHeaderSize;
+    while (offset + kRecordHeaderSize <= file_size) {
+        auto crc = ReadU32(map_ + offset);
+        auto payload_len = ReadU32(map_ + offset + 4);
+        // payload 至少包含 type 与 key_len
+        if (payload_len < 5 || payload_len > kMaxPayloadBytes || payload_len > file_size - offset - kRecordHeaderSize) {
+            break;
+        }
+        if (KRPixelKernels::Crc32(map_ + offset + 4, 4 + payload_len) != crc) {
+            break;
+        }
+        auto *payload = map_ + offset + kRecordHeaderSize;
+        auto type = static_cast<RecordType>(payload[0]);
+        auto key_len = ReadU32(payload + 1);
+        if ((type != kRecordPut && type != kRecordRemove) || key_len > payload_len - 5) {
+            break;
+        }
+        auto *key = reinterpret_cast<const char *>(payload + 5);
+        ApplyLocked(type, std::string(key, key_len), std::string(key + key_len, payload_len - 5 - key_len));
+        offset += kRecordHeaderSize + payload_len;
+        stats_.recovered_records++;
+    }
+    log_end_ = offset;
+    // 有效记录之后应全部为 0，否则是写到一半的记录：清零，避免之后追加的短记录后面残留可被误读的内容
+    for (size_t i = offset; i < file_size; ++i) {
+        if (map_[i] != 0) {
+            stats_.tail_discarded = true;
+            memset(map_ + offset, 0, file_size - offset);
+            SyncRangeLocked(offset, file_size);
+            break;
+        }
+    }
+    stats_.log_bytes = log_end_;
+}
+
+bool KRPreferencesLogStore::Get(const std::string &key, std::string *value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return false;
+    }
+    *value = it->second;
+    return true;
+}
+
+void KRPreferencesLogStore::Put(const std::string &key, const std::string &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end() && it->second == value) {
+        return;
+    }
+    EncodeRecord(&pending_, kRecordPut, key, value);
+    pending_records_++;
+    ApplyLocked(kRecordPut, key, value);
+}
+
+void KRPreferencesLogStore::Remove(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.find(key) == entries_.end()) {
+        return;
+    }
+    EncodeRecord(&pending_, kRecordRemove, key, "");
+    pending_records_++;
+    ApplyLocked(kRecordRemove, key, "");
+}
+
+size_t KRPreferencesLogStore::Size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void KRPreferencesLogStore::Flush() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (commit_scheduled_ || pending_.empty()) {
+            return;
+        }
+        commit_scheduled_ = true;
+        inflight_tasks_++;
+    }
+    auto task = [this] {
+        {
+            // 开始提交后到达的写入需要新的提交任务
+            std::lock_guard<std::mutex> lock(mutex_);
+            commit_scheduled_ = false;
+        }
+        CommitPending(false);
+        std::lock_guard<std::mutex> lock(mutex_);
+        inflight_tasks_--;
+        idle_cv_.notify_all();
+    };
+    if (io_dispatcher_) {
+        io_dispatcher_(std::move(task));
+    } else {
+        task();
+    }
+}
+
+bool KRPreferencesLogStore::FlushSync() {
+    return CommitPending(false);
+}
+
+bool KRPreferencesLogStore::Compact() {
+    return CommitPending(true);
+}
+
+KRPreferencesLogStore::Stats KRPreferencesLogStore::GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto stats = stats_;
+    stats.live_bytes = live_bytes_;
+    return stats;
+}
+
+bool KRPreferencesLogStore::CommitPending(bool force_compact) {
+    std::lock_guard<std::mutex> io_lock(io_mutex_);
+    std::vector<uint8_t> records;
+    std::vector<uint8_t> snapshot;
+    uint64_t record_count = 0;
+    bool compact = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        records.swap(pending_);
+        record_count = pending_records_;
+        pending_records_ = 0;
+        if (fd_ < 0) {
+            return false;  // 文件不可用，只保留内存表
+        }
+        size_t projected = log_end_ + records.size();
+        compact = (force_compact || (projected > kCompactMinBytes && projected > kCompactRatio * live_bytes_));
+        if (compact) {
+            // 快照与取走待提交记录在同一把锁内完成，快照已包含这些记录
+            snapshot = EncodeSnapshotLocked();
+        }
+    }
+    if (!compact && records.empty()) {
+        return true;
+    }
+    bool ok = compact ? RewriteLocked(snapshot) : AppendLocked(records);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!ok) {
+        // 写入失败时放回待提交缓冲，下次提交重试
+        records.insert(records.end(), pending_.begin(), pending_.end());
+        pending_.swap(records);
+        pending_records_ += record_count;
+        return false;
+    }
+    stats_.commit_count++;
+    stats_.committed_records += record_count;
+    if (compact) {
+        stats_.compaction_count++;
+    }
+    stats_.log_bytes = log_end_;
+    return true;
+}
+
+bool KRPreferencesLogStore::AppendLocked(const std::vector<uint8_t> &records) {
+    size_t required = log_end_ + records.size();
+    if (required > capacity_) {
+        // 扩容：重新截断文件长度并映射，新增部分由文件系统补 0
+        size_t capacity = std::max(capacity_, kInitialCapacity);
+        while (capacity < required) {
+            capacity *= 2;
+        }
+        UnmapLocked();
+        if (ftruncate(fd_, capacity) != 0 || !MapLocked(capacity)) {
+            if (!MapLocked(capacity_)) {
+                CloseLocked();  // 连原映射都恢复不了，之后只在内存中读写
+            }
+            return false;
+        }
+    }
+    memcpy(map_ + log_end_, records.data(), records.size());
+    if (!SyncRangeLocked(log_end_, required)) {
+        return false;
+    }
+    log_end_ = required;
+    return true;
+}
+
+bool KRPreferencesLogStore::RewriteLocked(const std::vector<uint8_t> &records) {
+    auto temp_path = path_ + ".compact";
+    int temp_fd = open(temp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0660);
+    if (temp_fd < 0) {
+        return false;
+    }
+    // rename 后新文件即为日志，先加锁，关闭旧 fd 时其它进程也拿不到锁
+    if (flock(temp_fd, LOCK_EX | LOCK_NB) != 0) {
+        close(temp_fd);
+        unlink(temp_path.c_str());
+        return false;
+    }
+    size_t used = kHeaderSize + records.size();
+    size_t capacity = CapacityFor(used);
+    uint8_t header[kHeaderSize];
+    WriteHeader(header);
+    bool ok = ftruncate(temp_fd, capacity) == 0 && WriteFully(temp_fd, header, kHeaderSize, 0) &&
+              WriteFully(temp_fd, records.data(), records.size(), kHeaderSize) && fsync(temp_fd) == 0 &&
+              rename(temp_path.c_str(), path_.c_str()) == 0;
+    if (!ok) {
+        close(temp_fd);
+        unlink(temp_path.c_str());
+        return false;
+    }
+    UnmapLocked();
+    close(fd_);
+    fd_ = temp_fd;
+    if (!MapLocked(capacity)) {
+        CloseLocked();
+        return false;
+    }
+    log_end_ = used;
+    return true;
+}
+
+bool KRPreferencesLogStore::MapLocked(size_t capacity) {
+    auto *map = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+    map_ = static_cast<uint8_t *>(map);
+    capacity_ = capacity;
+    return true;
+}
+
+void KRPreferencesLogStore::UnmapLocked() {
+    if (map_ != nullptr) {
+        munmap(map_, capacity_);
+        map_ = nullptr;
+    }
+}
+
+void KRPreferencesLogStore::CloseLocked() {
+    UnmapLocked();
+    if (fd_ >= 0) {
+        close(fd_);  // 同时释放文件锁
+        fd_ = -1;
+    }
+}
+
+bool KRPreferencesLogStore::SyncRangeLocked(size_t begin, size_t end) {
+    static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t aligned_begin = begin / page_size * page_size;
+    return msync(map_ + aligned_begin, end - aligned_begin, MS_SYNC) == 0;
+}
+
+void KRPreferencesLogStore::ApplyLocked(RecordType type, std::string key, std::string value) {
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        live_bytes_ -= EncodedSize(it->first, it->second);
+    }
+    if (type == kRecordRemove) {
+        if (it != entries_.end()) {
+            entries_.erase(it);
+        }
+        return;
+    }
+    live_bytes_ += EncodedSize(key, value);
+    if (it != entries_.end()) {
+        it->second = std::move(value);
+    } else {
+        entries_.emplace(std::move(key), std::move(value));
+    }
+}
+
+std::vector<uint8_t> KRPreferencesLogStore::EncodeSnapshotLocked() {
+    std::vector<uint8_t> snapshot;
+    snapshot.reserve(live_bytes_);
+    for (const auto &entry : entries_) {
+        EncodeRecord(&snapshot, kRecordPut, entry.first, entry.second);
+    }
+    return snapshot;
+}
+
+size_t KRPreferencesLogStore::EncodedSize(const std::string &key, const std::string &value) {
+    return kRecordHeaderSize + 5 + key.size() + value.size();
+}
+
+void KRPreferencesLogStore::EncodeRecord(std::vector<uint8_t> *out, RecordType type, const std::string &key,
+                                         const std::string &value) {
+    auto payload_len = static_cast<uint32_t>(5 + key.size() + value.size());
+    size_t offset = out->size();
+    out->resize(offset + kRecordHeaderSize + payload_len);
+    auto *record = out->data() + offset;
+    WriteU32(record + 4, payload_len);
+    record[kRecordHeaderSize] = type;
+    WriteU32(record + kRecordHeaderSize + 1, static_cast<uint32_t>(key.size()));
+    memcpy(record + kRecordHeaderSize + 5, key.data(), key.size());
+    memcpy(record + kRecordHeaderSize + 5 + key.size(), value.data(), value.size());
+    WriteU32(record, KRPixelKernels::Crc32(record + 4, 4 + payload_len));
+}
+
+}  //  namespace util
+}  //  namespace kuikly
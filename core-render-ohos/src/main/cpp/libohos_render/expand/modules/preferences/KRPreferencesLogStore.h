@@ -0,0 +1,151 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace kuikly {
+namespace util {
+
+/**
+ * 追加写的键值存储，用于 DataPreferences 持久化。
+ *
+ * 文件格式：16 字节文件头（magic、版本）之后是连续的记录，每条记录为
+ *   [crc32 u32][payload_len u32][type u8][key_len u32][key][value]
+ * crc32 覆盖 payload_len 与 payload。文件按容量预分配并 mmap，未写入部分为 0。
+ *
+ * 1) 写入只追加一条记录，不再整文件重写；Put 先进入内存表和待提交缓冲，Flush 在 I/O 队列上成批提交（group commit）；
+ * 2) 打开时顺序校验记录，遇到长度越界或 crc 不一致即视为断电时的半条记录，丢弃其后的内容并清零；
+ * 3) 日志体积超过有效数据的 kCompactRatio 倍时在提交时压缩：写临时文件、fsync 后 rename 覆盖。
+ *
+ * 线程约定：所有接口线程安全；文件操作串行执行。记录按本机字节序（小端）写入。
+ * 进程约定：打开期间对文件持有 flock 独占锁，同一文件同时只有一个 store 可以写入；
+ * 后打开的（其它进程或本进程另一个 store）Open 返回 false，只在内存中读写、不落盘。
+ */
+class KRPreferencesLogStore {
+ public:
+    /**
+     * 把任务投递到后台 I/O 线程执行
+     */
+    using Dispatcher = std::function<void(std::function<void()> task)>;
+
+    enum RecordType : uint8_t {
+        kRecordPut = 1,
+        kRecordRemove = 2,
+    };
+
+    struct Stats {
+        uint64_t commit_count = 0;        // 提交次数（一次提交可包含多条记录）
+        uint64_t committed_records = 0;   // 提交的记录数
+        uint64_t compaction_count = 0;    // 压缩次数
+        uint64_t recovered_records = 0;   // 打开时回放的记录数
+        bool tail_discarded = false;      // 打开时是否丢弃了不完整的尾部
+        size_t log_bytes = 0;             // 日志当前长度（含文件头）
+        size_t live_bytes = 0;            // 有效数据压缩后的长度（含文件头）
+    };
+
+    static constexpr uint32_t kMagic = 0x564b524b;  // "KRKV"
+    static constexpr uint32_t kVersion = 1;
+    static constexpr size_t kHeaderSize = 16;
+    static constexpr size_t kRecordHeaderSize = 8;
+    static constexpr size_t kInitialCapacity = 64 * 1024;
+    static constexpr size_t kCompactMinBytes = 256 * 1024;
+    static constexpr size_t kCompactRatio = 2;
+    static constexpr uint32_t kMaxPayloadBytes = 64 * 1024 * 1024;
+
+    KRPreferencesLogStore(const std::string &path, Dispatcher io_dispatcher);
+    ~KRPreferencesLogStore();
+
+    KRPreferencesLogStore(const KRPreferencesLogStore &) = delete;
+    KRPreferencesLogStore &operator=(const KRPreferencesLogStore &) = delete;
+
+    /**
+     * 打开并回放日志，文件不存在或短于文件头时创建
+     * @return 文件无法打开、映射或已被其它 store 加锁时返回 false，此后只在内存中读写，已有文件保持不变
+     */
+    bool Open();
+
+    bool Get(const std::string &key, std::string *value);
+    void Put(const std::string &key, const std::string &value);
+    void Remove(const std::string &key);
+    size_t Size();
+
+    /**
+     * 异步提交：已有提交任务在排队时直接合并进去
+     */
+    void Flush();
+
+    /**
+     * 在调用线程上提交并落盘
+     */
+    bool FlushSync();
+
+    /**
+     * 立即压缩日志
+     */
+    bool Compact();
+
+    Stats GetStats();
+
+    /**
+     * 把一条记录编码追加到 out
+     */
+    static void EncodeRecord(std::vector<uint8_t> *out, RecordType type, const std::string &key,
+                             const std::string &value);
+
+ private:
+    bool CommitPending(bool force_compact);
+    bool InitializeLocked();
+    void ReplayLocked(size_t file_size);
+    bool AppendLocked(const std::vector<uint8_t> &records);
+    bool RewriteLocked(const std::vector<uint8_t> &records);
+    bool MapLocked(size_t capacity);
+    void UnmapLocked();
+    void CloseLocked();
+    bool SyncRangeLocked(size_t begin, size_t end);
+    void ApplyLocked(RecordType type, std::string key, std::string value);
+    std::vector<uint8_t> EncodeSnapshotLocked();
+    static size_t EncodedSize(const std::string &key, const std::string &value);
+
+    const std::string path_;
+    const Dispatcher io_dispatcher_;
+
+    // 内存表与待提交记录
+    std::mutex mutex_;
+    std::condition_variable idle_cv_;
+    std::unordered_map<std::string, std::string> entries_;
+    std::vector<uint8_t> pending_;
+    uint64_t pending_records_ = 0;
+    size_t live_bytes_ = kHeaderSize;
+    bool commit_scheduled_ = false;
+    int inflight_tasks_ = 0;
+    Stats stats_;
+
+    // 文件状态，只在持有 io_mutex_ 时访问
+    std::mutex io_mutex_;
+    int fd_ = -1;
+    uint8_t *map_ = nullptr;
+    size_t capacity_ = 0;
+    size_t log_end_ = 0;
+};
+
+}  //  namespace util
+}  //  namespace kuikly
@@ -19,6 +19,7 @@
 #define FOAWARD_ARTKS_MODULE_NAME "FOAWARD_ARTKS_MODULE_NAME"
 
 #include <unordered_map>
+#include <utility>
 #include "libohos_render/foundation/KRCommon.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/manager/KRArkTSManager.h"
@@ -76,7 +77,7 @@ class IKRRenderModuleExport : public std::enable_shared_from_this<IKRRenderModul
      */
     KRAnyValue CallArkTSMethod(const std::string &method, KRAnyValue params, const KRRenderCallback &callback,
                                bool callback_keep_alive = false) {
-        return ToCallArkTSMethod(false, GetModuleName(), method, params, callback, callback_keep_alive);
+        return ToCallArkTSMethod(false, GetModuleName(), method, std::move(params), callback, callback_keep_alive);
     }
 
     /**
@@ -89,7 +90,7 @@ class IKRRenderModuleExport : public std::enable_shared_from_this<IKRRenderModul
      */
     KRAnyValue SyncCallArkTSMethod(const std::string &method, KRAnyValue params, const KRRenderCallback &callback,
                                    bool callback_keep_alive = false) {
-        return ToCallArkTSMethod(true, GetModuleName(), method, params, callback, callback_keep_alive);
+        return ToCallArkTSMethod(true, GetModuleName(), method, std::move(params), callback, callback_keep_alive);
     }
 
     /**
@@ -107,13 +108,15 @@ class IKRRenderModuleExport : public std::enable_shared_from_this<IKRRenderModul
                                  bool callback_keep_alive = false) {
         auto instnce_id = instance_id_;
         auto result = new KRResult();
+        // params 之后不再使用，调用方也未持有时其中的二进制数据可直接转移给 ArkTS
         KRContextScheduler::ScheduleTaskOnMainThread(
-            isSync, [isSync, result, module_name, method, instnce_id, params, callback, callback_keep_alive] {
+            isSync, [isSync, result, module_name, method, instnce_id, params = std::move(params), callback,
+                     callback_keep_alive] {
                 auto module_name_value = KRRenderValue::Make(module_name);
                 auto method_name = KRRenderValue::Make(method);
                 auto arktsResult = KRArkTSManager::GetInstance().CallArkTSMethod(
                     instnce_id, KRNativeCallArkTSMethod::CallModuleMethod, module_name_value, method_name, params,
-                    nullptr, nullptr, callback, callback_keep_alive);
+                    nullptr, nullptr, callback, callback_keep_alive, nullptr, false, nullptr, true);
                 if (isSync) {
                     result->result = arktsResult;
                 }
@@ -52,6 +52,14 @@ class IKRRenderShadowExport : public std::enable_shared_from_this<IKRRenderShado
      */
     virtual KRSize CalculateRenderViewSize(double constraint_width, double constraint_height) = 0;
 
+    /**
+     * 预测性布局（可选实现）：在同步的 CalculateRenderViewSize 之前以预测的约束提前在工作线程测量，
+     * 之后 CalculateRenderViewSize 的约束一致时直接复用结果
+     * @param constraint_width 预测的约束宽度
+     * @param constraint_height 预测的约束高度
+     */
+    virtual void StartSpeculativeLayout(double constraint_width, double constraint_height) {}
+
     /**
      * 将要SetShadow调用
      * @return
@@ -171,14 +171,23 @@ void IKRRenderViewExport::ToSetProp(const std::string &prop_key, const KRAnyValu
     if (node_ == nullptr) {
         return;
     }
+    static const KRPropKeyId kFramePropId = KRPropKeyTable::GetInstance().Intern("frame");
+    auto prop_id = KRPropKeyTable::GetInstance().Find(prop_key);
     // 把设置过的key收集下, 以便ResetProp
     if (CanReuse()) {
-        CollectReuseKeyIfNeed(prop_key);
+        CollectReuseKeyIfNeed(prop_id, prop_key);
+    }
+    if (!pending_reset_props_.Empty()) {
+        if (base_props_handler_ != nullptr && base_props_handler_->isAnimationNode()) {
+            ApplyPendingResetProps();  // 动画需要从默认值开始，先完成重置
+        } else {
+            pending_reset_props_.Erase(prop_id);  // 新 cell 会覆盖该属性，无需重置
+        }
     }
 
     auto didHanded = false;
     if (base_props_handler_ != nullptr) {
-        auto isFrameProp = kuikly::util::isEqual(prop_key, "frame");
+        auto isFrameProp = prop_id == kFramePropId;
         if (!(isFrameProp && CustomSetViewFrame())) {
             didHanded = ToSetBaseProp(prop_key, prop_value, event_call_back);  // 基础属性设置分发处理
         }
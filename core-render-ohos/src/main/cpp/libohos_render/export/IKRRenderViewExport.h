@@ -27,6 +27,7 @@
 #include "libohos_render/export/IKRRenderModuleExport.h"
 #include "libohos_render/export/IKRRenderShadowExport.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKeyTable.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/manager/KRArkTSManager.h"
@@ -307,7 +308,7 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
         }
         // 把设置过的key收集下, 以便ResetProp
         if (CanReuse()) {
-            CollectReuseKeyIfNeed(prop_key);
+            CollectReuseKeyIfNeed(KRPropKeyTable::GetInstance().Find(prop_key), prop_key);
         }
 
         auto didHanded = false;
@@ -337,35 +338,104 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
         if (node_ == nullptr) {
             return;
         }
-        auto didHanded = false;
-        if (base_props_handler_ != nullptr && base_props_handler_->ResetProp(prop_key)) {
-            didHanded = true;
-        }
-        if (!didHanded && base_event_handler_ != nullptr) {
-            didHanded = base_event_handler_->ResetProp(prop_key);
-        }
-        if (!didHanded) {
-            ResetProp(prop_key);
-        }
+        ResetPropById(KRPropKeyTable::GetInstance().Find(prop_key), prop_key);
         frame_ = KRRect(0, 0, 0, 0);
     }
 
+    /**
+     * 复用重置：按已设置属性的位图一次遍历，按 id 分发到各 handler。
+     * 只影响自身节点属性的基础属性（KRBasePropsHandler::IsSelfContainedReset）延迟到插入父节点前
+     * 再重置（ApplyPendingResetProps），期间新 cell 再次设置的属性直接跳过重置
+     */
     void ToReuse() {
         KREnsureMainThread();
 
         if (node_ == nullptr) {
             return;
         }
-        if (did_set_props_.size() > 0) {
-            for (const auto &prop_key : did_set_props_) {
-                ToResetProp(prop_key);
-            }
-            did_set_props_.clear();
+        if (!did_set_props_.Empty()) {
+            auto &prop_key_table = KRPropKeyTable::GetInstance();
+            did_set_props_.ForEach([this, &prop_key_table](KRPropKeyId prop_id) {
+                if (KRBasePropsHandler::IsSelfContainedReset(prop_id)) {
+                    pending_reset_props_.Insert(prop_id);
+                } else {
+                    ResetPropById(prop_id, prop_key_table.KeyOf(prop_id));
+                }
+            });
+            // 驻留表容量耗尽后未分配到id的属性名，只能走字符串重置
+            did_set_props_.ForEachUnkeyed(
+                [this](const std::string &prop_key) { ResetPropById(kKRInvalidPropKeyId, prop_key); });
+            did_set_props_.Clear();
         }
+        frame_ = KRRect(0, 0, 0, 0);
         UnregisterEvent();
         ResetTouchInterrupter();
     }
 
+    /**
+     * 执行复用时延迟的属性重置，view 插入父节点（即将上屏）前调用
+     */
+    void ApplyPendingResetProps() {
+        if (pending_reset_props_.Empty()) {
+            return;
+        }
+        KREnsureMainThread();
+
+        if (node_ != nullptr) {
+            auto &prop_key_table = KRPropKeyTable::GetInstance();
+            pending_reset_props_.ForEach([this, &prop_key_table](KRPropKeyId prop_id) {
+                ResetPropById(prop_id, prop_key_table.KeyOf(prop_id));
+            });
+        }
+        pending_reset_props_.Clear();
+    }
+
+    /**
+     * 把复用池中的 view 交给另一个页面：重新绑定根视图，按新页面重建基础属性 / 事件处理器。
+     * 调用前 view 必须已经 ToReuse 且不在任何父节点下
+     * @return 新页面已销毁时返回 false，view 不可再用
+     */
+    bool ToAdopt(std::weak_ptr<IKRRenderView> root_view, const std::string &instance_id) {
+        KREnsureMainThread();
+
+        if (!RebindRootView(root_view, instance_id)) {
+            return false;
+        }
+        parent_.reset();
+        parent_tag_ = -1;
+        DidAdopt();
+        return true;
+    }
+
+    /**
+     * ToAdopt 换绑到新页面后调用。组件内部自建、不经过复用池的子 view（如 KRImageViewWrapper 的图片视图）
+     * 需在此调用 RebindRootView 随之换绑；持有原页面其它 view 引用的组件在此释放
+     */
+    virtual void DidAdopt() {}
+
+    /**
+     * 重新绑定根视图，按新页面重建基础属性 / 事件处理器，不改变父子关系
+     * @return 新页面已销毁时返回 false
+     */
+    bool RebindRootView(std::weak_ptr<IKRRenderView> root_view, const std::string &instance_id) {
+        KREnsureMainThread();
+
+        auto strongRoot = root_view.lock();
+        if (strongRoot == nullptr || node_ == nullptr) {
+            return false;
+        }
+        root_view_ = root_view;
+        instance_id_ = instance_id;
+        // 延迟的基础属性重置依赖旧处理器记录的状态，须在换新前完成；其余属性已在 ToReuse 中复原
+        ApplyPendingResetProps();
+        // 旧处理器持有原页面的配置与 UI 上下文，直接换新
+        base_props_handler_->OnDestroy();
+        base_event_handler_->OnDestroy();
+        base_props_handler_ = CreateBasePropHandler(strongRoot);
+        base_event_handler_ = CreateBaseEventHandler(strongRoot);
+        return true;
+    }
+
     virtual void RemoveChildNode(ArkUI_NodeHandle parent, ArkUI_NodeHandle child) {
         if (parent_node_content_handle_ && child &&
             kuikly::util::ArkUINativeNodeAPI::GetInstance()->IsNodeAlive(child)) {
@@ -580,10 +650,24 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
         KREventDispatchCenter::GetInstance().UnregisterGestureEvent(shared_from_this());
         KREventDispatchCenter::GetInstance().UnregisterGestureInterrupter(shared_from_this());
     }
-    void CollectReuseKeyIfNeed(const std::string &prop_key) {
-        if (std::find(did_set_props_.begin(), did_set_props_.end(), prop_key) == did_set_props_.end()) {
-            did_set_props_.push_back(prop_key);
+    void ResetPropById(KRPropKeyId prop_id, const std::string &prop_key) {
+        auto didHanded = false;
+        if (base_props_handler_ != nullptr && base_props_handler_->ResetProp(prop_id)) {
+            didHanded = true;
+        }
+        if (!didHanded && base_event_handler_ != nullptr) {
+            didHanded = base_event_handler_->ResetProp(prop_id);
+        }
+        if (!didHanded) {
+            ResetProp(prop_key);
+        }
+    }
+    void CollectReuseKeyIfNeed(KRPropKeyId prop_id, const std::string &prop_key) {
+        if (prop_id == kKRInvalidPropKeyId) {
+            // 未注册过的属性名（如自定义组件属性）首次出现时驻留
+            prop_id = KRPropKeyTable::GetInstance().Intern(prop_key);
         }
+        did_set_props_.Insert(prop_id, prop_key);
     }
 
  protected:
@@ -594,7 +678,8 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
     std::shared_ptr<KRBaseEventHandler> base_event_handler_;
     std::string view_name_;
     int view_tag_ = 0;
-    std::vector<std::string> did_set_props_;
+    KRPropKeySet did_set_props_;
+    KRPropKeySet pending_reset_props_;  // 复用后尚未执行的延迟重置
 
     ArkUI_NodeHandle parent_node_ = nullptr;
     int parent_tag_ = -1;
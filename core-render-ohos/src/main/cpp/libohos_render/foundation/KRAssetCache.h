@@ -0,0 +1,324 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRASSETCACHE_H
+#define CORE_RENDER_OHOS_KRASSETCACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * 线程安全的异步资源缓存（动图等解析开销大的资源，进程内共享）。
+ *
+ * 设计要点：
+ * 1) 按字节预算 LRU 淘汰，条目开销由加载方给出；值为 shared_ptr，使用方持有期间即使被淘汰也不会失效；
+ * 2) 同一 key 的并发请求合并为一次加载，加载完成后按请求顺序回调所有等待者；
+ * 3) 请求可取消：被取消的请求不再回调，某次加载的等待者全部取消后该加载标记为取消，
+ *    加载函数可通过 cancelled() 提前结束，结果不写入缓存；
+ * 4) 加载在 load_executor 上执行，回调在 callback_executor 上派发（命中缓存时在调用线程同步回调）。
+ *    回调派发前会再次确认请求未被取消，因此在回调线程上 Cancel 之后不会再收到回调。
+ *
+ * 缓存需要比进行中的加载存活得更久，通常以进程级单例使用。只依赖标准库。
+ */
+template <typename Value>
+class KRAssetCache {
+ public:
+    using ValuePtr = std::shared_ptr<Value>;
+    using Completion = std::function<void(ValuePtr)>;
+    using Executor = std::function<void(std::function<void()>)>;
+    /**
+     * 加载函数（在 load_executor 上执行），失败返回空；cost 写入条目字节数
+     */
+    using Loader = std::function<ValuePtr(const std::function<bool()> &cancelled, size_t &cost)>;
+
+    struct Stats {
+        uint64_t hit_count = 0;
+        uint64_t miss_count = 0;
+        uint64_t coalesced_count = 0;   // 合并到进行中加载的请求数
+        uint64_t load_count = 0;        // 实际发起的加载数
+        uint64_t load_failure_count = 0;
+        uint64_t cancel_count = 0;      // 因等待者全部取消而放弃的加载数
+        uint64_t eviction_count = 0;    // 因超出字节预算被淘汰的条目数
+        size_t entry_count = 0;
+        size_t inflight_count = 0;
+        size_t bytes = 0;
+    };
+
+    KRAssetCache(size_t capacity_bytes, Executor load_executor, Executor callback_executor)
+        : capacity_bytes_(capacity_bytes),
+          load_executor_(std::move(load_executor)),
+          callback_executor_(std::move(callback_executor)) {}
+
+    KRAssetCache(const KRAssetCache &) = delete;
+    KRAssetCache &operator=(const KRAssetCache &) = delete;
+
+    /**
+     * 获取资源
+     * @return 请求 id，用于 Cancel；命中缓存（已同步回调）时返回 0
+     */
+    uint64_t Fetch(const std::string &key, Loader loader, Completion completion) {
+        ValuePtr cached;
+        std::shared_ptr<Load> load;
+        uint64_t request_id = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = entries_.find(key);
+            if (it != entries_.end()) {
+                hit_count_++;
+                lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+                cached = it->second.value;
+            } else {
+                miss_count_++;
+                request_id = ++next_request_id_;
+                requests_[request_id] = key;
+                auto inflight = inflight_.find(key);
+                if (inflight != inflight_.end()) {
+                    coalesced_count_++;
+                    inflight->second->waiters.emplace_back(request_id, std::move(completion));
+                    return request_id;
+                }
+                load = std::make_shared<Load>();
+                load->waiters.emplace_back(request_id, std::move(completion));
+                inflight_[key] = load;
+                load_count_++;
+            }
+        }
+        if (!load) {
+            completion(cached);
+            return 0;
+        }
+        load_executor_([this, key, load, loader = std::move(loader)] {
+            size_t cost = 0;
+            ValuePtr value;
+            if (!load->cancelled.load(std::memory_order_acquire)) {
+                value = loader([load] { return load->cancelled.load(std::memory_order_acquire); }, cost);
+            }
+            FinishLoad(key, load, std::move(value), cost);
+        });
+        return request_id;
+    }
+
+    /**
+     * 取消请求，之后不再回调；request_id 为 0 或已完成时忽略
+     */
+    void Cancel(uint64_t request_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto request = requests_.find(request_id);
+        if (request == requests_.end()) {
+            return;
+        }
+        auto inflight = inflight_.find(request->second);
+        requests_.erase(request);
+        if (inflight == inflight_.end()) {
+            return;  // 已加载完成，回调尚未派发，派发时会跳过
+        }
+        auto &load = inflight->second;
+        auto &waiters = load->waiters;
+        for (auto it = waiters.begin(); it != waiters.end(); ++it) {
+            if (it->first == request_id) {
+                waiters.erase(it);
+                break;
+            }
+        }
+        if (waiters.empty()) {
+            // 之后同 key 的请求重新发起加载，不合并到已取消的加载上
+            load->cancelled.store(true, std::memory_order_release);
+            inflight_.erase(inflight);
+            cancel_count_++;
+        }
+    }
+
+    /**
+     * 只查缓存，不发起加载
+     */
+    ValuePtr Get(const std::string &key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return nullptr;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+        return it->second.value;
+    }
+
+    /**
+     * key 对应的条目是否仍是 value（不更新 LRU），供外部持有者判断资源是否已被淘汰
+     */
+    bool Contains(const std::string &key, const ValuePtr &value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        return it != entries_.end() && it->second.value == value;
+    }
+
+    /**
+     * 直接写入缓存（调用方自行同步加载时使用），不影响同 key 进行中的加载
+     */
+    void Put(const std::string &key, ValuePtr value, size_t cost) {
+        std::vector<ValuePtr> evicted;  // 在锁外释放
+        std::lock_guard<std::mutex> lock(mutex_);
+        InsertLocked(key, std::move(value), cost, evicted);
+    }
+
+    void Remove(const std::string &key) {
+        ValuePtr removed;  // 在锁外释放
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            removed = std::move(it->second.value);
+            bytes_ -= it->second.cost;
+            lru_.erase(it->second.lru_it);
+            entries_.erase(it);
+        }
+    }
+
+    void Clear() {
+        std::unordered_map<std::string, Entry> entries;
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries.swap(entries_);
+        lru_.clear();
+        bytes_ = 0;
+    }
+
+    void SetCapacityBytes(size_t capacity_bytes) {
+        std::vector<ValuePtr> evicted;
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_bytes_ = capacity_bytes;
+        EvictLocked(evicted, capacity_bytes_);
+    }
+
+    /**
+     * 从最久未访问的条目开始淘汰，直到占用不超过 target_bytes（不改变预算，用于内存压力裁剪）
+     */
+    void TrimToBytes(size_t target_bytes) {
+        std::vector<ValuePtr> evicted;
+        std::lock_guard<std::mutex> lock(mutex_);
+        EvictLocked(evicted, target_bytes);
+    }
+
+    Stats GetStats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stats stats;
+        stats.hit_count = hit_count_;
+        stats.miss_count = miss_count_;
+        stats.coalesced_count = coalesced_count_;
+        stats.load_count = load_count_;
+        stats.load_failure_count = load_failure_count_;
+        stats.cancel_count = cancel_count_;
+        stats.eviction_count = eviction_count_;
+        stats.entry_count = entries_.size();
+        stats.inflight_count = inflight_.size();
+        stats.bytes = bytes_;
+        return stats;
+    }
+
+ private:
+    struct Entry {
+        ValuePtr value;
+        size_t cost;
+        std::list<std::string>::iterator lru_it;
+    };
+
+    struct Load {
+        std::atomic<bool> cancelled{false};
+        std::vector<std::pair<uint64_t, Completion>> waiters;  // 受 mutex_ 保护
+    };
+
+    void FinishLoad(const std::string &key, const std::shared_ptr<Load> &load, ValuePtr value, size_t cost) {
+        std::vector<std::pair<uint64_t, Completion>> waiters;
+        std::vector<ValuePtr> evicted;  // 在锁外释放
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto inflight = inflight_.find(key);
+            if (inflight == inflight_.end() || inflight->second != load) {
+                return;  // 已取消
+            }
+            inflight_.erase(inflight);
+            waiters.swap(load->waiters);
+            if (!value) {
+                load_failure_count_++;
+            } else {
+                InsertLocked(key, value, cost, evicted);
+            }
+        }
+        callback_executor_([this, waiters = std::move(waiters), value]() {
+            for (const auto &waiter : waiters) {
+                if (TakeRequest(waiter.first)) {
+                    waiter.second(value);
+                }
+            }
+        });
+    }
+
+    bool TakeRequest(uint64_t request_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return requests_.erase(request_id) > 0;
+    }
+
+    void InsertLocked(const std::string &key, ValuePtr value, size_t cost, std::vector<ValuePtr> &evicted) {
+        if (!value || cost > capacity_bytes_) {
+            return;  // 超出整个预算的条目不缓存
+        }
+        auto existing = entries_.find(key);
+        if (existing != entries_.end()) {
+            evicted.push_back(std::move(existing->second.value));
+            bytes_ -= existing->second.cost;
+            lru_.erase(existing->second.lru_it);
+            entries_.erase(existing);
+        }
+        lru_.push_front(key);
+        entries_[key] = Entry{std::move(value), cost, lru_.begin()};
+        bytes_ += cost;
+        EvictLocked(evicted, capacity_bytes_);
+    }
+
+    void EvictLocked(std::vector<ValuePtr> &evicted, size_t limit_bytes) {
+        while (bytes_ > limit_bytes && !lru_.empty()) {
+            auto victim = entries_.find(lru_.back());
+            bytes_ -= victim->second.cost;
+            evicted.push_back(std::move(victim->second.value));
+            entries_.erase(victim);
+            lru_.pop_back();
+            eviction_count_++;
+        }
+    }
+
+    std::mutex mutex_;
+    size_t capacity_bytes_;
+    size_t bytes_ = 0;
+    Executor load_executor_;
+    Executor callback_executor_;
+    std::list<std::string> lru_;  // front 为最近访问
+    std::unordered_map<std::string, Entry> entries_;
+    std::unordered_map<std::string, std::shared_ptr<Load>> inflight_;
+    std::unordered_map<uint64_t, std::string> requests_;  // 尚未回调的请求 id -> key
+    uint64_t next_request_id_ = 0;
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+    uint64_t coalesced_count_ = 0;
+    uint64_t load_count_ = 0;
+    uint64_t load_failure_count_ = 0;
+    uint64_t cancel_count_ = 0;
+    uint64_t eviction_count_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRASSETCACHE_H
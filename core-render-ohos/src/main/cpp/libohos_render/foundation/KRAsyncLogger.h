@@ -0,0 +1,543 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRASYNCLOGGER_H
+#define CORE_RENDER_OHOS_KRASYNCLOGGER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// 日志级别，取值与 hilog LogLevel 一致
+constexpr int kKRLogLevelDebug = 3;
+constexpr int kKRLogLevelInfo = 4;
+constexpr int kKRLogLevelWarn = 5;
+constexpr int kKRLogLevelError = 6;
+constexpr int kKRLogLevelFatal = 7;
+
+/**
+ * 输出端（KRRenderAdapterManager::Log / IKRLogAdapter）只有 debug / info / error 三个通道，
+ * 其它级别映射到最近的通道，避免被静默丢弃
+ */
+inline int KRLogSinkLevel(int level) {
+    if (level >= kKRLogLevelWarn) {
+        return kKRLogLevelError;
+    }
+    return level <= kKRLogLevelDebug ? kKRLogLevelDebug : kKRLogLevelInfo;
+}
+
+struct KRLogRecord {
+    int level = kKRLogLevelDebug;
+    int64_t time_ns = 0;  // steady_clock，用于合并多个线程的日志
+    std::string tag;
+    std::string message;
+};
+
+/**
+ * 单生产者单消费者环形缓冲区，每个写日志的线程独占一个
+ */
+class KRLogRingBuffer {
+ public:
+    explicit KRLogRingBuffer(size_t capacity) : slots_(RoundUpPowerOfTwo(capacity)), mask_(slots_.size() - 1) {}
+
+    KRLogRingBuffer(const KRLogRingBuffer &) = delete;
+    KRLogRingBuffer &operator=(const KRLogRingBuffer &) = delete;
+
+    /**
+     * 写入，仅生产者线程调用；满时返回 false，record 保持不变
+     */
+    bool TryPush(KRLogRecord &record) {
+        auto head = head_.load(std::memory_order_relaxed);
+        if (head - cached_tail_ >= slots_.size()) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head - cached_tail_ >= slots_.size()) {
+                return false;
+            }
+        }
+        slots_[head & mask_] = std::move(record);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * 读取，仅消费者调用
+     */
+    bool TryPop(KRLogRecord &record) {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        record = std::move(slots_[tail & mask_]);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t SizeApprox() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    size_t Capacity() const {
+        return slots_.size();
+    }
+
+    // 以下计数只由生产者线程写入
+    std::atomic<uint64_t> pushed{0};
+    std::atomic<uint64_t> dropped{0};
+    // 生产者线程退出后置位，消费者读空后回收
+    std::atomic<bool> retired{false};
+    // 已上报的丢弃数，仅消费者访问
+    uint64_t reported_dropped = 0;
+
+ private:
+    static size_t RoundUpPowerOfTwo(size_t value) {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    std::vector<KRLogRecord> slots_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> head_{0};  // 生产者端
+    size_t cached_tail_ = 0;                   // 生产者缓存的 tail，减少跨核读取
+    alignas(64) std::atomic<size_t> tail_{0};  // 消费者端
+};
+
+/**
+ * 异步日志管线。
+ *
+ * 1) 级别过滤：IsEnabled 只读一个原子变量，调用方在格式化之前判断，关闭的级别不产生任何开销；
+ * 2) 写入：每个线程首次写日志时注册自己的环形缓冲区，之后写入无锁；
+ * 3) 输出：一个后台线程定期（或缓冲区过半、出现 error 时被唤醒）收集所有缓冲区，按时间排序后成批交给 sink；
+ * 4) 溢出：缓冲区满时丢弃并计数，下一批输出时补一条丢弃统计；error 及以上级别不丢弃，先同步冲刷再写入；
+ * 5) Flush 在调用线程上同步冲刷，用于崩溃、页面销毁等场景；sink 内部再写的日志不会递归冲刷。
+ *
+ * 只依赖标准库。
+ */
+class KRAsyncLogger {
+ public:
+    /**
+     * 批量输出，在后台线程或 Flush 的调用线程上执行，同一时刻只有一个线程调用
+     */
+    using Sink = std::function<void(std::vector<KRLogRecord> &batch)>;
+
+    struct Stats {
+        uint64_t enqueued = 0;       // 写入缓冲区的条数
+        uint64_t dropped = 0;        // 缓冲区满被丢弃的条数
+        uint64_t written = 0;        // 交给 sink 的条数（不含丢弃统计）
+        uint64_t sync_written = 0;   // 同步模式或缓冲区满时直接写出的条数
+        uint64_t batch_count = 0;    // 输出批次数
+        uint64_t max_batch = 0;      // 最大批次条数
+        size_t ring_count = 0;       // 当前注册的缓冲区数
+    };
+
+    static constexpr size_t kDefaultRingCapacity = 1024;
+    static constexpr int kDefaultDrainIntervalMs = 20;
+    static constexpr int kIdleDrainIntervalMs = 1000;
+    static constexpr char kDropTag[] = "KRLog";
+
+    static KRAsyncLogger &GetInstance() {
+        static auto *logger = [] {
+            auto *instance = new KRAsyncLogger(kDefaultRingCapacity, kDefaultDrainIntervalMs);
+            InstallTerminateHook();
+            return instance;
+        }();
+        return *logger;
+    }
+
+    KRAsyncLogger(size_t ring_capacity, int drain_interval_ms)
+        : id_(NextLoggerId()), ring_capacity_(ring_capacity), drain_interval_ms_(drain_interval_ms) {}
+
+    ~KRAsyncLogger() {
+        Stop();
+    }
+
+    KRAsyncLogger(const KRAsyncLogger &) = delete;
+    KRAsyncLogger &operator=(const KRAsyncLogger &) = delete;
+
+    void SetSink(Sink sink) {
+        std::lock_guard<std::mutex> lock(drain_mutex_);
+        sink_ = std::move(sink);
+    }
+
+    /**
+     * 运行期最低输出级别，低于该级别的日志在格式化前被过滤
+     */
+    void SetMinLevel(int level) {
+        min_level_.store(level, std::memory_order_relaxed);
+    }
+
+    int GetMinLevel() const {
+        return min_level_.load(std::memory_order_relaxed);
+    }
+
+    bool IsEnabled(int level) const {
+        return level >= min_level_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 关闭异步时在调用线程上直接写出（调试时保证日志与崩溃点严格同步）
+     */
+    void SetAsync(bool async) {
+        async_.store(async, std::memory_order_relaxed);
+    }
+
+    /**
+     * 写日志，任意线程调用
+     */
+    void Log(int level, std::string tag, std::string message) {
+        KRLogRecord record;
+        record.level = level;
+        record.time_ns = NowNs();
+        record.tag = std::move(tag);
+        record.message = std::move(message);
+        if (!async_.load(std::memory_order_relaxed) || stopped_.load(std::memory_order_acquire) ||
+            local_rings_destroyed_) {
+            WriteSync(record);
+            return;
+        }
+        auto *ring = LocalRing();
+        if (!ring->TryPush(record) && !RetryPushAfterYield(ring, record)) {
+            if (level < kKRLogLevelError || in_sink_) {
+                ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return;
+            }
+            // error 不丢弃：先把已有日志冲刷出去保证顺序，再写入
+            Flush();
+            if (!ring->TryPush(record)) {
+                WriteSync(record);
+                return;
+            }
+        }
+        ring->pushed.store(ring->pushed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (level >= kKRLogLevelError || ring->SizeApprox() >= ring->Capacity() / 2) {
+            Wake();
+            return;
+        }
+        // 与后台线程的 idle_ 置位构成 Dekker 式同步，保证进入空闲等待前写入的日志一定会被看到
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (idle_.load(std::memory_order_relaxed) && idle_.exchange(false)) {
+            Wake();
+        }
+    }
+
+    /**
+     * 在调用线程上同步冲刷所有缓冲区
+     */
+    void Flush() {
+        if (in_sink_) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(drain_mutex_);
+        DrainLocked();
+    }
+
+    /**
+     * 崩溃时冲刷：等待后台线程释放最多 timeout_ms，避免崩溃点恰好在输出中时死锁
+     */
+    bool FlushForCrash(int timeout_ms) {
+        if (in_sink_) {
+            return false;
+        }
+        // 逐次 try_lock 而非 timed_mutex：崩溃路径上不依赖条件等待
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (!drain_mutex_.try_lock()) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        DrainLocked();
+        drain_mutex_.unlock();
+        return true;
+    }
+
+    /**
+     * 停止后台线程并冲刷，之后的日志同步写出
+     */
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            if (stopped_.exchange(true)) {
+                return;
+            }
+            wake_pending_.store(true);
+        }
+        wake_cv_.notify_one();
+        if (drain_thread_.joinable()) {
+            drain_thread_.join();
+        }
+        Flush();
+    }
+
+    Stats GetStats() {
+        Stats stats;
+        {
+            std::lock_guard<std::mutex> lock(rings_mutex_);
+            stats.enqueued = retired_pushed_;
+            stats.dropped = retired_dropped_;
+            for (auto &ring : rings_) {
+                stats.enqueued += ring->pushed.load(std::memory_order_relaxed);
+                stats.dropped += ring->dropped.load(std::memory_order_relaxed);
+            }
+            stats.ring_count = rings_.size();
+        }
+        std::lock_guard<std::mutex> lock(drain_mutex_);
+        stats.written = written_;
+        stats.sync_written = sync_written_;
+        stats.batch_count = batch_count_;
+        stats.max_batch = max_batch_;
+        return stats;
+    }
+
+ private:
+    struct LocalRingEntry {
+        uint64_t logger_id;
+        std::shared_ptr<KRLogRingBuffer> ring;
+    };
+
+    struct LocalRings {
+        std::vector<LocalRingEntry> entries;
+        ~LocalRings() {
+            // 线程退出时其他 thread_local 的析构里仍可能写日志，之后改为同步写出
+            local_rings_destroyed_ = true;
+            for (auto &entry : entries) {
+                entry.ring->retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    static uint64_t NextLoggerId() {
+        static std::atomic<uint64_t> next_id{0};
+        return ++next_id;
+    }
+
+    static int64_t NowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    static void InstallTerminateHook() {
+        static std::terminate_handler previous = std::set_terminate([] {
+            GetInstance().FlushForCrash(100);
+            if (previous) {
+                previous();
+            }
+            std::abort();
+        });
+    }
+
+    KRLogRingBuffer *LocalRing() {
+        static thread_local LocalRings local_rings;
+        auto &entries = local_rings.entries;
+        if (!entries.empty() && entries.back().logger_id == id_) {
+            return entries.back().ring.get();
+        }
+        for (auto &entry : entries) {
+            if (entry.logger_id == id_) {
+                return entry.ring.get();
+            }
+        }
+        auto ring = std::make_shared<KRLogRingBuffer>(ring_capacity_);
+        {
+            std::lock_guard<std::mutex> lock(rings_mutex_);
+            rings_.push_back(ring);
+        }
+        entries.push_back({id_, ring});
+        EnsureDrainThread();
+        return ring.get();
+    }
+
+    void EnsureDrainThread() {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        if (drain_thread_started_ || stopped_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        drain_thread_started_ = true;
+        drain_thread_ = std::thread([this] { DrainLoop(); });
+    }
+
+    /**
+     * 缓冲区满时唤醒后台线程并让出一次 CPU 再重试，突发写入时减少丢弃；不会阻塞等待
+     */
+    bool RetryPushAfterYield(KRLogRingBuffer *ring, KRLogRecord &record) {
+        if (in_sink_) {
+            return false;
+        }
+        Wake();
+        std::this_thread::yield();
+        return ring->TryPush(record);
+    }
+
+    void Wake() {
+        // 已有未处理的唤醒时不再加锁，缓冲区过半后的连续写入只付出一次原子读
+        if (wake_pending_.load(std::memory_order_relaxed) || wake_pending_.exchange(true)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        wake_cv_.notify_one();
+    }
+
+    void DrainLoop() {
+        while (true) {
+            size_t drained = 0;
+            {
+                std::lock_guard<std::mutex> lock(drain_mutex_);
+                drained = DrainLocked();
+            }
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            if (stopped_.load(std::memory_order_relaxed)) {
+                return;
+            }
+            int interval_ms = drain_interval_ms_;
+            if (drained == 0) {
+                idle_.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                interval_ms = HasPendingRecords() ? 0 : kIdleDrainIntervalMs;
+            }
+            if (interval_ms > 0) {
+                wake_cv_.wait_for(lock, std::chrono::milliseconds(interval_ms),
+                                  [this] { return wake_pending_.load(); });
+            }
+            wake_pending_.store(false);
+            idle_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    bool HasPendingRecords() {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        for (auto &ring : rings_) {
+            if (ring->SizeApprox() > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * 收集并输出，调用方持有 drain_mutex_
+     * @return 输出的条数
+     */
+    size_t DrainLocked() {
+        batch_.clear();
+        size_t drop_records = 0;
+        {
+            std::lock_guard<std::mutex> lock(rings_mutex_);
+            for (auto it = rings_.begin(); it != rings_.end();) {
+                auto &ring = *it;
+                // 先读 retired 再读空，保证回收时生产者已不再写入
+                bool retired = ring->retired.load(std::memory_order_acquire);
+                KRLogRecord record;
+                while (ring->TryPop(record)) {
+                    batch_.push_back(std::move(record));
+                }
+                auto dropped = ring->dropped.load(std::memory_order_relaxed);
+                if (dropped != ring->reported_dropped) {
+                    KRLogRecord drop_record;
+                    drop_record.level = kKRLogLevelError;  // 输出端没有 warn 通道
+                    drop_record.time_ns = NowNs();
+                    drop_record.tag = kDropTag;
+                    drop_record.message = "log buffer overflow, dropped " +
+                                          std::to_string(dropped - ring->reported_dropped) + " lines";
+                    batch_.push_back(std::move(drop_record));
+                    ring->reported_dropped = dropped;
+                    drop_records++;
+                }
+                if (retired) {
+                    retired_pushed_ += ring->pushed.load(std::memory_order_relaxed);
+                    retired_dropped_ += dropped;
+                    it = rings_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        if (batch_.empty()) {
+            return 0;
+        }
+        std::stable_sort(batch_.begin(), batch_.end(),
+                         [](const KRLogRecord &lhs, const KRLogRecord &rhs) { return lhs.time_ns < rhs.time_ns; });
+        written_ += batch_.size() - drop_records;  // 丢弃统计不计入 written
+        batch_count_++;
+        max_batch_ = std::max<uint64_t>(max_batch_, batch_.size());
+        CallSink(batch_);
+        return batch_.size();
+    }
+
+    void WriteSync(KRLogRecord &record) {
+        if (in_sink_) {
+            return;
+        }
+        std::vector<KRLogRecord> batch;
+        batch.push_back(std::move(record));
+        std::lock_guard<std::mutex> lock(drain_mutex_);
+        sync_written_++;
+        CallSink(batch);
+    }
+
+    void CallSink(std::vector<KRLogRecord> &batch) {
+        if (!sink_) {
+            return;
+        }
+        in_sink_ = true;
+        sink_(batch);
+        in_sink_ = false;
+    }
+
+    const uint64_t id_;
+    const size_t ring_capacity_;
+    const int drain_interval_ms_;
+    std::atomic<int> min_level_{kKRLogLevelDebug};
+    std::atomic<bool> async_{true};
+    std::atomic<bool> stopped_{false};
+    std::atomic<bool> idle_{false};
+
+    std::mutex rings_mutex_;
+    std::vector<std::shared_ptr<KRLogRingBuffer>> rings_;
+    uint64_t retired_pushed_ = 0;
+    uint64_t retired_dropped_ = 0;
+
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    std::atomic<bool> wake_pending_{false};
+    bool drain_thread_started_ = false;
+    std::thread drain_thread_;
+
+    // 消费端：后台线程与 Flush 互斥
+    std::mutex drain_mutex_;
+    Sink sink_;
+    std::vector<KRLogRecord> batch_;
+    uint64_t written_ = 0;
+    uint64_t sync_written_ = 0;
+    uint64_t batch_count_ = 0;
+    uint64_t max_batch_ = 0;
+
+    static inline thread_local bool in_sink_ = false;
+    static inline thread_local bool local_rings_destroyed_ = false;
+};
+
+#endif  // CORE_RENDER_OHOS_KRASYNCLOGGER_H
@@ -0,0 +1,291 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRCACHEBUDGETCOORDINATOR_H
+#define CORE_RENDER_OHOS_KRCACHEBUDGETCOORDINATOR_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * 内存裁剪级别
+ */
+enum class KRMemoryTrimLevel {
+    kNone = 0,
+    kModerate = 1,  // 裁剪到全局预算的一半
+    kCritical = 2,  // 清空所有可裁剪的缓存
+};
+
+/**
+ * 进程级缓存预算协调器。
+ *
+ * 各缓存注册自己的名称、优先级、当前字节数查询和裁剪回调，协调器统一执行：
+ * 1) 全局字节预算：总占用超出预算时按优先级从低到高裁剪，直到回到预算内；
+ * 2) 内存压力：系统内存级别回调或 PSS 超过阈值时按 moderate / critical 级别裁剪；
+ * 3) 驻留报告：按缓存名汇总当前占用，用于日志与排查。
+ *
+ * 线程约定：Register / Unregister / 配置接口线程安全；EnforceBudget / Trim / Report 会调用各缓存的回调，
+ * 需在主线程调用（页面级缓存只在主线程访问）。只依赖标准库。
+ */
+class KRCacheBudgetCoordinator {
+ public:
+    /**
+     * 当前占用字节数
+     */
+    using BytesFn = std::function<size_t()>;
+    /**
+     * 把占用裁剪到 target_bytes 以内（尽力而为，正在使用的资源可以保留）
+     */
+    using TrimFn = std::function<void(size_t target_bytes)>;
+
+    struct Residency {
+        std::string name;
+        int priority = 0;
+        size_t bytes = 0;
+        size_t instance_count = 0;
+        bool trimmable = false;
+    };
+
+    struct Stats {
+        uint64_t trim_count = 0;      // 执行过裁剪的次数
+        uint64_t trimmed_bytes = 0;   // 累计裁剪掉的字节数
+        KRMemoryTrimLevel last_level = KRMemoryTrimLevel::kNone;
+    };
+
+    // 各缓存的裁剪优先级，越小越先裁剪：重建代价越低越靠前
+    static constexpr int kPriorityViewReuse = 0;
+    static constexpr int kPriorityAPNGAsset = 10;
+    static constexpr int kPrioritySnapshot = 15;
+    static constexpr int kPriorityDecodedImage = 20;
+    static constexpr int kPriorityEmojiPixmap = 30;
+    static constexpr int kPriorityTextMeasure = 40;
+    static constexpr int kPriorityPinned = 100;  // 只统计不裁剪
+
+    static constexpr size_t kDefaultBudgetBytes = 96 * 1024 * 1024;
+    static constexpr int64_t kDefaultModeratePssBytes = 1024LL * 1024 * 1024;
+    static constexpr int64_t kDefaultCriticalPssBytes = 1536LL * 1024 * 1024;
+
+    static KRCacheBudgetCoordinator &GetInstance() {
+        static auto *coordinator = new KRCacheBudgetCoordinator(kDefaultBudgetBytes);
+        return *coordinator;
+    }
+
+    explicit KRCacheBudgetCoordinator(size_t budget_bytes) : budget_bytes_(budget_bytes) {}
+
+    KRCacheBudgetCoordinator(const KRCacheBudgetCoordinator &) = delete;
+    KRCacheBudgetCoordinator &operator=(const KRCacheBudgetCoordinator &) = delete;
+
+    /**
+     * 注册缓存
+     * @param name 缓存名，同名实例（如页面级缓存）在报告中合并
+     * @param priority 优先级，越小越先被裁剪；同优先级按注册顺序
+     * @param trim 裁剪回调，为空表示只参与统计不可裁剪
+     * @return 注册 id，用于 Unregister
+     */
+    uint64_t Register(const std::string &name, int priority, BytesFn bytes, TrimFn trim) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto id = ++next_id_;
+        clients_[id] = Client{name, priority, std::move(bytes), std::move(trim)};
+        return id;
+    }
+
+    void Unregister(uint64_t id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        clients_.erase(id);
+    }
+
+    void SetBudgetBytes(size_t budget_bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        budget_bytes_ = budget_bytes;
+    }
+
+    size_t GetBudgetBytes() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return budget_bytes_;
+    }
+
+    /**
+     * 设置 PSS 阈值，0 表示不启用该级别
+     */
+    void SetPssThresholds(int64_t moderate_bytes, int64_t critical_bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        moderate_pss_bytes_ = moderate_bytes;
+        critical_pss_bytes_ = critical_bytes;
+    }
+
+    /**
+     * PSS 采样对应的裁剪级别
+     */
+    KRMemoryTrimLevel LevelForPss(int64_t pss_bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (critical_pss_bytes_ > 0 && pss_bytes >= critical_pss_bytes_) {
+            return KRMemoryTrimLevel::kCritical;
+        }
+        if (moderate_pss_bytes_ > 0 && pss_bytes >= moderate_pss_bytes_) {
+            return KRMemoryTrimLevel::kModerate;
+        }
+        return KRMemoryTrimLevel::kNone;
+    }
+
+    /**
+     * 系统内存级别（AbilityConstant.MemoryLevel：0 MODERATE、1 LOW、2 CRITICAL）对应的裁剪级别
+     */
+    static KRMemoryTrimLevel LevelForSystemMemoryLevel(int level) {
+        if (level <= 0) {
+            return KRMemoryTrimLevel::kModerate;
+        }
+        return KRMemoryTrimLevel::kCritical;
+    }
+
+    /**
+     * 总占用超出全局预算时裁剪
+     * @return 裁剪掉的字节数
+     */
+    size_t EnforceBudget() {
+        return TrimToTotal(GetBudgetBytes(), KRMemoryTrimLevel::kNone);
+    }
+
+    /**
+     * 按级别裁剪
+     * @return 裁剪掉的字节数
+     */
+    size_t Trim(KRMemoryTrimLevel level) {
+        switch (level) {
+            case KRMemoryTrimLevel::kModerate:
+                return TrimToTotal(GetBudgetBytes() / 2, level);
+            case KRMemoryTrimLevel::kCritical:
+                return TrimToTotal(0, level);
+            default:
+                return EnforceBudget();
+        }
+    }
+
+    /**
+     * 按缓存名汇总的驻留报告，按优先级排序
+     */
+    std::vector<Residency> Report() {
+        std::vector<Residency> report;
+        for (auto &client : SnapshotClients()) {
+            auto it = std::find_if(report.begin(), report.end(),
+                                   [&client](const Residency &item) { return item.name == client.second.name; });
+            if (it == report.end()) {
+                Residency residency;
+                residency.name = client.second.name;
+                residency.priority = client.second.priority;
+                residency.trimmable = static_cast<bool>(client.second.trim);
+                report.push_back(residency);
+                it = report.end() - 1;
+            }
+            if (IsRegistered(client.first)) {
+                it->bytes += client.second.bytes();
+                it->instance_count++;
+            }
+        }
+        return report;
+    }
+
+    /**
+     * 驻留报告转为单行文本，用于日志
+     */
+    static std::string FormatReport(const std::vector<Residency> &report) {
+        std::ostringstream out;
+        size_t total = 0;
+        for (const auto &item : report) {
+            total += item.bytes;
+            out << item.name << "(p" << item.priority << (item.trimmable ? "" : ",pinned") << ",x"
+                << item.instance_count << ")=" << item.bytes / 1024 << "KB ";
+        }
+        out << "total=" << total / 1024 << "KB";
+        return out.str();
+    }
+
+    Stats GetStats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+ private:
+    struct Client {
+        std::string name;
+        int priority;
+        BytesFn bytes;
+        TrimFn trim;
+    };
+
+    std::vector<std::pair<uint64_t, Client>> SnapshotClients() {
+        std::vector<std::pair<uint64_t, Client>> clients;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            clients.assign(clients_.begin(), clients_.end());
+        }
+        // id 递增，稳定排序后同优先级保持注册顺序
+        std::stable_sort(clients.begin(), clients.end(),
+                         [](const auto &lhs, const auto &rhs) { return lhs.second.priority < rhs.second.priority; });
+        return clients;
+    }
+
+    bool IsRegistered(uint64_t id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return clients_.find(id) != clients_.end();
+    }
+
+    size_t TrimToTotal(size_t target_total, KRMemoryTrimLevel level) {
+        auto clients = SnapshotClients();
+        std::vector<size_t> sizes;
+        size_t total = 0;
+        for (auto &client : clients) {
+            sizes.push_back(client.second.bytes());
+            total += sizes.back();
+        }
+        size_t trimmed = 0;
+        for (size_t i = 0; i < clients.size() && total > target_total; ++i) {
+            auto &client = clients[i].second;
+            if (!client.trim || sizes[i] == 0 || !IsRegistered(clients[i].first)) {
+                continue;  // 裁剪前面的缓存时可能注销了后面的缓存
+            }
+            size_t excess = total - target_total;
+            client.trim(sizes[i] > excess ? sizes[i] - excess : 0);
+            size_t after = std::min(client.bytes(), sizes[i]);
+            trimmed += sizes[i] - after;
+            total -= sizes[i] - after;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (trimmed > 0) {
+            stats_.trim_count++;
+            stats_.trimmed_bytes += trimmed;
+        }
+        if (level != KRMemoryTrimLevel::kNone) {
+            stats_.last_level = level;
+        }
+        return trimmed;
+    }
+
+    std::mutex mutex_;
+    size_t budget_bytes_;
+    int64_t moderate_pss_bytes_ = kDefaultModeratePssBytes;
+    int64_t critical_pss_bytes_ = kDefaultCriticalPssBytes;
+    std::map<uint64_t, Client> clients_;
+    uint64_t next_id_ = 0;
+    Stats stats_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRCACHEBUDGETCOORDINATOR_H
@@ -0,0 +1,127 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CORE_RENDER_OHOS_KRCHUNKALLOCATOR_H
+#define CORE_RENDER_OHOS_KRCHUNKALLOCATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+/**
+ * 按块分配的内存池，用于一次构造大量小对象（如批量渲染指令解码出的属性值）。
+ *
+ * 1) 对象在块内顺序分配，释放时不归还，块内对象全部释放后整块释放；
+ * 2) 对象可能被长期持有，因此按块而不是按整批保活，单个长期存活的对象最多滞留一个块；
+ * 3) 分配只能在一个线程进行，对象可在任意线程释放。只依赖标准库。
+ */
+class KRChunkArena {
+ public:
+    class Chunk {
+     public:
+        explicit Chunk(size_t capacity) : data_(new uint8_t[capacity]), capacity_(capacity) {}
+
+        void *TryAllocate(size_t size, size_t alignment) {
+            auto offset = (used_ + alignment - 1) & ~(alignment - 1);
+            if (offset + size > capacity_) {
+                return nullptr;
+            }
+            used_ = offset + size;
+            return data_.get() + offset;
+        }
+
+        bool Contains(const void *p) const {
+            auto address = static_cast<const uint8_t *>(p);
+            return address >= data_.get() && address < data_.get() + capacity_;
+        }
+
+        size_t Remaining() const {
+            return capacity_ - used_;
+        }
+
+     private:
+        std::unique_ptr<uint8_t[]> data_;
+        const size_t capacity_;
+        size_t used_ = 0;
+    };
+
+    static constexpr size_t kDefaultChunkSize = 8 * 1024;
+
+    KRChunkArena() : KRChunkArena(kDefaultChunkSize) {}
+    explicit KRChunkArena(size_t chunk_size) : chunk_size_(chunk_size) {}
+
+    /**
+     * 返回剩余空间不小于bytes（含对齐余量）的块，当前块不足时新开一块
+     */
+    std::shared_ptr<Chunk> Reserve(size_t bytes) {
+        bytes += alignof(std::max_align_t);
+        if (current_ == nullptr || current_->Remaining() < bytes) {
+            current_ = std::make_shared<Chunk>(std::max(chunk_size_, bytes));
+        }
+        return current_;
+    }
+
+ private:
+    const size_t chunk_size_;
+    std::shared_ptr<Chunk> current_;
+};
+
+/**
+ * 从KRChunkArena的块中分配的分配器，配合std::allocate_shared使用：
+ * 控制块保存分配器副本，从而持有所在的块；块空间不足时退回到全局堆
+ */
+template <typename T>
+class KRChunkAllocator {
+ public:
+    using value_type = T;
+
+    explicit KRChunkAllocator(std::shared_ptr<KRChunkArena::Chunk> chunk) : chunk_(std::move(chunk)) {}
+
+    template <typename U>
+    KRChunkAllocator(const KRChunkAllocator<U> &other) : chunk_(other.chunk_) {}  // NOLINT
+
+    T *allocate(size_t n) {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned type");
+        if (auto p = chunk_->TryAllocate(sizeof(T) * n, alignof(T))) {
+            return static_cast<T *>(p);
+        }
+        return static_cast<T *>(::operator new(sizeof(T) * n));
+    }
+
+    void deallocate(T *p, size_t) {
+        if (!chunk_->Contains(p)) {
+            ::operator delete(p);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const KRChunkAllocator<U> &other) const {
+        return chunk_ == other.chunk_;
+    }
+
+    template <typename U>
+    bool operator!=(const KRChunkAllocator<U> &other) const {
+        return chunk_ != other.chunk_;
+    }
+
+ private:
+    template <typename U>
+    friend class KRChunkAllocator;
+
+    std::shared_ptr<KRChunkArena::Chunk> chunk_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRCHUNKALLOCATOR_H
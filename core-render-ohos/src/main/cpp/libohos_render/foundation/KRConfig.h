@@ -16,7 +16,9 @@
 #ifndef CORE_RENDER_OHOS_KRCONFIG_H
 #define CORE_RENDER_OHOS_KRCONFIG_H
 
+#include <atomic>
 #include <cassert>
+#include <cstdint>
 #include <string>
 #include "libohos_render/foundation/type/KRRenderValue.h"
 
@@ -27,6 +29,8 @@ class KRConfig {
     }
 
     void Update(const std::string &configJson) {
+        auto lastFontSizeScale = fontSizeScale_;
+        auto lastFontWeightScale = fontWeightScale_;
         auto configValue = KRRenderValue::Make(configJson);
         auto map = configValue->toMap();
         auto vp2px = map.find("vp2px");
@@ -100,6 +104,23 @@ class KRConfig {
         if (performanceMonitorTypesMask != map.end()) {
             performanceMonitorTypesMask_ = performanceMonitorTypesMask->second->toInt();
         }
+
+        // 首次初始化不算变化，之后字体缩放变化时使文本测量缓存失效
+        if (updated_ && (lastFontSizeScale != fontSizeScale_ || lastFontWeightScale != fontWeightScale_)) {
+            BumpFontGeneration();
+        }
+        updated_ = true;
+    }
+
+    /**
+     * 字体配置版本号，字体缩放变化或注册自定义字体后递增（全进程共享，用于失效文本测量缓存）
+     */
+    static uint32_t GetFontGeneration() {
+        return FontGeneration().load(std::memory_order_acquire);
+    }
+
+    static void BumpFontGeneration() {
+        FontGeneration().fetch_add(1, std::memory_order_acq_rel);
     }
 
     /**
@@ -185,6 +206,11 @@ class KRConfig {
     }
 
  private:
+    static std::atomic<uint32_t> &FontGeneration() {
+        static std::atomic<uint32_t> gFontGeneration{0};
+        return gFontGeneration;
+    }
+
     float vp2px_ = 0;
     float fontWeightScale_ = 1;
     float fontSizeScale_ = 1;
@@ -199,6 +225,7 @@ class KRConfig {
     bool fontSizeScaleFollowSystem_ = true;
     int performanceMonitorTypesMask_ = 0;
     bool useOhSharedPreferences_ = true;    // 默认使用新的SharedPreferencesModule
+    bool updated_ = false;
 };
 
 #endif  // CORE_RENDER_OHOS_KRCONFIG_H
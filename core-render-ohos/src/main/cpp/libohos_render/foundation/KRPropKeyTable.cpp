@@ -0,0 +1,268 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/KRPropKeyTable.h"
+
+
+namespace {
+// 单个桶尝试的最大位移值，超出时槽位数翻倍重建
+constexpr uint32_t kMaxDisplacement = 1u << 16;
+
+uint64_t Mix64(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+}  // namespace
+
+KRPropKeyTable &KRPropKeyTable::GetInstance() {
+    static KRPropKeyTable gInstance;
+    return gInstance;
+}
+
+KRPropKeyTable::KRPropKeyTable() {
+    Rebuild();
+}
+
+uint64_t KRPropKeyTable::Hash(std::string_view key) {
+    // FNV-1a 64
+    uint64_t h = 14695981039346656037ull;
+    for (unsigned char c : key) {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+    return Mix64(h);
+}
+
+uint32_t KRPropKeyTable::SlotOf(uint64_t hash, uint32_t displacement, uint32_t slot_mask) {
+    // 低32位为起点，高32位为步长（奇数），同桶内不同key在不同位移下分散
+    auto f = static_cast<uint32_t>(hash);
+    auto g = static_cast<uint32_t>(hash >> 32) | 1u;
+    return (f + displacement * g) & slot_mask;
+}
+
+KRPropKeyId KRPropKeyTable::Lookup(const Snapshot *snapshot, std::string_view key) const {
+    auto hash = Hash(key);
+    auto displacement = snapshot->displacements[(hash >> 40) & snapshot->bucket_mask];
+    auto id = snapshot->slots[SlotOf(hash, displacement, snapshot->slot_mask)];
+    if (id != kKRInvalidPropKeyId && KeyAt(id) == key) {
+        return id;
+    }
+    // 重建后新增的key在增量表中，遇到空槽位即未驻留
+    for (auto slot = static_cast<uint32_t>(hash) & snapshot->overflow_mask;;
+         slot = (slot + 1) & snapshot->overflow_mask) {
+        id = snapshot->overflow[slot].load(std::memory_order_acquire);
+        if (id == kKRInvalidPropKeyId) {
+            return kKRInvalidPropKeyId;
+        }
+        if (KeyAt(id) == key) {
+            return id;
+        }
+    }
+}
+
+const std::string &KRPropKeyTable::KeyAt(KRPropKeyId id) const {
+    auto chunk = key_chunks_[id >> kKeyChunkBits].load(std::memory_order_acquire);
+    return *chunk[id & (kKeyChunkSize - 1)];
+}
+
+KRPropKeyId KRPropKeyTable::Find(std::string_view key) const {
+    return Lookup(snapshot_.load(std::memory_order_acquire), key);
+}
+
+KRPropKeyId KRPropKeyTable::Intern(std::string_view key) {
+    auto id = Find(key);
+    if (id != kKRInvalidPropKeyId) {
+        return id;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    id = Find(key);  // double check
+    if (id != kKRInvalidPropKeyId) {
+        return id;
+    }
+    if (key_storage_.size() >= kMaxKeys) {
+        return kKRInvalidPropKeyId;
+    }
+    id = AppendKeyLocked(key);
+    if (overflow_size_ < snapshots_.back()->overflow_capacity) {
+        InsertOverflowLocked(id);
+    } else {
+        Rebuild();
+    }
+    return id;
+}
+
+std::vector<KRPropKeyId> KRPropKeyTable::Intern(const std::vector<std::string_view> &keys) {
+    std::vector<KRPropKeyId> ids(keys.size(), kKRInvalidPropKeyId);
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<KRPropKeyId> new_ids;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ids[i] = Find(keys[i]);
+        if (ids[i] != kKRInvalidPropKeyId) {
+            continue;
+        }
+        // 本批次内重复的key
+        for (size_t j = 0; j < i; ++j) {
+            if (keys[j] == keys[i]) {
+                ids[i] = ids[j];
+                break;
+            }
+        }
+        if (ids[i] != kKRInvalidPropKeyId || key_storage_.size() >= kMaxKeys) {
+            continue;
+        }
+        ids[i] = AppendKeyLocked(keys[i]);
+        new_ids.push_back(ids[i]);
+    }
+    if (overflow_size_ + new_ids.size() <= snapshots_.back()->overflow_capacity) {
+        for (auto id : new_ids) {
+            InsertOverflowLocked(id);
+        }
+    } else {
+        Rebuild();
+    }
+    return ids;
+}
+
+const std::string &KRPropKeyTable::KeyOf(KRPropKeyId id) const {
+    static const std::string kEmpty;
+    if (id == kKRInvalidPropKeyId || id > key_count_.load(std::memory_order_acquire)) {
+        return kEmpty;
+    }
+    return KeyAt(id);
+}
+
+size_t KRPropKeyTable::Size() const {
+    return key_count_.load(std::memory_order_acquire);
+}
+
+size_t KRPropKeyTable::SnapshotCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return snapshots_.size();
+}
+
+// 调用方需持有mutex_
+KRPropKeyId KRPropKeyTable::AppendKeyLocked(std::string_view key) {
+    key_storage_.emplace_back(key);
+    auto id = static_cast<KRPropKeyId>(key_storage_.size());
+    auto &chunk_slot = key_chunks_[id >> kKeyChunkBits];
+    auto chunk = chunk_slot.load(std::memory_order_relaxed);
+    if (chunk == nullptr) {
+        key_chunk_storage_.emplace_back(std::make_unique<const std::string *[]>(kKeyChunkSize));
+        chunk = key_chunk_storage_.back().get();
+        chunk_slot.store(chunk, std::memory_order_release);
+    }
+    chunk[id & (kKeyChunkSize - 1)] = &key_storage_.back();
+    key_count_.store(id, std::memory_order_release);
+    return id;
+}
+
+// 调用方需持有mutex_，id对应的属性名须已写入
+void KRPropKeyTable::InsertOverflowLocked(KRPropKeyId id) {
+    auto &snapshot = *snapshots_.back();
+    auto slot = static_cast<uint32_t>(Hash(key_storage_[id - 1])) & snapshot.overflow_mask;
+    while (snapshot.overflow[slot].load(std::memory_order_relaxed) != kKRInvalidPropKeyId) {
+        slot = (slot + 1) & snapshot.overflow_mask;
+    }
+    snapshot.overflow[slot].store(id, std::memory_order_release);
+    ++overflow_size_;
+}
+
+// 调用方需持有mutex_（构造函数除外）
+void KRPropKeyTable::Rebuild() {
+    auto snapshot = std::make_unique<Snapshot>();
+    std::vector<uint64_t> hashes(1, 0);
+    hashes.reserve(key_storage_.size() + 1);
+    for (const auto &key : key_storage_) {
+        hashes.push_back(Hash(key));
+    }
+
+    // 槽位数取不小于2N的2的幂（负载0.5），平均每桶约2个key
+    uint32_t slot_count = 8;
+    while (slot_count < key_storage_.size() * 2) {
+        slot_count <<= 1;
+    }
+    for (;;) {
+        uint32_t bucket_count = std::max<uint32_t>(1, slot_count / 4);
+        std::vector<std::vector<KRPropKeyId>> buckets(bucket_count);
+        for (size_t id = 1; id < hashes.size(); ++id) {
+            buckets[(hashes[id] >> 40) & (bucket_count - 1)].push_back(static_cast<KRPropKeyId>(id));
+        }
+        std::vector<uint32_t> order(bucket_count);
+        for (uint32_t i = 0; i < bucket_count; ++i) {
+            order[i] = i;
+        }
+        // 大桶优先放置
+        std::stable_sort(order.begin(), order.end(),
+                         [&buckets](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+        snapshot->slots.assign(slot_count, kKRInvalidPropKeyId);
+        snapshot->displacements.assign(bucket_count, 0);
+        bool success = true;
+        std::vector<uint32_t> placed;
+        for (auto bucket_index : order) {
+            const auto &bucket = buckets[bucket_index];
+            if (bucket.empty()) {
+                break;
+            }
+            bool bucket_placed = false;
+            for (uint32_t displacement = 0; displacement < kMaxDisplacement && !bucket_placed; ++displacement) {
+                placed.clear();
+                bucket_placed = true;
+                for (auto id : bucket) {
+                    auto slot = SlotOf(hashes[id], displacement, slot_count - 1);
+                    if (snapshot->slots[slot] != kKRInvalidPropKeyId ||
+                        std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+                        bucket_placed = false;
+                        break;
+                    }
+                    placed.push_back(slot);
+                }
+                if (bucket_placed) {
+                    for (size_t i = 0; i < bucket.size(); ++i) {
+                        snapshot->slots[placed[i]] = bucket[i];
+                    }
+                    snapshot->displacements[bucket_index] = displacement;
+                }
+            }
+            if (!bucket_placed) {
+                success = false;
+                break;
+            }
+        }
+        if (success) {
+            snapshot->bucket_mask = bucket_count - 1;
+            snapshot->slot_mask = slot_count - 1;
+            break;
+        }
+        slot_count <<= 1;
+    }
+
+    // 增量表容量不小于当前key数，写满前不再重建，重建间隔随key数翻倍
+    snapshot->overflow_capacity = std::max(kMinOverflowKeys, key_storage_.size());
+    uint32_t overflow_slot_count = 8;
+    while (overflow_slot_count < snapshot->overflow_capacity * 2) {
+        overflow_slot_count <<= 1;
+    }
+    snapshot->overflow = std::make_unique<std::atomic<KRPropKeyId>[]>(overflow_slot_count);
+    snapshot->overflow_mask = overflow_slot_count - 1;
+    overflow_size_ = 0;
+
+    snapshot_.store(snapshot.get(), std::memory_order_release);
+    snapshots_.push_back(std::move(snapshot));
+}
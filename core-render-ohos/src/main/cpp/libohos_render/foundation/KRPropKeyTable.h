@@ -0,0 +1,267 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRPROPKEYTABLE_H
+#define CORE_RENDER_OHOS_KRPROPKEYTABLE_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * 属性名驻留后的id，0为无效id
+ */
+using KRPropKeyId = uint16_t;
+constexpr KRPropKeyId kKRInvalidPropKeyId = 0;
+
+/**
+ * 进程级属性名驻留表
+ * 1. 各组件在注册分发表时为属性名分配稠密id（从1开始）
+ * 2. Kotlin侧传入的属性名通过完美哈希表（hash-and-displace）查找id，每次查找一次哈希+一次比较；
+ *    未命中时再查增量表（线性探测）
+ * 3. 新属性名写入当前表的增量表，查找无锁；增量表写满（容量不小于完美哈希表的key数）时才整体重建并原子发布，
+ *    key数每翻倍至多重建一次
+ * 4. 无锁查找无法确定旧表何时不再被读取，旧表保留至进程结束；重建次数有上界（见 kMaxSnapshots），
+ *    保留的旧表总大小不超过当前表
+ */
+class KRPropKeyTable {
+ public:
+    static KRPropKeyTable &GetInstance();
+
+    /**
+     * 驻留属性名，已存在时返回已有id
+     * @param key 属性名
+     * @return 属性id，超出容量时返回kKRInvalidPropKeyId
+     */
+    KRPropKeyId Intern(std::string_view key);
+
+    /**
+     * 批量驻留属性名，增量表放不下时只重建一次哈希表，供分发表注册使用
+     * @param keys 属性名列表
+     * @return 与keys一一对应的属性id
+     */
+    std::vector<KRPropKeyId> Intern(const std::vector<std::string_view> &keys);
+
+    /**
+     * 查找属性名对应id，不会新增
+     * @param key 属性名
+     * @return 属性id，未驻留时返回kKRInvalidPropKeyId
+     */
+    KRPropKeyId Find(std::string_view key) const;
+
+    /**
+     * 根据id获取属性名
+     * @param id 属性id
+     * @return 属性名，id无效时返回空串
+     */
+    const std::string &KeyOf(KRPropKeyId id) const;
+
+    /**
+     * 已驻留的属性名数量
+     */
+    size_t Size() const;
+
+    /**
+     * 已发布的哈希表数量（含保留的旧表），即重建次数
+     */
+    size_t SnapshotCount() const;
+
+    /**
+     * 可驻留的属性名上限，超出后 Intern 返回 kKRInvalidPropKeyId
+     */
+    static constexpr size_t kMaxKeys = 65534;
+    /**
+     * 增量表的最小容量
+     */
+    static constexpr size_t kMinOverflowKeys = 64;
+    /**
+     * 哈希表数量上限：构造时 1 个，之后 key 数每翻倍（从 kMinOverflowKeys 起）至多重建 1 次
+     */
+    static constexpr size_t kMaxSnapshots = 12;
+
+ private:
+    struct Snapshot {
+        uint32_t bucket_mask = 0;
+        uint32_t slot_mask = 0;
+        std::vector<uint32_t> displacements;  // 桶 -> 位移值
+        std::vector<KRPropKeyId> slots;       // 槽位 -> id
+        uint32_t overflow_mask = 0;
+        size_t overflow_capacity = 0;                        // 增量表最多容纳的key数（负载不超过0.5）
+        std::unique_ptr<std::atomic<KRPropKeyId>[]> overflow;  // 增量表槽位 -> id，写入后不再修改
+    };
+
+    // id -> 属性名按块分配，块与块内元素写入后不再修改，读取无需加锁
+    static constexpr size_t kKeyChunkBits = 8;
+    static constexpr size_t kKeyChunkSize = size_t(1) << kKeyChunkBits;
+    static constexpr size_t kKeyChunkCount = (kMaxKeys + 1 + kKeyChunkSize - 1) / kKeyChunkSize;
+
+    KRPropKeyTable();
+    KRPropKeyTable(const KRPropKeyTable &) = delete;
+    KRPropKeyTable &operator=(const KRPropKeyTable &) = delete;
+
+    static uint64_t Hash(std::string_view key);
+    static uint32_t SlotOf(uint64_t hash, uint32_t displacement, uint32_t slot_mask);
+    KRPropKeyId Lookup(const Snapshot *snapshot, std::string_view key) const;
+    const std::string &KeyAt(KRPropKeyId id) const;
+    KRPropKeyId AppendKeyLocked(std::string_view key);
+    void InsertOverflowLocked(KRPropKeyId id);
+    void Rebuild();
+
+    std::atomic<const Snapshot *> snapshot_{nullptr};
+    std::atomic<size_t> key_count_{0};
+    std::array<std::atomic<const std::string **>, kKeyChunkCount> key_chunks_{};
+    mutable std::mutex mutex_;
+    std::deque<std::string> key_storage_;  // deque扩容不会使已有元素地址失效
+    std::vector<std::unique_ptr<const std::string *[]>> key_chunk_storage_;
+    size_t overflow_size_ = 0;  // 当前表增量表中的key数
+    std::vector<std::unique_ptr<Snapshot>> snapshots_;
+};
+
+/**
+ * 已设置属性的id位图，替代按字符串线性查找的std::vector<std::string>
+ * 驻留表容量耗尽后没有id的属性名按字符串记录，不会丢失
+ */
+class KRPropKeySet {
+ public:
+    /**
+     * 记录属性，id无效时按属性名记录
+     */
+    void Insert(KRPropKeyId id, std::string_view key) {
+        if (id != kKRInvalidPropKeyId) {
+            Insert(id);
+        } else if (std::find(unkeyed_.begin(), unkeyed_.end(), key) == unkeyed_.end()) {
+            unkeyed_.emplace_back(key);
+        }
+    }
+
+    void Insert(KRPropKeyId id) {
+        if (id == kKRInvalidPropKeyId) {
+            return;
+        }
+        size_t word = id >> 6;
+        if (word >= words_.size()) {
+            words_.resize(word + 1, 0);
+        }
+        words_[word] |= (uint64_t(1) << (id & 63));
+    }
+
+    void Erase(KRPropKeyId id) {
+        size_t word = id >> 6;
+        if (word < words_.size()) {
+            words_[word] &= ~(uint64_t(1) << (id & 63));
+        }
+    }
+
+    bool Contains(KRPropKeyId id) const {
+        size_t word = id >> 6;
+        return word < words_.size() && (words_[word] & (uint64_t(1) << (id & 63))) != 0;
+    }
+
+    bool Empty() const {
+        if (!unkeyed_.empty()) {
+            return false;
+        }
+        for (auto word : words_) {
+            if (word != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void Clear() {
+        std::fill(words_.begin(), words_.end(), 0);
+        unkeyed_.clear();
+    }
+
+    /**
+     * 按id升序遍历
+     */
+    template <typename Fn>
+    void ForEach(Fn &&fn) const {
+        for (size_t i = 0; i < words_.size(); ++i) {
+            uint64_t bits = words_[i];
+            while (bits != 0) {
+                int bit = __builtin_ctzll(bits);
+                bits &= bits - 1;
+                fn(static_cast<KRPropKeyId>((i << 6) + bit));
+            }
+        }
+    }
+
+    /**
+     * 按插入顺序遍历没有id的属性名
+     */
+    template <typename Fn>
+    void ForEachUnkeyed(Fn &&fn) const {
+        for (const auto &key : unkeyed_) {
+            fn(key);
+        }
+    }
+
+ private:
+    std::vector<uint64_t> words_;
+    std::vector<std::string> unkeyed_;
+};
+
+/**
+ * 按属性id索引的分发表，每个Handler类持有一份静态实例
+ * @tparam Fn 处理函数指针类型
+ */
+template <typename Fn>
+class KRPropKeyJumpTable {
+ public:
+    KRPropKeyJumpTable(std::initializer_list<std::pair<const char *, Fn>> entries) {
+        std::vector<std::string_view> keys;
+        keys.reserve(entries.size());
+        for (const auto &entry : entries) {
+            keys.emplace_back(entry.first);
+        }
+        auto ids = KRPropKeyTable::GetInstance().Intern(keys);
+        size_t index = 0;
+        for (const auto &entry : entries) {
+            auto id = ids[index++];
+            if (id == kKRInvalidPropKeyId) {
+                continue;
+            }
+            if (id >= handlers_.size()) {
+                handlers_.resize(id + 1, nullptr);
+            }
+            handlers_[id] = entry.second;
+        }
+    }
+
+    Fn Find(KRPropKeyId id) const {
+        return id < handlers_.size() ? handlers_[id] : nullptr;
+    }
+
+    Fn Find(const std::string &key) const {
+        return Find(KRPropKeyTable::GetInstance().Find(key));
+    }
+
+ private:
+    std::vector<Fn> handlers_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRPROPKEYTABLE_H
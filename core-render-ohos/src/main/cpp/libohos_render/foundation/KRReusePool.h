@@ -0,0 +1,394 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRREUSEPOOL_H
+#define CORE_RENDER_OHOS_KRREUSEPOOL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * 按类型分组的对象复用池（进程级共享的 native view 等创建代价高的对象）。
+ *
+ * 设计要点：
+ * 1) 每个类型有数量上限，全部类型共享总数上限；超出时按 LRU 淘汰，被淘汰的对象交给 destroyer 销毁；
+ * 2) 同类型内取最近放入的对象（LIFO），保持热对象常驻；
+ * 3) 预热学习：LearnSession 按会话内各类型的使用量做滑动平均，PrewarmPlan 给出各类型还需预热的数量，
+ *    学习结果可序列化，跨进程保留；只有成功放入过池子的类型才会被学习（不可复用的类型不预热）；
+ * 4) 统计命中 / 未命中 / 淘汰 / 预热命中，按类型汇总用于报告命中率。
+ *
+ * 线程约定：不加锁，只在一个线程（主线程）访问。只依赖标准库。
+ */
+template <typename T>
+class KRReusePool {
+ public:
+    using Ptr = std::shared_ptr<T>;
+    using Destroyer = std::function<void(const Ptr &)>;
+
+    struct Options {
+        size_t max_total = 256;              // 池中对象总数上限
+        size_t default_max_per_type = 64;    // 未单独配置的类型的上限
+        std::unordered_map<std::string, size_t> max_per_type;
+        size_t max_learned_types = 32;       // 学习表最多保留的类型数
+    };
+
+    struct Stats {
+        uint64_t hit_count = 0;
+        uint64_t miss_count = 0;
+        uint64_t recycle_count = 0;      // 成功放入池中的次数（不含预热）
+        uint64_t eviction_count = 0;     // 因超出上限或裁剪被销毁的对象数
+        uint64_t prewarm_count = 0;      // 预热放入的对象数
+        uint64_t prewarm_hit_count = 0;  // 命中的对象来自预热
+        size_t size = 0;
+    };
+
+    KRReusePool(const Options &options, Destroyer destroyer)
+        : options_(options), destroyer_(std::move(destroyer)) {}
+
+    ~KRReusePool() {
+        Clear();
+    }
+
+    KRReusePool(const KRReusePool &) = delete;
+    KRReusePool &operator=(const KRReusePool &) = delete;
+
+    /**
+     * 取出一个 type 类型的对象（最近放入的优先）
+     * @return 池中没有时返回空
+     */
+    Ptr Acquire(const std::string &type) {
+        auto &state = types_[type];
+        if (state.entries.empty()) {
+            state.stats.miss_count++;
+            return nullptr;
+        }
+        auto it = state.entries.back();
+        state.entries.pop_back();
+        state.stats.hit_count++;
+        if (it->prewarmed) {
+            state.stats.prewarm_hit_count++;
+        }
+        Ptr item = std::move(it->item);
+        lru_.erase(it);
+        return item;
+    }
+
+    /**
+     * 放回一个已重置的对象
+     * @return 类型上限为 0 时不放入并销毁对象，返回 false
+     */
+    bool Recycle(const std::string &type, Ptr item) {
+        if (!Insert(type, std::move(item), false)) {
+            return false;
+        }
+        types_[type].stats.recycle_count++;
+        return true;
+    }
+
+    /**
+     * 放入一个预热创建的对象；该类型已不需要预热时不放入并销毁对象，返回 false
+     */
+    bool Prewarm(const std::string &type, Ptr item) {
+        if (PrewarmDeficit(type) == 0) {
+            Destroy(item);
+            return false;
+        }
+        if (!Insert(type, std::move(item), true)) {
+            return false;
+        }
+        types_[type].stats.prewarm_count++;
+        return true;
+    }
+
+    /**
+     * 标记 type 不可复用（预热创建后发现不能复用、或创建失败），不再学习和预热
+     */
+    void Forget(const std::string &type) {
+        learned_.erase(type);
+        reusable_types_.erase(type);
+    }
+
+    /**
+     * 用一次会话（一个页面）内各类型的使用量更新学习表
+     * 学习值 = 上次学习值与本次使用量的加权平均（新值占 1/4），会话内未出现的类型按 3/4 衰减
+     */
+    void LearnSession(const std::unordered_map<std::string, size_t> &demand) {
+        for (auto it = learned_.begin(); it != learned_.end();) {
+            if (demand.count(it->first) == 0) {
+                it->second = it->second * 3 / 4;
+            }
+            it = it->second == 0 ? learned_.erase(it) : std::next(it);
+        }
+        for (const auto &entry : demand) {
+            if (entry.second == 0 || reusable_types_.count(entry.first) == 0) {
+                continue;
+            }
+            auto it = learned_.find(entry.first);
+            if (it == learned_.end()) {
+                learned_[entry.first] = entry.second;
+            } else {
+                it->second = (it->second * 3 + entry.second + 3) / 4;
+            }
+        }
+        ShrinkLearned();
+    }
+
+    /**
+     * 该类型还需预热的数量：学习值（不超过类型上限）减去池中已有数量
+     */
+    size_t PrewarmDeficit(const std::string &type) const {
+        auto learned = learned_.find(type);
+        if (learned == learned_.end()) {
+            return 0;
+        }
+        size_t target = std::min(learned->second, MaxForType(type));
+        size_t pooled = Size(type);
+        return target > pooled ? target - pooled : 0;
+    }
+
+    /**
+     * 预热计划：按学习值从大到小列出需要预热的类型及数量，总量不超过池的剩余容量
+     */
+    std::vector<std::pair<std::string, size_t>> PrewarmPlan() const {
+        std::vector<std::pair<std::string, size_t>> learned(learned_.begin(), learned_.end());
+        std::sort(learned.begin(), learned.end(), [](const auto &a, const auto &b) {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        });
+        size_t room = options_.max_total > lru_.size() ? options_.max_total - lru_.size() : 0;
+        std::vector<std::pair<std::string, size_t>> plan;
+        for (const auto &entry : learned) {
+            size_t count = std::min(PrewarmDeficit(entry.first), room);
+            if (count > 0) {
+                plan.emplace_back(entry.first, count);
+                room -= count;
+            }
+        }
+        return plan;
+    }
+
+    /**
+     * 学习表序列化，每行 "类型 数量"
+     */
+    std::string SerializeProfile() const {
+        std::ostringstream out;
+        out << kProfileHeader << '\n';
+        for (const auto &entry : learned_) {
+            out << entry.first << ' ' << entry.second << '\n';
+        }
+        return out.str();
+    }
+
+    /**
+     * 载入序列化的学习表（与当前学习表合并，取较大值）；载入的类型视为可复用
+     * @return 格式不正确时忽略并返回 false
+     */
+    bool LoadProfile(const std::string &text) {
+        std::istringstream in(text);
+        std::string header;
+        if (!std::getline(in, header) || header != kProfileHeader) {
+            return false;
+        }
+        std::string type;
+        long long count = 0;
+        while (in >> type >> count) {
+            if (count <= 0) {
+                continue;
+            }
+            auto &learned = learned_[type];
+            learned = std::max(learned, static_cast<size_t>(count));
+            reusable_types_.insert(type);
+        }
+        ShrinkLearned();
+        return true;
+    }
+
+    /**
+     * 按 LRU 淘汰，直到池中对象数不超过 max_count
+     * @return 淘汰的对象数
+     */
+    size_t TrimTo(size_t max_count) {
+        size_t evicted = 0;
+        while (lru_.size() > max_count) {
+            EvictOldest();
+            evicted++;
+        }
+        return evicted;
+    }
+
+    void Clear() {
+        TrimTo(0);
+    }
+
+    size_t Size() const {
+        return lru_.size();
+    }
+
+    size_t Size(const std::string &type) const {
+        auto it = types_.find(type);
+        return it == types_.end() ? 0 : it->second.entries.size();
+    }
+
+    size_t LearnedCount(const std::string &type) const {
+        auto it = learned_.find(type);
+        return it == learned_.end() ? 0 : it->second;
+    }
+
+    Stats GetStats() const {
+        Stats total;
+        for (const auto &entry : types_) {
+            Accumulate(&total, entry.second.stats);
+        }
+        total.size = lru_.size();
+        return total;
+    }
+
+    Stats GetStats(const std::string &type) const {
+        auto it = types_.find(type);
+        if (it == types_.end()) {
+            return Stats();
+        }
+        auto stats = it->second.stats;
+        stats.size = it->second.entries.size();
+        return stats;
+    }
+
+    /**
+     * 命中率报告，例如 "hit 120/150 (80.0%) size 42 [KRView 90/100 size 30, ...]"
+     */
+    std::string FormatReport() const {
+        std::vector<std::pair<std::string, Stats>> types;
+        for (const auto &entry : types_) {
+            if (entry.second.stats.hit_count + entry.second.stats.miss_count > 0) {
+                types.emplace_back(entry.first, GetStats(entry.first));
+            }
+        }
+        std::sort(types.begin(), types.end(), [](const auto &a, const auto &b) {
+            return a.second.hit_count + a.second.miss_count > b.second.hit_count + b.second.miss_count;
+        });
+        std::ostringstream out;
+        AppendHitRate(out, GetStats());
+        out << " evicted " << GetStats().eviction_count << " [";
+        for (size_t i = 0; i < types.size(); ++i) {
+            out << (i == 0 ? "" : ", ") << types[i].first << ' ';
+            AppendHitRate(out, types[i].second);
+        }
+        out << ']';
+        return out.str();
+    }
+
+ private:
+    static constexpr const char *kProfileHeader = "kr_reuse_profile_v1";
+
+    struct Entry {
+        std::string type;
+        Ptr item;
+        bool prewarmed = false;
+    };
+    using EntryList = std::list<Entry>;
+
+    struct TypeState {
+        // 该类型在 lru_ 中的条目，按放入先后排列（back 为最近放入）
+        std::deque<typename EntryList::iterator> entries;
+        Stats stats;
+    };
+
+    bool Insert(const std::string &type, Ptr item, bool prewarmed) {
+        size_t max_for_type = MaxForType(type);
+        if (!item || max_for_type == 0 || options_.max_total == 0) {
+            Destroy(item);
+            return false;
+        }
+        auto &state = types_[type];
+        while (state.entries.size() >= max_for_type) {
+            EvictFrom(state);
+        }
+        while (lru_.size() >= options_.max_total) {
+            EvictOldest();
+        }
+        lru_.push_front(Entry{type, std::move(item), prewarmed});
+        state.entries.push_back(lru_.begin());
+        reusable_types_.insert(type);
+        return true;
+    }
+
+    // 同类型内放入顺序与 lru_ 中的相对顺序一致，因此全局最旧的条目也是其类型内最旧的条目
+    void EvictOldest() {
+        EvictFrom(types_[lru_.back().type]);
+    }
+
+    void EvictFrom(TypeState &state) {
+        auto it = state.entries.front();
+        state.entries.pop_front();
+        state.stats.eviction_count++;
+        Ptr item = std::move(it->item);
+        lru_.erase(it);
+        Destroy(item);
+    }
+
+    void Destroy(const Ptr &item) {
+        if (item && destroyer_) {
+            destroyer_(item);
+        }
+    }
+
+    size_t MaxForType(const std::string &type) const {
+        auto it = options_.max_per_type.find(type);
+        return it == options_.max_per_type.end() ? options_.default_max_per_type : it->second;
+    }
+
+    void ShrinkLearned() {
+        while (learned_.size() > options_.max_learned_types) {
+            auto smallest = std::min_element(learned_.begin(), learned_.end(),
+                                             [](const auto &a, const auto &b) { return a.second < b.second; });
+            learned_.erase(smallest);
+        }
+    }
+
+    static void Accumulate(Stats *total, const Stats &stats) {
+        total->hit_count += stats.hit_count;
+        total->miss_count += stats.miss_count;
+        total->recycle_count += stats.recycle_count;
+        total->eviction_count += stats.eviction_count;
+        total->prewarm_count += stats.prewarm_count;
+        total->prewarm_hit_count += stats.prewarm_hit_count;
+    }
+
+    static void AppendHitRate(std::ostringstream &out, const Stats &stats) {
+        auto requests = stats.hit_count + stats.miss_count;
+        char rate[16];
+        snprintf(rate, sizeof(rate), "%.1f%%", requests == 0 ? 0.0 : stats.hit_count * 100.0 / requests);
+        out << "hit " << stats.hit_count << '/' << requests << " (" << rate << ") size " << stats.size;
+    }
+
+    const Options options_;
+    const Destroyer destroyer_;
+    EntryList lru_;  // front 为最近放入
+    std::unordered_map<std::string, TypeState> types_;
+    std::unordered_map<std::string, size_t> learned_;
+    std::unordered_set<std::string> reusable_types_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRREUSEPOOL_H
@@ -0,0 +1,103 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/ffrt/KRFfrtExecutorBackend.h"
+
+#include <utility>
+#include <vector>
+
+#include "libohos_render/foundation/ffrt/KRFfrt.h"
+
+namespace kuikly {
+namespace dispatch {
+
+KRFfrtExecutorBackend::KRFfrtExecutorBackend(size_t max_inflight) : slots_(max_inflight) {}
+
+KRFfrtExecutorBackend::~KRFfrtExecutorBackend() {
+    Shutdown();
+}
+
+void KRFfrtExecutorBackend::Post(QoS qos, KRTask job) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stop_) {
+        lock.unlock();
+        job();
+        return;
+    }
+    auto *item = new Job{this, qos, std::move(job)};
+    auto level = QoSLevel(qos);
+    if (!slots_.CanStart(level)) {
+        waiting_[level].push_back(item);
+        return;
+    }
+    slots_.Acquire(level);
+    lock.unlock();
+    Submit(item);
+}
+
+void KRFfrtExecutorBackend::Shutdown() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stop_ = true;
+    // 排队的作业会在前面的作业结束时依次提交，全部执行完才返回
+    idle_condition_.wait(lock, [this] { return slots_.Running() == 0; });
+}
+
+void KRFfrtExecutorBackend::Execute(void *arg) {
+    auto *job = static_cast<Job *>(arg);
+    if (!job) {
+        return;
+    }
+    job->task();
+    job->task.Reset();
+    job->backend->OnJobDone(job->qos);
+}
+
+void KRFfrtExecutorBackend::Cleanup(void *arg) {
+    delete static_cast<Job *>(arg);
+}
+
+void KRFfrtExecutorBackend::Submit(Job *job) {
+    ffrt_task_attr_t attr;
+    ffrt_task_attr_init(&attr);
+    ffrt_task_attr_set_qos(&attr, static_cast<ffrt_qos_t>(job->qos));
+    ffrt_submit_base(ffrt_create_function_wrapper(Execute, Cleanup, job, ffrt_function_kind_general), nullptr,
+                     nullptr, &attr);
+    ffrt_task_attr_destroy(&attr);
+}
+
+void KRFfrtExecutorBackend::OnJobDone(QoS qos) {
+    std::vector<Job *> next;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        slots_.Release(QoSLevel(qos));
+        // 释放的名额交给可以开始的最高 QoS 排队作业
+        for (int level = kQoSLevelCount - 1; level >= 0; --level) {
+            while (!waiting_[level].empty() && slots_.CanStart(level)) {
+                next.push_back(waiting_[level].front());
+                waiting_[level].pop_front();
+                slots_.Acquire(level);
+            }
+        }
+        if (slots_.Running() == 0) {
+            idle_condition_.notify_all();
+        }
+    }
+    for (auto *job : next) {
+        Submit(job);
+    }
+}
+
+}  // namespace dispatch
+}  // namespace kuikly
@@ -0,0 +1,67 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFFRTEXECUTORBACKEND_H
+#define CORE_RENDER_OHOS_KRFFRTEXECUTORBACKEND_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include "libohos_render/foundation/thread/KRExecutor.h"
+
+namespace kuikly {
+namespace dispatch {
+
+/**
+ * 基于 ffrt_submit_base 的执行后端（设备构建）
+ * 1. 作业以对应 QoS 提交给 ffrt，复用系统 worker，不创建自有线程
+ * 2. 同时提交给 ffrt 的作业数不超过 max_inflight，并按 KRQoSSlots 为高 QoS 保留名额；
+ *    超出部分按 QoS 排队，有作业结束时优先提交高 QoS 的
+ */
+class KRFfrtExecutorBackend : public KRExecutorBackend {
+ public:
+    explicit KRFfrtExecutorBackend(size_t max_inflight);
+    ~KRFfrtExecutorBackend() override;
+
+    void Post(QoS qos, KRTask job) override;
+    void Shutdown() override;
+
+ private:
+    struct Job {
+        KRFfrtExecutorBackend *backend;
+        QoS qos;
+        KRTask task;
+    };
+
+    /// ffrt task body，执行作业后提交下一个排队的作业
+    static void Execute(void *arg);
+    /// ffrt task cleanup（after_func）；释放 Job
+    static void Cleanup(void *arg);
+
+    void Submit(Job *job);
+    void OnJobDone(QoS qos);
+
+    std::mutex mutex_;
+    std::condition_variable idle_condition_;
+    std::deque<Job *> waiting_[kQoSLevelCount];
+    KRQoSSlots slots_;
+    bool stop_ = false;
+};
+
+}  // namespace dispatch
+}  // namespace kuikly
+
+#endif  // CORE_RENDER_OHOS_KRFFRTEXECUTORBACKEND_H
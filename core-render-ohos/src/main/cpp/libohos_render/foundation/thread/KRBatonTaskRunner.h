@@ -0,0 +1,102 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CORE_RENDER_OHOS_KRBATONTASKRUNNER_H
+#define CORE_RENDER_OHOS_KRBATONTASKRUNNER_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include "KRBlockingMpscQueue.h"
+#include "KRThreadBaton.h"
+
+/**
+ * KRThread的任务队列与执行权交接（只依赖标准库）
+ * 工作线程调用RunLoop消费队列，每执行完一个任务检查一次是否有调用方等待执行权；
+ * 调用方通过TryRunOnCurThread在自身线程上与工作线程互斥地执行同步任务。
+ * 线程创建、日志及获取失败后的处理由使用方负责。
+ */
+class KRBatonTaskRunner {
+ public:
+    /**
+     * 投递任务，无锁入队，工作线程挂起时才会加锁唤醒
+     */
+    void Post(KRTask task) {
+        m_tasks.Push(std::move(task));
+    }
+
+    /**
+     * 工作线程循环，Stop后执行完已入队的任务再返回
+     */
+    void RunLoop() {
+        KRTask task;
+        while (true) {
+            if (m_tasks.Empty()) {
+                if (m_stop.load()) {
+                    break;
+                }
+                m_tasks.Wait();
+                continue;
+            }
+            m_baton.AcquireForWorker();
+            while (m_tasks.Pop(task)) {
+                task();
+                task.Reset();
+                m_baton.YieldToCallerIfWaiting();
+            }
+            m_baton.ReleaseForWorker();
+        }
+    }
+
+    void Stop() {
+        m_stop.store(true);
+        m_tasks.Wake();
+    }
+
+    /**
+     * 在调用线程执行任务：重入时直接执行，否则等待工作线程在两个任务之间让出执行权
+     * @return false表示超时或工作线程正同步等待主线程，任务未执行
+     */
+    bool TryRunOnCurThread(const std::function<void()> &task, std::chrono::milliseconds timeout) {
+        if (m_baton.IsHeldByCurrentThread()) {
+            task();
+            return true;
+        }
+        if (!m_baton.AcquireForCaller(timeout)) {
+            return false;
+        }
+        task();
+        m_baton.ReleaseForCaller();
+        return true;
+    }
+
+    bool IsHeldByCurrentThread() const {
+        return m_baton.IsHeldByCurrentThread();
+    }
+
+    void SetSyncMainTaskPending(bool pending) {
+        m_baton.SetSyncMainTaskPending(pending);
+    }
+
+    KRThreadBaton::Stats GetStats() {
+        return m_baton.GetStats();
+    }
+
+ private:
+    KRTaskQueue m_tasks;
+    KRThreadBaton m_baton;
+    std::atomic<bool> m_stop{false};
+};
+
+#endif  // CORE_RENDER_OHOS_KRBATONTASKRUNNER_H
@@ -0,0 +1,96 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRBLOCKINGMPSCQUEUE_H
+#define CORE_RENDER_OHOS_KRBLOCKINGMPSCQUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include "libohos_render/foundation/thread/KRMpscQueue.h"
+#include "libohos_render/foundation/thread/KRTask.h"
+
+/**
+ * 工作线程任务队列：无锁MPSC队列 + 消费者空闲挂起
+ * 生产者入队不加锁，只有消费者正挂起时才加锁唤醒；消费者挂起前在锁内复查队列，不会丢失唤醒
+ */
+template <typename T>
+class KRBlockingMpscQueue {
+ public:
+    /**
+     * 入队，任意线程调用
+     */
+    void Push(T value) {
+        queue_.Push(std::move(value));
+        if (consumer_waiting_.load()) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            condition_.notify_one();
+        }
+    }
+
+    /**
+     * 出队，仅消费者线程调用
+     */
+    bool Pop(T &value) {
+        return queue_.Pop(value);
+    }
+
+    bool Empty() const {
+        return queue_.Empty();
+    }
+
+    /**
+     * 消费者挂起直到有新任务或被Wake唤醒
+     */
+    void Wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        consumer_waiting_.store(true);
+        condition_.wait(lock, [this] { return woken_ || !queue_.Empty(); });
+        consumer_waiting_.store(false);
+        woken_ = false;
+    }
+
+    /**
+     * 消费者挂起直到有新任务、被Wake唤醒或到达指定时间
+     */
+    void WaitUntil(std::chrono::steady_clock::time_point time) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        consumer_waiting_.store(true);
+        condition_.wait_until(lock, time, [this] { return woken_ || !queue_.Empty(); });
+        consumer_waiting_.store(false);
+        woken_ = false;
+    }
+
+    /**
+     * 唤醒消费者（如停止线程时）
+     */
+    void Wake() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        woken_ = true;
+        condition_.notify_one();
+    }
+
+ private:
+    KRMpscQueue<T> queue_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::atomic<bool> consumer_waiting_{false};
+    bool woken_ = false;
+};
+
+using KRTaskQueue = KRBlockingMpscQueue<KRTask>;
+
+#endif  // CORE_RENDER_OHOS_KRBLOCKINGMPSCQUEUE_H
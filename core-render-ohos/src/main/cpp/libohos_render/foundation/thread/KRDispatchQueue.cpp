@@ -0,0 +1,275 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * KRDispatchQueue.cpp — 运行在 KRExecutor 后端上的通用任务队列实现。
+ * 设计与 lifecycle 详见 KRDispatchQueue.h 顶部注释。
+ */
+
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
+
+#include <algorithm>
+#include <climits>
+#include <exception>
+#include <utility>
+
+namespace kuikly {
+namespace dispatch {
+
+// ----------------------------------------------------------------------
+// Lifecycle 设计要点（critical path）：
+//
+//   Async(task) → ready_ 表 + order_ 队列；队列向后端投递作业（jobs_），作业数不超过 max_concurrency_，
+//   每个作业从 order_ 取任务执行，最多连续执行 kMaxTasksPerJob 个后结束，剩余任务由新作业继续。
+//   Serial 队列 max_concurrency_ == 1，同一时刻只有一个作业，因此严格 FIFO。
+//
+//   AsyncAfter(task) → delayed_ 表 + KRTimerQueue 定时器（分组为 timer_group_）；到期时在定时器线程转入
+//   ready_。Cancel 从 ready_ / delayed_ 中移除，order_ 中的 id 作为墓碑在出队时跳过。
+//
+//   作业捕获 this：Shutdown / 析构等待 jobs_ == 0 后才返回，作业结束前不会访问已析构的队列；
+//   作业在持锁时 notify 后不再访问 this。
+// ----------------------------------------------------------------------
+
+KRDispatchQueue::KRDispatchQueue(const std::string &name, QueueType type, QoS qos, int max_concurrency,
+                                 KRExecutor *executor)
+    : name_(name),
+      qos_(qos),
+      max_concurrency_(type == QueueType::Serial ? 1 : std::max(max_concurrency, 1)),
+      executor_(executor ? executor : &KRExecutor::GetInstance()),
+      timer_group_("dispatch:" + name + "@" + std::to_string(reinterpret_cast<uintptr_t>(this))) {
+    if (!executor_->Register(this)) {
+        // 执行器已关闭：队列直接处于关闭状态，提交被拒绝
+        closed_ = true;
+    }
+}
+
+KRDispatchQueue::~KRDispatchQueue() {
+    // 先注销：执行器正在关闭本队列时等待其完成
+    executor_->Unregister(this);
+    Shutdown(false);
+}
+
+KRDispatchTaskId KRDispatchQueue::Async(Task task, KRSourceLocation location) {
+    return AsyncAfter(0, std::move(task), location);
+}
+
+KRDispatchTaskId KRDispatchQueue::AsyncAfter(uint64_t delay_ms, Task task, KRSourceLocation location) {
+    if (!task) {
+        return 0;  // 显式空 task，无操作
+    }
+    TaskItem item{location, std::move(task)};  // 拒绝时在锁外释放闭包
+    int jobs = 0;
+    KRDispatchTaskId id;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_) {
+            stats_.rejected++;
+            return 0;
+        }
+        id = next_id_++;
+        stats_.submitted++;
+        if (delay_ms == 0) {
+            order_.push_back(id);
+            ready_.emplace(id, std::move(item));
+            jobs = ClaimJobsLocked();
+        } else {
+            // 先占位再加定时器：定时器可能在 Schedule 返回前就到期
+            delayed_.emplace(id, 0);
+        }
+    }
+    if (delay_ms == 0) {
+        PostJobs(jobs);
+        return id;
+    }
+
+    auto timer_id = KRTimerQueue::GetInstance().Schedule(
+        [this, id, item = std::move(item)]() mutable { FireDelayed(id, std::move(item)); },
+        static_cast<int>(std::min<uint64_t>(delay_ms, INT_MAX)), timer_group_);
+    bool cancelled = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = delayed_.find(id);
+        if (it != delayed_.end()) {
+            it->second = timer_id;
+        } else {
+            // 已到期或已被 Cancel；后者需要释放定时器中的闭包
+            cancelled = true;
+        }
+    }
+    if (cancelled) {
+        KRTimerQueue::GetInstance().Cancel(timer_id);
+    }
+    return id;
+}
+
+bool KRDispatchQueue::Cancel(KRDispatchTaskId id) {
+    TaskItem item;  // 在锁外释放闭包
+    KRTimerId timer_id = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = ready_.find(id);
+        if (it != ready_.end()) {
+            item = std::move(it->second);
+            ready_.erase(it);
+            if (ready_.empty()) {
+                order_.clear();  // 只剩墓碑
+            }
+        } else {
+            auto delayed_it = delayed_.find(id);
+            if (delayed_it == delayed_.end()) {
+                return false;
+            }
+            timer_id = delayed_it->second;
+            delayed_.erase(delayed_it);
+        }
+        stats_.cancelled++;
+    }
+    if (timer_id != 0) {
+        KRTimerQueue::GetInstance().Cancel(timer_id);
+    }
+    return true;
+}
+
+void KRDispatchQueue::Drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_condition_.wait(lock, [this] { return ready_.empty() && jobs_ == 0; });
+}
+
+bool KRDispatchQueue::Shutdown(bool drain, std::chrono::milliseconds timeout) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        stats_.cancelled += delayed_.size();
+        delayed_.clear();
+    }
+    // 取消未到期的延时任务；返回时不会再有本队列的定时器回调在执行
+    KRTimerQueue::GetInstance().CancelGroup(timer_group_);
+
+    std::unordered_map<KRDispatchTaskId, TaskItem> dropped;  // 在锁外释放闭包
+    bool drained;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto idle = [this] { return ready_.empty() && jobs_ == 0; };
+        if (drain && timeout == std::chrono::milliseconds::max()) {
+            idle_condition_.wait(lock, idle);
+        } else if (drain) {
+            idle_condition_.wait_for(lock, timeout, idle);
+        }
+        drained = ready_.empty();
+        stats_.cancelled += ready_.size();
+        dropped.swap(ready_);
+        order_.clear();
+        // 正在执行的任务跑完
+        idle_condition_.wait(lock, [this] { return jobs_ == 0; });
+    }
+    return drained;
+}
+
+bool KRDispatchQueue::IsShutdown() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+}
+
+KRDispatchQueue::Stats KRDispatchQueue::GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void KRDispatchQueue::FireDelayed(KRDispatchTaskId id, TaskItem item) {
+    int jobs = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (delayed_.erase(id) == 0 || closed_) {
+            return;  // 已取消或队列已关闭
+        }
+        order_.push_back(id);
+        ready_.emplace(id, std::move(item));
+        jobs = ClaimJobsLocked();
+    }
+    PostJobs(jobs);
+}
+
+int KRDispatchQueue::ClaimJobsLocked() {
+    int jobs = 0;
+    while (jobs_ < max_concurrency_ && static_cast<size_t>(jobs_) < ready_.size()) {
+        jobs_++;
+        jobs++;
+    }
+    return jobs;
+}
+
+void KRDispatchQueue::PostJobs(int jobs) {
+    for (int i = 0; i < jobs; ++i) {
+        executor_->Post(qos_, [this] { RunJob(); });
+    }
+}
+
+bool KRDispatchQueue::PopLocked(TaskItem *item) {
+    while (!order_.empty()) {
+        auto id = order_.front();
+        order_.pop_front();
+        auto it = ready_.find(id);
+        if (it != ready_.end()) {
+            *item = std::move(it->second);
+            ready_.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void KRDispatchQueue::RunJob() {
+    for (int i = 0; i < kMaxTasksPerJob; ++i) {
+        TaskItem item;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!PopLocked(&item)) {
+                break;
+            }
+            running_++;
+            stats_.max_running = std::max(stats_.max_running, static_cast<size_t>(running_));
+        }
+        RunItem(item);
+        item.task.Reset();
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_--;
+        stats_.executed++;
+    }
+
+    int jobs;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_--;
+        // 还有任务时补投作业，交还线程让其它队列的作业有机会执行
+        jobs = ClaimJobsLocked();
+        if (jobs_ == 0) {
+            idle_condition_.notify_all();
+            return;
+        }
+    }
+    PostJobs(jobs);
+}
+
+void KRDispatchQueue::RunItem(TaskItem &item) {
+    // try/catch 把任务里的异常吃掉 —— worker 线程抛异常会让进程崩溃。业务自身需要异常捕获时应在 lambda 内处理。
+    try {
+        item.task();
+    } catch (const std::exception &e) {
+        KRExecutor::ReportTaskException(name_, item.location.Location(), e.what());
+    } catch (...) {
+        KRExecutor::ReportTaskException(name_, item.location.Location(), "non-std exception");
+    }
+}
+
+}  // namespace dispatch
+}  // namespace kuikly
@@ -0,0 +1,294 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRDISPATCHQUEUE_H
+#define CORE_RENDER_OHOS_KRDISPATCHQUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "libohos_render/foundation/thread/KRExecutor.h"
+#include "libohos_render/foundation/thread/KRTask.h"
+#include "libohos_render/foundation/thread/KRTimerQueue.h"
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_FILE_NAME)
+#define KR_DISPATCH_QUEUE_CALLER_FILE __builtin_FILE_NAME()
+#elif __has_builtin(__builtin_FILE)
+#define KR_DISPATCH_QUEUE_CALLER_FILE __builtin_FILE()
+#endif
+#endif
+
+#ifndef KR_DISPATCH_QUEUE_CALLER_FILE
+#if defined(__FILE_NAME__)
+#define KR_DISPATCH_QUEUE_CALLER_FILE __FILE_NAME__
+#else
+#define KR_DISPATCH_QUEUE_CALLER_FILE __FILE__
+#endif
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_LINE)
+#define KR_DISPATCH_QUEUE_CALLER_LINE __builtin_LINE()
+#endif
+#endif
+
+#ifndef KR_DISPATCH_QUEUE_CALLER_LINE
+#define KR_DISPATCH_QUEUE_CALLER_LINE __LINE__
+#endif
+
+namespace kuikly {
+namespace dispatch {
+namespace detail {
+
+constexpr const char *kUnknownLocation = "<unknown>";
+constexpr std::size_t kSourceLocationCapacity = 48;
+
+constexpr const char *BaseName(const char *path, std::size_t *length) {
+    if (!path) {
+        path = kUnknownLocation;
+    }
+
+    const char *base = path;
+    std::size_t base_length = 0;
+    for (const char *p = path; *p != '\0'; ++p) {
+        if (*p == '/' || *p == '\\') {
+            base = p + 1;
+            base_length = 0;
+        } else {
+            ++base_length;
+        }
+    }
+
+    if (length) {
+        *length = base_length;
+    }
+    return base;
+}
+
+constexpr std::size_t UIntLength(unsigned int value) {
+    std::size_t length = 1;
+    while (value >= 10) {
+        value /= 10;
+        ++length;
+    }
+    return length;
+}
+
+}  // namespace detail
+
+class KRSourceLocation {
+ public:
+    constexpr KRSourceLocation() : KRSourceLocation(detail::kUnknownLocation, 0) {}
+
+    constexpr KRSourceLocation(const char *file, int line) {
+        std::size_t file_length = 0;
+        const char *source_file = detail::BaseName(file, &file_length);
+
+        unsigned int line_value =
+            line < 0 ? static_cast<unsigned int>(-(line + 1)) + 1U : static_cast<unsigned int>(line);
+        const std::size_t digit_count = detail::UIntLength(line_value);
+        const std::size_t suffix_length = 1 + (line < 0 ? 1 : 0) + digit_count;
+        const std::size_t max_file_length =
+            detail::kSourceLocationCapacity > suffix_length + 1
+                ? detail::kSourceLocationCapacity - suffix_length - 1
+                : 0;
+
+        const std::size_t copy_length = file_length > max_file_length ? max_file_length : file_length;
+        const char *file_start = source_file + file_length - copy_length;
+
+        std::size_t index = 0;
+        for (; index < copy_length; ++index) {
+            location_[index] = file_start[index];
+        }
+        location_[index++] = ':';
+
+        if (line < 0) {
+            location_[index++] = '-';
+        }
+
+        for (std::size_t digit_index = digit_count; digit_index > 0; --digit_index) {
+            unsigned int divisor = 1;
+            for (std::size_t i = 1; i < digit_index; ++i) {
+                divisor *= 10;
+            }
+            location_[index++] = static_cast<char>('0' + (line_value / divisor) % 10);
+        }
+        location_[index] = '\0';
+    }
+
+    constexpr const char *Location() const { return location_; }
+
+ private:
+    char location_[detail::kSourceLocationCapacity]{};
+};
+
+using KRDispatchTaskId = uint64_t;  // 0 为无效 id（提交被拒绝）
+
+/**
+ * @brief 通用 DispatchQueue 任务队列，所有后台工作的统一入口，运行在 KRExecutor 的后端上。
+ *
+ * 设计目标：
+ *   1) 替代 native 业务自行造的 "std::thread + condvar + queue" 工作线程与各自的线程池；
+ *   2) 队列语义（串行 / 并发度、延时、取消、排空）在本类实现，与后端无关：设备上由 ffrt worker 执行，
+ *      主机上由 KRThreadPoolBackend 执行；
+ *   3) 接口形态向 GCD（dispatch_queue_t）看齐；
+ *   4) RAII：析构时丢弃未执行的任务并等待正在执行的任务结束。
+ *
+ * 用法示例（serial，与 GCD dispatch_async 等价）：
+ * @code
+ *   auto q = std::make_unique<KRDispatchQueue>("decode_queue");
+ *   q->Async([uri] { Decode(uri); });
+ *   auto id = q->AsyncAfter(100, [] { TimeoutCheck(); });
+ *   q->Cancel(id);
+ * @endcode
+ *
+ * @note 任务在后端 worker 线程执行，**不在调用方线程执行**。如需切回主线程，请显式使用
+ *       KRMainThread::RunOnMainThread。
+ *
+ * @note 所有接口线程安全。延时任务到期前保存在共享的 KRTimerQueue 中，不占用 worker。
+ */
+class KRDispatchQueue {
+ public:
+    using Task = KRTask;
+
+    struct Stats {
+        uint64_t submitted = 0;   // 接受的任务数（含延时任务）
+        uint64_t executed = 0;    // 执行完的任务数
+        uint64_t cancelled = 0;   // 被取消或关闭时丢弃的任务数
+        uint64_t rejected = 0;    // 关闭后提交被拒绝的任务数
+        size_t max_running = 0;   // 同时执行的任务数峰值
+    };
+
+    /**
+     * @brief 创建一个 DispatchQueue。
+     *
+     * @param name             队列名（用于日志定位；建议 ASCII，不超过 ~32 字符）。
+     * @param type             Serial / Concurrent。
+     * @param qos              队列 QoS。
+     * @param max_concurrency  仅对 Concurrent 生效（Serial 时为 1）；默认 4。
+     * @param executor         所属执行器，默认为 KRExecutor::GetInstance()。
+     */
+    explicit KRDispatchQueue(const std::string &name,
+                             QueueType type = QueueType::Serial,
+                             QoS qos = QoS::Default,
+                             int max_concurrency = 4,
+                             KRExecutor *executor = nullptr);
+
+    ~KRDispatchQueue();
+
+    KRDispatchQueue(const KRDispatchQueue &) = delete;
+    KRDispatchQueue &operator=(const KRDispatchQueue &) = delete;
+    KRDispatchQueue(KRDispatchQueue &&) = delete;
+    KRDispatchQueue &operator=(KRDispatchQueue &&) = delete;
+
+    /**
+     * @brief 异步派发一个任务到本队列。
+     *
+     * Task 会自动携带调用点的 `文件名:行号` 作为 location，任务抛出异常时连同 location 一起上报。
+     *
+     * @return 任务 id，可用于 Cancel；队列已关闭时返回 0，任务被丢弃。
+     */
+    KRDispatchTaskId Async(Task task,
+                           KRSourceLocation location = KRSourceLocation(KR_DISPATCH_QUEUE_CALLER_FILE,
+                                                                        KR_DISPATCH_QUEUE_CALLER_LINE));
+
+    /**
+     * @brief 延迟若干毫秒后异步派发。
+     *
+     * @param delay_ms  延迟毫秒数；0 等价于 Async。
+     * @param task      任务体（捕获语义同 Async）。
+     */
+    KRDispatchTaskId AsyncAfter(uint64_t delay_ms,
+                                Task task,
+                                KRSourceLocation location = KRSourceLocation(KR_DISPATCH_QUEUE_CALLER_FILE,
+                                                                             KR_DISPATCH_QUEUE_CALLER_LINE));
+
+    /**
+     * @brief 取消尚未开始执行的任务（含未到期的延时任务），闭包在返回前释放。
+     * @return 取消成功返回 true；任务已开始执行、已执行完或 id 无效时返回 false。
+     */
+    bool Cancel(KRDispatchTaskId id);
+
+    /**
+     * @brief 等待已派发的任务（不含未到期的延时任务）全部执行完。不能在本队列的任务中调用。
+     */
+    void Drain();
+
+    /**
+     * @brief 关闭队列：此后提交被拒绝，未到期的延时任务被取消。
+     *
+     * @param drain    为 true 时在 timeout 内等待已排队的任务执行完，超时后丢弃剩余任务；
+     *                 为 false 时直接丢弃。两种情况都会等待正在执行的任务结束。
+     * @return 没有丢弃排队任务时返回 true。
+     */
+    bool Shutdown(bool drain, std::chrono::milliseconds timeout = std::chrono::milliseconds::max());
+
+    bool IsShutdown();
+
+    Stats GetStats();
+
+    /**
+     * @brief 队列名（构造时传入；析构后仍有效，用于错误日志）。
+     */
+    const std::string &Name() const { return name_; }
+
+    QoS GetQoS() const { return qos_; }
+
+ private:
+    struct TaskItem {
+        KRSourceLocation location;
+        Task task;
+    };
+
+    void FireDelayed(KRDispatchTaskId id, TaskItem item);
+    /// 按就绪任务数与并发度占用作业名额，返回需要投递的作业数（锁外调用 PostJobs）
+    int ClaimJobsLocked();
+    void PostJobs(int jobs);
+    bool PopLocked(TaskItem *item);
+    void RunJob();
+    void RunItem(TaskItem &item);
+
+    /// 一个作业最多连续执行的任务数，之后交还 worker，避免单个队列长期占用线程
+    static constexpr int kMaxTasksPerJob = 16;
+
+    const std::string name_;
+    const QoS qos_;
+    const int max_concurrency_;
+    KRExecutor *const executor_;
+    const std::string timer_group_;  // 延时任务在共享定时器队列中的分组
+
+    std::mutex mutex_;
+    std::condition_variable idle_condition_;
+    std::deque<KRDispatchTaskId> order_;                       // 含墓碑（已取消的 id）
+    std::unordered_map<KRDispatchTaskId, TaskItem> ready_;     // 已派发未开始的任务
+    std::unordered_map<KRDispatchTaskId, KRTimerId> delayed_;  // 未到期的延时任务
+    KRDispatchTaskId next_id_ = 1;
+    int jobs_ = 0;     // 已投递到后端且未结束的作业数，不超过 max_concurrency_
+    int running_ = 0;  // 正在执行的任务数
+    bool closed_ = false;
+    Stats stats_;
+};
+
+}  // namespace dispatch
+}  // namespace kuikly
+
+#endif  // CORE_RENDER_OHOS_KRDISPATCHQUEUE_H
@@ -0,0 +1,248 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRExecutor.h"
+
+#include <pthread.h>
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
+
+// 设备构建（CMake 中定义 KR_EXECUTOR_USE_FFRT）使用 ffrt 后端并把任务异常写入日志；主机构建使用 std::thread 后端
+#ifdef KR_EXECUTOR_USE_FFRT
+#include "libohos_render/foundation/ffrt/KRFfrtExecutorBackend.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+#endif
+
+namespace kuikly {
+namespace dispatch {
+
+namespace {
+
+// 后端同时执行的作业数上限（与原 KRGCDQueue 的 4 条线程一致），按 QoS 分级分配见 KRQoSSlots
+constexpr size_t kMaxBackendConcurrency = 4;
+// 每个 Global 队列的并发度
+constexpr int kGlobalQueueConcurrency = 4;
+
+std::unique_ptr<KRExecutorBackend> CreateDefaultBackend() {
+#ifdef KR_EXECUTOR_USE_FFRT
+    return std::make_unique<KRFfrtExecutorBackend>(kMaxBackendConcurrency);
+#else
+    size_t threads = std::clamp<size_t>(std::thread::hardware_concurrency(), 2, kMaxBackendConcurrency);
+    return std::make_unique<KRThreadPoolBackend>(threads, "kuiklyexec");
+#endif
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// KRThreadPoolBackend
+// ----------------------------------------------------------------------
+KRThreadPoolBackend::KRThreadPoolBackend(size_t max_threads, const std::string &name)
+    : max_threads_(std::max<size_t>(max_threads, 1)), name_(name), slots_(max_threads_) {}
+
+KRThreadPoolBackend::~KRThreadPoolBackend() {
+    Shutdown();
+}
+
+void KRThreadPoolBackend::Post(QoS qos, KRTask job) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stop_) {
+        lock.unlock();
+        job();
+        return;
+    }
+    ready_[QoSLevel(qos)].push_back(std::move(job));
+    pending_++;
+    // 待执行的作业多于空闲线程时才扩容，线程数不超过上限
+    if (pending_ > idle_ && threads_.size() < max_threads_) {
+        threads_.emplace_back([this] { Worker(); });
+        auto thread_name = name_ + "-" + std::to_string(threads_.size());
+        pthread_setname_np(threads_.back().native_handle(), thread_name.c_str());
+        stats_.thread_count = threads_.size();
+        return;
+    }
+    lock.unlock();
+    condition_.notify_one();
+}
+
+void KRThreadPoolBackend::Shutdown() {
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        threads.swap(threads_);
+    }
+    condition_.notify_all();
+    // 工作线程执行完剩余作业后退出
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+KRThreadPoolBackend::Stats KRThreadPoolBackend::GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+// 调用方需持有mutex_；返回可以开始执行的最高 QoS 级别，没有时返回 -1
+int KRThreadPoolBackend::RunnableLevelLocked() const {
+    for (int level = kQoSLevelCount - 1; level >= 0; --level) {
+        if (!ready_[level].empty() && slots_.CanStart(level)) {
+            return level;
+        }
+    }
+    return -1;
+}
+
+void KRThreadPoolBackend::Worker() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        auto level = RunnableLevelLocked();
+        if (level < 0) {
+            if (stop_ && pending_ == 0) {
+                return;
+            }
+            // 没有作业，或排队的作业所在 QoS 的名额已满
+            idle_++;
+            condition_.wait(lock, [this] { return (stop_ && pending_ == 0) || RunnableLevelLocked() >= 0; });
+            idle_--;
+            continue;
+        }
+        KRTask job = std::move(ready_[level].front());
+        ready_[level].pop_front();
+        pending_--;
+        running_++;
+        slots_.Acquire(level);
+        stats_.peak_running = std::max(stats_.peak_running, running_);
+        lock.unlock();
+        job();
+        job.Reset();
+        lock.lock();
+        running_--;
+        slots_.Release(level);
+        stats_.executed++;
+        if (stop_) {
+            condition_.notify_all();
+        } else if (pending_ > 0) {
+            // 释放的名额可能让其他 QoS 的排队作业可以执行
+            condition_.notify_one();
+        }
+    }
+}
+
+// ----------------------------------------------------------------------
+// KRExecutor
+// ----------------------------------------------------------------------
+KRExecutor &KRExecutor::GetInstance() {
+    static KRExecutor *gExecutor = new KRExecutor(CreateDefaultBackend());
+    return *gExecutor;
+}
+
+KRExecutor::KRExecutor(std::unique_ptr<KRExecutorBackend> backend) : backend_(std::move(backend)) {
+    static const QoS kGlobalQoS[kQoSLevelCount] = {QoS::Background, QoS::Utility, QoS::Default, QoS::UserInitiated,
+                                                   QoS::UserInteractive};
+    static const char *kGlobalNames[kQoSLevelCount] = {"kr.global.background", "kr.global.utility",
+                                                       "kr.global.default", "kr.global.user_initiated",
+                                                       "kr.global.user_interactive"};
+    for (int level = 0; level < kQoSLevelCount; ++level) {
+        global_queues_.push_back(std::make_unique<KRDispatchQueue>(kGlobalNames[level], QueueType::Concurrent,
+                                                                   kGlobalQoS[level], kGlobalQueueConcurrency, this));
+    }
+}
+
+KRExecutor::~KRExecutor() {
+    Shutdown(std::chrono::milliseconds::max());
+    global_queues_.clear();
+    backend_.reset();
+}
+
+KRDispatchQueue &KRExecutor::Global(QoS qos) {
+    return *global_queues_[QoSLevel(qos)];
+}
+
+bool KRExecutor::Shutdown(std::chrono::milliseconds timeout) {
+    std::vector<KRDispatchQueue *> queues;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (shutdown_) {
+            return true;
+        }
+        shutdown_ = true;
+        queues.assign(queues_.begin(), queues_.end());
+    }
+    const bool forever = timeout == std::chrono::milliseconds::max();
+    const auto deadline = std::chrono::steady_clock::now() + (forever ? std::chrono::milliseconds(0) : timeout);
+    bool drained = true;
+    for (auto *queue : queues) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (queues_.count(queue) == 0) {
+                continue;  // 队列已析构
+            }
+            closing_queue_ = queue;
+        }
+        auto remaining = forever ? std::chrono::milliseconds::max()
+                                 : std::max(std::chrono::milliseconds(0),
+                                            std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                deadline - std::chrono::steady_clock::now()));
+        // 排空期间任务提交到已关闭队列的新任务会被拒绝
+        drained = queue->Shutdown(true, remaining) && drained;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closing_queue_ = nullptr;
+        }
+        busy_condition_.notify_all();
+    }
+    backend_->Shutdown();
+    return drained;
+}
+
+bool KRExecutor::IsShutdown() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return shutdown_;
+}
+
+void KRExecutor::ReportTaskException(const std::string &queue, const char *location, const char *what) {
+#ifdef KR_EXECUTOR_USE_FFRT
+    KR_LOG_ERROR << "[KRDispatchQueue:" << queue << "] location=" << location << " threw: " << what;
+#else
+    fprintf(stderr, "[KRDispatchQueue:%s] location=%s threw: %s\n", queue.c_str(), location, what);
+#endif
+}
+
+bool KRExecutor::Register(KRDispatchQueue *queue) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (shutdown_) {
+        return false;
+    }
+    queues_.insert(queue);
+    return true;
+}
+
+void KRExecutor::Unregister(KRDispatchQueue *queue) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    busy_condition_.wait(lock, [this, queue] { return closing_queue_ != queue; });
+    queues_.erase(queue);
+}
+
+void KRExecutor::Post(QoS qos, KRTask job) {
+    backend_->Post(qos, std::move(job));
+}
+
+}  // namespace dispatch
+}  // namespace kuikly
@@ -0,0 +1,256 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KREXECUTOR_H
+#define CORE_RENDER_OHOS_KREXECUTOR_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "libohos_render/foundation/thread/KRTask.h"
+
+namespace kuikly {
+namespace dispatch {
+
+class KRDispatchQueue;
+
+/**
+ * @brief Queue type — 串行 / 并发。
+ *
+ * Serial：FIFO，前一个 task 完成后才执行下一个，等价于 GCD serial queue。
+ * Concurrent：多任务并发执行，受 max_concurrency 上限约束。
+ */
+enum class QueueType {
+    Serial,
+    Concurrent,
+};
+
+/**
+ * @brief Quality of Service — 数值与 ffrt_qos_default_t 一致，ffrt 后端可直接 static_cast。
+ *
+ * 选用建议：
+ *   - Background：日志落盘、文件写入、metrics 采集
+ *   - Utility：图片解码、字体加载等 "用户感知但不阻塞主交互" 的工作
+ *   - Default：通用业务任务，未指定时的默认值
+ *   - UserInitiated：响应用户操作、与当前帧布局相关的预计算
+ *   - UserInteractive：动画 / 输入事件相关的前置任务
+ */
+enum class QoS : int {
+    Inherit         = -1,  // 继承提交方的 QoS；std::thread 后端按 Default 处理
+    Background      = 0,
+    Utility         = 1,
+    Default         = 2,
+    UserInitiated   = 3,
+    UserInteractive = 5,
+};
+
+constexpr int kQoSLevelCount = 5;
+
+/**
+ * QoS 对应的级别 0 ~ kQoSLevelCount-1，越大越优先；Inherit 按 Default 处理
+ */
+constexpr int QoSLevel(QoS qos) {
+    switch (qos) {
+        case QoS::Background:
+            return 0;
+        case QoS::Utility:
+            return 1;
+        case QoS::UserInitiated:
+            return 3;
+        case QoS::UserInteractive:
+            return 4;
+        default:
+            return 2;
+    }
+}
+
+/**
+ * 后端的执行名额按 QoS 分级，调用方加锁
+ * 1. 同时执行的作业总数不超过 max_concurrency
+ * 2. Background 合计至多占一半名额，Default 及以下合计至多占 max_concurrency - 1：
+ *    落盘等阻塞 I/O 和批量解码占满时，Utility 与 UserInitiated 及以上（文本排版等当前帧相关的作业）仍有名额
+ */
+class KRQoSSlots {
+ public:
+    explicit KRQoSSlots(size_t max_concurrency) : max_concurrency_(max_concurrency > 0 ? max_concurrency : 1) {}
+
+    /**
+     * QoS 级别为 level 的作业现在能否开始执行
+     */
+    bool CanStart(int level) const {
+        size_t running_at_or_below = 0;
+        for (int i = 0; i <= level; ++i) {
+            running_at_or_below += running_[i];
+        }
+        return Running() < max_concurrency_ && running_at_or_below < Limit(level);
+    }
+    void Acquire(int level) {
+        running_[level]++;
+    }
+    void Release(int level) {
+        running_[level]--;
+    }
+    size_t Running() const {
+        size_t running = 0;
+        for (auto count : running_) {
+            running += count;
+        }
+        return running;
+    }
+    /**
+     * QoS 级别不高于 level 的作业合计可同时执行的数量
+     */
+    size_t Limit(int level) const {
+        size_t limit = max_concurrency_;
+        if (level == QoSLevel(QoS::Background)) {
+            limit = max_concurrency_ / 2;
+        } else if (level < QoSLevel(QoS::UserInitiated)) {
+            limit = max_concurrency_ - 1;
+        }
+        return std::max<size_t>(limit, 1);
+    }
+
+ private:
+    const size_t max_concurrency_;
+    size_t running_[kQoSLevelCount] = {};  // 下标为 QoSLevel
+};
+
+/**
+ * 执行后端：只负责在某个 QoS 上运行一个作业，队列语义（串行、取消、延时、排空）由 KRDispatchQueue 实现
+ */
+class KRExecutorBackend {
+ public:
+    virtual ~KRExecutorBackend() = default;
+
+    /**
+     * 投递一个作业，任意线程调用
+     */
+    virtual void Post(QoS qos, KRTask job) = 0;
+
+    /**
+     * 执行完已投递的作业后停止，之后 Post 的作业在调用线程直接执行
+     */
+    virtual void Shutdown() = 0;
+};
+
+/**
+ * 基于 std::thread 的后端（主机环境与未启用 ffrt 时使用）
+ * 1. 线程数不超过 max_threads，有作业且没有空闲线程时才创建新线程
+ * 2. 每个 QoS 一条就绪队列，空闲线程优先取高 QoS 的作业；各 QoS 的同时执行数按 KRQoSSlots 分级限制
+ */
+class KRThreadPoolBackend : public KRExecutorBackend {
+ public:
+    struct Stats {
+        size_t thread_count = 0;     // 已创建的线程数
+        size_t peak_running = 0;     // 同时执行作业的峰值
+        uint64_t executed = 0;       // 执行的作业数
+    };
+
+    KRThreadPoolBackend(size_t max_threads, const std::string &name);
+    ~KRThreadPoolBackend() override;
+
+    void Post(QoS qos, KRTask job) override;
+    void Shutdown() override;
+    Stats GetStats();
+
+ private:
+    void Worker();
+    int RunnableLevelLocked() const;
+
+    const size_t max_threads_;
+    const std::string name_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<KRTask> ready_[kQoSLevelCount];  // 下标为 QoSLevel
+    std::vector<std::thread> threads_;
+    size_t idle_ = 0;
+    size_t running_ = 0;
+    size_t pending_ = 0;
+    bool stop_ = false;
+    KRQoSSlots slots_;
+    Stats stats_;
+};
+
+/**
+ * 统一的后台任务执行器
+ * 1. 所有后台工作通过 KRDispatchQueue 提交：命名的串行 / 并发队列，带 QoS，可延时、可取消
+ * 2. Global(qos) 为各 QoS 提供共享的并发队列，替代原先各自创建线程或线程池的做法
+ * 3. 设备上使用 ffrt 后端（复用系统 worker），主机上使用 KRThreadPoolBackend；线程数都有上限
+ * 4. Shutdown 依次关闭已注册的队列（排空或超时后丢弃），最后停止后端
+ */
+class KRExecutor {
+ public:
+    /**
+     * 全局执行器（不析构）
+     */
+    static KRExecutor &GetInstance();
+
+    explicit KRExecutor(std::unique_ptr<KRExecutorBackend> backend);
+    ~KRExecutor();
+
+    KRExecutor(const KRExecutor &) = delete;
+    KRExecutor &operator=(const KRExecutor &) = delete;
+
+    /**
+     * 共享的并发队列
+     * @param qos 队列 QoS，Inherit 按 Default 处理
+     */
+    KRDispatchQueue &Global(QoS qos = QoS::Default);
+
+    /**
+     * 关闭执行器：不再接受新任务，已排队的任务在 timeout 内执行完，超时未执行的任务被丢弃；
+     * 不能在本执行器的任务中调用
+     * @return 全部排队任务都已执行时返回 true
+     */
+    bool Shutdown(std::chrono::milliseconds timeout);
+
+    bool IsShutdown();
+
+    /**
+     * 任务抛出异常时调用（设备上写入日志）
+     */
+    static void ReportTaskException(const std::string &queue, const char *location, const char *what);
+
+ private:
+    friend class KRDispatchQueue;
+
+    /**
+     * @return 执行器已关闭时返回 false，队列应直接进入关闭状态
+     */
+    bool Register(KRDispatchQueue *queue);
+    void Unregister(KRDispatchQueue *queue);
+    void Post(QoS qos, KRTask job);
+
+    std::unique_ptr<KRExecutorBackend> backend_;
+    std::mutex mutex_;
+    std::condition_variable busy_condition_;
+    std::unordered_set<KRDispatchQueue *> queues_;
+    KRDispatchQueue *closing_queue_ = nullptr;  // Shutdown 正在关闭的队列，期间不能析构
+    bool shutdown_ = false;
+    std::vector<std::unique_ptr<KRDispatchQueue>> global_queues_;  // 下标为 QoS 级别
+};
+
+}  // namespace dispatch
+}  // namespace kuikly
+
+#endif  // CORE_RENDER_OHOS_KREXECUTOR_H
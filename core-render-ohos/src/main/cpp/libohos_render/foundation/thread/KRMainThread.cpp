@@ -16,33 +16,28 @@
 #include "KRMainThread.h"
 
 #include <hilog/log.h>
-#include "KRDelayThread.h"
+#include "KRTaskTrampoline.h"
+#include "KRTimerQueue.h"
 
 
 static  napi_threadsafe_function g_threadsafe_func_handle = NULL;
-// 延时Api
-static void DispatchAsync(std::function<void()> task, int delayMilliseconds = 0) {
-    static KRDelayThread *gDelayThread = new KRDelayThread("kuiklyasync");
-    gDelayThread->DispatchAsync(task, delayMilliseconds);
+// 主线程每轮最多连续执行任务的时间，超出后剩余任务留到下一轮事件循环，保证输入事件及时响应
+static constexpr auto kMainThreadDrainBudget = std::chrono::milliseconds(8);
+// 延时Api，与KRThread共用全局定时器队列
+static void DispatchAsync(KRTask task, int delayMilliseconds = 0) {
+    KRTimerQueue::GetInstance().Schedule(std::move(task), delayMilliseconds);
 }
-class MainThreadTask {
- public:
-    explicit MainThreadTask(std::function<void()> func) : func(std::move(func)) {}
 
-    void execute() {
-        func();
-    }
-
- private:
-    std::function<void()> func;
-};
+static KRTaskTrampoline &MainThreadTrampoline() {
+    // 队列由空变为非空时才通过threadsafe function唤醒主线程，一次唤醒批量执行
+    static KRTaskTrampoline *gTrampoline = new KRTaskTrampoline([] {
+        napi_call_threadsafe_function(g_threadsafe_func_handle, nullptr, napi_tsfn_blocking);
+    });
+    return *gTrampoline;
+}
 
 static void gcd_threadsafe_func(napi_env env, napi_value js_fun, void *context, void *data) {
-    MainThreadTask *task = static_cast<MainThreadTask *>(data);
-    if (task != nullptr) {
-        task->execute();
-        delete task;
-    }
+    MainThreadTrampoline().Drain(kMainThreadDrainBudget);
 }
 
 KRMainThread::KRMainThread() {
@@ -65,13 +60,12 @@ void KRMainThread::Export(napi_env env, napi_value exports) {
     }
 }
 
-void KRMainThread::RunOnMainThread(std::function<void()> task, int delayMilliseconds) {
+void KRMainThread::RunOnMainThread(KRTask task, int delayMilliseconds) {
     if (delayMilliseconds > 0) {
-        DispatchAsync([task] { RunOnMainThread(task); }, delayMilliseconds);
+        DispatchAsync([task = std::move(task)]() mutable { RunOnMainThread(std::move(task)); }, delayMilliseconds);
     } else {
         if (g_threadsafe_func_handle) {
-            MainThreadTask *mainTask = new MainThreadTask(task);
-            napi_call_threadsafe_function(g_threadsafe_func_handle, static_cast<void *>(mainTask), napi_tsfn_blocking);
+            MainThreadTrampoline().Post(std::move(task));
         } else {
             OH_LOG_Print(LOG_APP, LOG_ERROR, 0x7, "KRMainThread", "function handle is null");
         }
@@ -18,6 +18,7 @@
 
 #include <napi/native_api.h>
 #include <functional>
+#include "libohos_render/foundation/thread/KRTask.h"
 
 class KRMainThread {
  public:
@@ -29,11 +30,11 @@ class KRMainThread {
     static void Export(napi_env env, napi_value exports);
 
     /**
-     * @brief 在主线程上执行任务，可以选择延迟执行
+     * @brief 在主线程上执行任务，可以选择延迟执行；同一轮事件循环内投递的任务合并为一次唤醒批量执行
      * @param task 需要在主线程上执行的任务
      * @param delayMilliseconds 延迟执行任务的毫秒数，默认为0，表示立即执行
      */
-    static void RunOnMainThread(std::function<void()> task, int delayMilliseconds = 0);
+    static void RunOnMainThread(KRTask task, int delayMilliseconds = 0);
 
     /**
      * @brief 在主线程的下一个事件循环中执行任务
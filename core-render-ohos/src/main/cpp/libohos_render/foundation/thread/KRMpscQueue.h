@@ -0,0 +1,128 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRMPSCQUEUE_H
+#define CORE_RENDER_OHOS_KRMPSCQUEUE_H
+
+#include <atomic>
+#include <thread>
+#include <utility>
+
+/**
+ * 无锁多生产者单消费者队列（Vyukov intrusive MPSC）
+ * 1. Push任意线程调用，只有一次原子exchange，不会阻塞；同一生产者的元素按提交顺序出队
+ * 2. Pop/Empty只能由唯一的消费者线程调用
+ * 3. 每个元素一个节点，元素直接存放在节点内（配合KRTask的小对象优化，入队只有这一次内存分配）
+ */
+template <typename T>
+class KRMpscQueue {
+ public:
+    KRMpscQueue() : head_(&stub_), tail_(&stub_) {}
+
+    ~KRMpscQueue() {
+        T value;
+        while (Pop(value)) {
+        }
+    }
+
+    KRMpscQueue(const KRMpscQueue &) = delete;
+    KRMpscQueue &operator=(const KRMpscQueue &) = delete;
+
+    /**
+     * 入队，任意线程调用
+     */
+    void Push(T value) {
+        PushNode(new Node(std::move(value)));
+    }
+
+    /**
+     * 出队，仅消费者线程调用
+     * @param value 出队的元素
+     * @return 队列为空时返回false
+     */
+    bool Pop(T &value) {
+        while (true) {
+            auto result = TryPop(value);
+            if (result != PopResult::kRetry) {
+                return result == PopResult::kSuccess;
+            }
+            // 生产者已exchange但尚未链接next，极短窗口，让出CPU等待其完成
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * 队列是否为空，仅消费者线程调用；与生产者Push之间是顺序一致的，可用于挂起前的复查
+     */
+    bool Empty() const {
+        return tail_ == &stub_ && head_.load() == &stub_;
+    }
+
+ private:
+    struct Node {
+        Node() = default;
+        explicit Node(T &&v) : value(std::move(v)) {}
+        std::atomic<Node *> next{nullptr};
+        T value;
+    };
+
+    enum class PopResult { kSuccess, kEmpty, kRetry };
+
+    void PushNode(Node *node) {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        auto prev = head_.exchange(node);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    PopResult TryPop(T &value) {
+        auto tail = tail_;
+        auto next = tail->next.load(std::memory_order_acquire);
+        if (tail == &stub_) {
+            if (next == nullptr) {
+                return head_.load() == &stub_ ? PopResult::kEmpty : PopResult::kRetry;
+            }
+            tail_ = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next != nullptr) {
+            tail_ = next;
+            return Take(tail, value);
+        }
+        if (tail != head_.load()) {
+            return PopResult::kRetry;
+        }
+        // tail是最后一个节点，放回stub后才能取走它
+        PushNode(&stub_);
+        next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return PopResult::kRetry;
+        }
+        tail_ = next;
+        return Take(tail, value);
+    }
+
+    static PopResult Take(Node *node, T &value) {
+        value = std::move(node->value);
+        delete node;
+        return PopResult::kSuccess;
+    }
+
+    alignas(64) std::atomic<Node *> head_;  // 生产者端
+    alignas(64) Node *tail_;                // 消费者端
+    Node stub_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRMPSCQUEUE_H
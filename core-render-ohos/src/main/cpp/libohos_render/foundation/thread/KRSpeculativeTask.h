@@ -0,0 +1,84 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRSPECULATIVETASK_H
+#define CORE_RENDER_OHOS_KRSPECULATIVETASK_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+/**
+ * 预测性任务（认领或等待）
+ * 1. 任务提交到工作线程池后，由工作线程调用Run执行；
+ * 2. 任务所有者（如context线程）在需要结果时调用CancelOrWait：任务尚未开始则直接取消（由所有者自行同步计算，
+ *    不必等待排队中的任务），正在执行则等待其结束，已结束则立即返回；
+ * 3. Run与CancelOrWait只有一方能认领任务，工作线程执行完毕前所有者不会访问任务写入的数据。
+ */
+class KRSpeculativeTask {
+ public:
+    explicit KRSpeculativeTask(std::function<void()> work) : work_(std::move(work)) {}
+
+    KRSpeculativeTask(const KRSpeculativeTask &) = delete;
+    KRSpeculativeTask &operator=(const KRSpeculativeTask &) = delete;
+
+    /**
+     * 工作线程调用：任务未被取消时执行
+     */
+    void Run() {
+        State expected = State::kPending;
+        if (!state_.compare_exchange_strong(expected, State::kRunning, std::memory_order_acq_rel)) {
+            return;
+        }
+        work_();
+        work_ = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            state_.store(State::kDone, std::memory_order_release);
+        }
+        condition_.notify_all();
+    }
+
+    /**
+     * 所有者调用：取消尚未开始的任务，或等待执行中的任务结束
+     * @return 任务已由工作线程执行完毕时返回true，被取消时返回false
+     */
+    bool CancelOrWait() {
+        State expected = State::kPending;
+        if (state_.compare_exchange_strong(expected, State::kCancelled, std::memory_order_acq_rel)) {
+            return false;
+        }
+        if (expected == State::kCancelled) {
+            return false;
+        }
+        if (expected == State::kRunning) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this] { return state_.load(std::memory_order_acquire) == State::kDone; });
+        }
+        return true;
+    }
+
+ private:
+    enum class State { kPending, kRunning, kDone, kCancelled };
+
+    std::function<void()> work_;  // 只由认领成功的一方访问
+    std::atomic<State> state_{State::kPending};
+    std::mutex mutex_;
+    std::condition_variable condition_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRSPECULATIVETASK_H
@@ -0,0 +1,169 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTASK_H
+#define CORE_RENDER_OHOS_KRTASK_H
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * 只可移动的void()任务闭包，带小对象优化
+ * 1. 闭包对象不超过kInlineSize且可无异常移动时直接存放在内部缓冲区，不分配堆内存
+ * 2. 只可移动，入队、出队不会像std::function那样复制捕获的shared_ptr/string
+ * 3. 可由lambda、函数指针或std::function构造，空的std::function/函数指针构造出空任务
+ */
+class KRTask {
+ public:
+    static constexpr size_t kInlineSize = 56;
+
+    KRTask() noexcept = default;
+    KRTask(std::nullptr_t) noexcept {}  // NOLINT
+
+    template <typename F, typename Fn = typename std::decay<F>::type,
+              typename = typename std::enable_if<!std::is_same<Fn, KRTask>::value>::type>
+    KRTask(F &&f) {  // NOLINT 允许由lambda隐式构造
+        if (IsEmptyCallable(f)) {
+            return;
+        }
+        if constexpr (kStoredInline<Fn>) {
+            new (&storage_) Fn(std::forward<F>(f));
+        } else {
+            *reinterpret_cast<Fn **>(&storage_) = new Fn(std::forward<F>(f));
+        }
+        ops_ = &kOps<Fn>;
+    }
+
+    KRTask(KRTask &&other) noexcept {
+        MoveFrom(other);
+    }
+
+    KRTask &operator=(KRTask &&other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    KRTask(const KRTask &) = delete;
+    KRTask &operator=(const KRTask &) = delete;
+
+    ~KRTask() {
+        Reset();
+    }
+
+    void operator()() {
+        ops_->invoke(&storage_);
+    }
+
+    explicit operator bool() const noexcept {
+        return ops_ != nullptr;
+    }
+
+    void Reset() noexcept {
+        if (ops_) {
+            ops_->destroy(&storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    /**
+     * 闭包是否存放在内部缓冲区（未分配堆内存）
+     */
+    bool IsInline() const noexcept {
+        return ops_ != nullptr && ops_->is_inline;
+    }
+
+ private:
+    using Storage = typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::type;
+
+    struct Ops {
+        void (*invoke)(void *storage);
+        void (*move)(void *dst, void *src) noexcept;  // 移动到dst并销毁src
+        void (*destroy)(void *storage) noexcept;
+        bool is_inline;
+    };
+
+    template <typename Fn>
+    static constexpr bool kStoredInline = sizeof(Fn) <= kInlineSize && alignof(Fn) <= alignof(Storage) &&
+                                          std::is_nothrow_move_constructible<Fn>::value;
+
+    template <typename Fn>
+    static Fn *Target(void *storage) noexcept {
+        if constexpr (kStoredInline<Fn>) {
+            return std::launder(reinterpret_cast<Fn *>(storage));
+        } else {
+            return *reinterpret_cast<Fn **>(storage);
+        }
+    }
+
+    template <typename Fn>
+    static void Invoke(void *storage) {
+        (*Target<Fn>(storage))();
+    }
+
+    template <typename Fn>
+    static void Move(void *dst, void *src) noexcept {
+        if constexpr (kStoredInline<Fn>) {
+            auto from = Target<Fn>(src);
+            new (dst) Fn(std::move(*from));
+            from->~Fn();
+        } else {
+            *reinterpret_cast<Fn **>(dst) = *reinterpret_cast<Fn **>(src);
+        }
+    }
+
+    template <typename Fn>
+    static void Destroy(void *storage) noexcept {
+        if constexpr (kStoredInline<Fn>) {
+            Target<Fn>(storage)->~Fn();
+        } else {
+            delete Target<Fn>(storage);
+        }
+    }
+
+    template <typename Fn>
+    static constexpr Ops kOps = {&Invoke<Fn>, &Move<Fn>, &Destroy<Fn>, kStoredInline<Fn>};
+
+    template <typename F>
+    static bool IsEmptyCallable(const F &) noexcept {
+        return false;
+    }
+    template <typename R, typename... Args>
+    static bool IsEmptyCallable(R (*const &f)(Args...)) noexcept {
+        return f == nullptr;
+    }
+    template <typename Signature>
+    static bool IsEmptyCallable(const std::function<Signature> &f) noexcept {
+        return !f;
+    }
+
+    void MoveFrom(KRTask &other) noexcept {
+        if (other.ops_) {
+            other.ops_->move(&storage_, &other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    Storage storage_;
+    const Ops *ops_ = nullptr;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTASK_H
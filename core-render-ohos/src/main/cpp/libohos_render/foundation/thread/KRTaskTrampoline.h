@@ -0,0 +1,118 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTASKTRAMPOLINE_H
+#define CORE_RENDER_OHOS_KRTASKTRAMPOLINE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include "libohos_render/foundation/thread/KRMpscQueue.h"
+#include "libohos_render/foundation/thread/KRTask.h"
+
+/**
+ * 合并唤醒的跨线程任务蹦床
+ * 1. 任意线程Post任务到无锁队列，只有队列由空变为非空时才调用一次signal唤醒目标线程（如napi threadsafe function）
+ * 2. 目标线程被唤醒后调用Drain批量执行队列中的任务，超过时间预算时停止并重新signal，剩余任务留到下一轮事件循环，
+ *    避免一次突发的大量任务阻塞输入事件
+ */
+class KRTaskTrampoline {
+ public:
+    using Signal = std::function<void()>;
+
+    struct Stats {
+        uint64_t task_count = 0;             // 已执行任务数
+        uint64_t drain_count = 0;            // Drain次数（即目标线程被唤醒次数）
+        uint64_t budget_exceeded_count = 0;  // 因超出时间预算而提前结束的Drain次数
+        uint64_t signal_count = 0;           // signal调用次数
+    };
+
+    /**
+     * @param signal 唤醒目标线程，被唤醒后目标线程需调用Drain
+     */
+    explicit KRTaskTrampoline(Signal signal) : signal_(std::move(signal)) {}
+
+    /**
+     * 投递任务，任意线程调用
+     */
+    void Post(KRTask task) {
+        queue_.Push(std::move(task));
+        // 计数在入队之后递增，可能短暂为负（Drain已取走但计数尚未递增），此时不需要signal
+        if (pending_.fetch_add(1, std::memory_order_acq_rel) == 0) {
+            RaiseSignal();
+        }
+    }
+
+    /**
+     * 执行队列中的任务，仅目标线程调用
+     * @param budget 本轮最长执行时间，超时后剩余任务重新signal到下一轮
+     * @return 本轮执行的任务数
+     */
+    int64_t Drain(std::chrono::steady_clock::duration budget) {
+        auto deadline = std::chrono::steady_clock::now() + budget;
+        int64_t executed = 0;
+        bool budget_exceeded = false;
+        KRTask task;
+        while (queue_.Pop(task)) {
+            task();
+            task.Reset();
+            executed++;
+            if (std::chrono::steady_clock::now() >= deadline) {
+                budget_exceeded = true;
+                break;
+            }
+        }
+        task_count_.fetch_add(executed, std::memory_order_relaxed);
+        drain_count_.fetch_add(1, std::memory_order_relaxed);
+        if (budget_exceeded) {
+            budget_exceeded_count_.fetch_add(1, std::memory_order_relaxed);
+        }
+        // 执行期间新投递的任务未触发signal（计数未归零），或因预算中断而有剩余时，需要再唤醒一次
+        if (pending_.fetch_sub(executed, std::memory_order_acq_rel) - executed > 0) {
+            RaiseSignal();
+        }
+        return executed;
+    }
+
+    /**
+     * 统计数据，任意线程调用
+     */
+    Stats GetStats() const {
+        Stats stats;
+        stats.task_count = task_count_.load(std::memory_order_relaxed);
+        stats.drain_count = drain_count_.load(std::memory_order_relaxed);
+        stats.budget_exceeded_count = budget_exceeded_count_.load(std::memory_order_relaxed);
+        stats.signal_count = signal_count_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+ private:
+    void RaiseSignal() {
+        signal_count_.fetch_add(1, std::memory_order_relaxed);
+        signal_();
+    }
+
+    Signal signal_;
+    KRMpscQueue<KRTask> queue_;
+    std::atomic<int64_t> pending_{0};  // 已投递未执行的任务数
+    std::atomic<uint64_t> task_count_{0};
+    std::atomic<uint64_t> drain_count_{0};
+    std::atomic<uint64_t> budget_exceeded_count_{0};
+    std::atomic<uint64_t> signal_count_{0};
+};
+
+#endif  // CORE_RENDER_OHOS_KRTASKTRAMPOLINE_H
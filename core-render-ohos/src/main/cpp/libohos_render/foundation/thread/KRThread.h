@@ -16,57 +16,42 @@
 #ifndef CORE_RENDER_OHOS_KRTHREAD_H
 #define CORE_RENDER_OHOS_KRTHREAD_H
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
-#include <condition_variable>
 #include <functional>
 #include <future>
-#include <mutex>
-#include <queue>
 #include <thread>
-#include "KRDelayThread.h"
+#include "KRBatonTaskRunner.h"
+#include "KRTimerQueue.h"
 
 #include "libohos_render/utils/KRRenderLoger.h"
 class KRThread {
  public:
-    explicit KRThread(const std::string &name) : m_stop(false) {
+    explicit KRThread(const std::string &name)
+        : m_timerGroup(name + "@" + std::to_string(reinterpret_cast<uintptr_t>(this))) {
         m_workerThread = std::thread([this] {
             m_workerThreadId = std::this_thread::get_id();
-            this->Worker();
+            m_runner.RunLoop();
         });
         pthread_setname_np(m_workerThread.native_handle(), name.c_str());
-
-        m_delayThread = new KRDelayThread(name + "d");
     }
 
     ~KRThread() {
-        delete m_delayThread;
-        m_delayThread = nullptr;
-        {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_stop = true;
-            m_condition.notify_one();
-        }
+        // 丢弃未到期的延时任务，并等待正在转发的延时任务结束
+        KRTimerQueue::GetInstance().CancelGroup(m_timerGroup);
+        m_runner.Stop();
         m_workerThread.join();
     }
 
-    void DispatchAsync(const std::function<void()> task, int delayMilliseconds = 0) {
+    void DispatchAsync(KRTask task, int delayMilliseconds = 0) {
         if (delayMilliseconds > 0) {
-            m_delayThread->DispatchAsync([task, this] { this->DispatchAsync(task, 0); }, delayMilliseconds);
+            KRTimerQueue::GetInstance().Schedule(
+                [task = std::move(task), this]() mutable { this->DispatchAsync(std::move(task), 0); },
+                delayMilliseconds, m_timerGroup);
             return;
         }
-        if (IsCurrentThreadWorkerThread()) {
-            // 如果当前线程已经是工作线程，直接将任务添加到队列
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_tasks.emplace(task);
-        } else {
-            // 否则，将任务添加到队列
-            {
-                std::unique_lock<std::mutex> lock(m_mutex);
-                m_tasks.emplace(task);
-            }
-            m_condition.notify_one();
-        }
+        m_runner.Post(std::move(task));
     }
 
     void DispatchSync(const std::function<void()> &task) {
@@ -74,66 +59,29 @@ class KRThread {
         return;
     }
 
+    /**
+     * 在调用线程直接执行任务：工作线程空闲时立即执行，繁忙时挂起等待其在两个任务之间让出执行权，
+     * 超过100ms或工作线程正同步等待主线程时转为异步派发
+     */
     void DirectRunOnCurThread(const std::function<void()> &task) {
-        if (m_isExecutingTask.load()) {
-            task();
-        } else {
-            auto start = std::chrono::steady_clock::now();  // 记录开始时间
-            bool didHandleTask = false;
-            while (!SyncMainTaskMutex(false, false, false)) {
-                // 检查是否超时
-                auto now = std::chrono::steady_clock::now();
-                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - start);
-                if (duration.count() > 100) {
-                    break;  // 超时，跳出循环
-                }
-                // 尝试获取互斥锁
-                if (TaskMutex(true, false, false)) {
-                    m_isExecutingTask.store(true);  // 设置正在执行任务标志
-                    task();
-                    m_isExecutingTask.store(false);  // 清除正在执行任务标志
-                    TaskMutex(false, true, false);
-                    didHandleTask = true;
-                    break;  // 任务执行完成，跳出循环
-                }
-            }
-            if (!didHandleTask) {
-                KR_LOG_INFO << "DispatchAsync when run DirectRunOnCurThread";
-                DispatchAsync(task);
-            }
+        if (!m_runner.TryRunOnCurThread(task, std::chrono::milliseconds(kDirectRunTimeoutMs))) {
+            KR_LOG_INFO << "DispatchAsync when run DirectRunOnCurThread";
+            DispatchAsync(task);
         }
     }
 
-    bool TaskMutex(bool try_lock, bool is_set, bool value) {
-        std::unique_lock<std::mutex> lock(m_taskMutex);
-        if (try_lock) {
-            if (m_mutex_locked) {
-                return false;
-            } else {
-                m_mutex_locked = true;
-                return true;
-            }
-        }
-        if (is_set) {
-            m_mutex_locked = value;
-        }
-        return m_mutex_locked;
+    /**
+     * 标记工作线程正同步等待主线程任务，期间主线程的DirectRunOnCurThread不等待直接转为异步
+     */
+    void SetSyncMainTaskPending(bool pending) {
+        m_runner.SetSyncMainTaskPending(pending);
     }
 
-    bool SyncMainTaskMutex(bool try_lock, bool is_set, bool value) {
-        std::unique_lock<std::mutex> lock(m_syncMainTaskMutex);
-        if (try_lock) {
-            if (m_sync_main_task_locked) {
-                return false;
-            } else {
-                m_sync_main_task_locked = true;
-                return true;
-            }
-        }
-        if (is_set) {
-            m_sync_main_task_locked = value;
-        }
-        return m_sync_main_task_locked;
+    /**
+     * 调用方（主线程）DirectRunOnCurThread的等待统计
+     */
+    KRThreadBaton::Stats GetDirectRunStats() {
+        return m_runner.GetStats();
     }
 
     bool IsCurrentThreadWorkerThread() const {
@@ -145,50 +93,12 @@ class KRThread {
     }
 
  private:
-    void Worker() {
-        while (true) {
-            std::queue<std::function<void()>> tasks;
-            {
-                std::unique_lock<std::mutex> lock(m_mutex);
-                m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
-
-                if (m_stop && m_tasks.empty()) {
-                    break;
-                }
-
-                std::swap(tasks, m_tasks);  // 将m_tasks所有任务一次性移动到tasks
-            }
-            {
-                if (TaskMutex(true, false, false)) {
-                    while (!tasks.empty()) {
-                        auto &task = tasks.front();
-                        task();
-                        tasks.pop();
-                    }
-                    TaskMutex(false, true, false);
-                } else {
-                    std::unique_lock<std::mutex> lock(m_mutex);
-                    while (!tasks.empty()) {
-                        m_tasks.push(std::move(tasks.front()));
-                        tasks.pop();
-                    }
-                }
-            }
-        }
-    }
+    static constexpr int kDirectRunTimeoutMs = 100;
 
-    std::queue<std::function<void()>> m_tasks;
-    std::mutex m_mutex;
-    std::mutex m_taskMutex;
-    bool m_mutex_locked = false;
-    std::mutex m_syncMainTaskMutex;
-    bool m_sync_main_task_locked = false;
-    std::condition_variable m_condition;
-    bool m_stop = false;
+    KRBatonTaskRunner m_runner;
     std::thread m_workerThread;
     std::thread::id m_workerThreadId;
-    KRDelayThread *m_delayThread = nullptr;
-    std::atomic<bool> m_isExecutingTask{false};
+    const std::string m_timerGroup;  // 本线程延时任务在共享定时器队列中的分组
 };
 
 #endif  // CORE_RENDER_OHOS_KRTHREAD_H
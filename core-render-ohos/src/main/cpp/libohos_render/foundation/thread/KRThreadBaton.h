@@ -0,0 +1,186 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTHREADBATON_H
+#define CORE_RENDER_OHOS_KRTHREADBATON_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+/**
+ * KRThread任务执行权（接力棒）
+ * 同一时刻只有一个线程持有执行权：工作线程执行队列任务，或调用方线程（通常为主线程）直接执行同步任务。
+ * 1. 调用方优先：有调用方等待时，工作线程在两个任务之间让出执行权，且不会抢先开始新一批任务
+ * 2. 等待基于条件变量挂起，不占用CPU，不与被等待的工作线程争抢核心
+ * 3. 工作线程正同步等待主线程时（SetSyncMainTaskPending），调用方立即放弃等待，避免死锁
+ */
+class KRThreadBaton {
+ public:
+    /**
+     * 调用方等待统计
+     */
+    struct Stats {
+        uint64_t acquire_count = 0;   // 调用方尝试获取次数
+        uint64_t immediate_count = 0;  // 无需等待即获取
+        uint64_t waited_count = 0;     // 等待后获取
+        uint64_t failed_count = 0;     // 超时或工作线程等待主线程而放弃
+        uint64_t total_wait_us = 0;    // 累计等待时长
+        uint64_t max_wait_us = 0;      // 单次最长等待
+    };
+
+    /**
+     * 工作线程获取执行权，调用方持有或等待中时挂起
+     */
+    void AcquireForWorker() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        worker_condition_.wait(lock, [this] { return owner_ == Owner::kNone && waiting_callers_ == 0; });
+        SetOwnerLocked(Owner::kWorker);
+    }
+
+    void ReleaseForWorker() {
+        bool notify = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            SetOwnerLocked(Owner::kNone);
+            notify = waiting_callers_ > 0;
+        }
+        if (notify) {
+            caller_condition_.notify_one();
+        }
+    }
+
+    /**
+     * 工作线程在两个任务之间调用：有调用方等待时让出执行权，待其执行完毕后重新获取
+     */
+    void YieldToCallerIfWaiting() {
+        if (waiting_callers_hint_.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+        ReleaseForWorker();
+        AcquireForWorker();
+    }
+
+    /**
+     * 调用方获取执行权
+     * @param timeout 最长等待时间
+     * @return 是否获取成功；超时或工作线程正同步等待主线程时返回false
+     */
+    bool AcquireForCaller(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stats_.acquire_count++;
+        if (sync_main_task_pending_) {
+            stats_.failed_count++;
+            return false;
+        }
+        if (owner_ == Owner::kNone) {
+            stats_.immediate_count++;
+            SetOwnerLocked(Owner::kCaller);
+            return true;
+        }
+        auto start = std::chrono::steady_clock::now();
+        waiting_callers_++;
+        waiting_callers_hint_.store(waiting_callers_, std::memory_order_release);
+        bool acquired = caller_condition_.wait_for(lock, timeout, [this] {
+            return sync_main_task_pending_ || owner_ == Owner::kNone;
+        }) && !sync_main_task_pending_;
+        waiting_callers_--;
+        waiting_callers_hint_.store(waiting_callers_, std::memory_order_release);
+        auto waited = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        stats_.total_wait_us += waited;
+        stats_.max_wait_us = std::max(stats_.max_wait_us, waited);
+        if (acquired) {
+            stats_.waited_count++;
+            SetOwnerLocked(Owner::kCaller);
+        } else {
+            stats_.failed_count++;
+            if (waiting_callers_ == 0 && owner_ == Owner::kNone) {
+                // 工作线程可能因本调用方等待而挂起
+                worker_condition_.notify_one();
+            }
+        }
+        return acquired;
+    }
+
+    void ReleaseForCaller() {
+        bool notify_caller = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            SetOwnerLocked(Owner::kNone);
+            notify_caller = waiting_callers_ > 0;
+        }
+        if (notify_caller) {
+            caller_condition_.notify_one();
+        } else {
+            worker_condition_.notify_one();
+        }
+    }
+
+    /**
+     * 当前线程是否持有执行权（用于重入判断）
+     */
+    bool IsHeldByCurrentThread() const {
+        return owner_thread_.load(std::memory_order_acquire) == std::this_thread::get_id();
+    }
+
+    /**
+     * 标记工作线程正同步等待主线程任务
+     */
+    void SetSyncMainTaskPending(bool pending) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            sync_main_task_pending_ = pending;
+        }
+        if (pending) {
+            caller_condition_.notify_all();
+        }
+    }
+
+    bool IsSyncMainTaskPending() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return sync_main_task_pending_;
+    }
+
+    Stats GetStats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+ private:
+    enum class Owner { kNone, kWorker, kCaller };
+
+    void SetOwnerLocked(Owner owner) {
+        owner_ = owner;
+        owner_thread_.store(owner == Owner::kNone ? std::thread::id() : std::this_thread::get_id(),
+                            std::memory_order_release);
+    }
+
+    std::mutex mutex_;
+    std::condition_variable worker_condition_;
+    std::condition_variable caller_condition_;
+    Owner owner_ = Owner::kNone;
+    std::atomic<std::thread::id> owner_thread_{std::thread::id()};
+    int waiting_callers_ = 0;
+    std::atomic<int> waiting_callers_hint_{0};  // 供工作线程无锁判断是否需要让行
+    bool sync_main_task_pending_ = false;
+    Stats stats_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTHREADBATON_H
@@ -0,0 +1,264 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTIMERQUEUE_H
+#define CORE_RENDER_OHOS_KRTIMERQUEUE_H
+
+#include <pthread.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "libohos_render/foundation/thread/KRTask.h"
+
+using KRTimerId = uint64_t;  // 0为无效id
+
+/**
+ * 可取消的延时任务队列（最小堆 + 墓碑）
+ * 1. 全进程共用一个调度线程（GetInstance），取代原先每个KRThread/KRMainThread各自的延时线程
+ * 2. Schedule返回定时器id，Cancel为O(1)：只从表中移除任务（立即释放闭包），堆中的节点作为墓碑在到期或压缩时丢弃
+ * 3. 定时器可归属一个分组（如页面instanceId），CancelGroup一次性取消该分组的全部定时器
+ * 4. 到期时间相同时按Schedule顺序执行；任务在调度线程执行，只应做转发（如投递到工作线程），不应阻塞
+ */
+class KRTimerQueue {
+ public:
+    struct Stats {
+        uint64_t scheduled_count = 0;   // Schedule次数
+        uint64_t fired_count = 0;       // 到期执行次数
+        uint64_t cancelled_count = 0;   // 被取消（含分组取消）的次数
+        uint64_t compaction_count = 0;  // 墓碑过多时重建堆的次数
+        size_t pending_count = 0;       // 当前未到期的定时器数
+    };
+
+    /**
+     * 全局共享的定时器队列（不析构）
+     */
+    static KRTimerQueue &GetInstance() {
+        static KRTimerQueue *gTimerQueue = new KRTimerQueue("kuiklytimer");
+        return *gTimerQueue;
+    }
+
+    explicit KRTimerQueue(const std::string &name) {
+        thread_ = std::thread([this] { this->Dispatcher(); });
+        pthread_setname_np(thread_.native_handle(), name.c_str());
+    }
+
+    ~KRTimerQueue() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_one();
+        thread_.join();
+    }
+
+    KRTimerQueue(const KRTimerQueue &) = delete;
+    KRTimerQueue &operator=(const KRTimerQueue &) = delete;
+
+    /**
+     * 添加定时器，任意线程调用
+     * @param task 到期时在调度线程执行的任务
+     * @param delayMilliseconds 延时毫秒
+     * @param group 所属分组，空串表示不分组
+     * @return 定时器id，用于Cancel
+     */
+    KRTimerId Schedule(KRTask task, int delayMilliseconds, const std::string &group = std::string()) {
+        auto time = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(delayMilliseconds, 0));
+        bool earliest = false;
+        KRTimerId id;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            id = next_id_++;
+            timers_.emplace(id, Timer{std::move(task), group});
+            if (!group.empty()) {
+                groups_[group].insert(id);
+            }
+            // 只有新定时器成为最早到期时才需要唤醒调度线程重新计算等待时间
+            earliest = heap_.empty() || time < heap_.front().time;
+            heap_.push_back(HeapNode{time, id});
+            std::push_heap(heap_.begin(), heap_.end());
+            scheduled_count_++;
+        }
+        if (earliest) {
+            condition_.notify_one();
+        }
+        return id;
+    }
+
+    /**
+     * 取消定时器，任意线程调用
+     * @param id Schedule返回的定时器id
+     * @return 定时器尚未执行且取消成功时返回true
+     */
+    bool Cancel(KRTimerId id) {
+        KRTask task;  // 在锁外释放闭包，闭包析构中可能再次调用本队列
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = timers_.find(id);
+            if (it == timers_.end()) {
+                return false;
+            }
+            task = std::move(it->second.task);
+            RemoveFromGroupLocked(it->second.group, id);
+            timers_.erase(it);
+            cancelled_count_++;
+            CompactIfNeedLocked();
+        }
+        return true;
+    }
+
+    /**
+     * 取消分组内的全部定时器，任意线程调用；返回时该分组不会再有任务在调度线程执行
+     * @param group 分组
+     * @return 取消的定时器个数
+     */
+    size_t CancelGroup(const std::string &group) {
+        std::vector<KRTask> tasks;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            auto group_it = groups_.find(group);
+            if (group_it != groups_.end()) {
+                tasks.reserve(group_it->second.size());
+                for (auto id : group_it->second) {
+                    auto it = timers_.find(id);
+                    tasks.push_back(std::move(it->second.task));
+                    timers_.erase(it);
+                }
+                groups_.erase(group_it);
+                cancelled_count_ += tasks.size();
+                CompactIfNeedLocked();
+            }
+            // 该分组的任务正在调度线程执行时等待其结束（调度线程自身调用时不等待）
+            if (std::this_thread::get_id() != thread_.get_id()) {
+                idle_condition_.wait(lock, [this, &group] { return !running_ || running_group_ != group; });
+            }
+        }
+        return tasks.size();
+    }
+
+    Stats GetStats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stats stats;
+        stats.scheduled_count = scheduled_count_;
+        stats.fired_count = fired_count_;
+        stats.cancelled_count = cancelled_count_;
+        stats.compaction_count = compaction_count_;
+        stats.pending_count = timers_.size();
+        return stats;
+    }
+
+ private:
+    struct Timer {
+        KRTask task;
+        std::string group;
+    };
+
+    struct HeapNode {
+        std::chrono::steady_clock::time_point time;
+        KRTimerId id;  // id单调递增，到期时间相同时按添加顺序执行
+
+        bool operator<(const HeapNode &other) const {
+            // std::push_heap 是最大堆，反转比较使最早到期的在堆顶
+            return time != other.time ? time > other.time : id > other.id;
+        }
+    };
+
+    void RemoveFromGroupLocked(const std::string &group, KRTimerId id) {
+        if (group.empty()) {
+            return;
+        }
+        auto it = groups_.find(group);
+        if (it != groups_.end()) {
+            it->second.erase(id);
+            if (it->second.empty()) {
+                groups_.erase(it);
+            }
+        }
+    }
+
+    // 墓碑超过堆大小一半时重建堆，避免大量取消的长延时定时器占用内存
+    void CompactIfNeedLocked() {
+        size_t tombstones = heap_.size() - timers_.size();
+        if (tombstones < kCompactThreshold || tombstones * 2 < heap_.size()) {
+            return;
+        }
+        heap_.erase(std::remove_if(heap_.begin(), heap_.end(),
+                                   [this](const HeapNode &node) { return timers_.count(node.id) == 0; }),
+                    heap_.end());
+        std::make_heap(heap_.begin(), heap_.end());
+        compaction_count_++;
+    }
+
+    void Dispatcher() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stop_) {
+            if (heap_.empty()) {
+                condition_.wait(lock);
+                continue;
+            }
+            auto top = heap_.front();
+            auto it = timers_.find(top.id);
+            if (it != timers_.end() && std::chrono::steady_clock::now() < top.time) {
+                condition_.wait_until(lock, top.time);
+                continue;
+            }
+            std::pop_heap(heap_.begin(), heap_.end());
+            heap_.pop_back();
+            if (it == timers_.end()) {
+                continue;  // 墓碑
+            }
+            KRTask task = std::move(it->second.task);
+            running_group_ = std::move(it->second.group);
+            RemoveFromGroupLocked(running_group_, top.id);
+            timers_.erase(it);
+            running_ = true;
+            fired_count_++;
+            lock.unlock();
+            task();
+            task.Reset();
+            lock.lock();
+            running_ = false;
+            running_group_.clear();
+            idle_condition_.notify_all();
+        }
+    }
+
+    static constexpr size_t kCompactThreshold = 64;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;       // 唤醒调度线程
+    std::condition_variable idle_condition_;  // 调度线程执行完一个任务
+    std::vector<HeapNode> heap_;              // 含墓碑（已取消的id）
+    std::unordered_map<KRTimerId, Timer> timers_;
+    std::unordered_map<std::string, std::unordered_set<KRTimerId>> groups_;
+    KRTimerId next_id_ = 1;
+    bool stop_ = false;
+    bool running_ = false;
+    std::string running_group_;
+    uint64_t scheduled_count_ = 0;
+    uint64_t fired_count_ = 0;
+    uint64_t cancelled_count_ = 0;
+    uint64_t compaction_count_ = 0;
+    std::thread thread_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTIMERQUEUE_H
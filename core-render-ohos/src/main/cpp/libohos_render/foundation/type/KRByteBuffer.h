@@ -0,0 +1,140 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRBYTEBUFFER_H
+#define CORE_RENDER_OHOS_KRBYTEBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * 不小于该长度的二进制数据转移给 ArkTS 时使用外部 ArrayBuffer，更小的数据拷贝比创建外部 ArrayBuffer 更便宜
+ */
+constexpr size_t kKRByteBufferZeroCopyThreshold = 16 * 1024;
+
+/**
+ * 引用计数的二进制数据，KRRenderValue::ByteArray 的底层存储
+ * 1. 自有内存：Copy / Adopt 创建，数据保存在内部 std::vector 中
+ * 2. 外部内存：Wrap 创建，不拷贝，最后一个引用释放时调用 release 回调归还内存
+ *    （如 KRAnyDataCreateBytesNoCopy 的调用方回调）
+ * 外部内存按约定只读，持有期间数据由提供方保证有效且不被修改；
+ * ArkTS 的 ArrayBuffer 可能被脚本写入或 detach，不满足该约定，不能与 native 共享：
+ * ArkTS -> native 总是拷贝；native -> ArkTS 只有唯一引用的自有内存可通过 TakeStorage 整体转移，否则拷贝
+ */
+class KRByteBuffer {
+ public:
+    using ReleaseCallback = std::function<void()>;
+
+    KRByteBuffer() = default;
+    ~KRByteBuffer() {
+        if (release_) {
+            release_();
+        }
+    }
+    KRByteBuffer(const KRByteBuffer &) = delete;
+    KRByteBuffer &operator=(const KRByteBuffer &) = delete;
+
+    /**
+     * 拷贝一份数据（一次memcpy）
+     */
+    static std::shared_ptr<KRByteBuffer> Copy(const void *data, size_t size) {
+        auto buffer = std::make_shared<KRByteBuffer>();
+        if (data != nullptr && size > 0) {
+            auto bytes = static_cast<const uint8_t *>(data);
+            buffer->storage_.assign(bytes, bytes + size);
+        }
+        buffer->data_ = buffer->storage_.data();
+        buffer->size_ = buffer->storage_.size();
+        return buffer;
+    }
+
+    /**
+     * 接管已有的 vector，不拷贝
+     */
+    static std::shared_ptr<KRByteBuffer> Adopt(std::vector<uint8_t> &&bytes) {
+        auto buffer = std::make_shared<KRByteBuffer>();
+        buffer->storage_ = std::move(bytes);
+        buffer->data_ = buffer->storage_.data();
+        buffer->size_ = buffer->storage_.size();
+        return buffer;
+    }
+
+    /**
+     * 包装外部内存，不拷贝
+     * @param data 外部数据地址
+     * @param size 数据长度
+     * @param release 最后一个引用释放时回调，可在任意线程调用，需自行切换线程
+     */
+    static std::shared_ptr<KRByteBuffer> Wrap(const void *data, size_t size, ReleaseCallback release) {
+        auto buffer = std::make_shared<KRByteBuffer>();
+        buffer->data_ = static_cast<uint8_t *>(const_cast<void *>(data));
+        buffer->size_ = data != nullptr ? size : 0;
+        buffer->release_ = std::move(release);
+        return buffer;
+    }
+
+    /**
+     * 交出自有内存的 vector，不拷贝：仅当 buffer 为唯一引用且不是包装的外部内存时成功，buffer 随之置空；
+     * 否则返回 nullptr，buffer 不变。用于把数据整体转移给 ArkTS 等会写入数据的独占方
+     */
+    static std::unique_ptr<std::vector<uint8_t>> TakeStorage(std::shared_ptr<KRByteBuffer> &buffer) {
+        if (!buffer || buffer.use_count() != 1 || buffer->IsExternal() || buffer->data_ != buffer->storage_.data()) {
+            return nullptr;
+        }
+        auto storage = std::make_unique<std::vector<uint8_t>>(std::move(buffer->storage_));
+        buffer.reset();
+        return storage;
+    }
+
+    uint8_t *data() {
+        return data_;
+    }
+    const uint8_t *data() const {
+        return data_;
+    }
+    size_t size() const {
+        return size_;
+    }
+    bool empty() const {
+        return size_ == 0;
+    }
+    const uint8_t *begin() const {
+        return data_;
+    }
+    const uint8_t *end() const {
+        return data_ + size_;
+    }
+    uint8_t operator[](size_t index) const {
+        return data_[index];
+    }
+    /**
+     * 是否为包装的外部内存
+     */
+    bool IsExternal() const {
+        return release_ != nullptr;
+    }
+
+ private:
+    std::vector<uint8_t> storage_;
+    uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+    ReleaseCallback release_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRBYTEBUFFER_H
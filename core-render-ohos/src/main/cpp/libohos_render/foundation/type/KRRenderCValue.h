@@ -52,5 +52,9 @@ extern int com_tencent_kuikly_SetCallKotlin(CallKotlin callKotlin);
 extern const KRRenderCValue com_tencent_kuikly_CallNative(int methodId, KRRenderCValue arg0, KRRenderCValue arg1,
                                                           KRRenderCValue arg2, KRRenderCValue arg3, KRRenderCValue arg4,
                                                           KRRenderCValue arg5);
+/**
+ * 批量派发渲染指令, buffer 格式见 KRRenderCommandBuffer.h, 调用返回后 buffer 可由调用方释放
+ */
+extern void com_tencent_kuikly_CallNativeBatch(const char *pagerId, const uint8_t *data, int32_t size);
 }
 #endif  // CORE_RENDER_OHOS_KRRENDERCVALUE_H
@@ -24,6 +24,7 @@
 #include <js_native_api_types.h>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <mutex>
 #include <sstream>
@@ -33,6 +34,7 @@
 #include <vector>
 #include "KRRenderCValue.h"
 #include "libohos_render/foundation/ark_ts.h"
+#include "libohos_render/foundation/type/KRByteBuffer.h"
 #include "libohos_render/foundation/type/KRRenderCValue.h"
 #include "libohos_render/utils/KRJsUtil.h"
 #include "libohos_render/utils/KRRenderLoger.h"
@@ -75,9 +77,15 @@ struct NapiValue {
  * - 或使用宏 KREmptyValue() 和 NewKRRenderValue(value)
  * 
  * 线程安全说明：
- * - toString(), toMap(), toArray() 返回值类型（线程安全，无共享状态）
- * - toCValue() 使用双重检查锁定优化（初始化后无锁访问）
+ * - toString(), toMap(), toArray() 返回值类型（线程安全）
+ * - 字符串形式的 map/array 只解析一次并缓存，toMapRef()/toArrayRef()/valueForKey()/valueAtIndex()
+ *   返回借用的引用，生命周期与当前 KRRenderValue 一致，不产生拷贝
+ * - toCValue() 与解析缓存均使用双重检查锁定优化（初始化后无锁访问）
  * - 禁止拷贝和移动以防止意外的数据共享
+ *
+ * 二进制数据：ByteArray 为 std::shared_ptr<KRByteBuffer>（早期版本为 std::shared_ptr<std::vector<uint8_t>>）。
+ * KRByteBuffer 提供 data()/size()/begin()/end()/operator[]，只读访问的代码无需修改；
+ * 仍按 vector 传入的可使用 KRRenderValue(const LegacyByteArray &)，需要 vector 的可使用 toByteVector()
  */
 class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
  private:
@@ -88,7 +96,8 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
  public:
     using Map = std::unordered_map<std::string, std::shared_ptr<KRRenderValue>>;
     using Array = std::vector<std::shared_ptr<KRRenderValue>>;
-    using ByteArray = std::shared_ptr<std::vector<uint8_t>>;
+    using ByteArray = std::shared_ptr<KRByteBuffer>;
+    using LegacyByteArray = std::shared_ptr<std::vector<uint8_t>>;
     
     KRRenderValue(const KRRenderValue&) = delete;
     KRRenderValue& operator=(const KRRenderValue&) = delete;
@@ -102,6 +111,12 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     template<typename... Args>
     static std::shared_ptr<KRRenderValue> Make(Args&&... args);
 
+    /**
+     * 同Make，对象及控制块由alloc分配，用于批量构造时减少堆分配（如KRChunkAllocator）
+     */
+    template<typename Alloc, typename... Args>
+    static std::shared_ptr<KRRenderValue> MakeWithAllocator(const Alloc &alloc, Args&&... args);
+
  protected:
     KRRenderValue() {
         value_ = std::monostate();
@@ -150,6 +165,17 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         value_ = value;
     }
 
+    /**
+     * 兼容旧版 ByteArray：共享 vector 的内存不拷贝，KRByteBuffer 持有 vector 直到释放
+     */
+    explicit KRRenderValue(const LegacyByteArray &value) : KRRenderValue() {
+        if (value) {
+            value_ = KRByteBuffer::Wrap(value->data(), value->size(), [value] {});
+        } else {
+            value_ = KRByteBuffer::Copy(nullptr, 0);
+        }
+    }
+
     explicit KRRenderValue(const KRRenderCValue &cValue) : KRRenderValue() {
         if (cValue.type == KRRenderCValue::Type::BOOL) {
             value_ = cValue.value.boolValue != 0;
@@ -164,13 +190,8 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         } else if (cValue.type == KRRenderCValue::Type::STRING) {
             value_ = std::string(cValue.value.stringValue);
         } else if (cValue.type == KRRenderCValue::Type::BYTES) {
-            auto length = cValue.size;
-            auto start_address = cValue.value.bytesValue;
-            auto bytes = std::make_shared<std::vector<uint8_t>>();
-            for (int i = 0; i < length; i++) {
-                bytes->push_back(*(reinterpret_cast<uint8_t *>(start_address + i)));
-            }
-            value_ = bytes;
+            // KRRenderCValue 不转移内存所有权，调用返回后即失效，只能拷贝
+            value_ = KRByteBuffer::Copy(cValue.value.bytesValue, cValue.size > 0 ? cValue.size : 0);
         } else if (cValue.type == KRRenderCValue::Type::ARRAY) {
             auto array_size = cValue.size;
             Array array;
@@ -209,14 +230,10 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             napi_is_arraybuffer(napi_env, nvalue, &is_byte_array);
             if (is_byte_array) {
                 void *byte_array = nullptr;
-                size_t byte_length;
+                size_t byte_length = 0;
                 napi_get_arraybuffer_info(napi_env, nvalue, &byte_array, &byte_length);
-                auto bytes = std::make_shared<std::vector<uint8_t>>();
-                auto byte_buffer = reinterpret_cast<uint8_t *>(byte_array);
-                for (size_t i = 0; i < byte_length; i++) {
-                    bytes->push_back(*(byte_buffer + i));
-                }
-                value_ = bytes;
+                // ArkTS 侧之后仍可能写入或 detach 该 ArrayBuffer，拷贝一份调用时的快照
+                value_ = KRByteBuffer::Copy(byte_array, byte_length);
                 return;
             }
 
@@ -232,11 +249,10 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                                                               &typedArrayData, &arraybuffer, &byteOffset);
                 if (status == napi_ok && typedArrayType == napi_int8_array) {
                     if (typedArrayData != nullptr) {
-                        value_ = std::make_shared<std::vector<uint8_t>>(byteOffset + (const char *)typedArrayData,
-                                                                        typedArrayLength + byteOffset +
-                                                                            (const char *)typedArrayData);
+                        value_ = KRByteBuffer::Copy(byteOffset + static_cast<const char *>(typedArrayData),
+                                                    typedArrayLength);
                     } else {
-                        value_ = std::make_shared<std::vector<uint8_t>>();
+                        value_ = KRByteBuffer::Copy(nullptr, 0);
                     }
                     return;
                 }
@@ -308,12 +324,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                 void *byte_array = nullptr;
                 size_t byte_length;
                 OH_JSVM_GetArraybufferInfo(js_env, js_value, &byte_array, &byte_length);
-                auto bytes = std::make_shared<std::vector<uint8_t>>();
-                auto byte_buffer = reinterpret_cast<uint8_t *>(byte_array);
-                for (int i = 0; i < byte_length; i++) {
-                    bytes->push_back(*(byte_buffer + i));
-                }
-                value_ = bytes;
+                value_ = KRByteBuffer::Copy(byte_array, byte_length);
                 return;
             }
             bool is_type_array;
@@ -325,12 +336,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                 JSVM_Value retArrayBuffer;
                 size_t byteOffset = -1;
                 OH_JSVM_GetTypedarrayInfo(js_env, js_value, &type, &length, &data, &retArrayBuffer, &byteOffset);
-                auto bytes = std::make_shared<std::vector<uint8_t>>();
-                auto byte_buffer = reinterpret_cast<uint8_t *>(data);
-                for (int i = 0; i < length; i++) {
-                    bytes->push_back(*(byte_buffer + i));
-                }
-                value_ = bytes;
+                value_ = KRByteBuffer::Copy(data, length);
                 return;
             }
 
@@ -489,54 +495,109 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     }
 
     Map toMap() const {
+        return toMapRef();
+    }
+
+    Array toArray() const {
+        return toArrayRef();
+    }
+
+    /**
+     * 以借用方式获取 Map，不拷贝；字符串值首次调用时解析并缓存
+     * @return 非 map 且无法解析时返回空 Map
+     */
+    const Map &toMapRef() const {
         if (isMap()) {
             return std::get<Map>(value_);
-        } else if (isString()) {
-            std::string str = toString();
-            cJSON *cjson = cJSON_Parse(str.c_str());
-            if(cjson == nullptr){
-                return Map();
-            }
-            Map map;
-            for (cJSON *item = cjson->child; item != NULL; item = item->next) {
-                map[item->string] = fromJsonValue(item);
+        }
+        if (!isString()) {
+            return EmptyMap();
+        }
+        if (auto parsed = parsed_map_.load(std::memory_order_acquire)) {
+            return *parsed;
+        }
+        std::lock_guard<std::mutex> lock(c_value_mutex_);
+        auto parsed = parsed_map_.load(std::memory_order_relaxed);
+        if (parsed == nullptr) {
+            parsed = new Map();
+            cJSON *cjson = cJSON_Parse(std::get<std::string>(value_).c_str());
+            if (cjson != nullptr) {
+                for (cJSON *item = cjson->child; item != NULL; item = item->next) {
+                    (*parsed)[item->string] = fromJsonValue(item);
+                }
+                cJSON_Delete(cjson);
             }
-            cJSON_Delete(cjson);
-            return map;
-        } else {
-            return Map();
+            parsed_map_.store(parsed, std::memory_order_release);
         }
+        return *parsed;
     }
 
-    Array toArray() const {
+    /**
+     * 以借用方式获取 Array，不拷贝；字符串值首次调用时解析并缓存
+     * @return 非 array 且无法解析时返回空 Array
+     */
+    const Array &toArrayRef() const {
         if (isArray()) {
             return std::get<Array>(value_);
-        } else if (isString()) {
-            std::string str = toString();
-            cJSON *cjson = cJSON_Parse(str.c_str());
-            if(cjson == nullptr){
-                return Array();
-            }
-            Array json_vec;
-            // 使用链表遍历而非 cJSON_GetArrayItem(i)，避免 O(n²) 性能问题
-            for (cJSON *item = cjson->child; item != NULL; item = item->next) {
-                json_vec.push_back(fromJsonValue(item));
+        }
+        if (!isString()) {
+            return EmptyArray();
+        }
+        if (auto parsed = parsed_array_.load(std::memory_order_acquire)) {
+            return *parsed;
+        }
+        std::lock_guard<std::mutex> lock(c_value_mutex_);
+        auto parsed = parsed_array_.load(std::memory_order_relaxed);
+        if (parsed == nullptr) {
+            parsed = new Array();
+            cJSON *cjson = cJSON_Parse(std::get<std::string>(value_).c_str());
+            if (cjson != nullptr) {
+                // 使用链表遍历而非 cJSON_GetArrayItem(i)，避免 O(n²) 性能问题
+                for (cJSON *item = cjson->child; item != NULL; item = item->next) {
+                    parsed->push_back(fromJsonValue(item));
+                }
+                cJSON_Delete(cjson);
             }
-            cJSON_Delete(cjson);
-            return json_vec;
-        } else {
-            return Array();
+            parsed_array_.store(parsed, std::memory_order_release);
         }
+        return *parsed;
+    }
+
+    /**
+     * 按 key 查找 map 元素，不拷贝
+     * @return 不存在时返回空指针
+     */
+    const std::shared_ptr<KRRenderValue> &valueForKey(const std::string &key) const {
+        const auto &map = toMapRef();
+        auto it = map.find(key);
+        return it != map.end() ? it->second : EmptyValue();
+    }
+
+    /**
+     * 按下标获取 array 元素，不拷贝
+     * @return 越界时返回空指针
+     */
+    const std::shared_ptr<KRRenderValue> &valueAtIndex(size_t index) const {
+        const auto &array = toArrayRef();
+        return index < array.size() ? array[index] : EmptyValue();
     }
 
     const ByteArray toByteArray() const {
         if (isByteArray()) {
             return std::get<ByteArray>(value_);
         } else {
-            return std::make_shared<std::vector<uint8_t>>();
+            return KRByteBuffer::Copy(nullptr, 0);
         }
     }
 
+    /**
+     * 兼容旧版 ByteArray：拷贝一份 vector
+     */
+    LegacyByteArray toByteVector() const {
+        const auto bytes = toByteArray();
+        return std::make_shared<std::vector<uint8_t>>(bytes->begin(), bytes->end());
+    }
+
     const KRRenderCValue &toCValue() const {
         if (c_value_initialized_.load(std::memory_order_acquire)) {
             return c_value_;
@@ -574,7 +635,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         } else if (isMap()) {
             ToJsonMapOrArrayLocked();
         } else if (isArray()) {
-            auto array = toArray();
+            const auto &array = toArrayRef();
             if (HadByteArrayElement(array)) {  // 有二进制元素的话, 不进行 json 序列化，直接传递数组
                 c_value_.type = KRRenderCValue::Type::ARRAY;
                 c_value_.size = array.size();
@@ -611,24 +672,20 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             auto str = toString();
             js_status = OH_JSVM_CreateStringUtf8(js_env, str.c_str(), str.size(), js_value);
         } else if (isByteArray()) {
-            auto &data = toByteArray();
+            const auto &data = std::get<ByteArray>(value_);
             auto size = data->size();
             void *buffer = nullptr;
             JSVM_Value array_buffer_value = nullptr;
             js_status = OH_JSVM_CreateArraybuffer(js_env, size, &buffer, &array_buffer_value);
-            if (js_status == JSVM_OK) {
-                auto byte_buffer = reinterpret_cast<uint8_t *>(buffer);
-                auto origin_buffer = data.get()->data();
-                for (int i = 0; i < size; i++) {
-                    byte_buffer[i] = origin_buffer[i];
-                }
+            if (js_status == JSVM_OK && size > 0) {
+                memcpy(buffer, data->data(), size);
             }
             OH_JSVM_CreateTypedarray(js_env, JSVM_TypedarrayType::JSVM_INT8_ARRAY, size, array_buffer_value, 0,
                                      js_value);
         } else if (isMap()) {
             js_status = ToJsonMapOrArray(js_env, js_value);
         } else if (isArray()) {
-            auto array = toArray();
+            const auto &array = toArrayRef();
             if (HadByteArrayElement(array)) {  // 有二进制元素的话, 不进行 json 序列化，直接传递数组
                 auto size = array.size();
                 js_status = OH_JSVM_CreateArrayWithLength(js_env, size, js_value);
@@ -661,23 +718,17 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             auto str = toString();
             nstatus = napi_create_string_utf8(env, str.c_str(), str.size(), nvalue);
         } else if (isByteArray()) {
-            auto &data = toByteArray();
-            auto size = data->size();
-            void *buffer = nullptr;
+            const auto &data = std::get<ByteArray>(value_);
             napi_value arrayBuffer;
-            nstatus = napi_create_arraybuffer(env, size, &buffer, &arrayBuffer);
+            nstatus = kuikly::util::CreateNApiArrayBuffer(env, data, &arrayBuffer);
             if (nstatus == napi_ok) {
-                auto byte_buffer = reinterpret_cast<uint8_t *>(buffer);
-                auto origin_buffer = data.get()->data();
-                for (int i = 0; i < size; i++) {
-                    byte_buffer[i] = origin_buffer[i];
-                }
+                auto size = data->size();
                 nstatus = napi_create_typedarray(env, napi_int8_array, size, arrayBuffer, 0, nvalue);
             }
         } else if (isMap()) {
             nstatus = ToJsonMapOrArray(env, nvalue);
         } else if (isArray()) {
-            auto array = toArray();
+            const auto &array = toArrayRef();
 #if 0
             if (HadByteArrayElement(array)) {
 #endif
@@ -701,11 +752,35 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         }
     }
 
+    /**
+     * 同 ToNapiValue，用于调用方之后不再使用 value 的场景：value 为唯一引用的二进制数据时，
+     * 数据整体转移给 ArkTS（见 TransferNApiArrayBuffer），不拷贝，value 随之变为空值
+     */
+    static void TransferToNapiValue(const std::shared_ptr<KRRenderValue> &value, const napi_env &env,
+                                    napi_value *nvalue, napi_status &nstatus) {
+        if (value.use_count() != 1 || !value->isByteArray()) {
+            value->ToNapiValue(env, nvalue, nstatus);
+            return;
+        }
+        // 唯一引用，没有其它持有者能观察到 value 被清空
+        auto data = std::move(std::get<ByteArray>(value->value_));
+        value->value_ = std::monostate();
+        value->c_value_initialized_.store(false, std::memory_order_release);
+        auto size = data ? data->size() : 0;
+        napi_value arrayBuffer;
+        nstatus = kuikly::util::TransferNApiArrayBuffer(env, std::move(data), &arrayBuffer);
+        if (nstatus == napi_ok) {
+            nstatus = napi_create_typedarray(env, napi_int8_array, size, arrayBuffer, 0, nvalue);
+        }
+    }
+
     ~KRRenderValue() {
         if (array_ptr_) {
             delete[] array_ptr_;
             array_ptr_ = nullptr;
         }
+        delete parsed_map_.load(std::memory_order_relaxed);
+        delete parsed_array_.load(std::memory_order_relaxed);
     }
 
  private:
@@ -720,6 +795,26 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     mutable KRRenderCValue c_value_;
     mutable KRRenderCValue *array_ptr_ = nullptr;  // 指向数组的指针, 用于防止数组元素copy
 
+    // 字符串形式 map/array 的解析缓存，按需创建，与 c_value_ 共用 c_value_mutex_
+    // （toCValue 持锁时只会访问 Map/Array 类型自身的数据，不会进入解析分支）
+    mutable std::atomic<Map *> parsed_map_{nullptr};
+    mutable std::atomic<Array *> parsed_array_{nullptr};
+
+    static const Map &EmptyMap() {
+        static const Map kEmptyMap;
+        return kEmptyMap;
+    }
+
+    static const Array &EmptyArray() {
+        static const Array kEmptyArray;
+        return kEmptyArray;
+    }
+
+    static const std::shared_ptr<KRRenderValue> &EmptyValue() {
+        static const std::shared_ptr<KRRenderValue> kEmptyValue;
+        return kEmptyValue;
+    }
+
     // 用于 toCValue() 内部调用，调用时已持有锁
     void ToJsonMapOrArrayLocked() const {
         cJSON* cjson = toJson(this);
@@ -766,7 +861,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     static cJSON *toJson(const KRRenderValue *value) {
         if (value->isMap()) {
             cJSON* obj = cJSON_CreateObject();
-            auto map = value->toMap();
+            const auto &map = value->toMapRef();
             for (const auto &entry : map) {
                 cJSON* child = toJson(entry.second.get());
                 cJSON_AddItemToObject(obj, entry.first.c_str(), child);
@@ -774,7 +869,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             return obj;
         } else if (value->isArray()) {
             cJSON* arr = cJSON_CreateArray();
-            auto array = value->toArray();
+            const auto &array = value->toArrayRef();
             for (const auto &element : array) {
                 cJSON* child = toJson(element.get());
                 cJSON_AddItemToArray(arr, child);
@@ -836,4 +931,9 @@ std::shared_ptr<KRRenderValue> KRRenderValue::Make(Args&&... args) {
     return std::make_shared<Accessor>(std::forward<Args>(args)...);
 }
 
+template<typename Alloc, typename... Args>
+std::shared_ptr<KRRenderValue> KRRenderValue::MakeWithAllocator(const Alloc &alloc, Args&&... args) {
+    return std::allocate_shared<Accessor>(alloc, std::forward<Args>(args)...);
+}
+
 #endif  // CORE_RENDER_OHOS_KRRENDERVALUE_H
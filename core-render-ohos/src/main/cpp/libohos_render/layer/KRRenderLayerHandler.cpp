@@ -15,6 +15,8 @@
 
 #include "libohos_render/layer/KRRenderLayerHandler.h"
 
+#include "libohos_render/layer/KRViewReusePool.h"
+
 /**
  * 初始化
  * @param rootView 渲染根容器view
@@ -23,6 +25,7 @@ void KRRenderLayerHandler::Init(std::weak_ptr<IKRRenderView> root_view,
                                 std::shared_ptr<KRRenderContextParams> &context) {
     context_ = context;
     root_view_ = root_view;
+    KRViewReusePool::GetInstance().OnPageInit(root_view_, context_->InstanceId());
 }
 
 /**
@@ -38,7 +41,8 @@ void KRRenderLayerHandler::CreateRenderView(int tag, const std::string &view_nam
     }
     auto it = view_registry_.find(tag);
     if (it == view_registry_.end() || it->second == nullptr) {
-        auto view = PopViewFromReuseQueue(view_name);
+        created_view_counts_[view_name]++;
+        auto view = KRViewReusePool::GetInstance().Acquire(view_name, root_view_, context_->InstanceId());
         if (view == nullptr) {
             view = IKRRenderViewExport::CreateView(view_name);
             if(view){
@@ -77,7 +81,7 @@ void KRRenderLayerHandler::RemoveRenderView(int tag) {
     handle_to_tag_.erase(view->GetNode());
     view_registry_.erase(it);
     if (view->CanReuse()) {
-        PushViewToReuseQueue(view);  // 放入复用队列
+        KRViewReusePool::GetInstance().Recycle(view);  // 放入全局复用池
     } else {
         // 触摸事件分发子系统涉及多个子系统，存在衔接问题，表现上5.0.0.102版本后比较容易出现节点析构后系统内部会因为事件派发出现crash，
         // 这里暂时做个兜底，延缓两帧再销毁view，后续系统OK后再恢复回来。
@@ -96,6 +100,9 @@ void KRRenderLayerHandler::RemoveRenderView(int tag) {
 void KRRenderLayerHandler::InsertSubRenderView(int parent_tag, int child_tag, int index) {
     auto isRootViewTag = parent_tag == -1;
     auto &child_view = view_registry_[child_tag];
+    if (child_view != nullptr) {
+        child_view->ApplyPendingResetProps();  // 复用的 view 上屏前完成剩余的属性重置
+    }
     if (isRootViewTag) {
         if (auto lock = root_view_.lock()) {
             lock->AddContentView(child_view, index);
@@ -154,6 +161,7 @@ void KRRenderLayerHandler::SetShadow(int tag, const std::shared_ptr<IKRRenderSha
  * @return 计算得到的尺寸，"${width}|${height}" 格式封装返回
  */
 std::string KRRenderLayerHandler::CalculateRenderViewSize(int tag, double constraint_width, double constraint_height) {
+    StartSpeculativeLayoutIfNeed(tag, constraint_width, constraint_height);
     auto &shadow = shadow_registry_[tag];
     if (shadow != nullptr) {
         auto size = shadow->CalculateRenderViewSize(constraint_width, constraint_height);
@@ -162,6 +170,24 @@ std::string KRRenderLayerHandler::CalculateRenderViewSize(int tag, double constr
     return "0|0";
 }
 
+void KRRenderLayerHandler::StartSpeculativeLayoutIfNeed(int measuring_tag, double constraint_width,
+                                                        double constraint_height) {
+    if (speculative_layout_tags_.empty()) {
+        return;
+    }
+    // 同一轮布局中的文本节点约束大多相同（如列表 cell），以第一个同步测量的约束作为其余节点的预测值
+    for (auto tag : speculative_layout_tags_) {
+        if (tag == measuring_tag) {
+            continue;
+        }
+        auto it = shadow_registry_.find(tag);
+        if (it != shadow_registry_.end() && it->second != nullptr) {
+            it->second->StartSpeculativeLayout(constraint_width, constraint_height);
+        }
+    }
+    speculative_layout_tags_.clear();
+}
+
 /**
  * 调用渲染视图方法
  * @param tag 视图 ID
@@ -239,6 +265,10 @@ void KRRenderLayerHandler::SetShadowProp(int tag, const std::string &prop_key, c
         auto shadow = it->second;
         if (shadow != nullptr) {
             shadow->SetProp(prop_key, prop_value);
+            // 同一 shadow 的属性通常连续设置，只需记录一次
+            if (speculative_layout_tags_.empty() || speculative_layout_tags_.back() != tag) {
+                speculative_layout_tags_.push_back(tag);
+            }
         }
     }
 }
@@ -309,9 +339,17 @@ void KRRenderLayerHandler::WillDestroy() {}
  */
 void KRRenderLayerHandler::OnDestroy() {
     destroying_ = true;
+    auto &reuse_pool = KRViewReusePool::GetInstance();
     for (const auto &entry : view_registry_) {
         const std::shared_ptr<IKRRenderViewExport> &value = entry.second;
-        if (value) {
+        if (!value) {
+            continue;
+        }
+        if (value->CanReuse()) {
+            // 可复用的叶子节点从父节点摘下后交给全局复用池，供后续页面使用
+            value->ToRemoveFromSuperView();
+            reuse_pool.Recycle(value);
+        } else {
             value->ToDestroy();
         }
     }
@@ -331,38 +369,11 @@ void KRRenderLayerHandler::OnDestroy() {
         module_registry_.clear();
     }
 
-    for (const auto &entry0 : view_reuse_queue_) {
-        for (const auto &entry1 : entry0.second) {
-            if (entry1) {
-                entry1->ToDestroy();
-            }
-        }
-    }
-    view_reuse_queue_.clear();
+    reuse_pool.OnPageDestroy(context_ ? context_->InstanceId() : std::string(), created_view_counts_);
+    created_view_counts_.clear();
 }
 /*** private ****/
 
-std::shared_ptr<IKRRenderViewExport> KRRenderLayerHandler::PopViewFromReuseQueue(const std::string &view_name) {
-    auto it = view_reuse_queue_.find(view_name);
-    if (it != view_reuse_queue_.end()) {
-        // 键存在，可以安全地访问元素
-        auto &queue = it->second;
-        if (!queue.empty()) {
-            auto view = queue.back();
-            queue.pop_back();
-            return view;
-        }
-    }
-    return nullptr;
-}
-
-void KRRenderLayerHandler::PushViewToReuseQueue(std::shared_ptr<IKRRenderViewExport> view) {
-    auto view_name = view->GetViewName();
-    auto &queue = view_reuse_queue_[view_name];
-    view->ToReuse();
-    queue.push_back(view);
-}
-
 std::shared_ptr<IKRRenderModuleExport> KRRenderLayerHandler::GetModuleOrCreate(const std::string &module_name) {
     if (destroying_) {
         return nullptr;
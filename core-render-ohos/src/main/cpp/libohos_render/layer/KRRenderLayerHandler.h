@@ -192,18 +192,19 @@ class KRRenderLayerHandler : public IKRRenderLayer {
  private:
     std::shared_ptr<KRRenderContextParams> context_;
     std::weak_ptr<IKRRenderView> root_view_;
-    std::unordered_map<std::string, std::vector<std::shared_ptr<IKRRenderViewExport>>> view_reuse_queue_;
+    // 本页各类型 view 的创建数，页面销毁时交给 KRViewReusePool 学习预热数量
+    std::unordered_map<std::string, size_t> created_view_counts_;
     std::unordered_map<int, std::shared_ptr<IKRRenderViewExport>> view_registry_;
     std::unordered_map<void *, int> handle_to_tag_;
     std::unordered_map<std::string, std::shared_ptr<IKRRenderModuleExport>> module_registry_;
     std::unordered_map<int, std::shared_ptr<IKRRenderShadowExport>> shadow_registry_;
+    // 上次布局以来属性有更新的 shadow，下一次 CalculateRenderViewSize 时批量发起预测性布局
+    std::vector<int> speculative_layout_tags_;
     mutable std::shared_mutex module_rw_mutex_;  // 用于module读写安全用的读写锁
     bool destroying_ = false;
 
-    /** 从复用队列中弹出一个view */
-    std::shared_ptr<IKRRenderViewExport> PopViewFromReuseQueue(const std::string &view_name);
-    /** 把view放进复用队列里复用 */
-    void PushViewToReuseQueue(std::shared_ptr<IKRRenderViewExport> view);
+    /** 布局开始时以当前约束为预测值，让其余属性已更新的 shadow 提前在工作线程测量 */
+    void StartSpeculativeLayoutIfNeed(int measuring_tag, double constraint_width, double constraint_height);
 };
 
 #endif  // CORE_RENDER_OHOS_KRRENDERLAYERHANDLER_H
@@ -0,0 +1,201 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/layer/KRViewReusePool.h"
+
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#include "libohos_render/expand/modules/file/KRFileIOExecutor.h"
+#include "libohos_render/foundation/KRCacheBudgetCoordinator.h"
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+namespace {
+
+constexpr char kTag[] = "KRViewReusePool";
+// 池中单个 view（ArkUI 节点及其属性）的估算内存
+constexpr size_t kReuseViewEstimatedBytes = 4 * 1024;
+constexpr size_t kMaxPooledViews = 256;
+constexpr size_t kDefaultMaxPerType = 64;
+// 预热记录文件（filesDir 下）
+constexpr char kProfileFileName[] = "kuikly_view_reuse_profile";
+// 页面初始化后等待一段时间再开始预热，避开首屏
+constexpr int kPrewarmDelayMs = 1000;
+// 最近这段时间内有页面在取用 view 时视为主线程繁忙，推迟预热
+constexpr auto kPrewarmIdleThreshold = std::chrono::milliseconds(200);
+constexpr int kPrewarmRetryDelayMs = 200;
+// 每片预热的耗时上限与片间间隔（约一帧）
+constexpr auto kPrewarmSliceBudget = std::chrono::microseconds(2000);
+constexpr int kPrewarmSliceIntervalMs = 16;
+
+KRReusePool<IKRRenderViewExport>::Options PoolOptions() {
+    KRReusePool<IKRRenderViewExport>::Options options;
+    options.max_total = kMaxPooledViews;
+    options.default_max_per_type = kDefaultMaxPerType;
+    // 容器 view 数量远多于其它类型
+    options.max_per_type["KRView"] = 128;
+    return options;
+}
+
+}  // namespace
+
+KRViewReusePool &KRViewReusePool::GetInstance() {
+    static KRViewReusePool *instance = new KRViewReusePool();
+    return *instance;
+}
+
+KRViewReusePool::KRViewReusePool()
+    : pool_(PoolOptions(), [](const std::shared_ptr<IKRRenderViewExport> &view) { view->ToDestroy(); }) {
+    KRCacheBudgetCoordinator::GetInstance().Register(
+        "view_reuse", KRCacheBudgetCoordinator::kPriorityViewReuse,
+        [this] { return pool_.Size() * kReuseViewEstimatedBytes; },
+        [this](size_t target_bytes) { TrimToBytes(target_bytes); });
+}
+
+void KRViewReusePool::OnPageInit(const std::weak_ptr<IKRRenderView> &root_view, const std::string &instance_id) {
+    auto root = root_view.lock();
+    if (root == nullptr) {
+        return;
+    }
+    prewarm_root_ = root_view;
+    prewarm_instance_id_ = instance_id;
+    LoadProfileIfNeed(root->GetContext()->Config()->GetFilesDir());
+    SchedulePrewarm(kPrewarmDelayMs);
+}
+
+void KRViewReusePool::OnPageDestroy(const std::string &instance_id,
+                                    const std::unordered_map<std::string, size_t> &created_counts) {
+    pool_.LearnSession(created_counts);
+    if (!profile_path_.empty()) {
+        kuikly::module::KRFileIOExecutor::GetInstance().Write(profile_path_, pool_.SerializeProfile(), false,
+                                                              nullptr);
+    }
+    if (prewarm_instance_id_ == instance_id) {
+        prewarm_root_.reset();
+    }
+    KR_LOG_INFO_WITH_TAG(kTag) << FormatReport();
+}
+
+std::shared_ptr<IKRRenderViewExport> KRViewReusePool::Acquire(const std::string &view_name,
+                                                              const std::weak_ptr<IKRRenderView> &root_view,
+                                                              const std::string &instance_id) {
+    last_acquire_time_ = std::chrono::steady_clock::now();
+    auto view = pool_.Acquire(view_name);
+    if (view == nullptr || view->GetInstanceId() == instance_id) {
+        return view;
+    }
+    // 来自其它（可能已销毁的）页面
+    if (!view->ToAdopt(root_view, instance_id)) {
+        view->ToDestroy();
+        return nullptr;
+    }
+    return view;
+}
+
+void KRViewReusePool::Recycle(const std::shared_ptr<IKRRenderViewExport> &view) {
+    view->ToReuse();
+    pool_.Recycle(view->GetViewName(), view);
+}
+
+KRReusePool<IKRRenderViewExport>::Stats KRViewReusePool::GetStats() const {
+    return pool_.GetStats();
+}
+
+std::string KRViewReusePool::FormatReport() const {
+    return pool_.FormatReport();
+}
+
+void KRViewReusePool::LoadProfileIfNeed(const std::string &files_dir) {
+    if (profile_requested_ || files_dir.empty()) {
+        return;
+    }
+    profile_requested_ = true;
+    profile_path_ = files_dir + "/" + kProfileFileName;
+    auto &queue = kuikly::dispatch::KRExecutor::GetInstance().Global(kuikly::dispatch::QoS::Utility);
+    queue.Async([path = profile_path_] {
+        std::ifstream file(path);
+        if (!file) {
+            return;
+        }
+        std::ostringstream text;
+        text << file.rdbuf();
+        KRMainThread::RunOnMainThread([text = text.str()] {
+            auto &self = KRViewReusePool::GetInstance();
+            if (self.pool_.LoadProfile(text)) {
+                self.SchedulePrewarm(kPrewarmDelayMs);
+            }
+        });
+    });
+}
+
+void KRViewReusePool::SchedulePrewarm(int delay_ms) {
+    if (prewarm_scheduled_) {
+        return;
+    }
+    prewarm_scheduled_ = true;
+    KRMainThread::RunOnMainThread(
+        [] {
+            auto &self = KRViewReusePool::GetInstance();
+            self.prewarm_scheduled_ = false;
+            self.RunPrewarmSlice();
+        },
+        delay_ms);
+}
+
+void KRViewReusePool::RunPrewarmSlice() {
+    if (prewarm_root_.expired()) {
+        return;  // 没有存活的页面可绑定，下一个页面初始化时再安排
+    }
+    auto start = std::chrono::steady_clock::now();
+    if (start - last_acquire_time_ < kPrewarmIdleThreshold) {
+        SchedulePrewarm(kPrewarmRetryDelayMs);
+        return;
+    }
+    auto plan = pool_.PrewarmPlan();
+    if (plan.empty()) {
+        return;
+    }
+    for (const auto &entry : plan) {
+        const auto &view_name = entry.first;
+        for (size_t i = 0; i < entry.second; ++i) {
+            if (std::chrono::steady_clock::now() - start >= kPrewarmSliceBudget) {
+                SchedulePrewarm(kPrewarmSliceIntervalMs);
+                return;
+            }
+            auto view = IKRRenderViewExport::CreateView(view_name);
+            if (view == nullptr) {
+                pool_.Forget(view_name);
+                break;
+            }
+            view->SetRootView(prewarm_root_, prewarm_instance_id_);
+            view->SetViewName(view_name);
+            view->ToInit();
+            if (!view->CanReuse()) {
+                view->ToDestroy();
+                pool_.Forget(view_name);
+                break;
+            }
+            pool_.Prewarm(view_name, view);
+        }
+    }
+    SchedulePrewarm(kPrewarmSliceIntervalMs);
+}
+
+void KRViewReusePool::TrimToBytes(size_t target_bytes) {
+    pool_.TrimTo(target_bytes / kReuseViewEstimatedBytes);
+}
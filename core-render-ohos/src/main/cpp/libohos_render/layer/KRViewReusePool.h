@@ -0,0 +1,84 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRVIEWREUSEPOOL_H
+#define CORE_RENDER_OHOS_KRVIEWREUSEPOOL_H
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "libohos_render/export/IKRRenderViewExport.h"
+#include "libohos_render/foundation/KRReusePool.h"
+#include "libohos_render/view/IKRRenderView.h"
+
+/**
+ * 进程级 native view 复用池（所有页面共享）
+ * 1. 页面删除或销毁时可复用的 view 重置后放入池中，任意页面创建同名 view 时优先取用；
+ *    来自其它页面的 view 通过 ToAdopt 重新绑定到当前页面
+ * 2. 按类型数量上限与总数上限 LRU 淘汰，注册到 KRCacheBudgetCoordinator，内存压力时裁剪
+ * 3. 页面销毁时按本页各类型的创建数学习预热数量并写入 filesDir，下次启动时载入；
+ *    主线程空闲（一段时间内没有页面在创建 view）时分片预热，每片耗时有上限
+ * 只在主线程访问
+ */
+class KRViewReusePool {
+ public:
+    static KRViewReusePool &GetInstance();
+
+    /**
+     * 页面初始化时调用：首次调用时载入预热记录，并安排空闲预热
+     */
+    void OnPageInit(const std::weak_ptr<IKRRenderView> &root_view, const std::string &instance_id);
+
+    /**
+     * 页面销毁时调用
+     * @param created_counts 本页各类型 view 的创建数（含复用命中），用于学习预热数量
+     */
+    void OnPageDestroy(const std::string &instance_id, const std::unordered_map<std::string, size_t> &created_counts);
+
+    /**
+     * 取出一个可用的 view，已绑定到 root_view；池中没有时返回空
+     */
+    std::shared_ptr<IKRRenderViewExport> Acquire(const std::string &view_name,
+                                                 const std::weak_ptr<IKRRenderView> &root_view,
+                                                 const std::string &instance_id);
+
+    /**
+     * 放回一个已从父节点移除且 CanReuse 的 view，池已满时按 LRU 销毁
+     */
+    void Recycle(const std::shared_ptr<IKRRenderViewExport> &view);
+
+    KRReusePool<IKRRenderViewExport>::Stats GetStats() const;
+    std::string FormatReport() const;
+
+ private:
+    KRViewReusePool();
+
+    void LoadProfileIfNeed(const std::string &files_dir);
+    void SchedulePrewarm(int delay_ms);
+    void RunPrewarmSlice();
+    void TrimToBytes(size_t target_bytes);
+
+    KRReusePool<IKRRenderViewExport> pool_;
+    // 预热创建的 view 先绑定到最近初始化的页面，被其它页面取用时再 ToAdopt
+    std::weak_ptr<IKRRenderView> prewarm_root_;
+    std::string prewarm_instance_id_;
+    std::string profile_path_;
+    bool profile_requested_ = false;
+    bool prewarm_scheduled_ = false;
+    std::chrono::steady_clock::time_point last_acquire_time_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRVIEWREUSEPOOL_H
@@ -24,13 +24,15 @@
 #include "libohos_render/view/KRRenderView.h"
 
 
-napi_value CToNApiValue(napi_env env, const KRAnyValue &value) {
+napi_value CToNApiValue(napi_env env, const KRAnyValue &value, bool transfer = false) {
     napi_value arg0Value;
     napi_status status;
-    if (value != nullptr) {
-        value->ToNapiValue(env, &arg0Value, status);
-    } else {
+    if (value == nullptr) {
         napi_get_null(env, &arg0Value);
+    } else if (transfer) {
+        KRRenderValue::TransferToNapiValue(value, env, &arg0Value, status);
+    } else {
+        value->ToNapiValue(env, &arg0Value, status);
     }
     return arg0Value;
 }
@@ -86,7 +88,7 @@ KRAnyValue KRArkTSManager::CallArkTSMethod(const std::string &instanceId, KRNati
                                            const KRAnyValue &arg3, const KRAnyValue &arg4,
                                            const KRRenderCallback &callback, bool callback_keep_alive,
                                            ArkUI_NodeHandle *return_node_handle, bool arg_prefers_raw_napi_value,
-                                           ArkUI_NodeContentHandle *pContentHandle) {
+                                           ArkUI_NodeContentHandle *pContentHandle, bool transfer_args) {
     if (arkTSCallbackData_ == nullptr) {
         return nullptr;
     }
@@ -101,11 +103,11 @@ KRAnyValue KRArkTSManager::CallArkTSMethod(const std::string &instanceId, KRNati
     napi_value methodIdValue;
     napi_create_int32(env, (int32_t)methodId, &methodIdValue);
     callbackArgs[1] = methodIdValue;
-    callbackArgs[2] = CToNApiValue(env, arg0);
-    callbackArgs[3] = CToNApiValue(env, arg1);
-    callbackArgs[4] = CToNApiValue(env, arg2);
-    callbackArgs[5] = CToNApiValue(env, arg3);
-    callbackArgs[6] = CToNApiValue(env, arg4);
+    callbackArgs[2] = CToNApiValue(env, arg0, transfer_args);
+    callbackArgs[3] = CToNApiValue(env, arg1, transfer_args);
+    callbackArgs[4] = CToNApiValue(env, arg2, transfer_args);
+    callbackArgs[5] = CToNApiValue(env, arg3, transfer_args);
+    callbackArgs[6] = CToNApiValue(env, arg4, transfer_args);
     if (callback != nullptr) {
         auto pager_id = instanceId;
         auto renderView = KRRenderManager::GetInstance().GetRenderView(pager_id);
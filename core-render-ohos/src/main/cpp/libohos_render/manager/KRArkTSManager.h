@@ -63,12 +63,14 @@ class KRArkTSManager {
      * 注：不允许在子线程调用，若要在子线程调用，请用KRContextScheduler::ScheduleTaskOnMainThread
      * @param return_node_handle 返回ArkTS侧的ArkUI node节点句柄（默认为null）
      * @param callback_keep_alive callback 是否 keep alive
+     * @param transfer_args 调用方之后不再使用 arg0~arg4 时为 true，唯一引用的二进制参数整体转移给 ArkTS，不拷贝
      */
     KRAnyValue CallArkTSMethod(const std::string &instanceId, KRNativeCallArkTSMethod methodId, const KRAnyValue &arg0,
                                const KRAnyValue &arg1, const KRAnyValue &arg2, const KRAnyValue &arg3,
                                const KRAnyValue &arg4, const KRRenderCallback &callback,
                                bool callback_keep_alive = false, ArkUI_NodeHandle *return_node_handle = nullptr,
-                               bool arg_prefers_raw_napi_value = false, ArkUI_NodeContentHandle *contentHandle = nullptr);
+                               bool arg_prefers_raw_napi_value = false,
+                               ArkUI_NodeContentHandle *contentHandle = nullptr, bool transfer_args = false);
 
     /**
      * 获取NAPI Env
@@ -23,6 +23,7 @@
 #include <multimedia/image_framework/image_pixel_map_mdk.h>
 #include <unistd.h>
 
+#include "libohos_render/foundation/KRCacheBudgetCoordinator.h"
 #include "libohos_render/foundation/KRCommon.h"
 #include "libohos_render/foundation/ark_ts.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
@@ -59,7 +60,14 @@ static void DisposeItem(struct KRSnapshotItem *item) {
     }
 }
 
+KRSnapshotManager::KRSnapshotManager() {
+    budget_id_ = KRCacheBudgetCoordinator::GetInstance().Register(
+        "snapshot", KRCacheBudgetCoordinator::kPrioritySnapshot, [this] { return GetDrawableBytes(); },
+        [this](size_t target_bytes) { TrimDrawables(target_bytes); });
+}
+
 KRSnapshotManager::~KRSnapshotManager() {
+    KRCacheBudgetCoordinator::GetInstance().Unregister(budget_id_);
     std::for_each(drawableDescriptorCache_.begin(), drawableDescriptorCache_.end(),
                   [](auto desc) { DisposeItem(&desc.second); });
     drawableDescriptorCache_.clear();
@@ -79,6 +87,10 @@ void KRSnapshotManager::CacheSnapshot(napi_env env, napi_value drawableDescripto
         item.env = env;
         item.drawableDescriptorRef = arkTs.CreateReference(drawableDescriptor);
         item.pixelMapRef = arkTs.CreateReference(pixelMap);
+        OhosPixelMapInfos info;
+        if (OH_PixelMap_GetImageInfo(OH_PixelMap_InitNativePixelMap(env, pixelMap), &info) == IMAGE_RESULT_SUCCESS) {
+            item.byteCount = static_cast<size_t>(info.rowSize) * info.height;
+        }
         drawableDescriptorCache_[key] = item;
     } else {
         drawableDescriptorCache_.erase(key);
@@ -92,6 +104,31 @@ void KRSnapshotManager::UpdateSnapshot(const std::string &uri, const std::string
     }
 }
 
+size_t KRSnapshotManager::GetDrawableBytes() const {
+    size_t bytes = 0;
+    for (const auto &entry : drawableDescriptorCache_) {
+        if (entry.second.drawableDescriptor) {
+            bytes += entry.second.byteCount;
+        }
+    }
+    return bytes;
+}
+
+void KRSnapshotManager::TrimDrawables(size_t target_bytes) {
+    // 只释放已落盘（uri 可用）的位图，之后按 uri 设置到节点；尚未落盘的仍需保留
+    size_t bytes = GetDrawableBytes();
+    for (auto &entry : drawableDescriptorCache_) {
+        if (bytes <= target_bytes) {
+            break;
+        }
+        auto &item = entry.second;
+        if (item.drawableDescriptor && !item.uri.empty()) {
+            bytes -= item.byteCount;
+            ReleaseDrawableItem(&item);
+        }
+    }
+}
+
 bool KRSnapshotManager::SetCachedSnapshotToNode(ArkUI_NodeHandle node, const std::string &key) {
     auto item = drawableDescriptorCache_.find(key);
     if (item != drawableDescriptorCache_.end()) {
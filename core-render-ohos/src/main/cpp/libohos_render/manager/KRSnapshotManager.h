@@ -29,10 +29,12 @@ struct KRSnapshotItem {
     napi_ref drawableDescriptorRef;
     napi_ref pixelMapRef;
     std::string uri;
+    size_t byteCount = 0;
 };
 
 class KRSnapshotManager {
  public:
+    KRSnapshotManager();
     ~KRSnapshotManager();
 
     bool SetCachedSnapshotToNode(ArkUI_NodeHandle node, const std::string &key);
@@ -66,8 +68,11 @@ class KRSnapshotManager {
     void UpdateSnapshot(const std::string &uri, const std::string &key);
     void UpdateCachedSnapshotUriAfterDelay(int delayMS, const std::string &key, const std::string &path,
                                            const std::string &pathUri, std::weak_ptr<IKRRenderViewExport> weak_view);
+    size_t GetDrawableBytes() const;
+    void TrimDrawables(size_t target_bytes);
 
     std::unordered_map<std::string, struct KRSnapshotItem> drawableDescriptorCache_;
+    uint64_t budget_id_ = 0;
 };
 
 #endif  // CORE_RENDER_OHOS_KRSNAPSHOTMANAGER_H
@@ -19,7 +19,9 @@
 #include "libohos_render/performance/memory/KRMemoryData.h"
 #include <atomic>
 #include <hidebug/hidebug.h>
-#include "libohos_render/foundation/ffrt/KRFfrt.h"
+#include "libohos_render/foundation/KRCacheBudgetCoordinator.h"
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/foundation/type/KRRenderValue.h"
 
 const char KRMemoryMonitor::kMonitorName[] = "KRMemoryMonitor";
@@ -75,6 +77,16 @@ void KRMemoryMonitor::DoDumpMemory() {
     long heap = GetEnvHeapSize();
     KR_LOG_INFO_WITH_TAG(kTag) << "dumpMemory["<< dump_memory_count_ <<"]pssSize: " << pss << ", EnvHeap: " << heap;
     memory_data_.Record(pss, heap);
+    auto level = KRCacheBudgetCoordinator::GetInstance().LevelForPss(pss);
+    if (level != KRMemoryTrimLevel::kNone) {
+        // 缓存回调需在主线程执行
+        KRMainThread::RunOnMainThread([level, pss] {
+            auto &coordinator = KRCacheBudgetCoordinator::GetInstance();
+            auto trimmed = coordinator.Trim(level);
+            KR_LOG_INFO_WITH_TAG(kTag) << "pss " << pss << " over threshold, trimmed " << trimmed / 1024 << "KB, "
+                                       << KRCacheBudgetCoordinator::FormatReport(coordinator.Report());
+        });
+    }
     dump_memory_count_++;
     if (dump_memory_count_ < MAX_DUMP_MEMORY_COUNT) {
         ScheduleNextDump();
@@ -105,22 +117,18 @@ long long KRMemoryMonitor::GetEnvHeapSize() {
     return 0;
 }
 
-void KRMemoryMonitor::ExecuteMemoryTask(void* arg) {
-    auto* task_param = static_cast<MonitorTaskParam*>(arg);
-    if (!task_param) return;
+void KRMemoryMonitor::ExecuteMemoryTask(MemoryTaskType type) {
     try {
-        if (auto monitor = task_param->monitor_weak_ptr.lock()) {
-            switch (task_param->type) {
-                case MemoryTaskType::INIT: {
-                    long initPss = monitor->GetPssSize();
-                    long initEnvHeap = monitor->GetEnvHeapSize();
-                    monitor->memory_data_.OnInit(initPss, initEnvHeap);
-                    break;
-                }
-                case MemoryTaskType::DUMP_MEMORY: {
-                    monitor->DoDumpMemory();
-                    break;
-                }
+        switch (type) {
+            case MemoryTaskType::INIT: {
+                long initPss = GetPssSize();
+                long initEnvHeap = GetEnvHeapSize();
+                memory_data_.OnInit(initPss, initEnvHeap);
+                break;
+            }
+            case MemoryTaskType::DUMP_MEMORY: {
+                DoDumpMemory();
+                break;
             }
         }
     } catch (...) {
@@ -128,21 +136,12 @@ void KRMemoryMonitor::ExecuteMemoryTask(void* arg) {
     }
 }
 
-void KRMemoryMonitor::CleanupMemoryTask(void* arg) {
-    auto* task_param = static_cast<MonitorTaskParam*>(arg);
-    delete task_param;
-}
-
 void KRMemoryMonitor::SubmitMonitorTask(MemoryTaskType type, long delay_ms) {
     std::weak_ptr<KRMemoryMonitor> weak_self = shared_from_this();
-    auto* param = new MonitorTaskParam(type, std::move(weak_self));
-    ffrt_task_attr_t attr;
-    ffrt_task_attr_init(&attr);
-    if (delay_ms > 0) {
-        ffrt_task_attr_set_delay(&attr, delay_ms * 1000); // 毫秒转纳秒
-    }
-    ffrt_submit_base(
-        ffrt_create_function_wrapper(ExecuteMemoryTask, CleanupMemoryTask, param, ffrt_function_kind_general), 
-        NULL, NULL, &attr);
-    ffrt_task_attr_destroy(&attr);
+    auto &queue = kuikly::dispatch::KRExecutor::GetInstance().Global(kuikly::dispatch::QoS::Background);
+    queue.AsyncAfter(delay_ms > 0 ? delay_ms : 0, [weak_self, type] {
+        if (auto monitor = weak_self.lock()) {
+            monitor->ExecuteMemoryTask(type);
+        }
+    });
 }
\ No newline at end of file
@@ -50,8 +50,7 @@ class KRMemoryMonitor: public KRMonitor, public std::enable_shared_from_this<KRM
      * 获取当前运行环境内存信息
      */
     long long GetEnvHeapSize();
-    static void ExecuteMemoryTask(void* arg);
-    static void CleanupMemoryTask(void* arg);
+    void ExecuteMemoryTask(MemoryTaskType type);
     void SubmitMonitorTask(MemoryTaskType type, long delay_ms = 0);
     std::atomic<bool> is_started_{false};
     std::atomic<bool> is_resumed_{false};
@@ -64,12 +63,4 @@ class KRMemoryMonitor: public KRMonitor, public std::enable_shared_from_this<KRM
     int mode_;
 };
 
-struct MonitorTaskParam {
-    MemoryTaskType type;
-    std::weak_ptr<KRMemoryMonitor> monitor_weak_ptr;
-    
-    MonitorTaskParam(MemoryTaskType t, std::weak_ptr<KRMemoryMonitor> ptr) 
-        : type(t), monitor_weak_ptr(std::move(ptr)) {}
-};
-
 #endif //CORE_RENDER_OHOS_KRMEMORYMONITOR_H
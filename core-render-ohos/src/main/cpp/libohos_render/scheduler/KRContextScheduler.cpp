@@ -28,6 +28,10 @@ class KRContextSchedulerInternal {
     virtual void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) = 0;
 
     virtual bool IsCurrentOnContextThread() = 0;
+
+    virtual KRThreadBaton::Stats GetDirectRunStats() {
+        return KRThreadBaton::Stats();
+    }
 };
 
 class KRContextSchedulerMultiThreaded : public KRContextSchedulerInternal {
@@ -36,6 +40,9 @@ class KRContextSchedulerMultiThreaded : public KRContextSchedulerInternal {
     void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) override;
     void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) override;
     bool IsCurrentOnContextThread() override;
+    KRThreadBaton::Stats GetDirectRunStats() override {
+        return GetContextThread()->GetDirectRunStats();
+    }
 
  private:
     static KRThread *GetContextThread() {
@@ -73,7 +80,7 @@ void KRContextSchedulerMultiThreaded::ScheduleTask(bool sync, int delayMs, const
 void KRContextSchedulerMultiThreaded::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
     if (sync) {
         if (GetContextThread()->IsCurrentThreadWorkerThread()) {
-            GetContextThread()->SyncMainTaskMutex(true, false, false);
+            GetContextThread()->SetSyncMainTaskPending(true);
             std::mutex mtx;
             std::condition_variable cv;
             bool task_completed = false;
@@ -87,7 +94,7 @@ void KRContextSchedulerMultiThreaded::ScheduleTaskOnMainThread(bool sync, const
                 cv.notify_one();
             });
             cv.wait(lock, [&task_completed] { return task_completed; });
-            GetContextThread()->SyncMainTaskMutex(false, true, false);
+            GetContextThread()->SetSyncMainTaskPending(false);
         } else {
             // 说明在主线程, 直接同步
             task();
@@ -178,6 +185,9 @@ void KRContextScheduler::DirectRunOnMainThread(bool isSync, const KRSchedulerTas
 bool KRContextScheduler::IsCurrentOnContextThread() {
     return GetInstance()->IsCurrentOnContextThread();
 }
+KRThreadBaton::Stats KRContextScheduler::GetDirectRunStats() {
+    return GetInstance()->GetDirectRunStats();
+}
 
 EXTERN_C_START
 /**
@@ -54,6 +54,11 @@ class KRContextScheduler {
      */
     static bool IsCurrentOnContextThread();
 
+    /**
+     * 主线程同步执行Context任务（DirectRunOnMainThread/同步ScheduleTask）时的等待统计，仅MultiThread模式有数据
+     */
+    static KRThreadBaton::Stats GetDirectRunStats();
+
     /**
      * 设置线程模型，初始化kuikly前调用，初始化后调用无作用
      * @param mode 单线程或多线程模式
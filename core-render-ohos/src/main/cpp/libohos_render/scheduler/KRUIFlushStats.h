@@ -0,0 +1,69 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRUIFLUSHSTATS_H
+#define CORE_RENDER_OHOS_KRUIFLUSHSTATS_H
+
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * KRUIScheduler的UI任务flush统计
+ * 每次flush（一次layout + 一次主线程同步）记录一次，按帧间隔对flush时间分桶统计每帧flush次数
+ */
+struct KRUIFlushStats {
+    static constexpr int64_t kFrameIntervalNanos = 16666667;  // 60fps 的刷新间隔（ns）
+
+    uint64_t flush_count = 0;            // flush总次数
+    uint64_t task_count = 0;             // flush的UI任务总数
+    uint64_t max_tasks_per_flush = 0;    // 单次flush最多任务数
+    uint64_t frame_count = 0;            // 发生过flush的帧数
+    uint64_t max_flushes_per_frame = 0;  // 单帧最多flush次数
+    uint64_t vsync_flush_count = 0;      // VSync触发的flush次数
+    uint64_t deadline_flush_count = 0;   // VSync未按时到达，由兜底定时触发的flush次数
+
+    /**
+     * 记录一次flush
+     * @param tasks 本次flush的UI任务数
+     * @param now_nanos 当前单调时钟时间（纳秒）
+     */
+    void RecordFlush(uint64_t tasks, int64_t now_nanos) {
+        flush_count++;
+        task_count += tasks;
+        max_tasks_per_flush = std::max(max_tasks_per_flush, tasks);
+        auto frame = now_nanos / kFrameIntervalNanos;
+        if (frame_count == 0 || frame != current_frame_) {
+            current_frame_ = frame;
+            current_frame_flushes_ = 0;
+            frame_count++;
+        }
+        current_frame_flushes_++;
+        max_flushes_per_frame = std::max(max_flushes_per_frame, current_frame_flushes_);
+    }
+
+    double TasksPerFlush() const {
+        return flush_count == 0 ? 0 : static_cast<double>(task_count) / flush_count;
+    }
+
+    double FlushesPerFrame() const {
+        return frame_count == 0 ? 0 : static_cast<double>(flush_count) / frame_count;
+    }
+
+ private:
+    int64_t current_frame_ = 0;
+    uint64_t current_frame_flushes_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRUIFLUSHSTATS_H
@@ -15,17 +15,26 @@
 
 #include "libohos_render/scheduler/KRUIScheduler.h"
 
+#include <atomic>
+#include <chrono>
+#include "libohos_render/foundation/thread/KRTimerQueue.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
+#include "libohos_render/scheduler/KRVSyncDispatcher.h"
+
+static std::atomic<int> gFlushMode{KRUIScheduler::FlushMode::Immediate};
+// VSync模式下等待VSync的最长时间（约两帧），超时后直接flush
+static std::atomic<int> gFlushDeadlineMs{32};
 
 // should call on context线程
-void KRUIScheduler::AddTaskToMainQueueWithTask(const KRSchedulerTask &task) {
+void KRUIScheduler::AddTaskToMainQueueWithTask(KRTask task) {
     std::lock_guard<std::mutex> lock(m_mutex_);
-    m_main_thread_tasks_on_context_queue_.push_back(task);
+    m_main_thread_tasks_on_context_queue_.push_back(std::move(task));
     SetNeedSyncMainQuequeTasks();
 }
 // should call on context线程
 void KRUIScheduler::PerformSyncMainQueueTasksBlockIfNeed(bool sync) {
     if (m_need_sync_main_queue_tasks_block_) {
+        CancelDeadlineTimer();
         m_need_sync_main_queue_tasks_block_(sync);
         m_need_sync_main_queue_tasks_block_ = nullptr;
     }
@@ -35,7 +44,7 @@ void KRUIScheduler::PerformWhenViewDidLoad(const KRSchedulerTask &task) {
     if (m_view_did_load_) {
         task();
     } else {
-        m_view_did_load_main_thread_tasks_.push_back(task);
+        m_view_did_load_main_thread_tasks_.emplace_back(task);
     }
 }
 
@@ -44,7 +53,7 @@ bool KRUIScheduler::IsPerformMainTasking() {
 }
 
 void KRUIScheduler::PerformTaskWhenDidEnd(const KRSchedulerTask &task) {
-    m_did_end_main_thread_tasks_.push_back(task);
+    m_did_end_main_thread_tasks_.emplace_back(task);
 }
 
 void KRUIScheduler::Destroy() {
@@ -53,6 +62,30 @@ void KRUIScheduler::Destroy() {
     m_delegate_ = nullptr;
     m_need_sync_main_queue_tasks_block_ = nullptr;
     m_main_thread_tasks_on_context_queue_.clear();
+    if (m_flush_stats_.flush_count > 0) {
+        KR_LOG_INFO << "KRUIScheduler flush stats, mode: " << m_flush_mode_ << ", flushes: " << m_flush_stats_.flush_count
+                    << ", tasks/flush: " << m_flush_stats_.TasksPerFlush()
+                    << ", flushes/frame: " << m_flush_stats_.FlushesPerFrame()
+                    << ", max flushes/frame: " << m_flush_stats_.max_flushes_per_frame
+                    << ", vsync: " << m_flush_stats_.vsync_flush_count
+                    << ", deadline: " << m_flush_stats_.deadline_flush_count;
+    }
+}
+
+KRUIFlushStats KRUIScheduler::GetFlushStats() {
+    std::lock_guard<std::mutex> lock(m_mutex_);
+    return m_flush_stats_;
+}
+
+void KRUIScheduler::SetFlushMode(FlushMode mode, int deadlineMs) {
+    gFlushMode.store(mode);
+    if (deadlineMs > 0) {
+        gFlushDeadlineMs.store(deadlineMs);
+    }
+}
+
+KRUIScheduler::FlushMode KRUIScheduler::GetFlushMode() {
+    return static_cast<FlushMode>(gFlushMode.load());
 }
 
 void KRUIScheduler::SetNeedSyncMainQuequeTasks() {
@@ -73,12 +106,16 @@ void KRUIScheduler::SetNeedSyncMainQuequeTasks() {
                 scheduler->m_delegate_->WillPerformUITasksWithScheduler();
             }
             
-            std::vector<KRSchedulerTask> performTasks;
+            std::vector<KRTask> performTasks;
             {
                 std::lock_guard<std::mutex> lock(scheduler->m_mutex_);
-                performTasks = scheduler->m_main_thread_tasks_on_context_queue_;
-                scheduler->m_main_thread_tasks_on_context_queue_ = {};
-                scheduler->m_main_thread_tasks_.insert(scheduler->m_main_thread_tasks_.end(), performTasks.begin(), performTasks.end());
+                performTasks.swap(scheduler->m_main_thread_tasks_on_context_queue_);
+                auto now = std::chrono::steady_clock::now().time_since_epoch();
+                scheduler->m_flush_stats_.RecordFlush(
+                    performTasks.size(), std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+            }
+            for (auto &task : performTasks) {
+                scheduler->m_main_thread_tasks_.Push(std::move(task));
             }
             
             scheduler->PerformOnMainQueueWithTask(sync, [weakSelf] {
@@ -89,15 +126,19 @@ void KRUIScheduler::SetNeedSyncMainQuequeTasks() {
                 
                 auto scheduler = std::dynamic_pointer_cast<KRUIScheduler>(strongSelf);
                 
-                std::vector<KRSchedulerTask> mainTasks;
-                {
-                    std::lock_guard<std::mutex> lock(scheduler->m_mutex_);
-                    mainTasks = scheduler->m_main_thread_tasks_;
-                    scheduler->m_main_thread_tasks_ = {};
+                // 先取出当前所有任务再执行，任务内重入flush时只执行之后入队的任务
+                std::vector<KRTask> mainTasks;
+                KRTask task;
+                while (scheduler->m_main_thread_tasks_.Pop(task)) {
+                    mainTasks.push_back(std::move(task));
                 }
                 scheduler->RunMainQueueTasks(mainTasks);
             });
         };
+        if (m_flush_mode_ == FlushMode::VSync) {
+            ScheduleFrameAlignedFlush();
+            return;
+        }
         KRContextScheduler::ScheduleTask(false, 0, [weakSelf] { 
             auto strongSelf = weakSelf.lock();
             if (!strongSelf) {
@@ -109,6 +150,62 @@ void KRUIScheduler::SetNeedSyncMainQuequeTasks() {
     }
 }
 
+// context线程，VSync模式：等下一帧VSync到来再flush，期间新增的UI任务合并到同一次flush
+void KRUIScheduler::ScheduleFrameAlignedFlush() {
+    std::weak_ptr<IKRScheduler> weakSelf = shared_from_this();
+    auto generation = ++m_flush_generation_;
+    auto instanceId = m_instance_id_;
+    auto vsyncRequested = KRVSyncDispatcher::GetInstance().RequestFrame([weakSelf, generation](long long) {
+        // VSync线程，切回context线程flush
+        KRContextScheduler::ScheduleTask(false, 0, [weakSelf, generation] {
+            if (auto strongSelf = weakSelf.lock()) {
+                std::dynamic_pointer_cast<KRUIScheduler>(strongSelf)->PerformFrameAlignedFlushIfNeed(
+                    generation, FlushTrigger::kVSync);
+            }
+        });
+    });
+    auto flushOnDeadline = [weakSelf, generation] {
+        if (auto strongSelf = weakSelf.lock()) {
+            std::dynamic_pointer_cast<KRUIScheduler>(strongSelf)->PerformFrameAlignedFlushIfNeed(
+                generation, FlushTrigger::kDeadline);
+        }
+    };
+    if (!vsyncRequested) {
+        // VSync不可用时直接异步flush
+        KRContextScheduler::ScheduleTask(false, 0, flushOnDeadline);
+        return;
+    }
+    // 兜底：VSync未按时到达（如页面在后台）时按截止时间flush；VSync先到时取消，不再唤醒context线程
+    m_deadline_timer_ = KRTimerQueue::GetInstance().Schedule(
+        [flushOnDeadline] { KRContextScheduler::ScheduleTask(false, 0, flushOnDeadline); },
+        gFlushDeadlineMs.load(), instanceId);
+}
+
+// context线程
+void KRUIScheduler::CancelDeadlineTimer() {
+    if (m_deadline_timer_) {
+        KRTimerQueue::GetInstance().Cancel(m_deadline_timer_);
+        m_deadline_timer_ = 0;
+    }
+}
+
+// context线程
+void KRUIScheduler::PerformFrameAlignedFlushIfNeed(uint64_t generation, FlushTrigger trigger) {
+    // 本次请求对应的flush已由另一触发源或同步flush（PerformSyncMainQueueTasksBlockIfNeed(true)）执行过
+    if (generation != m_flush_generation_ || !m_need_sync_main_queue_tasks_block_) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex_);
+        if (trigger == FlushTrigger::kVSync) {
+            m_flush_stats_.vsync_flush_count++;
+        } else {
+            m_flush_stats_.deadline_flush_count++;
+        }
+    }
+    PerformSyncMainQueueTasksBlockIfNeed(false);
+}
+
 void KRUIScheduler::PerformOnMainQueueWithTask(bool sync, const std::function<void()> &task) {
     if (sync) {
         m_main_thread_task_wait_to_sync_block_ = task;
@@ -127,7 +224,7 @@ void KRUIScheduler::PerformOnMainQueueWithTask(bool sync, const std::function<vo
     }
 }
 
-void KRUIScheduler::RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks) {
+void KRUIScheduler::RunMainQueueTasks(std::vector<KRTask> &tasks) {
     // 主线程
     m_performing_main_queue_task_ = true;
     for (size_t i = 0; i < tasks.size(); i++) {
@@ -136,15 +233,15 @@ void KRUIScheduler::RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks)
     m_performing_main_queue_task_ = false;
     if (!m_view_did_load_) {
         m_view_did_load_ = true;
-        auto viewDidLoadTasks = m_view_did_load_main_thread_tasks_;
-        m_view_did_load_main_thread_tasks_ = {};
+        auto viewDidLoadTasks = std::move(m_view_did_load_main_thread_tasks_);
+        m_view_did_load_main_thread_tasks_.clear();
         for (size_t i = 0; i < viewDidLoadTasks.size(); i++) {
             viewDidLoadTasks[i]();
         }
     }
     if (m_did_end_main_thread_tasks_.size() > 0) {
-        auto tasks = m_did_end_main_thread_tasks_;
-        m_did_end_main_thread_tasks_ = {};
+        auto tasks = std::move(m_did_end_main_thread_tasks_);
+        m_did_end_main_thread_tasks_.clear();
         for (size_t i = 0; i < tasks.size(); i++) {
             tasks[i]();
         }
@@ -157,3 +254,16 @@ void KRUIScheduler::PerformMainThreadTaskWaitToSyncBlockIfNeed() {
         m_main_thread_task_wait_to_sync_block_ = nullptr;
     }
 }
+
+EXTERN_C_START
+/**
+ * 设置UI任务flush模式，初始化kuikly前调用，对之后创建的页面生效
+ * @param mode 0 ：默认模式，有UI任务即调度flush， 1 ：帧对齐模式，每个VSync合并为一次layout和一次主线程同步
+ * @param deadline_ms 帧对齐模式下等待VSync的最长时间，<=0时使用默认值
+ */
+void KRSetUIFlushMode(int mode, int deadline_ms) {
+    auto flush_mode = mode == KRUIScheduler::FlushMode::VSync ? KRUIScheduler::FlushMode::VSync
+                                                              : KRUIScheduler::FlushMode::Immediate;
+    KRUIScheduler::SetFlushMode(flush_mode, deadline_ms);
+}
+EXTERN_C_END
@@ -19,10 +19,14 @@
 #include <functional>
 #include <future>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
 #include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/foundation/thread/KRMpscQueue.h"
+#include "libohos_render/foundation/thread/KRTask.h"
 #include "libohos_render/scheduler/IKRScheduler.h"
+#include "libohos_render/scheduler/KRUIFlushStats.h"
 
 using KRSyncSchedulerTask = std::function<void(bool sync)>;
 
@@ -35,10 +39,20 @@ class KRRenderUISchedulerDelegate {
 
 class KRUIScheduler : public IKRScheduler {
  public:
-    explicit KRUIScheduler(KRRenderUISchedulerDelegate *delegate) : m_delegate_(delegate) {}
+    enum FlushMode {
+        Immediate = 0,  // 默认模式，首个UI任务入队后立即调度一次flush
+        VSync = 1       // 帧对齐模式，合并一帧内的UI任务，每个VSync只做一次layout和一次主线程同步
+    };
+
+    /**
+     * @param delegate UI任务回调
+     * @param instanceId 页面实例id，用于把flush调度回页面所属的Context线程
+     */
+    KRUIScheduler(KRRenderUISchedulerDelegate *delegate, const std::string &instanceId)
+        : m_delegate_(delegate), m_instance_id_(instanceId), m_flush_mode_(GetFlushMode()) {}
 
     // should call on context线程
-    void AddTaskToMainQueueWithTask(const KRSchedulerTask &task);
+    void AddTaskToMainQueueWithTask(KRTask task);
     // should call on context线程
     void PerformSyncMainQueueTasksBlockIfNeed(bool sync);
     // should call on main thread
@@ -56,24 +70,48 @@ class KRUIScheduler : public IKRScheduler {
     void ResetDelegate(){
         m_delegate_ = nullptr;
     }
+
+    /**
+     * flush统计（tasks/flush、flushes/frame），任意线程可调用
+     */
+    KRUIFlushStats GetFlushStats();
+
+    /**
+     * 设置UI任务flush模式，对之后创建的页面生效
+     * @param mode flush模式
+     * @param deadlineMs VSync模式下等待VSync的最长时间，超时后直接flush（如页面退到后台VSync停止时）
+     */
+    static void SetFlushMode(FlushMode mode, int deadlineMs);
+    static FlushMode GetFlushMode();
+
  private:
+    enum class FlushTrigger { kVSync, kDeadline };
+
     void SetNeedSyncMainQuequeTasks();
+    void ScheduleFrameAlignedFlush();
+    void PerformFrameAlignedFlushIfNeed(uint64_t generation, FlushTrigger trigger);
+    void CancelDeadlineTimer();
 
     void PerformOnMainQueueWithTask(bool sync, const std::function<void()> &task);
 
-    void RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks);
+    void RunMainQueueTasks(std::vector<KRTask> &tasks);
 
     bool m_is_destroyed_ = false;
     KRSyncSchedulerTask m_need_sync_main_queue_tasks_block_ = nullptr;
     KRRenderUISchedulerDelegate *m_delegate_ = nullptr;
     bool m_performing_main_queue_task_ = false;
-    std::vector<KRSchedulerTask> m_main_thread_tasks_on_context_queue_;
-    std::vector<KRSchedulerTask> m_main_thread_tasks_;
-    std::vector<KRSchedulerTask> m_view_did_load_main_thread_tasks_;
-    std::vector<KRSchedulerTask> m_did_end_main_thread_tasks_;
+    std::vector<KRTask> m_main_thread_tasks_on_context_queue_;  // 由m_mutex_保护
+    KRMpscQueue<KRTask> m_main_thread_tasks_;  // context线程flush时入队，主线程出队执行
+    std::vector<KRTask> m_view_did_load_main_thread_tasks_;
+    std::vector<KRTask> m_did_end_main_thread_tasks_;
     std::function<void()> m_main_thread_task_wait_to_sync_block_ = nullptr;
     std::mutex m_mutex_;
     bool m_view_did_load_ = false;
+    std::string m_instance_id_;
+    FlushMode m_flush_mode_ = FlushMode::Immediate;
+    uint64_t m_flush_generation_ = 0;  // 仅在context线程访问，用于丢弃已被其他途径执行过的VSync/兜底flush
+    uint64_t m_deadline_timer_ = 0;    // 仅在context线程访问，VSync模式下兜底flush的定时器id
+    KRUIFlushStats m_flush_stats_;      // 由m_mutex_保护
 };
 
 #endif  // CORE_RENDER_OHOS_KRUISCHEDULER_H
@@ -0,0 +1,64 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/scheduler/KRVSyncDispatcher.h"
+
+#include <cstring>
+#include "libohos_render/utils/KRRenderLoger.h"
+
+constexpr char kVSyncName[] = "KRVSyncDispatcher";
+
+KRVSyncDispatcher &KRVSyncDispatcher::GetInstance() {
+    // 不析构：VSync回调可能晚于静态对象析构到达
+    static KRVSyncDispatcher *instance_ = nullptr;
+    static std::once_flag flag;
+    std::call_once(flag, []() { instance_ = new KRVSyncDispatcher(); });
+    return *instance_;
+}
+
+KRVSyncDispatcher::KRVSyncDispatcher() {
+    native_vsync_ = OH_NativeVSync_Create(kVSyncName, strlen(kVSyncName));
+    if (!native_vsync_) {
+        KR_LOG_ERROR << "KRVSyncDispatcher create native vsync failed";
+    }
+}
+
+bool KRVSyncDispatcher::RequestFrame(const FrameCallback &callback) {
+    if (!native_vsync_) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!frame_requested_) {
+        if (OH_NativeVSync_RequestFrame(native_vsync_, &KRVSyncDispatcher::OnVSync, this) != 0) {
+            return false;
+        }
+        frame_requested_ = true;
+    }
+    callbacks_.push_back(callback);
+    return true;
+}
+
+void KRVSyncDispatcher::OnVSync(long long timestamp, void *data) {
+    auto *dispatcher = static_cast<KRVSyncDispatcher *>(data);
+    std::vector<FrameCallback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(dispatcher->mutex_);
+        dispatcher->frame_requested_ = false;
+        callbacks.swap(dispatcher->callbacks_);
+    }
+    for (auto &callback : callbacks) {
+        callback(timestamp);
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRVSYNCDISPATCHER_H
+#define CORE_RENDER_OHOS_KRVSYNCDISPATCHER_H
+
+#include <native_vsync/native_vsync.h>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * 全局VSync分发器
+ * 所有页面共用一个OH_NativeVSync，同一帧内的多次请求合并为一次OH_NativeVSync_RequestFrame，
+ * 回调在VSync线程执行，回调内不应做耗时操作
+ */
+class KRVSyncDispatcher {
+ public:
+    using FrameCallback = std::function<void(long long timestamp)>;
+
+    static KRVSyncDispatcher &GetInstance();
+
+    /**
+     * 请求在下一帧VSync到来时回调一次
+     * @param callback 帧回调，参数为VSync时间戳（纳秒）
+     * @return 是否请求成功，VSync不可用时返回false，调用方需自行兜底
+     */
+    bool RequestFrame(const FrameCallback &callback);
+
+ private:
+    KRVSyncDispatcher();
+    static void OnVSync(long long timestamp, void *data);
+
+    std::mutex mutex_;
+    std::vector<FrameCallback> callbacks_;
+    bool frame_requested_ = false;
+    OH_NativeVSync *native_vsync_ = nullptr;
+};
+
+#endif  // CORE_RENDER_OHOS_KRVSYNCDISPATCHER_H
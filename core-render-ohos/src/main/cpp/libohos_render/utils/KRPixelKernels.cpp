@@ -0,0 +1,497 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRPixelKernels.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define KR_PIXEL_KERNELS_NEON 1
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define KR_PIXEL_KERNELS_ARM_CRC32 1
+#endif
+#elif defined(__SSE2__)
+#include <immintrin.h>
+#define KR_PIXEL_KERNELS_SSE2 1
+#if defined(__GNUC__)
+#define KR_PIXEL_KERNELS_AVX2 1
+#endif
+#endif
+
+// 向量实现逐条执行乘、加，标量实现也不能被编译器合并为 FMA，否则两者舍入不同
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#endif
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// CRC32
+// ---------------------------------------------------------------------------
+using Crc32Tables = std::array<std::array<uint32_t, 256>, 8>;
+
+const Crc32Tables &GetCrc32Tables() {
+    static const Crc32Tables tables = [] {
+        Crc32Tables t;
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (uint32_t k = 0; k < 8; ++k) {
+                c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
+            }
+            t[0][i] = c;
+        }
+        for (uint32_t i = 0; i < 256; ++i) {
+            for (size_t k = 1; k < t.size(); ++k) {
+                t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xFF];
+            }
+        }
+        return t;
+    }();
+    return tables;
+}
+
+#if KR_PIXEL_KERNELS_ARM_CRC32
+uint32_t Crc32Arm(uint32_t state, const uint8_t *data, size_t length) {
+    for (; length >= 8; length -= 8, data += 8) {
+        uint64_t value;
+        memcpy(&value, data, 8);
+        state = __crc32d(state, value);
+    }
+    for (; length > 0; --length, ++data) {
+        state = __crc32b(state, *data);
+    }
+    return state;
+}
+#else
+// slice-by-8：每次查 8 张表处理 8 字节，state 为未取反的内部状态
+uint32_t Crc32SliceBy8(uint32_t state, const uint8_t *data, size_t length) {
+    const auto &t = GetCrc32Tables();
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    for (; length >= 8; length -= 8, data += 8) {
+        uint32_t one;
+        uint32_t two;
+        memcpy(&one, data, 4);
+        memcpy(&two, data + 4, 4);
+        one ^= state;
+        state = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24] ^
+                t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24];
+    }
+#endif
+    for (; length > 0; --length, ++data) {
+        state = t[0][(state ^ *data) & 0xFF] ^ (state >> 8);
+    }
+    return state;
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// 标量参考实现
+// ---------------------------------------------------------------------------
+inline void BlendOverPixel(uint8_t *dst, const uint8_t *src) {
+    float srcAlpha = src[3] / 255.0f;
+    float dstAlpha = dst[3] / 255.0f;
+    float srcInverse = 1 - srcAlpha;
+    float dstWeight = dstAlpha * srcInverse;
+    float outAlpha = srcAlpha + dstWeight;
+    if (outAlpha == 0) {
+        memset(dst, 0, 4);
+        return;
+    }
+    for (int c = 0; c < 3; ++c) {
+        float s = src[c] * srcAlpha;
+        float d = dst[c] * dstAlpha;
+        d = d * srcInverse;
+        dst[c] = static_cast<uint8_t>((s + d) / outAlpha);
+    }
+    dst[3] = static_cast<uint8_t>(outAlpha * 255);
+}
+
+inline void PremultiplyPixel(uint8_t *dst, const uint8_t *src) {
+    uint32_t a = src[3];
+    dst[0] = static_cast<uint8_t>((src[0] * a + 127) / 255);
+    dst[1] = static_cast<uint8_t>((src[1] * a + 127) / 255);
+    dst[2] = static_cast<uint8_t>((src[2] * a + 127) / 255);
+    dst[3] = static_cast<uint8_t>(a);
+}
+
+inline void UnpremultiplyPixel(uint8_t *dst, const uint8_t *src) {
+    uint32_t a = src[3];
+    if (a == 0) {
+        memset(dst, 0, 4);
+        return;
+    }
+    dst[0] = static_cast<uint8_t>(std::min<uint32_t>(255, (src[0] * 255 + a / 2) / a));
+    dst[1] = static_cast<uint8_t>(std::min<uint32_t>(255, (src[1] * 255 + a / 2) / a));
+    dst[2] = static_cast<uint8_t>(std::min<uint32_t>(255, (src[2] * 255 + a / 2) / a));
+    dst[3] = static_cast<uint8_t>(a);
+}
+
+// ---------------------------------------------------------------------------
+// NEON（aarch64）
+// ---------------------------------------------------------------------------
+#if KR_PIXEL_KERNELS_NEON
+inline float32x4_t NeonChannel(uint32x4_t pixels, int shift) {
+    uint32x4_t mask = vdupq_n_u32(0xFF);
+    switch (shift) {
+        case 8:
+            return vcvtq_f32_u32(vandq_u32(vshrq_n_u32(pixels, 8), mask));
+        case 16:
+            return vcvtq_f32_u32(vandq_u32(vshrq_n_u32(pixels, 16), mask));
+        default:
+            return vcvtq_f32_u32(vandq_u32(pixels, mask));
+    }
+}
+
+// 每次 4 像素，返回已处理的像素数
+size_t BlendOverNeon(uint8_t *dst, const uint8_t *src, size_t count) {
+    const float32x4_t k255 = vdupq_n_f32(255.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        uint32x4_t s = vreinterpretq_u32_u8(vld1q_u8(src + i * 4));
+        uint32x4_t d = vreinterpretq_u32_u8(vld1q_u8(dst + i * 4));
+        float32x4_t srcAlpha = vdivq_f32(vcvtq_f32_u32(vshrq_n_u32(s, 24)), k255);
+        float32x4_t dstAlpha = vdivq_f32(vcvtq_f32_u32(vshrq_n_u32(d, 24)), k255);
+        float32x4_t srcInverse = vsubq_f32(one, srcAlpha);
+        float32x4_t outAlpha = vaddq_f32(srcAlpha, vmulq_f32(dstAlpha, srcInverse));
+        uint32x4_t out = vshlq_n_u32(vcvtq_u32_f32(vmulq_f32(outAlpha, k255)), 24);
+        for (int shift = 0; shift < 24; shift += 8) {
+            float32x4_t sc = vmulq_f32(NeonChannel(s, shift), srcAlpha);
+            float32x4_t dc = vmulq_f32(vmulq_f32(NeonChannel(d, shift), dstAlpha), srcInverse);
+            uint32x4_t c = vcvtq_u32_f32(vdivq_f32(vaddq_f32(sc, dc), outAlpha));
+            out = vorrq_u32(out, vshlq_u32(c, vdupq_n_s32(shift)));
+        }
+        out = vbicq_u32(out, vceqq_f32(outAlpha, vdupq_n_f32(0)));
+        vst1q_u8(dst + i * 4, vreinterpretq_u8_u32(out));
+    }
+    return i;
+}
+
+inline uint8x16_t NeonPremultiplyChannel(uint8x16_t c, uint8x16_t a) {
+    uint16x8_t lo = vmull_u8(vget_low_u8(c), vget_low_u8(a));
+    uint16x8_t hi = vmull_u8(vget_high_u8(c), vget_high_u8(a));
+    // (t + ((t + 128) >> 8) + 128) >> 8 == round(t / 255)
+    lo = vrsraq_n_u16(lo, lo, 8);
+    hi = vrsraq_n_u16(hi, hi, 8);
+    return vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8));
+}
+
+// 每次 16 像素
+size_t PremultiplyNeon(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        uint8x16x4_t px = vld4q_u8(src + i * 4);
+        px.val[0] = NeonPremultiplyChannel(px.val[0], px.val[3]);
+        px.val[1] = NeonPremultiplyChannel(px.val[1], px.val[3]);
+        px.val[2] = NeonPremultiplyChannel(px.val[2], px.val[3]);
+        vst4q_u8(dst + i * 4, px);
+    }
+    return i;
+}
+
+// 每次 4 像素；分子为不超过 65152 的整数，单精度除法后截断与整数除法结果一致
+size_t UnpremultiplyNeon(uint8_t *dst, const uint8_t *src, size_t count) {
+    const float32x4_t k255 = vdupq_n_f32(255.0f);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        uint32x4_t s = vreinterpretq_u32_u8(vld1q_u8(src + i * 4));
+        uint32x4_t alpha = vshrq_n_u32(s, 24);
+        float32x4_t a = vcvtq_f32_u32(alpha);
+        float32x4_t half = vcvtq_f32_u32(vshrq_n_u32(alpha, 1));
+        uint32x4_t out = vandq_u32(s, vdupq_n_u32(0xFF000000));
+        for (int shift = 0; shift < 24; shift += 8) {
+            float32x4_t q = vdivq_f32(vaddq_f32(vmulq_f32(NeonChannel(s, shift), k255), half), a);
+            uint32x4_t c = vcvtq_u32_f32(vminq_f32(q, k255));
+            out = vorrq_u32(out, vshlq_u32(c, vdupq_n_s32(shift)));
+        }
+        out = vbicq_u32(out, vceqq_u32(alpha, vdupq_n_u32(0)));
+        vst1q_u8(dst + i * 4, vreinterpretq_u8_u32(out));
+    }
+    return i;
+}
+#endif  // KR_PIXEL_KERNELS_NEON
+
+// ---------------------------------------------------------------------------
+// SSE2 / AVX2（x86_64）
+// ---------------------------------------------------------------------------
+#if KR_PIXEL_KERNELS_SSE2
+inline __m128 SseChannel(__m128i pixels, int shift) {
+    return _mm_cvtepi32_ps(_mm_and_si128(_mm_srl_epi32(pixels, _mm_cvtsi32_si128(shift)), _mm_set1_epi32(0xFF)));
+}
+
+size_t BlendOverSse2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m128 k255 = _mm_set1_ps(255.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 4));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i * 4));
+        __m128 srcAlpha = _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(s, 24)), k255);
+        __m128 dstAlpha = _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(d, 24)), k255);
+        __m128 srcInverse = _mm_sub_ps(one, srcAlpha);
+        __m128 outAlpha = _mm_add_ps(srcAlpha, _mm_mul_ps(dstAlpha, srcInverse));
+        __m128i out = _mm_slli_epi32(_mm_cvttps_epi32(_mm_mul_ps(outAlpha, k255)), 24);
+        for (int shift = 0; shift < 24; shift += 8) {
+            __m128 sc = _mm_mul_ps(SseChannel(s, shift), srcAlpha);
+            __m128 dc = _mm_mul_ps(_mm_mul_ps(SseChannel(d, shift), dstAlpha), srcInverse);
+            __m128i c = _mm_cvttps_epi32(_mm_div_ps(_mm_add_ps(sc, dc), outAlpha));
+            out = _mm_or_si128(out, _mm_sll_epi32(c, _mm_cvtsi32_si128(shift)));
+        }
+        out = _mm_andnot_si128(_mm_castps_si128(_mm_cmpeq_ps(outAlpha, _mm_setzero_ps())), out);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 4), out);
+    }
+    return i;
+}
+
+// 两个像素展开为 8 个 16 位通道，乘以 (a, a, a, 255) 后按 round(t / 255) 收缩
+inline __m128i SsePremultiply16(__m128i v) {
+    const __m128i rgbMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alphaLane = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i m = _mm_or_si128(_mm_and_si128(a, rgbMask), alphaLane);
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(v, m), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+size_t PremultiplySse2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 4));
+        __m128i lo = SsePremultiply16(_mm_unpacklo_epi8(px, zero));
+        __m128i hi = SsePremultiply16(_mm_unpackhi_epi8(px, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 4), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+size_t UnpremultiplySse2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m128 k255 = _mm_set1_ps(255.0f);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 4));
+        __m128i alpha = _mm_srli_epi32(s, 24);
+        __m128 a = _mm_cvtepi32_ps(alpha);
+        __m128 half = _mm_cvtepi32_ps(_mm_srli_epi32(alpha, 1));
+        __m128i out = _mm_slli_epi32(alpha, 24);
+        for (int shift = 0; shift < 24; shift += 8) {
+            __m128 q = _mm_div_ps(_mm_add_ps(_mm_mul_ps(SseChannel(s, shift), k255), half), a);
+            __m128i c = _mm_cvttps_epi32(_mm_min_ps(q, k255));
+            out = _mm_or_si128(out, _mm_sll_epi32(c, _mm_cvtsi32_si128(shift)));
+        }
+        out = _mm_andnot_si128(_mm_cmpeq_epi32(alpha, _mm_setzero_si128()), out);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 4), out);
+    }
+    return i;
+}
+#endif  // KR_PIXEL_KERNELS_SSE2
+
+#if KR_PIXEL_KERNELS_AVX2
+bool HasAvx2() {
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    return has_avx2;
+}
+
+__attribute__((target("avx2"))) inline __m256 Avx2Channel(__m256i pixels, int shift) {
+    return _mm256_cvtepi32_ps(
+        _mm256_and_si256(_mm256_srl_epi32(pixels, _mm_cvtsi32_si128(shift)), _mm256_set1_epi32(0xFF)));
+}
+
+__attribute__((target("avx2"))) size_t BlendOverAvx2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m256 k255 = _mm256_set1_ps(255.0f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i * 4));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i * 4));
+        __m256 srcAlpha = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(s, 24)), k255);
+        __m256 dstAlpha = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(d, 24)), k255);
+        __m256 srcInverse = _mm256_sub_ps(one, srcAlpha);
+        __m256 outAlpha = _mm256_add_ps(srcAlpha, _mm256_mul_ps(dstAlpha, srcInverse));
+        __m256i out = _mm256_slli_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(outAlpha, k255)), 24);
+        for (int shift = 0; shift < 24; shift += 8) {
+            __m256 sc = _mm256_mul_ps(Avx2Channel(s, shift), srcAlpha);
+            __m256 dc = _mm256_mul_ps(_mm256_mul_ps(Avx2Channel(d, shift), dstAlpha), srcInverse);
+            __m256i c = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_add_ps(sc, dc), outAlpha));
+            out = _mm256_or_si256(out, _mm256_sll_epi32(c, _mm_cvtsi32_si128(shift)));
+        }
+        out = _mm256_andnot_si256(_mm256_castps_si256(_mm256_cmp_ps(outAlpha, _mm256_setzero_ps(), _CMP_EQ_OQ)), out);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 4), out);
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) inline __m256i Avx2Premultiply16(__m256i v) {
+    const __m256i rgbMask = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1);
+    const __m256i alphaLane = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+    __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m256i m = _mm256_or_si256(_mm256_and_si256(a, rgbMask), alphaLane);
+    __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(v, m), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+// unpack/pack 都在 128 位通道内进行，像素顺序保持不变
+__attribute__((target("avx2"))) size_t PremultiplyAvx2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i px = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i * 4));
+        __m256i lo = Avx2Premultiply16(_mm256_unpacklo_epi8(px, zero));
+        __m256i hi = Avx2Premultiply16(_mm256_unpackhi_epi8(px, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 4), _mm256_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) size_t UnpremultiplyAvx2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m256 k255 = _mm256_set1_ps(255.0f);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i * 4));
+        __m256i alpha = _mm256_srli_epi32(s, 24);
+        __m256 a = _mm256_cvtepi32_ps(alpha);
+        __m256 half = _mm256_cvtepi32_ps(_mm256_srli_epi32(alpha, 1));
+        __m256i out = _mm256_slli_epi32(alpha, 24);
+        for (int shift = 0; shift < 24; shift += 8) {
+            __m256 q = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(Avx2Channel(s, shift), k255), half), a);
+            __m256i c = _mm256_cvttps_epi32(_mm256_min_ps(q, k255));
+            out = _mm256_or_si256(out, _mm256_sll_epi32(c, _mm_cvtsi32_si128(shift)));
+        }
+        out = _mm256_andnot_si256(_mm256_cmpeq_epi32(alpha, _mm256_setzero_si256()), out);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 4), out);
+    }
+    return i;
+}
+#endif  // KR_PIXEL_KERNELS_AVX2
+
+}  // namespace
+
+const char *KRPixelKernels::Backend() {
+#if KR_PIXEL_KERNELS_NEON
+    return "neon";
+#elif KR_PIXEL_KERNELS_SSE2
+#if KR_PIXEL_KERNELS_AVX2
+    if (HasAvx2()) {
+        return "avx2";
+    }
+#endif
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+void KRPixelKernels::BlendOver(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t done = 0;
+#if KR_PIXEL_KERNELS_NEON
+    done = BlendOverNeon(dst, src, count);
+#elif KR_PIXEL_KERNELS_SSE2
+#if KR_PIXEL_KERNELS_AVX2
+    if (HasAvx2()) {
+        done = BlendOverAvx2(dst, src, count);
+    }
+#endif
+    done += BlendOverSse2(dst + done * 4, src + done * 4, count - done);
+#endif
+    BlendOverScalar(dst + done * 4, src + done * 4, count - done);
+}
+
+void KRPixelKernels::BlendOverScalar(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; ++i, src += 4, dst += 4) {
+        BlendOverPixel(dst, src);
+    }
+}
+
+void KRPixelKernels::CopyPixels(uint8_t *dst, const uint8_t *src, size_t count) {
+    // libc 的 memcpy 已按平台使用向量加载/存储
+    memcpy(dst, src, count * 4);
+}
+
+void KRPixelKernels::ClearRect(uint8_t *dst, size_t stride, int width, int height) {
+    if (width <= 0) {
+        return;
+    }
+    size_t row_bytes = static_cast<size_t>(width) * 4;
+    if (row_bytes == stride) {
+        memset(dst, 0, row_bytes * std::max(height, 0));
+        return;
+    }
+    for (int y = 0; y < height; ++y, dst += stride) {
+        memset(dst, 0, row_bytes);
+    }
+}
+
+void KRPixelKernels::Premultiply(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t done = 0;
+#if KR_PIXEL_KERNELS_NEON
+    done = PremultiplyNeon(dst, src, count);
+#elif KR_PIXEL_KERNELS_SSE2
+#if KR_PIXEL_KERNELS_AVX2
+    if (HasAvx2()) {
+        done = PremultiplyAvx2(dst, src, count);
+    }
+#endif
+    done += PremultiplySse2(dst + done * 4, src + done * 4, count - done);
+#endif
+    PremultiplyScalar(dst + done * 4, src + done * 4, count - done);
+}
+
+void KRPixelKernels::PremultiplyScalar(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; ++i, src += 4, dst += 4) {
+        PremultiplyPixel(dst, src);
+    }
+}
+
+void KRPixelKernels::Unpremultiply(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t done = 0;
+#if KR_PIXEL_KERNELS_NEON
+    done = UnpremultiplyNeon(dst, src, count);
+#elif KR_PIXEL_KERNELS_SSE2
+#if KR_PIXEL_KERNELS_AVX2
+    if (HasAvx2()) {
+        done = UnpremultiplyAvx2(dst, src, count);
+    }
+#endif
+    done += UnpremultiplySse2(dst + done * 4, src + done * 4, count - done);
+#endif
+    UnpremultiplyScalar(dst + done * 4, src + done * 4, count - done);
+}
+
+void KRPixelKernels::UnpremultiplyScalar(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; ++i, src += 4, dst += 4) {
+        UnpremultiplyPixel(dst, src);
+    }
+}
+
+uint32_t KRPixelKernels::Crc32(const uint8_t *data, size_t length, uint32_t crc) {
+#if KR_PIXEL_KERNELS_ARM_CRC32
+    return ~Crc32Arm(~crc, data, length);
+#else
+    return ~Crc32SliceBy8(~crc, data, length);
+#endif
+}
+
+uint32_t KRPixelKernels::Crc32Scalar(const uint8_t *data, size_t length, uint32_t crc) {
+    const auto &table = GetCrc32Tables()[0];
+    uint32_t state = ~crc;
+    for (size_t i = 0; i < length; ++i) {
+        state = (state >> 8) ^ table[(state ^ data[i]) & 0xFF];
+    }
+    return ~state;
+}
@@ -0,0 +1,69 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRPIXELKERNELS_H
+#define CORE_RENDER_OHOS_KRPIXELKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * RGBA_8888 像素处理与 CRC32 内核
+ * aarch64 使用 NEON（CRC32 在支持时使用硬件指令），x86_64 使用 SSE2 并在运行时检测 AVX2，其余平台走标量实现。
+ * 向量实现与 *Scalar 标量参考实现逐字节一致，标量实现即结果定义。
+ */
+class KRPixelKernels {
+ public:
+    /**
+     * 当前使用的向量实现："neon" / "avx2" / "sse2" / "scalar"
+     */
+    static const char *Backend();
+
+    /**
+     * APNG_BLEND_OP_OVER：src 以非预乘 alpha 叠加到 dst 上，count 为像素数
+     */
+    static void BlendOver(uint8_t *dst, const uint8_t *src, size_t count);
+    static void BlendOverScalar(uint8_t *dst, const uint8_t *src, size_t count);
+
+    /**
+     * APNG_BLEND_OP_SOURCE：src 覆盖 dst
+     */
+    static void CopyPixels(uint8_t *dst, const uint8_t *src, size_t count);
+
+    /**
+     * 将 dst 起始、行跨度为 stride 字节的 width * height 区域清为透明
+     */
+    static void ClearRect(uint8_t *dst, size_t stride, int width, int height);
+
+    /**
+     * 颜色通道乘以 alpha：c = round(c * a / 255)，dst 可与 src 相同
+     */
+    static void Premultiply(uint8_t *dst, const uint8_t *src, size_t count);
+    static void PremultiplyScalar(uint8_t *dst, const uint8_t *src, size_t count);
+
+    /**
+     * 预乘的逆运算：c = min(255, (c * 255 + a / 2) / a)，alpha 为 0 时整个像素清零，dst 可与 src 相同
+     */
+    static void Unpremultiply(uint8_t *dst, const uint8_t *src, size_t count);
+    static void UnpremultiplyScalar(uint8_t *dst, const uint8_t *src, size_t count);
+
+    /**
+     * CRC-32（PNG/zlib 多项式），crc 为前一段数据的结果，可分段累加
+     */
+    static uint32_t Crc32(const uint8_t *data, size_t length, uint32_t crc = 0);
+    static uint32_t Crc32Scalar(const uint8_t *data, size_t length, uint32_t crc = 0);
+};
+
+#endif  // CORE_RENDER_OHOS_KRPIXELKERNELS_H
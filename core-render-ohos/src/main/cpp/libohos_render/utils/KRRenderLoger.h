@@ -20,7 +20,14 @@
 #include <hilog/log.h>
 #include <sstream>
 #include <string>
+#include <vector>
 #include "libohos_render/adapter/KRRenderAdapterManager.h"
+#include "libohos_render/foundation/KRAsyncLogger.h"
+
+// 编译期最低日志级别，低于该级别的日志语句连同参数求值一起被裁掉（如 release 包定义为 LOG_INFO）
+#ifndef KR_LOG_MIN_LEVEL
+#define KR_LOG_MIN_LEVEL LOG_DEBUG
+#endif
 
 class KRRenderLog {
  public:
@@ -28,8 +35,8 @@ class KRRenderLog {
     KRRenderLog(LogLevel log_level, const std::string &tag) : log_level_(log_level), tag_(tag) {}
 
     ~KRRenderLog() {
-        stream_ << std::endl;
-        KRRenderAdapterManager::GetInstance().Log(log_level_, tag_, std::move(stream_.str()));
+        stream_ << '\n';
+        Logger().Log(log_level_, std::move(tag_), stream_.str());
     }
 
     template <typename T> KRRenderLog &operator<<(const T &value) {
@@ -37,18 +44,57 @@ class KRRenderLog {
         return *this;
     }
 
+    /**
+     * 编译期与运行期级别都满足才格式化
+     */
+    static bool IsEnabled(LogLevel log_level) {
+        return log_level >= KR_LOG_MIN_LEVEL && Logger().IsEnabled(log_level);
+    }
+
+    /**
+     * 运行期最低日志级别
+     */
+    static void SetMinLevel(int log_level) {
+        Logger().SetMinLevel(log_level);
+    }
+
+    /**
+     * 同步冲刷异步日志，页面销毁、异常上报前调用
+     */
+    static void Flush() {
+        Logger().Flush();
+    }
+
  private:
-    std::string tag_;
+    static KRAsyncLogger &Logger() {
+        static KRAsyncLogger &logger = [] () -> KRAsyncLogger & {
+            auto &instance = KRAsyncLogger::GetInstance();
+            instance.SetSink([](std::vector<KRLogRecord> &batch) {
+                auto &adapter_manager = KRRenderAdapterManager::GetInstance();
+                for (auto &record : batch) {
+                    adapter_manager.Log(static_cast<LogLevel>(KRLogSinkLevel(record.level)), record.tag,
+                                        record.message);
+                }
+            });
+            return instance;
+        }();
+        return logger;
+    }
+
     LogLevel log_level_;
-    std::stringstream stream_;
+    std::string tag_;
+    std::ostringstream stream_;
 };
 
-#define KR_LOG_INFO KRRenderLog(LOG_INFO)
-#define KR_LOG_DEBUG KRRenderLog(LOG_DEBUG)
-#define KR_LOG_ERROR KRRenderLog(LOG_ERROR)
+// 级别关闭时整条语句（包括 << 右侧的参数）都不会执行
+#define KR_LOG_IF_ENABLED(log_level) if (!KRRenderLog::IsEnabled(log_level)) {} else  // NOLINT
+
+#define KR_LOG_INFO KR_LOG_IF_ENABLED(LOG_INFO) KRRenderLog(LOG_INFO)
+#define KR_LOG_DEBUG KR_LOG_IF_ENABLED(LOG_DEBUG) KRRenderLog(LOG_DEBUG)
+#define KR_LOG_ERROR KR_LOG_IF_ENABLED(LOG_ERROR) KRRenderLog(LOG_ERROR)
 
-#define KR_LOG_INFO_WITH_TAG(tag) KRRenderLog(LOG_INFO, tag)
-#define KR_LOG_DEBUG_WITH_TAG(tag) KRRenderLog(LOG_DEBUG, tag)
-#define KR_LOG_ERROR_WITH_TAG(tag) KRRenderLog(LOG_ERROR, tag)
+#define KR_LOG_INFO_WITH_TAG(tag) KR_LOG_IF_ENABLED(LOG_INFO) KRRenderLog(LOG_INFO, tag)
+#define KR_LOG_DEBUG_WITH_TAG(tag) KR_LOG_IF_ENABLED(LOG_DEBUG) KRRenderLog(LOG_DEBUG, tag)
+#define KR_LOG_ERROR_WITH_TAG(tag) KR_LOG_IF_ENABLED(LOG_ERROR) KRRenderLog(LOG_ERROR, tag)
 
 #endif  // CORE_RENDER_OHOS_KRRENDERLOGER_H
@@ -15,6 +15,8 @@
 
 #include "NAPIUtil.h"
 
+#include <cstring>
+
 namespace kuikly {
 namespace util {
 
@@ -84,5 +86,33 @@ void GetNApiArgsStdString(const napi_env &env, const napi_value &value, std::str
     }
     result.append(buffer.data());
 }
+
+napi_status CreateNApiArrayBuffer(napi_env env, const std::shared_ptr<KRByteBuffer> &bytes, napi_value *result) {
+    auto size = bytes ? bytes->size() : 0;
+    void *buffer = nullptr;
+    auto status = napi_create_arraybuffer(env, size, &buffer, result);
+    if (status == napi_ok && size > 0) {
+        memcpy(buffer, bytes->data(), size);
+    }
+    return status;
+}
+
+napi_status TransferNApiArrayBuffer(napi_env env, std::shared_ptr<KRByteBuffer> &&bytes, napi_value *result) {
+    auto buffer = std::move(bytes);
+    if (buffer && buffer->size() >= kKRByteBufferZeroCopyThreshold) {
+        if (auto storage = KRByteBuffer::TakeStorage(buffer)) {
+            auto status = napi_create_external_arraybuffer(
+                env, storage->data(), storage->size(),
+                [](napi_env env, void *data, void *hint) { delete static_cast<std::vector<uint8_t> *>(hint); },
+                storage.get(), result);
+            if (status == napi_ok) {
+                storage.release();  // 由 finalizer 释放
+                return status;
+            }
+            buffer = KRByteBuffer::Adopt(std::move(*storage));
+        }
+    }
+    return CreateNApiArrayBuffer(env, buffer, result);
+}
 }  // namespace util
 }  // namespace kuikly
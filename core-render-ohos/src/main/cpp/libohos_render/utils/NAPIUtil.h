@@ -17,7 +17,9 @@
 #define CORE_RENDER_OHOS_NAPIUTIL_H
 
 #include <cstdint>
+#include <memory>
 #include <string>
+#include "libohos_render/foundation/type/KRByteBuffer.h"
 #include "napi/native_api.h"
 
 namespace kuikly {
@@ -37,6 +39,25 @@ std::string getNApiArgsStdString(napi_env env, napi_value value);
 
 void GetNApiArgsStdString(const napi_env &env, const napi_value &value, std::string &result);
 
+/**
+ * 创建 ArkTS 侧 ArrayBuffer 并拷贝 bytes 的数据（一次memcpy）
+ * ArkTS 可随意写入 ArrayBuffer，不能直接引用可能被多处共享的 native 内存
+ * @param env napi环境
+ * @param bytes 二进制数据
+ * @param result 创建的 ArrayBuffer
+ */
+napi_status CreateNApiArrayBuffer(napi_env env, const std::shared_ptr<KRByteBuffer> &bytes, napi_value *result);
+
+/**
+ * 把 bytes 转移给 ArkTS 侧 ArrayBuffer：bytes 为唯一引用的自有内存且不小于 kKRByteBufferZeroCopyThreshold 时
+ * 不拷贝，以外部 ArrayBuffer 直接使用其内存，内存归 ArrayBuffer 的 finalizer 所有，native 侧不再持有；
+ * 否则同 CreateNApiArrayBuffer
+ * @param env napi环境
+ * @param bytes 二进制数据，调用后不可再使用
+ * @param result 创建的 ArrayBuffer
+ */
+napi_status TransferNApiArrayBuffer(napi_env env, std::shared_ptr<KRByteBuffer> &&bytes, napi_value *result);
+
 }  // namespace util
 }  // namespace kuikly
 
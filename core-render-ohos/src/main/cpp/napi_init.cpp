@@ -16,6 +16,7 @@
 #include <arkui/native_node_napi.h>
 #include <cstdint>
 #include "libohos_render/expand/modules/back_press/KRBackPressModule.h"
+#include "libohos_render/foundation/KRCacheBudgetCoordinator.h"
 #include "libohos_render/foundation/KRCallbackData.h"
 #include "libohos_render/manager/KRArkTSManager.h"
 #include "libohos_render/manager/KRRenderManager.h"
@@ -99,6 +100,26 @@ static napi_value OnDestroyRenderView(napi_env env, napi_callback_info info) {
     }
     std::string instanceId = kuikly::util::getNApiArgsStdString(env, args[0]);
     KRRenderManager::GetInstance().DestroyRenderView(instanceId);
+    // 页面销毁后其图片只剩缓存引用，检查全局缓存预算
+    KRCacheBudgetCoordinator::GetInstance().EnforceBudget();
+    // 页面销毁前的日志同步冲刷，避免随后进程被回收时丢失
+    KRRenderLog::Flush();
+    return 0;
+}
+
+// 系统内存级别回调，按级别裁剪各缓存
+static napi_value OnMemoryLevel(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1] = {nullptr};
+    if (napi_ok != napi_get_cb_info(env, info, &argc, args, nullptr, nullptr)) {
+        napi_throw_error(env, "-1000", "napi_get_cb_info error");
+        return 0;
+    }
+    int32_t level = kuikly::util::getNApiArgsInt(env, args[0]);
+    auto &coordinator = KRCacheBudgetCoordinator::GetInstance();
+    auto trimmed = coordinator.Trim(KRCacheBudgetCoordinator::LevelForSystemMemoryLevel(level));
+    KR_LOG_INFO << "memory level: " << level << ", trimmed " << trimmed / 1024 << "KB, residency: "
+                << KRCacheBudgetCoordinator::FormatReport(coordinator.Report());
     return 0;
 }
 
@@ -231,6 +252,7 @@ static napi_value Init(napi_env env, napi_value exports) {
         {"OnLaunchStart", nullptr, OnLaunchStart, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"createNativeRoot", nullptr, CreateNativeRoot, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"isBackPressConsumed", nullptr, isBackPressConsumed, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"onMemoryLevel", nullptr, OnMemoryLevel, nullptr, nullptr, nullptr, napi_default, nullptr},
     };
     napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc);
     KRRenderManager::GetInstance().Export(env, exports);  // 尝试注册RenderView
@@ -79,3 +79,9 @@ export const sendEventSync: (
 export const createNativeRoot: (content: Object, instanceId: string) => void;
 
 export const isBackPressConsumed: (instanceId: string, sendTime: number) => number;
+
+/**
+ * 系统内存级别变化通知到Native层，按级别裁剪渲染缓存。
+ * @param level AbilityConstant.MemoryLevel
+ */
+export const onMemoryLevel: (level: number) => void
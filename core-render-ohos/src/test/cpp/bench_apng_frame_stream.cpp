@@ -0,0 +1,555 @@
+// 测试+基准: bench_apng_frame_stream
+//
+// 目标:
+//   验证 APNGFrameStream (APNG 流式按需合成) 的正确性与内存上界:
+//   1) 旧实现: 解析时逐帧解码并合成整张画布, 每帧保存一份 width * height * 4 的 RGBA pixelmap,
+//      内存随帧数线性增长;
+//   2) 新实现: APNG 只保存每帧压缩态的 PNG 数据, 播放视图按需解码合成, 像素缓冲固定为
+//      画布 + 备份 + 解码缓冲 + 小输出帧环, 预取帧受单动画与全局预算约束。
+//
+// 说明:
+//   ApngParser.h / APNGStructs / APNGFrameStream / KRPixelKernels 只依赖标准库, 这里直接编译生产实现。
+//   测试用 APNG 由 makeChunkBytes 拼装真实的 IHDR/acTL/fcTL/IDAT/fdAT/IEND 块, 经生产 parseAPNG 解析;
+//   帧数据不做 zlib 压缩, 直接以原始 RGBA 作为 IDAT 内容, FakeDecode 读取 IHDR 宽高并拼接 IDAT 代替平台 PNG 解码。
+//   EagerDecode 照搬改造前 APNG::DidAddFrame / HandleFrameBlendOp / HandlePostFrameDisposeOp 的合成逻辑。
+//
+// 编译(macOS/Linux 均可):
+//   M=../../main/cpp
+//   clang++ -std=c++17 -O2 -pthread -I $M bench_apng_frame_stream.cpp
+//       $M/libohos_render/expand/components/apng/APNGFrameStream.cpp
+//       $M/libohos_render/expand/components/apng/APNGStructs.cpp $M/libohos_render/utils/KRPixelKernels.cpp
+//       -o bench_apng_frame_stream
+//   运行:
+//   ./bench_apng_frame_stream
+//
+// 验证项:
+//   A. dispose_op none/background 与 blend_op source/over (含局部区域) 的合成结果与旧实现逐字节一致,
+//      覆盖同步读取、同线程预取、工作线程预取、循环播放与非顺序读取
+//   B. dispose_op previous 按 APNG 规范恢复到合成前的画布 (旧实现从未恢复, 与规范参考实现比对)
+//   C. 单动画预算与全局预算限制预取帧数, 预算不足时仍能同步合成; Trim/析构后全局预算归零
+//   D. 120 帧 400x400 动画: 像素内存与帧数无关, 每帧解码一次
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/expand/components/apng/APNGFrameStream.h"
+#include "libohos_render/expand/components/apng/ApngParser.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+// ---------------------------------------------------------------------------
+// 测试 APNG 构造
+// ---------------------------------------------------------------------------
+struct FrameSpec {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+    int dispose = 0;
+    int blend = 0;
+    int delay_num = 5;  // 单位 1/100 s
+    std::vector<uint8_t> rgba;
+};
+
+static uint32_t g_seed = 12345;
+static uint32_t NextRand() {
+    g_seed = g_seed * 1103515245u + 12345u;
+    return g_seed >> 8;
+}
+
+static std::vector<uint8_t> RandomPixels(int width, int height) {
+    std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4);
+    for (size_t i = 0; i < rgba.size(); i += 4) {
+        rgba[i + 0] = NextRand() & 0xFF;
+        rgba[i + 1] = NextRand() & 0xFF;
+        rgba[i + 2] = NextRand() & 0xFF;
+        // alpha 集中覆盖 0 / 255 与半透明
+        uint32_t r = NextRand() % 4;
+        rgba[i + 3] = r == 0 ? 0 : (r == 1 ? 255 : NextRand() & 0xFF);
+    }
+    return rgba;
+}
+
+static void AppendBytes(std::vector<uint8_t> &out, const std::vector<uint8_t> &bytes) {
+    out.insert(out.end(), bytes.begin(), bytes.end());
+}
+
+static void PutU32(std::vector<uint8_t> &out, uint32_t v) {
+    AppendBytes(out, makeDWordArray(v));
+}
+
+static void PutU16(std::vector<uint8_t> &out, uint16_t v) {
+    out.push_back(v >> 8);
+    out.push_back(v & 0xFF);
+}
+
+// 帧像素按行分成两段写入多个 IDAT/fdAT 块，覆盖 dataParts 拼接
+static std::vector<uint8_t> MakeAPNG(int width, int height, const std::vector<FrameSpec> &frames) {
+    std::vector<uint8_t> out = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
+    std::vector<uint8_t> ihdr;
+    PutU32(ihdr, width);
+    PutU32(ihdr, height);
+    ihdr.insert(ihdr.end(), {8, 6, 0, 0, 0});
+    AppendBytes(out, makeChunkBytes("IHDR", ihdr));
+    std::vector<uint8_t> actl;
+    PutU32(actl, frames.size());
+    PutU32(actl, 0);
+    AppendBytes(out, makeChunkBytes("acTL", actl));
+    uint32_t seq = 0;
+    for (size_t i = 0; i < frames.size(); i++) {
+        const auto &f = frames[i];
+        std::vector<uint8_t> fctl;
+        PutU32(fctl, seq++);
+        PutU32(fctl, f.width);
+        PutU32(fctl, f.height);
+        PutU32(fctl, f.x);
+        PutU32(fctl, f.y);
+        PutU16(fctl, f.delay_num);
+        PutU16(fctl, 100);
+        fctl.push_back(f.dispose);
+        fctl.push_back(f.blend);
+        AppendBytes(out, makeChunkBytes("fcTL", fctl));
+        size_t half = static_cast<size_t>(f.height / 2) * f.width * 4;
+        std::vector<std::vector<uint8_t>> parts = {
+            std::vector<uint8_t>(f.rgba.begin(), f.rgba.begin() + half),
+            std::vector<uint8_t>(f.rgba.begin() + half, f.rgba.end()),
+        };
+        for (auto &part : parts) {
+            if (i == 0) {
+                AppendBytes(out, makeChunkBytes("IDAT", part));
+            } else {
+                std::vector<uint8_t> fdat;
+                PutU32(fdat, seq++);
+                AppendBytes(fdat, part);
+                AppendBytes(out, makeChunkBytes("fdAT", fdat));
+            }
+        }
+    }
+    AppendBytes(out, makeChunkBytes("IEND", {}));
+    return out;
+}
+
+static std::shared_ptr<APNG> Parse(std::vector<uint8_t> bytes) {
+    std::shared_ptr<APNG> result;
+    int calls = 0;
+    parseAPNG(bytes, [&result, &calls](std::shared_ptr<APNG> apng) {
+        result = apng;
+        calls++;
+    });
+    return calls == 1 ? result : nullptr;
+}
+
+// 代替平台 PNG 解码：读取 IHDR 宽高，拼接 IDAT 内容即为 RGBA
+static bool FakeDecode(const std::vector<uint8_t> &png, int width, int height, std::vector<uint8_t> &rgba) {
+    if (png.size() < 8) {
+        return false;
+    }
+    std::vector<uint8_t> bytes(png);
+    DataView dv(bytes);
+    size_t off = 8;
+    int w = 0;
+    int h = 0;
+    rgba.clear();
+    while (off + 12 <= bytes.size()) {
+        size_t length = dv.getUint32(off);
+        std::string type = readString(bytes, off + 4, 4);
+        if (type == "IHDR") {
+            w = dv.getUint32(off + 8);
+            h = dv.getUint32(off + 12);
+        } else if (type == "IDAT") {
+            rgba.insert(rgba.end(), bytes.begin() + off + 8, bytes.begin() + off + 8 + length);
+        }
+        off += 12 + length;
+    }
+    return w == width && h == height && rgba.size() == static_cast<size_t>(w) * h * 4;
+}
+
+// ---------------------------------------------------------------------------
+// 参考实现
+// ---------------------------------------------------------------------------
+static void ReferenceBlend(std::vector<uint8_t> &canvas, int width, const Frame &frame,
+                           const std::vector<uint8_t> &frameBuffer) {
+    for (int y = 0; y < frame.height; ++y) {
+        for (int x = 0; x < frame.width; ++x) {
+            int srcIdx = (y * frame.width + x) * 4;
+            int dstIdx = ((y + frame.top) * width + (x + frame.left)) * 4;
+            if (frame.blendOp == 0) {
+                memcpy(&canvas[dstIdx], &frameBuffer[srcIdx], 4);
+            } else if (frame.blendOp == 1) {
+                uint8_t srcR = frameBuffer[srcIdx + 0];
+                uint8_t srcG = frameBuffer[srcIdx + 1];
+                uint8_t srcB = frameBuffer[srcIdx + 2];
+                uint8_t srcA = frameBuffer[srcIdx + 3];
+                uint8_t dstR = canvas[dstIdx + 0];
+                uint8_t dstG = canvas[dstIdx + 1];
+                uint8_t dstB = canvas[dstIdx + 2];
+                uint8_t dstA = canvas[dstIdx + 3];
+                float srcAlpha = srcA / 255.0f;
+                float dstAlpha = dstA / 255.0f;
+                float outAlpha = srcAlpha + dstAlpha * (1 - srcAlpha);
+                if (outAlpha == 0) {
+                    memset(&canvas[dstIdx], 0, 4);
+                } else {
+                    canvas[dstIdx + 0] = static_cast<uint8_t>((srcR * srcAlpha + dstR * dstAlpha * (1 - srcAlpha)) / outAlpha);
+                    canvas[dstIdx + 1] = static_cast<uint8_t>((srcG * srcAlpha + dstG * dstAlpha * (1 - srcAlpha)) / outAlpha);
+                    canvas[dstIdx + 2] = static_cast<uint8_t>((srcB * srcAlpha + dstB * dstAlpha * (1 - srcAlpha)) / outAlpha);
+                    canvas[dstIdx + 3] = static_cast<uint8_t>(outAlpha * 255);
+                }
+            }
+        }
+    }
+}
+
+static void ReferenceClear(std::vector<uint8_t> &canvas, int width, const Frame &frame) {
+    for (int y = 0; y < frame.height; ++y) {
+        memset(&canvas[((y + frame.top) * width + frame.left) * 4], 0, static_cast<size_t>(frame.width) * 4);
+    }
+}
+
+// 改造前的一次性全量解码（DidAddFrame），restore_previous 为 true 时按规范恢复 dispose_op previous
+static std::vector<std::vector<uint8_t>> EagerDecode(const APNG &apng, bool restore_previous) {
+    std::vector<std::vector<uint8_t>> outputs;
+    std::vector<uint8_t> canvas;
+    std::vector<uint8_t> previous;
+    bool hasFirstFullFrame = false;
+    for (const auto &frame : apng.frames) {
+        if (frame->width == 0 || frame->height == 0) {
+            continue;
+        }
+        std::vector<uint8_t> frameBuffer;
+        if (frame->width == apng.width && frame->height == apng.height && !hasFirstFullFrame) {
+            if (!FakeDecode(frame->data, frame->width, frame->height, frameBuffer)) {
+                continue;
+            }
+            hasFirstFullFrame = true;
+            outputs.push_back(frameBuffer);
+            canvas = frameBuffer;
+            previous.assign(canvas.size(), 0);
+        } else if (hasFirstFullFrame) {
+            if (frame->disposeOp == 2) {
+                previous = canvas;
+            }
+            if (FakeDecode(frame->data, frame->width, frame->height, frameBuffer)) {
+                ReferenceBlend(canvas, apng.width, *frame, frameBuffer);
+                outputs.push_back(canvas);
+            }
+        } else {
+            continue;
+        }
+        if (frame->disposeOp == 1) {
+            ReferenceClear(canvas, apng.width, *frame);
+        } else if (frame->disposeOp == 2 && restore_previous) {
+            canvas = previous;
+        }
+    }
+    return outputs;
+}
+
+// ---------------------------------------------------------------------------
+// 执行器
+// ---------------------------------------------------------------------------
+class WorkerThread {
+ public:
+    WorkerThread() : thread_([this] { Loop(); }) {}
+    ~WorkerThread() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        thread_.join();
+    }
+
+    void Post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    void Drain() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_cv_.wait(lock, [this] { return tasks_.empty() && !running_; });
+    }
+
+ private:
+    void Loop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            running_ = true;
+            lock.unlock();
+            task();
+            lock.lock();
+            running_ = false;
+            idle_cv_.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable idle_cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool running_ = false;
+    bool stop_ = false;
+    std::thread thread_;
+};
+
+static void InlineExecutor(std::function<void()> task) {
+    task();
+}
+
+// 模拟 APNGAnimateView::PlayNextFrame：读取当前帧，再预取下一帧
+static bool PlayAndCompare(APNGFrameStream &stream, const std::vector<std::vector<uint8_t>> &expected, int loops,
+                           WorkerThread *worker = nullptr) {
+    if (stream.FrameCount() != static_cast<int>(expected.size())) {
+        printf("  frame count %d != %zu\n", stream.FrameCount(), expected.size());
+        return false;
+    }
+    bool same = true;
+    for (int loop = 0; loop < loops; loop++) {
+        for (int i = 0; i < stream.FrameCount(); i++) {
+            bool ok = stream.ReadFrame(i, [&](const uint8_t *pixels, size_t size) {
+                if (size != expected[i].size() || memcmp(pixels, expected[i].data(), size) != 0) {
+                    printf("  mismatch at loop %d frame %d\n", loop, i);
+                    same = false;
+                }
+            });
+            same = same && ok;
+            stream.Prefetch((i + 1) % stream.FrameCount());
+            if (worker && i % 3 == 0) {
+                worker->Drain();
+            }
+        }
+    }
+    return same;
+}
+
+static std::shared_ptr<APNG> MakeMixedAPNG(int width, int height, int frame_count, bool with_previous) {
+    std::vector<FrameSpec> frames;
+    FrameSpec first;
+    first.width = width;
+    first.height = height;
+    first.rgba = RandomPixels(width, height);
+    frames.push_back(first);
+    for (int i = 1; i < frame_count; i++) {
+        FrameSpec f;
+        f.width = 1 + NextRand() % width;
+        f.height = 2 + NextRand() % (height - 1);
+        f.x = NextRand() % (width - f.width + 1);
+        f.y = NextRand() % (height - f.height + 1);
+        f.blend = NextRand() % 2;
+        f.dispose = with_previous ? NextRand() % 3 : NextRand() % 2;
+        f.delay_num = 1 + NextRand() % 10;
+        f.rgba = RandomPixels(f.width, f.height);
+        frames.push_back(f);
+    }
+    return Parse(MakeAPNG(width, height, frames));
+}
+
+// ---------------------------------------------------------------------------
+// 用例
+// ---------------------------------------------------------------------------
+static void TestEagerEquivalence() {
+    auto apng = MakeMixedAPNG(48, 32, 24, false);
+    CHECK("A", apng && apng->isAPNG && apng->frames.size() == 25);
+    if (!apng) {
+        return;
+    }
+    auto expected = EagerDecode(*apng, false);
+    CHECK("A", expected.size() == 24);
+
+    APNGFrameBudget budget(64 * 1024 * 1024);
+    APNGFrameStreamOptions options;
+    options.global_budget = &budget;
+    {
+        auto stream = APNGFrameStream::Create(apng, FakeDecode, nullptr, options);
+        CHECK("A", PlayAndCompare(*stream, expected, 2));
+        auto stats = stream->GetStats();
+        CHECK("A", stats.prefetch_hit == 0 && stats.decode_count == 48);
+    }
+    {
+        auto stream = APNGFrameStream::Create(apng, FakeDecode, InlineExecutor, options);
+        CHECK("A", PlayAndCompare(*stream, expected, 3));
+        auto stats = stream->GetStats();
+        // 首帧同步合成，其后全部由预取命中；每帧每轮只解码一次（另有最后一帧后预取的下一轮前两帧）
+        CHECK("A", stats.sync_composite == 1 && stats.prefetch_hit == 3 * 24 - 1);
+        CHECK("A", stats.decode_count == 3 * 24 + 2 && stats.rewind_count == 0);
+    }
+    {
+        WorkerThread worker;
+        auto stream = APNGFrameStream::Create(
+            apng, FakeDecode, [&worker](std::function<void()> task) { worker.Post(std::move(task)); }, options);
+        CHECK("A", PlayAndCompare(*stream, expected, 3, &worker));
+        // 播放中途 Trim（停止），排队中的预取失效，再次播放从头合成
+        stream->Prefetch(5);
+        stream->Trim();
+        CHECK("A", PlayAndCompare(*stream, expected, 1, &worker));
+        worker.Drain();
+        stream.reset();
+        CHECK("A", budget.UsedBytes() == 0);
+    }
+    {
+        // 非顺序读取：回退时从头重新合成
+        auto stream = APNGFrameStream::Create(apng, FakeDecode, nullptr, options);
+        bool same = true;
+        for (int index : {7, 3, 3, 20, 0, 23, 12}) {
+            stream->ReadFrame(index, [&](const uint8_t *pixels, size_t size) {
+                same = same && memcmp(pixels, expected[index].data(), size) == 0;
+            });
+        }
+        CHECK("A", same && stream->GetStats().rewind_count == 2);
+        CHECK("A", !stream->ReadFrame(24, nullptr) && !stream->ReadFrame(-1, nullptr));
+    }
+    // 帧间隔与最后一帧语义保持不变
+    auto stream = APNGFrameStream::Create(apng, FakeDecode, nullptr, options);
+    CHECK("A", stream->NextFrameDelay(0) == apng->frames[2]->delay);
+    CHECK("A", stream->NextFrameDelay(23) == apng->frames[24]->delay);
+    CHECK("A", stream->IsLast(23) && !stream->IsLast(22));
+}
+
+static void TestDisposePrevious() {
+    auto apng = MakeMixedAPNG(40, 40, 30, true);
+    CHECK("B", apng != nullptr);
+    if (!apng) {
+        return;
+    }
+    int previous_count = 0;
+    for (const auto &frame : apng->frames) {
+        previous_count += frame->disposeOp == 2 ? 1 : 0;
+    }
+    auto expected = EagerDecode(*apng, true);
+    auto legacy = EagerDecode(*apng, false);
+    APNGFrameBudget budget(64 * 1024 * 1024);
+    APNGFrameStreamOptions options;
+    options.global_budget = &budget;
+    auto stream = APNGFrameStream::Create(apng, FakeDecode, InlineExecutor, options);
+    CHECK("B", previous_count > 3 && expected != legacy);
+    CHECK("B", PlayAndCompare(*stream, expected, 2));
+    // 备份缓冲计入必需内存
+    CHECK("B", stream->GetStats().allocated_bytes == 40 * 40 * 4 * (3 + 1 + 2));
+}
+
+static void TestBudget() {
+    auto apng = MakeMixedAPNG(100, 100, 12, false);
+    auto expected = EagerDecode(*apng, false);
+    const size_t canvas = 100 * 100 * 4;
+    const size_t required = canvas * 3;  // 画布 + 解码缓冲 + 一个输出帧
+
+    APNGFrameBudget global(required + canvas);
+    APNGFrameStreamOptions options;
+    options.global_budget = &global;
+    auto s1 = APNGFrameStream::Create(apng, FakeDecode, InlineExecutor, options);
+    auto s2 = APNGFrameStream::Create(apng, FakeDecode, InlineExecutor, options);
+    CHECK("C", PlayAndCompare(*s1, expected, 1));
+    CHECK("C", PlayAndCompare(*s2, expected, 1));
+    // s1 占满全局预算只分到一个预取帧，s2 只剩必需缓冲（不预取，同步合成）
+    CHECK("C", s1->GetStats().output_slots == 2 && s2->GetStats().output_slots == 1);
+    CHECK("C", s2->GetStats().prefetch_hit == 0 && s2->GetStats().sync_composite == 12);
+    CHECK("C", global.UsedBytes() == required * 2 + canvas);
+    s1->Trim();
+    CHECK("C", global.UsedBytes() == required && s1->GetStats().allocated_bytes == 0);
+    CHECK("C", PlayAndCompare(*s1, expected, 1));
+    s1.reset();
+    s2.reset();
+    CHECK("C", global.UsedBytes() == 0);
+
+    // 单动画预算
+    APNGFrameBudget large(64 * 1024 * 1024);
+    options.global_budget = &large;
+    options.budget_bytes = required + canvas + canvas / 2;
+    auto s3 = APNGFrameStream::Create(apng, FakeDecode, InlineExecutor, options);
+    CHECK("C", PlayAndCompare(*s3, expected, 2) && s3->GetStats().output_slots == 2);
+    options.budget_bytes = 0;
+    auto s4 = APNGFrameStream::Create(apng, FakeDecode, InlineExecutor, options);
+    CHECK("C", PlayAndCompare(*s4, expected, 2) && s4->GetStats().output_slots == 1);
+    s3.reset();
+    s4.reset();
+    CHECK("C", large.UsedBytes() == 0);
+}
+
+static void BenchMemory() {
+    const int width = 400;
+    const int height = 400;
+    const int frame_count = 120;
+    std::vector<FrameSpec> frames;
+    FrameSpec first;
+    first.width = width;
+    first.height = height;
+    first.rgba = RandomPixels(width, height);
+    frames.push_back(first);
+    for (int i = 1; i < frame_count; i++) {
+        FrameSpec f;
+        f.width = 120;
+        f.height = 120;
+        f.x = (i * 37) % (width - f.width);
+        f.y = (i * 53) % (height - f.height);
+        f.blend = i % 2;
+        f.dispose = i % 3 == 0 ? 1 : 0;
+        f.rgba = RandomPixels(f.width, f.height);
+        frames.push_back(f);
+    }
+    auto apng = Parse(MakeAPNG(width, height, frames));
+    auto expected = EagerDecode(*apng, false);
+    size_t eager_bytes = expected.size() * static_cast<size_t>(width) * height * 4;
+
+    APNGFrameBudget budget(32 * 1024 * 1024);
+    APNGFrameStreamOptions options;
+    options.global_budget = &budget;
+    auto stream = APNGFrameStream::Create(apng, FakeDecode, InlineExecutor, options);
+    auto start = std::chrono::steady_clock::now();
+    CHECK("D", PlayAndCompare(*stream, expected, 2));
+    auto end = std::chrono::steady_clock::now();
+    auto stats = stream->GetStats();
+    double us_per_frame =
+        std::chrono::duration<double, std::micro>(end - start).count() / (2.0 * frame_count);
+    CHECK("D", stats.decode_count == 2 * frame_count + 2);
+    CHECK("D", stats.allocated_bytes * 10 < eager_bytes);
+
+    printf("frames=%d canvas=%dx%d compressed(raw in test)=%.1f MB\n", frame_count, width, height,
+           apng->CompressedBytes() / 1048576.0);
+    printf("%-8s %14s\n", "impl", "pixel bytes");
+    printf("%-8s %11.1f MB\n", "eager", eager_bytes / 1048576.0);
+    printf("%-8s %11.1f MB (slots=%d)\n", "stream", stats.allocated_bytes / 1048576.0, stats.output_slots);
+    printf("stream composite+read %.1f us/frame\n", us_per_frame);
+}
+
+int main() {
+    TestEagerEquivalence();
+    TestDisposePrevious();
+    TestBudget();
+    BenchMemory();
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
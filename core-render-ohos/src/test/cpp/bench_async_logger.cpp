@@ -0,0 +1,364 @@
+// 基准 + 压测: bench_async_logger
+//
+// 目标:
+//   验证 KRAsyncLogger (KRRenderLog 背后的异步日志管线) 的性能与正确性:
+//   1) 级别关闭时 4 线程 x 1M 次调用不格式化、不入队, 单次开销只有一次原子读;
+//   2) 级别开启时 4 线程 x 1M 次调用经每线程无锁环形缓冲区 + 单个后台线程成批输出,
+//      与原来 "每行 stringstream + 调用线程同步写 adapter" 的方式对比;
+//   3) 缓冲区溢出时丢弃数精确可查, error 级别不丢。
+//
+// 说明:
+//   KRAsyncLogger.h 只依赖标准库, 这里直接包含生产实现。
+//   BENCH_LOG 宏与 KRRenderLoger.h 中 KR_LOG_* 的展开方式一致 (if (!enabled) {} else 流式格式化)。
+//   基线 legacy 模拟原实现: 每行构造 stringstream, 在调用线程上加锁写入 adapter。
+//   两种方式都把每行 fwrite 到 /dev/null 模拟 adapter 的写出开销; 异步方式的写出在后台线程上完成。
+//   单核机器上生产者与后台线程抢同一个核, 总耗时接近; 多核时调用线程只承担格式化与入队。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_async_logger.cpp -o bench_async_logger
+//   运行:
+//   ./bench_async_logger
+//
+// 验证项:
+//   A. 级别关闭  : 4x1M 调用入队数为 0, 流式参数一次都没有求值
+//   B. 级别开启  : 输出 + 丢弃 == 调用数, 每个线程的输出顺序与写入顺序一致, 丢弃统计行之和等于丢弃数
+//   C. 溢出      : 小缓冲区 + 慢 sink 下丢弃数 > 0 且计数精确, error 日志全部输出;
+//                  丢弃统计行以 error 级别经生产 sink 的级别映射到达 adapter, 各级别都有输出通道
+//   D. 冲刷/生命周期: Flush 同步输出; 线程退出后缓冲区被回收; sink 内再写日志不死锁; 同步模式与 Stop 后直接写出
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/KRAsyncLogger.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+// 与 KRRenderLog 相同的流式写法: 析构时交给 logger
+class BenchLog {
+ public:
+    BenchLog(KRAsyncLogger &logger, int level, const char *tag) : logger_(logger), level_(level), tag_(tag) {}
+    ~BenchLog() {
+        stream_ << '\n';
+        logger_.Log(level_, tag_, stream_.str());
+    }
+    template <typename T> BenchLog &operator<<(const T &value) {
+        stream_ << value;
+        return *this;
+    }
+
+ private:
+    KRAsyncLogger &logger_;
+    int level_;
+    const char *tag_;
+    std::ostringstream stream_;
+};
+
+#define BENCH_LOG(logger, level) \
+    if (!(logger).IsEnabled(level)) {} else BenchLog(logger, level, "Bench")  // NOLINT
+
+constexpr int kThreads = 4;
+constexpr int kCallsPerThread = 1000000;
+
+static std::atomic<uint64_t> g_evaluated{0};
+static FILE *g_null_file = nullptr;
+
+static void AdapterWrite(const std::string &tag, const std::string &message) {
+    fwrite(tag.data(), 1, tag.size(), g_null_file);
+    fwrite(message.data(), 1, message.size(), g_null_file);
+}
+
+static int Evaluated(int value) {
+    g_evaluated.fetch_add(1, std::memory_order_relaxed);
+    return value;
+}
+
+static double RunThreads(const std::function<void(int thread_index)> &body) {
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back(body, t);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+// 解析 "t<thread> <seq>" 格式的消息
+static bool ParseMessage(const std::string &message, int &thread_index, long &seq) {
+    if (message.size() < 2 || message[0] != 't') {
+        return false;
+    }
+    char *end = nullptr;
+    thread_index = static_cast<int>(strtol(message.c_str() + 1, &end, 10));
+    seq = strtol(end, nullptr, 10);
+    return true;
+}
+
+struct OrderCheckingSink {
+    std::vector<long> last_seq = std::vector<long>(kThreads, -1);
+    uint64_t lines = 0;
+    uint64_t drop_notice_lines = 0;
+    uint64_t drop_notice_total = 0;
+    bool ordered = true;
+
+    void operator()(std::vector<KRLogRecord> &batch) {
+        for (auto &record : batch) {
+            if (record.tag == KRAsyncLogger::kDropTag) {
+                drop_notice_lines++;
+                auto pos = record.message.find("dropped ");
+                drop_notice_total += strtoull(record.message.c_str() + pos + 8, nullptr, 10);
+                continue;
+            }
+            int thread_index = 0;
+            long seq = 0;
+            if (ParseMessage(record.message, thread_index, seq) && thread_index >= 0 && thread_index < kThreads) {
+                ordered = ordered && seq > last_seq[thread_index];
+                last_seq[thread_index] = seq;
+            }
+            lines++;
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// A. 级别关闭
+// ---------------------------------------------------------------------------
+static void TestDisabled() {
+    printf("\n=== A. 级别关闭 (%d x %d) ===\n", kThreads, kCallsPerThread);
+    KRAsyncLogger logger(1024, 20);
+    OrderCheckingSink sink;
+    logger.SetSink([&sink](std::vector<KRLogRecord> &batch) { sink(batch); });
+    logger.SetMinLevel(kKRLogLevelInfo);
+    g_evaluated = 0;
+    double ms = RunThreads([&logger](int t) {
+        for (int i = 0; i < kCallsPerThread; ++i) {
+            BENCH_LOG(logger, kKRLogLevelDebug) << "t" << t << " " << Evaluated(i) << " frame value " << 3.14;
+        }
+    });
+    logger.Stop();
+    auto stats = logger.GetStats();
+    printf("  %.1f ms total, %.2f ns/call\n", ms, ms * 1e6 / kCallsPerThread);
+    CHECK("A", stats.enqueued == 0);
+    CHECK("A", sink.lines == 0);
+    CHECK("A", g_evaluated.load() == 0);
+    CHECK("A", stats.ring_count == 0);
+}
+
+// ---------------------------------------------------------------------------
+// B. 级别开启, 与原同步实现对比
+// ---------------------------------------------------------------------------
+static void TestEnabled() {
+    printf("\n=== B. 级别开启 (%d x %d) ===\n", kThreads, kCallsPerThread);
+
+    // 基线: 每行 stringstream + 调用线程上同步写入 (adapter 内部需要串行)
+    std::mutex legacy_mutex;
+    uint64_t legacy_lines = 0;
+    double legacy_ms = RunThreads([&](int t) {
+        for (int i = 0; i < kCallsPerThread; ++i) {
+            std::stringstream stream;
+            stream << "t" << t << " " << i << " frame value " << 3.14 << std::endl;
+            std::string tag = "Bench";
+            std::lock_guard<std::mutex> lock(legacy_mutex);
+            AdapterWrite(tag, stream.str());
+            legacy_lines++;
+        }
+    });
+
+    KRAsyncLogger logger(KRAsyncLogger::kDefaultRingCapacity, KRAsyncLogger::kDefaultDrainIntervalMs);
+    OrderCheckingSink sink;
+    logger.SetSink([&sink](std::vector<KRLogRecord> &batch) {
+        for (auto &record : batch) {
+            AdapterWrite(record.tag, record.message);
+        }
+        sink(batch);
+    });
+    double ms = RunThreads([&logger](int t) {
+        for (int i = 0; i < kCallsPerThread; ++i) {
+            BENCH_LOG(logger, kKRLogLevelInfo) << "t" << t << " " << i << " frame value " << 3.14;
+        }
+    });
+    logger.Stop();
+    auto stats = logger.GetStats();
+    uint64_t total = static_cast<uint64_t>(kThreads) * kCallsPerThread;
+    printf("  legacy sync : %.1f ms (%.1f ns/call per thread), lines=%llu\n", legacy_ms,
+           legacy_ms * 1e6 / kCallsPerThread, static_cast<unsigned long long>(legacy_lines));
+    printf("  async       : %.1f ms (%.1f ns/call per thread)\n", ms, ms * 1e6 / kCallsPerThread);
+    printf("  enqueued=%llu written=%llu dropped=%llu (%.2f%%) batches=%llu max_batch=%llu\n",
+           static_cast<unsigned long long>(stats.enqueued), static_cast<unsigned long long>(stats.written),
+           static_cast<unsigned long long>(stats.dropped), stats.dropped * 100.0 / total,
+           static_cast<unsigned long long>(stats.batch_count), static_cast<unsigned long long>(stats.max_batch));
+    CHECK("B", stats.enqueued + stats.dropped == total);
+    CHECK("B", stats.written == stats.enqueued);
+    CHECK("B", sink.lines == stats.written);
+    CHECK("B", sink.ordered);
+    CHECK("B", sink.drop_notice_total == stats.dropped);
+    CHECK("B", stats.dropped == 0 || sink.drop_notice_lines > 0);
+    CHECK("B", stats.ring_count == 0);  // 写日志的线程都已退出, 缓冲区被回收
+}
+
+// ---------------------------------------------------------------------------
+// C. 溢出
+// ---------------------------------------------------------------------------
+// 与 KRRenderAdapterManager::Log 的分支一致: 只有这些级别会写到 adapter / hilog, 其它级别被丢弃
+static bool AdapterHandles(int level) {
+    return level == kKRLogLevelInfo || level == kKRLogLevelDebug || level == kKRLogLevelError ||
+           level == kKRLogLevelWarn || level == kKRLogLevelFatal;
+}
+
+static void TestOverflow() {
+    printf("\n=== C. 溢出 ===\n");
+    bool all_levels_reach_adapter = true;
+    for (int level = 0; level <= kKRLogLevelFatal + 1; ++level) {
+        int sink_level = KRLogSinkLevel(level);
+        all_levels_reach_adapter = all_levels_reach_adapter && AdapterHandles(sink_level) &&
+                                   (sink_level == kKRLogLevelDebug || sink_level == kKRLogLevelInfo ||
+                                    sink_level == kKRLogLevelError);
+    }
+    CHECK("C", all_levels_reach_adapter);
+
+    KRAsyncLogger logger(64, 20);
+    uint64_t info_lines = 0;
+    uint64_t error_lines = 0;
+    uint64_t drop_notice_total = 0;
+    uint64_t drop_notice_lines = 0;
+    uint64_t drop_notice_to_adapter = 0;
+    // 与 KRRenderLoger.h 中生产 sink 相同: 先 KRLogSinkLevel 映射, 再交给 adapter
+    logger.SetSink([&](std::vector<KRLogRecord> &batch) {
+        for (auto &record : batch) {
+            if (record.tag == KRAsyncLogger::kDropTag) {
+                drop_notice_lines++;
+                if (AdapterHandles(KRLogSinkLevel(record.level)) && record.level == kKRLogLevelError) {
+                    drop_notice_to_adapter++;
+                }
+                drop_notice_total += strtoull(record.message.c_str() + record.message.find("dropped ") + 8, nullptr, 10);
+            } else if (record.level >= kKRLogLevelError) {
+                error_lines++;
+            } else {
+                info_lines++;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));  // 慢 sink
+    });
+    constexpr int kLines = 20000;
+    std::thread writer([&logger] {
+        for (int i = 0; i < kLines; ++i) {
+            int level = i % 100 == 0 ? kKRLogLevelError : kKRLogLevelInfo;
+            logger.Log(level, "Bench", "line " + std::to_string(i));
+        }
+    });
+    writer.join();
+    logger.Stop();
+    auto stats = logger.GetStats();
+    printf("  info written=%llu error written=%llu dropped=%llu sync=%llu\n",
+           static_cast<unsigned long long>(info_lines), static_cast<unsigned long long>(error_lines),
+           static_cast<unsigned long long>(stats.dropped), static_cast<unsigned long long>(stats.sync_written));
+    CHECK("C", stats.dropped > 0);
+    CHECK("C", error_lines == kLines / 100);
+    CHECK("C", info_lines + error_lines + stats.dropped == static_cast<uint64_t>(kLines));
+    CHECK("C", drop_notice_total == stats.dropped);
+    CHECK("C", drop_notice_lines > 0 && drop_notice_to_adapter == drop_notice_lines);
+}
+
+// ---------------------------------------------------------------------------
+// D. 冲刷与生命周期
+// ---------------------------------------------------------------------------
+static void TestFlushAndLifecycle() {
+    printf("\n=== D. 冲刷与生命周期 ===\n");
+    KRAsyncLogger logger(1024, 10000);
+    // sink 可能在后台线程执行, 读写 lines 需要加锁
+    std::mutex lines_mutex;
+    std::vector<std::string> lines;
+    std::atomic<bool> reenter{false};
+    logger.SetSink([&](std::vector<KRLogRecord> &batch) {
+        {
+            std::lock_guard<std::mutex> lock(lines_mutex);
+            for (auto &record : batch) {
+                lines.push_back(record.message);
+            }
+        }
+        if (reenter.exchange(false)) {
+            logger.Log(kKRLogLevelError, "Bench", "from sink");  // 不能死锁
+        }
+    });
+    auto snapshot = [&] {
+        std::lock_guard<std::mutex> lock(lines_mutex);
+        return lines;
+    };
+    for (int i = 0; i < 10; ++i) {
+        logger.Log(kKRLogLevelInfo, "Bench", "line " + std::to_string(i));
+    }
+    logger.Flush();
+    auto current = snapshot();
+    CHECK("D", current.size() == 10 && current.front() == "line 0" && current.back() == "line 9");
+
+    // 线程退出后其缓冲区在下一次冲刷时回收, 退出前写入的日志不丢
+    std::thread worker([&logger] { logger.Log(kKRLogLevelInfo, "Bench", "worker"); });
+    worker.join();
+    logger.Flush();
+    current = snapshot();
+    CHECK("D", current.size() == 11 && current.back() == "worker");
+    CHECK("D", logger.GetStats().ring_count == 1);
+
+    // sink 内写日志
+    reenter = true;
+    logger.Log(kKRLogLevelInfo, "Bench", "trigger");
+    logger.Flush();
+    logger.Flush();
+    current = snapshot();
+    CHECK("D", current.size() == 13 && current.back() == "from sink");
+
+    // 同步模式
+    logger.SetAsync(false);
+    logger.Log(kKRLogLevelInfo, "Bench", "sync");
+    current = snapshot();
+    CHECK("D", current.size() == 14 && current.back() == "sync");
+    logger.SetAsync(true);
+
+    // Stop 冲刷剩余日志, 之后直接写出
+    logger.Log(kKRLogLevelInfo, "Bench", "before stop");
+    logger.Stop();
+    current = snapshot();
+    CHECK("D", current.size() == 15 && current.back() == "before stop");
+    logger.Log(kKRLogLevelInfo, "Bench", "after stop");
+    current = snapshot();
+    CHECK("D", current.size() == 16 && current.back() == "after stop");
+    CHECK("D", logger.FlushForCrash(10));
+}
+
+int main() {
+    g_null_file = fopen("/dev/null", "w");
+    if (g_null_file == nullptr) {
+        printf("open /dev/null failed\n");
+        return 1;
+    }
+    TestDisabled();
+    TestEnabled();
+    TestOverflow();
+    TestFlushAndLifecycle();
+    fclose(g_null_file);
+
+    if (g_fail == 0) {
+        printf("\n>>> ALL PASS <<<\n");
+        return 0;
+    }
+    printf("\n>>> %d FAILED <<<\n", g_fail);
+    exit(1);
+}
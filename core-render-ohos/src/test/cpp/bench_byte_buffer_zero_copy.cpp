@@ -0,0 +1,213 @@
+// 测试+基准: bench_byte_buffer_zero_copy
+//
+// 目标:
+//   验证 KRByteBuffer (KRRenderValue::ByteArray 的底层存储) 的所有权语义,
+//   并对比二进制数据跨边界传递时三种方式的开销:
+//   1) 旧路径: std::vector<uint8_t> 逐字节 push_back;
+//   2) Copy: 一次 memcpy;
+//   3) Wrap: 包装外部内存 + 释放回调, 不拷贝 (C ABI NoCopy / 旧版 vector 形式的 ByteArray)。
+//   ArkTS ArrayBuffer 可被脚本写入或 detach, 不与 native 共享: ArkTS -> native 走 Copy;
+//   native -> ArkTS 对唯一引用的自有内存用 TakeStorage 整体转移 (外部 ArrayBuffer 的 finalizer 持有), 否则 Copy。
+//
+// 说明:
+//   KRByteBuffer.h 只依赖标准库, 这里直接包含生产实现;
+//   释放回调用计数器替身代替。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_byte_buffer_zero_copy.cpp -o bench_bbzc
+//   运行:
+//   ./bench_bbzc                # 默认 1MB, 200 轮
+//   ./bench_bbzc 4194304 100    # 数据长度, 轮数
+//
+// 验证项:
+//   A. Copy / Adopt 内容一致, 与源内存独立; 空数据不崩溃
+//   B. Wrap 不拷贝 (data() 指向外部内存), 最后一个引用释放时回调恰好一次;
+//      按 KRRenderValue(const LegacyByteArray &) 的方式包装 vector 时, vector 存活到最后一个引用释放
+//   C. 多线程并发持有/释放同一 Wrap 缓冲区, 回调恰好一次且在所有引用释放之后
+//   D. TakeStorage 只交出唯一引用的自有内存且不拷贝; 有其它引用或为外部内存时失败且 buffer 不变
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/type/KRByteBuffer.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+static void TestOwnership() {
+    std::vector<uint8_t> source(1000);
+    for (size_t i = 0; i < source.size(); ++i) {
+        source[i] = static_cast<uint8_t>(i * 31);
+    }
+
+    auto copied = KRByteBuffer::Copy(source.data(), source.size());
+    CHECK("A", copied->size() == source.size() && memcmp(copied->data(), source.data(), source.size()) == 0);
+    CHECK("A", copied->data() != source.data() && !copied->IsExternal());
+    source[0] ^= 0xFF;
+    CHECK("A", copied->data()[0] != source[0]);
+
+    auto expected = source;
+    auto adopted_address = source.data();
+    auto adopted = KRByteBuffer::Adopt(std::move(source));
+    CHECK("A", adopted->data() == adopted_address && adopted->size() == expected.size());
+    CHECK("A", std::vector<uint8_t>(adopted->begin(), adopted->end()) == expected);
+    CHECK("A", (*adopted)[1] == expected[1] && (*adopted)[999] == expected[999]);
+
+    auto empty = KRByteBuffer::Copy(nullptr, 16);
+    CHECK("A", empty->empty() && empty->begin() == empty->end());
+    auto empty_wrap = KRByteBuffer::Wrap(nullptr, 16, nullptr);
+    CHECK("A", empty_wrap->empty() && !empty_wrap->IsExternal());
+
+    int released = 0;
+    const void *released_address = nullptr;
+    {
+        auto wrapped = KRByteBuffer::Wrap(expected.data(), expected.size(), [&released, &released_address, &expected] {
+            released++;
+            released_address = expected.data();
+        });
+        CHECK("B", wrapped->data() == expected.data() && wrapped->IsExternal());
+        auto another = wrapped;
+        wrapped.reset();
+        CHECK("B", released == 0);
+        CHECK("B", another->size() == expected.size());
+    }
+    CHECK("B", released == 1 && released_address == expected.data());
+
+    // 与 KRRenderValue(const LegacyByteArray &) 一致: 捕获 vector 的 shared_ptr 保活
+    auto legacy = std::make_shared<std::vector<uint8_t>>(expected);
+    std::weak_ptr<std::vector<uint8_t>> weak_legacy = legacy;
+    auto legacy_wrapped = KRByteBuffer::Wrap(legacy->data(), legacy->size(), [legacy] {});
+    legacy.reset();
+    CHECK("B", !weak_legacy.expired() && legacy_wrapped->size() == expected.size());
+    CHECK("B", std::vector<uint8_t>(legacy_wrapped->begin(), legacy_wrapped->end()) == expected);
+    legacy_wrapped.reset();
+    CHECK("B", weak_legacy.expired());
+}
+
+static void TestTakeStorage() {
+    std::vector<uint8_t> source(kKRByteBufferZeroCopyThreshold, 7);
+    auto address = source.data();
+    auto owned = KRByteBuffer::Adopt(std::move(source));
+    auto shared = owned;
+    CHECK("D", KRByteBuffer::TakeStorage(owned) == nullptr && owned && owned->data() == address);
+    shared.reset();
+    auto storage = KRByteBuffer::TakeStorage(owned);
+    CHECK("D", storage != nullptr && storage->data() == address && storage->size() == kKRByteBufferZeroCopyThreshold);
+    CHECK("D", owned == nullptr);
+
+    int released = 0;
+    std::vector<uint8_t> external(64, 1);
+    auto wrapped = KRByteBuffer::Wrap(external.data(), external.size(), [&released] { released++; });
+    CHECK("D", KRByteBuffer::TakeStorage(wrapped) == nullptr && wrapped && released == 0);
+    wrapped.reset();
+    CHECK("D", released == 1);
+    std::shared_ptr<KRByteBuffer> none;
+    CHECK("D", KRByteBuffer::TakeStorage(none) == nullptr);
+}
+
+static void TestConcurrentRelease() {
+    constexpr int kThreads = 8;
+    constexpr int kIterations = 2000;
+    std::vector<uint8_t> memory(64 * 1024, 7);
+    std::atomic<int> released{0};
+    std::atomic<int> alive_readers{0};
+    std::atomic<bool> released_early{false};
+    for (int iteration = 0; iteration < 50; ++iteration) {
+        auto buffer = KRByteBuffer::Wrap(memory.data(), memory.size(), [&released, &alive_readers, &released_early] {
+            if (alive_readers.load() != 0) {
+                released_early = true;
+            }
+            released++;
+        });
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([buffer, &alive_readers]() mutable {
+                alive_readers++;
+                uint64_t sum = 0;
+                for (int i = 0; i < kIterations; ++i) {
+                    auto local = buffer;
+                    sum += local->data()[i % local->size()];
+                }
+                if (sum != 7ull * kIterations) {
+                    abort();
+                }
+                alive_readers--;
+                buffer.reset();
+            });
+        }
+        buffer.reset();
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+    CHECK("C", released == 50);
+    CHECK("C", !released_early);
+}
+
+int main(int argc, char **argv) {
+    size_t size = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1024 * 1024;
+    int rounds = argc > 2 ? atoi(argv[2]) : 200;
+
+    TestOwnership();
+    TestTakeStorage();
+    TestConcurrentRelease();
+
+    std::vector<uint8_t> source(size);
+    for (size_t i = 0; i < size; ++i) {
+        source[i] = static_cast<uint8_t>(i);
+    }
+    uint64_t checksum[3] = {0, 0, 0};
+    int wrap_released = 0;
+    double elapsed_ms[3] = {0, 0, 0};
+    for (int r = 0; r < rounds; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        {
+            auto bytes = std::make_shared<std::vector<uint8_t>>();
+            for (size_t i = 0; i < size; ++i) {
+                bytes->push_back(source[i]);
+            }
+            checksum[0] += (*bytes)[r % size];
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        {
+            auto bytes = KRByteBuffer::Copy(source.data(), source.size());
+            checksum[1] += bytes->data()[r % size];
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        {
+            auto bytes = KRByteBuffer::Wrap(source.data(), source.size(), [&wrap_released] { wrap_released++; });
+            checksum[2] += bytes->data()[r % size];
+        }
+        auto t3 = std::chrono::steady_clock::now();
+        elapsed_ms[0] += std::chrono::duration<double, std::milli>(t1 - t0).count();
+        elapsed_ms[1] += std::chrono::duration<double, std::milli>(t2 - t1).count();
+        elapsed_ms[2] += std::chrono::duration<double, std::milli>(t3 - t2).count();
+    }
+    CHECK("A", checksum[0] == checksum[1] && checksum[1] == checksum[2]);
+    CHECK("B", wrap_released == rounds);
+
+    printf("size=%zu rounds=%d\n", size, rounds);
+    printf("push_back loop : %9.4f ms/round\n", elapsed_ms[0] / rounds);
+    printf("memcpy copy    : %9.4f ms/round (%.1fx)\n", elapsed_ms[1] / rounds, elapsed_ms[0] / elapsed_ms[1]);
+    printf("wrap (no copy) : %9.4f ms/round (%.1fx)\n", elapsed_ms[2] / rounds, elapsed_ms[0] / elapsed_ms[2]);
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
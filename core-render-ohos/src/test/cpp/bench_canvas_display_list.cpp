@@ -0,0 +1,851 @@
+// 测试+基准: bench_canvas_display_list
+//
+// 目标:
+//   验证 KRCanvasDisplayList (KRCanvasView 绘制命令显示列表) 的正确性,
+//   并录制一张约 2k 条命令的折线/面积/柱状组合图表, 对比每帧回放耗时:
+//   1) 旧实现: ops 以 (method, params) 字符串对保存, 每帧逐条字符串比较分派, 每条命令重新解析 JSON,
+//      渐变样式每帧重新解析并创建着色器, 路径每帧重新构建;
+//   2) 新实现: 命令到达时编译一次为 操作码 + 紧凑浮点参数 + 资源下标, 每帧 switch 分派,
+//      着色器/虚线效果/路径按资源下标懒创建并跨帧复用。
+//
+// 说明:
+//   KRCanvasDisplayList 只依赖标准库与 KRJSONObject, 这里直接编译生产实现;
+//   OH_Drawing 的 canvas/pen/brush/path/shader 用 Fake* 模拟, 绘制时把画笔状态和路径内容折算为哈希,
+//   两种实现的哈希一致即说明回放结果一致。文字排版开销两种实现相同, 这里只记录参数不做排版。
+//   LegacyCanvas 与 CompiledCanvas 分别对应改造前后的 KRCanvasView::OnDraw, 保持相同的状态语义。
+//
+// 编译(macOS/Linux 均可):
+//   M=../../main/cpp
+//   clang++ -std=c++17 -O2 -I $M bench_canvas_display_list.cpp $M/libohos_render/expand/components/canvas/KRCanvasDisplayList.cpp
+//       $M/libohos_render/utils/KRJSONObject.cpp -x c $M/thirdparty/cJSON/cJSON.c -o bench_canvas_display_list
+//   运行:
+//   ./bench_canvas_display_list           # 默认回放 300 帧
+//   ./bench_canvas_display_list 1000
+//
+// 验证项:
+//   A. 编译后回放与逐帧解析回放的绘制结果完全一致 (连续多帧, 包括 stroke 后不经 beginPath 继续追加路径)
+//   B. 增量编译: 命令分批到达时只编译新命令, 未结束的路径段跨批次增长后结果仍一致; 参数缺省语义保持不变
+//   C. reset 后显示列表与其平台对象全部释放, 重复录制不会泄漏
+//   D. 每帧回放不再创建着色器/虚线效果/路径对象 (只剩写时复制), 回放耗时低于逐帧解析
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "libohos_render/expand/components/canvas/KRCanvasDisplayList.h"
+#include "libohos_render/utils/KRJSONObject.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+// ---------------------------------------------------------------------------
+// Fake 绘制后端
+// ---------------------------------------------------------------------------
+static int g_live_paths = 0;
+static int g_live_shaders = 0;
+static int g_live_effects = 0;
+static long g_native_creates = 0;  // 所有平台对象的创建次数
+
+struct FakePath {
+    std::vector<float> verbs;
+    FakePath() {
+        g_live_paths++;
+        g_native_creates++;
+    }
+    FakePath(const FakePath &other) : verbs(other.verbs) {
+        g_live_paths++;
+        g_native_creates++;
+    }
+    ~FakePath() {
+        g_live_paths--;
+    }
+    void Add(float verb, std::initializer_list<float> args) {
+        verbs.push_back(verb);
+        verbs.insert(verbs.end(), args.begin(), args.end());
+    }
+};
+
+struct FakeShader {
+    std::vector<float> params;
+    FakeShader() {
+        g_live_shaders++;
+        g_native_creates++;
+    }
+    ~FakeShader() {
+        g_live_shaders--;
+    }
+};
+
+struct FakeEffect {
+    std::vector<float> intervals;
+    FakeEffect() {
+        g_live_effects++;
+        g_native_creates++;
+    }
+    ~FakeEffect() {
+        g_live_effects--;
+    }
+};
+
+struct FakePaint {
+    float width = 1;
+    int cap = 0;
+    uint32_t color = 0xFF000000;
+    const FakeShader *shader = nullptr;
+    const FakeEffect *effect = nullptr;
+};
+
+// 绘制结果折算为 FNV-1a 哈希
+struct FakeCanvas {
+    uint64_t hash = 14695981039346656037ULL;
+    int draw_calls = 0;
+
+    void Mix(uint32_t v) {
+        for (int i = 0; i < 4; i++) {
+            hash ^= (v >> (i * 8)) & 0xFF;
+            hash *= 1099511628211ULL;
+        }
+    }
+    void Mix(float v) {
+        uint32_t bits;
+        memcpy(&bits, &v, sizeof(bits));
+        Mix(bits);
+    }
+    void Mix(const std::string &s) {
+        for (unsigned char c : s) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+    }
+    void MixPaint(const FakePaint &paint) {
+        Mix(paint.width);
+        Mix(static_cast<uint32_t>(paint.cap));
+        Mix(paint.color);
+        if (paint.shader) {
+            for (float v : paint.shader->params) {
+                Mix(v);
+            }
+        }
+        if (paint.effect) {
+            for (float v : paint.effect->intervals) {
+                Mix(v);
+            }
+        }
+    }
+    void DrawPath(uint32_t tag, const FakePath &path, const FakePaint &paint) {
+        draw_calls++;
+        Mix(tag);
+        for (float v : path.verbs) {
+            Mix(v);
+        }
+        MixPaint(paint);
+    }
+    void Op(uint32_t tag, std::initializer_list<float> args) {
+        Mix(tag);
+        for (float v : args) {
+            Mix(v);
+        }
+    }
+};
+
+enum Verb { kVerbMove = 1, kVerbLine, kVerbArc, kVerbClose, kVerbQuad, kVerbCubic };
+enum Tag { kTagStroke = 100, kTagFill, kTagClip, kTagText, kTagSave, kTagRestore, kTagTranslate, kTagScale, kTagRotate };
+
+// 与 ConvertToHexColor / Color::FromString 对应的简化版本: 只支持 #RRGGBB
+static uint32_t ParseColor(const std::string &str) {
+    if (str.size() == 7 && str[0] == '#') {
+        return 0xFF000000 | static_cast<uint32_t>(strtoul(str.c_str() + 1, nullptr, 16));
+    }
+    return 0xFF000000;
+}
+
+static const std::string kLinearGradient = "linear-gradient";
+
+// 与 parseGradientStyle 对应: 解析 linear-gradient{json} 并创建着色器
+static FakeShader *ParseGradient(const std::string &style) {
+    auto obj = kuikly::util::JSONObject::Parse(style.substr(kLinearGradient.size()));
+    if (!obj) {
+        return nullptr;
+    }
+    auto shader = new FakeShader();
+    shader->params = {static_cast<float>(obj->GetNumber("x0")), static_cast<float>(obj->GetNumber("y0")),
+                      static_cast<float>(obj->GetNumber("x1")), static_cast<float>(obj->GetNumber("y1"))};
+    std::string stops = obj->GetString("colorStops");
+    size_t start = 0;
+    while (start < stops.size()) {
+        size_t end = stops.find(',', start);
+        if (end == std::string::npos) {
+            end = stops.size();
+        }
+        auto stop = stops.substr(start, end - start);
+        auto space = stop.find(' ');
+        if (space != std::string::npos) {
+            shader->params.push_back(ParseColor(stop.substr(0, space)));
+            shader->params.push_back(std::stof(stop.substr(space + 1)));
+        }
+        start = end + 1;
+    }
+    return shader;
+}
+
+// ---------------------------------------------------------------------------
+// 旧实现: 与改造前 KRCanvasView::OnDraw 一致
+// ---------------------------------------------------------------------------
+class LegacyCanvas {
+ public:
+    ~LegacyCanvas() {
+        Reset();
+    }
+
+    void AddOp(const std::string &method, const std::string &params) {
+        ops_.push_back(std::pair{method, params});
+    }
+
+    void Reset() {
+        ops_.clear();
+        delete path_;
+        path_ = nullptr;
+        delete dash_;
+        dash_ = nullptr;
+        for (auto shader : leaked_shaders_) {
+            delete shader;
+        }
+        leaked_shaders_.clear();
+        pen_ = FakePaint();
+        brush_ = FakePaint();
+    }
+
+    void OnDraw(FakeCanvas &canvas) {
+        canvas_ = &canvas;
+        std::for_each(ops_.begin(), ops_.end(), [this](auto item) {
+            const std::string &method = item.first;
+            const std::string &params = item.second;
+            if (method == "lineCap") {
+                auto str = kuikly::util::JSONObject::Parse(params)->GetString("style");
+                pen_.cap = str == "round" ? 1 : (str == "square" ? 2 : 0);
+            } else if (method == "lineWidth") {
+                pen_.width = kuikly::util::JSONObject::Parse(params)->GetNumber("width");
+            } else if (method == "lineDash") {
+                auto intervals = kuikly::util::JSONObject::Parse(params)->GetNumberArray("intervals");
+                delete dash_;
+                dash_ = nullptr;
+                if (!intervals.empty()) {
+                    dash_ = new FakeEffect();
+                    dash_->intervals.assign(intervals.begin(), intervals.end());
+                }
+                pen_.effect = dash_;
+            } else if (method == "strokeStyle" || method == "fillStyle") {
+                auto &paint = method == "strokeStyle" ? pen_ : brush_;
+                auto style = kuikly::util::JSONObject::Parse(params)->GetString("style");
+                if (style.substr(0, kLinearGradient.size()) == kLinearGradient) {
+                    // 旧实现每帧创建着色器且未释放
+                    auto shader = ParseGradient(style);
+                    leaked_shaders_.push_back(shader);
+                    paint.shader = shader;
+                } else {
+                    paint.shader = nullptr;
+                    paint.color = ParseColor(style);
+                }
+            } else if (method == "beginPath") {
+                delete path_;
+                path_ = new FakePath();
+            } else if (method == "moveTo" || method == "lineTo") {
+                if (path_) {
+                    auto obj = kuikly::util::JSONObject::Parse(params);
+                    float x = obj->GetNumber("x");
+                    float y = obj->GetNumber("y");
+                    path_->Add(method == "moveTo" ? kVerbMove : kVerbLine, {x, y});
+                }
+            } else if (method == "arc") {
+                Arc(params);
+            } else if (method == "quadraticCurveTo") {
+                if (path_) {
+                    auto obj = kuikly::util::JSONObject::Parse(params);
+                    path_->Add(kVerbQuad, {static_cast<float>(obj->GetNumber("cpx")),
+                                           static_cast<float>(obj->GetNumber("cpy")),
+                                           static_cast<float>(obj->GetNumber("x")),
+                                           static_cast<float>(obj->GetNumber("y"))});
+                }
+            } else if (method == "closePath") {
+                if (path_) {
+                    path_->Add(kVerbClose, {});
+                }
+            } else if (method == "stroke") {
+                if (path_) {
+                    canvas_->DrawPath(kTagStroke, *path_, pen_);
+                }
+            } else if (method == "fill") {
+                if (path_) {
+                    canvas_->DrawPath(kTagFill, *path_, brush_);
+                }
+            } else if (method == "textAlign") {
+                if (params == "left") {
+                    align_ = 0;
+                } else if (params == "center") {
+                    align_ = 1;
+                } else if (params == "right") {
+                    align_ = 2;
+                }
+            } else if (method == "font") {
+                auto obj = kuikly::util::JSONObject::Parse(params);
+                font_size_ = obj->GetNumber("size");
+                italic_ = obj->GetString("style") == "italic";
+                weight_ = std::stoi(obj->GetString("weight"));
+                family_ = obj->GetString("family");
+            } else if (method == "fillText" || method == "strokeText") {
+                auto obj = kuikly::util::JSONObject::Parse(params);
+                canvas_->Mix(obj->GetString("text"));
+                canvas_->Mix(family_);
+                canvas_->Op(kTagText, {static_cast<float>(obj->GetNumber("x")),
+                                       static_cast<float>(obj->GetNumber("y")), font_size_,
+                                       static_cast<float>(italic_), static_cast<float>(weight_),
+                                       static_cast<float>(align_)});
+                canvas_->MixPaint(method == "fillText" ? brush_ : pen_);
+            } else if (method == "save") {
+                canvas_->Op(kTagSave, {});
+            } else if (method == "restore") {
+                canvas_->Op(kTagRestore, {});
+            } else if (method == "translate" || method == "scale") {
+                auto obj = kuikly::util::JSONObject::Parse(params);
+                canvas_->Op(method == "translate" ? kTagTranslate : kTagScale,
+                            {static_cast<float>(obj->GetNumber("x")), static_cast<float>(obj->GetNumber("y"))});
+            } else if (method == "rotate") {
+                float degrees = kuikly::util::JSONObject::Parse(params)->GetNumber("angle") * 180 / M_PI;
+                canvas_->Op(kTagRotate, {degrees});
+            }
+        });
+    }
+
+ private:
+    void Arc(const std::string &params) {
+        if (path_ == nullptr) {
+            return;
+        }
+        auto obj = kuikly::util::JSONObject::Parse(params);
+        float x = obj->GetNumber("x");
+        float y = obj->GetNumber("y");
+        float r = obj->GetNumber("r");
+        float startAngle = obj->GetNumber("sAngle") * 180 / M_PI;
+        float endAngle = obj->GetNumber("eAngle") * 180 / M_PI;
+        bool ccw = obj->GetNumber("counterclockwise");
+        float sweepAngle = endAngle - startAngle;
+        if (ccw) {
+            if (sweepAngle > 0 || sweepAngle <= -720) {
+                sweepAngle = std::fmod(sweepAngle, 360) - 360;
+            }
+        } else {
+            if (sweepAngle < 0 || sweepAngle >= 720) {
+                sweepAngle = std::fmod(sweepAngle, 360) + 360;
+            }
+        }
+        if (std::fabs(sweepAngle) < 360) {
+            path_->Add(kVerbArc, {x - r, y - r, x + r, y + r, startAngle, sweepAngle});
+        } else {
+            float halfSweepAngle = sweepAngle * 0.5;
+            path_->Add(kVerbArc, {x - r, y - r, x + r, y + r, startAngle, halfSweepAngle});
+            path_->Add(kVerbArc, {x - r, y - r, x + r, y + r, startAngle + halfSweepAngle, halfSweepAngle});
+        }
+    }
+
+    FakeCanvas *canvas_ = nullptr;
+    std::vector<std::pair<std::string, std::string>> ops_;
+    FakePath *path_ = nullptr;
+    FakeEffect *dash_ = nullptr;
+    std::vector<FakeShader *> leaked_shaders_;
+    FakePaint pen_;
+    FakePaint brush_;
+    int align_ = 0;
+    float font_size_ = 15;
+    bool italic_ = false;
+    int weight_ = 400;
+    std::string family_;
+};
+
+// ---------------------------------------------------------------------------
+// 新实现: 与改造后 KRCanvasView::Replay 一致
+// ---------------------------------------------------------------------------
+class CompiledCanvas {
+ public:
+    ~CompiledCanvas() {
+        Reset();
+    }
+
+    void AddOp(const std::string &method, const std::string &params) {
+        display_list_.Append(method, params);
+    }
+
+    void Reset() {
+        display_list_.Clear();
+        ReleaseDrawingPath();
+        for (auto *styles : {&stroke_styles_, &fill_styles_}) {
+            for (auto &entry : *styles) {
+                delete entry.shader;
+            }
+            styles->clear();
+        }
+        for (auto effect : dash_effects_) {
+            delete effect;
+        }
+        dash_effects_.clear();
+        for (auto &entry : path_runs_) {
+            delete entry.path;
+        }
+        path_runs_.clear();
+        pen_ = FakePaint();
+        brush_ = FakePaint();
+    }
+
+    const KRCanvasDisplayList &DisplayList() const {
+        return display_list_;
+    }
+
+    void OnDraw(FakeCanvas &canvas) {
+        canvas_ = &canvas;
+        for (const auto &op : display_list_.Ops()) {
+            Replay(op);
+        }
+    }
+
+ private:
+    struct StyleEntry {
+        bool resolved = false;
+        bool gradient = false;
+        uint32_t color = 0;
+        FakeShader *shader = nullptr;
+    };
+    struct PathEntry {
+        FakePath *path = nullptr;
+        uint32_t built_count = 0;
+    };
+
+    const StyleEntry &ResolveStyle(std::vector<StyleEntry> &styles, uint32_t style) {
+        if (styles.size() < display_list_.StringCount()) {
+            styles.resize(display_list_.StringCount());
+        }
+        auto &entry = styles[style];
+        if (!entry.resolved) {
+            entry.resolved = true;
+            const std::string &str = display_list_.String(style);
+            if (str.substr(0, kLinearGradient.size()) == kLinearGradient) {
+                entry.gradient = true;
+                entry.shader = ParseGradient(str);
+            } else {
+                entry.color = ParseColor(str);
+            }
+        }
+        return entry;
+    }
+
+    void ApplyStyle(FakePaint &paint, const StyleEntry &entry) {
+        if (entry.gradient) {
+            paint.shader = entry.shader;
+        } else {
+            paint.shader = nullptr;
+            paint.color = entry.color;
+        }
+    }
+
+    FakePath *GetPathRun(uint32_t index) {
+        if (path_runs_.size() < display_list_.PathRunCount()) {
+            path_runs_.resize(display_list_.PathRunCount());
+        }
+        auto &entry = path_runs_[index];
+        if (entry.path == nullptr) {
+            entry.path = new FakePath();
+        }
+        const auto &run = display_list_.PathRun(index);
+        for (; entry.built_count < run.count; entry.built_count++) {
+            ApplyPathOp(entry.path, display_list_.PathOp(run.first + entry.built_count));
+        }
+        return entry.path;
+    }
+
+    void ApplyPathOp(FakePath *path, const KRCanvasOp &op) {
+        const float *a = display_list_.Args(op);
+        switch (op.code) {
+        case KRCanvasOpCode::kMoveTo:
+            path->Add(kVerbMove, {a[0], a[1]});
+            break;
+        case KRCanvasOpCode::kLineTo:
+            path->Add(kVerbLine, {a[0], a[1]});
+            break;
+        case KRCanvasOpCode::kArc:
+            path->Add(kVerbArc, {a[0], a[1], a[2], a[3], a[4], a[5]});
+            break;
+        case KRCanvasOpCode::kClosePath:
+            path->Add(kVerbClose, {});
+            break;
+        case KRCanvasOpCode::kQuadTo:
+            path->Add(kVerbQuad, {a[0], a[1], a[2], a[3]});
+            break;
+        case KRCanvasOpCode::kCubicTo:
+            path->Add(kVerbCubic, {a[0], a[1], a[2], a[3], a[4], a[5]});
+            break;
+        default:
+            break;
+        }
+    }
+
+    void ReleaseDrawingPath() {
+        if (owns_path_) {
+            delete path_;
+        }
+        path_ = nullptr;
+        owns_path_ = false;
+    }
+
+    void Replay(const KRCanvasOp &op) {
+        const float *args = display_list_.Args(op);
+        switch (op.code) {
+        case KRCanvasOpCode::kLineCap:
+            pen_.cap = static_cast<int>(op.ref);
+            break;
+        case KRCanvasOpCode::kLineWidth:
+            pen_.width = args[0];
+            break;
+        case KRCanvasOpCode::kLineDash:
+            if (op.ref == KRCanvasDisplayList::kInvalidRef) {
+                pen_.effect = nullptr;
+                break;
+            }
+            if (dash_effects_.size() < display_list_.DashCount()) {
+                dash_effects_.resize(display_list_.DashCount(), nullptr);
+            }
+            if (dash_effects_[op.ref] == nullptr) {
+                dash_effects_[op.ref] = new FakeEffect();
+                dash_effects_[op.ref]->intervals = display_list_.Dash(op.ref);
+            }
+            pen_.effect = dash_effects_[op.ref];
+            break;
+        case KRCanvasOpCode::kStrokeStyle:
+            ApplyStyle(pen_, ResolveStyle(stroke_styles_, op.ref));
+            break;
+        case KRCanvasOpCode::kFillStyle:
+            ApplyStyle(brush_, ResolveStyle(fill_styles_, op.ref));
+            break;
+        case KRCanvasOpCode::kPath:
+            ReleaseDrawingPath();
+            path_ = GetPathRun(op.ref);
+            break;
+        case KRCanvasOpCode::kMoveTo:
+        case KRCanvasOpCode::kLineTo:
+        case KRCanvasOpCode::kArc:
+        case KRCanvasOpCode::kClosePath:
+        case KRCanvasOpCode::kQuadTo:
+        case KRCanvasOpCode::kCubicTo:
+            if (path_ == nullptr) {
+                break;
+            }
+            if (!owns_path_) {
+                path_ = new FakePath(*path_);
+                owns_path_ = true;
+            }
+            ApplyPathOp(path_, op);
+            break;
+        case KRCanvasOpCode::kStroke:
+            if (path_) {
+                canvas_->DrawPath(kTagStroke, *path_, pen_);
+            }
+            break;
+        case KRCanvasOpCode::kFill:
+            if (path_) {
+                canvas_->DrawPath(kTagFill, *path_, brush_);
+            }
+            break;
+        case KRCanvasOpCode::kTextAlign:
+            align_ = static_cast<int>(op.ref);
+            break;
+        case KRCanvasOpCode::kFont:
+            font_size_ = args[0];
+            italic_ = args[1] != 0;
+            weight_ = static_cast<int>(args[2]);
+            family_ = display_list_.String(op.ref);
+            break;
+        case KRCanvasOpCode::kFillText:
+        case KRCanvasOpCode::kStrokeText:
+            canvas_->Mix(display_list_.String(op.ref));
+            canvas_->Mix(family_);
+            canvas_->Op(kTagText, {args[0], args[1], font_size_, static_cast<float>(italic_),
+                                   static_cast<float>(weight_), static_cast<float>(align_)});
+            canvas_->MixPaint(op.code == KRCanvasOpCode::kFillText ? brush_ : pen_);
+            break;
+        case KRCanvasOpCode::kSave:
+            canvas_->Op(kTagSave, {});
+            break;
+        case KRCanvasOpCode::kRestore:
+            canvas_->Op(kTagRestore, {});
+            break;
+        case KRCanvasOpCode::kTranslate:
+            canvas_->Op(kTagTranslate, {args[0], args[1]});
+            break;
+        case KRCanvasOpCode::kScale:
+            canvas_->Op(kTagScale, {args[0], args[1]});
+            break;
+        case KRCanvasOpCode::kRotate:
+            canvas_->Op(kTagRotate, {args[0]});
+            break;
+        default:
+            break;
+        }
+    }
+
+    FakeCanvas *canvas_ = nullptr;
+    KRCanvasDisplayList display_list_;
+    FakePath *path_ = nullptr;
+    bool owns_path_ = false;
+    std::vector<StyleEntry> stroke_styles_;
+    std::vector<StyleEntry> fill_styles_;
+    std::vector<FakeEffect *> dash_effects_;
+    std::vector<PathEntry> path_runs_;
+    FakePaint pen_;
+    FakePaint brush_;
+    int align_ = 0;
+    float font_size_ = 15;
+    bool italic_ = false;
+    int weight_ = 400;
+    std::string family_;
+};
+
+// ---------------------------------------------------------------------------
+// 录制一张图表: 网格 + 坐标标签 + 折线 + 渐变面积 + 数据点 + 柱状
+// ---------------------------------------------------------------------------
+using OpList = std::vector<std::pair<std::string, std::string>>;
+
+static std::string Fmt(const char *format, ...) __attribute__((format(printf, 1, 2)));
+static std::string Fmt(const char *format, ...) {
+    char buf[512];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    return buf;
+}
+
+static OpList RecordChart(int points) {
+    OpList ops;
+    auto add = [&ops](const char *method, std::string params = "") { ops.emplace_back(method, std::move(params)); };
+    auto value = [](int i) { return 150 + 80 * std::sin(i * 0.07) + 20 * std::sin(i * 0.31); };
+    const float width = 600;
+    const float step = width / points;
+
+    add("save");
+    add("translate", R"({"x":40,"y":20})");
+    // 网格
+    add("lineWidth", R"({"width":1})");
+    add("strokeStyle", R"({"style":"#E0E0E0"})");
+    add("lineDash", R"({"intervals":[4,4]})");
+    for (int i = 0; i <= 10; i++) {
+        add("beginPath");
+        add("moveTo", Fmt(R"({"x":0,"y":%d})", i * 30));
+        add("lineTo", Fmt(R"({"x":%g,"y":%d})", width, i * 30));
+        add("stroke");
+    }
+    add("lineDash", R"({"intervals":[]})");
+    // 坐标标签
+    add("font", R"({"size":11,"style":"normal","weight":"400","family":""})");
+    add("textAlign", "right");
+    add("fillStyle", R"({"style":"#666666"})");
+    for (int i = 0; i <= 10; i++) {
+        add("fillText", Fmt(R"({"text":"%d","x":-6,"y":%d})", 300 - i * 30, i * 30 + 4));
+    }
+    // 渐变面积
+    add("fillStyle",
+        R"({"style":"linear-gradient{\"x0\":0,\"y0\":0,\"x1\":0,\"y1\":300,\"colorStops\":\"#3366FF 0,#FFFFFF 1\"}"})");
+    add("beginPath");
+    add("moveTo", Fmt(R"({"x":0,"y":%.2f})", value(0)));
+    for (int i = 1; i < points; i++) {
+        add("lineTo", Fmt(R"({"x":%.2f,"y":%.2f})", i * step, value(i)));
+    }
+    add("lineTo", Fmt(R"({"x":%.2f,"y":300})", (points - 1) * step));
+    add("lineTo", R"({"x":0,"y":300})");
+    add("closePath");
+    add("fill");
+    // 折线: 线宽/颜色穿插在路径命令中, 仍归入同一路径段
+    add("beginPath");
+    add("moveTo", Fmt(R"({"x":0,"y":%.2f})", value(0)));
+    add("strokeStyle", R"({"style":"#3366FF"})");
+    add("lineWidth", R"({"width":2})");
+    add("lineCap", R"({"style":"round"})");
+    for (int i = 1; i < points; i++) {
+        add("lineTo", Fmt(R"({"x":%.2f,"y":%.2f})", i * step, value(i)));
+    }
+    add("stroke");
+    // stroke 之后不经 beginPath 继续追加路径
+    add("lineTo", Fmt(R"({"x":%g,"y":0})", width));
+    add("stroke");
+    // 数据点
+    add("fillStyle", R"({"style":"#3366FF"})");
+    for (int i = 0; i < points; i += 4) {
+        add("beginPath");
+        add("arc", Fmt(R"({"x":%.2f,"y":%.2f,"r":3,"sAngle":0,"eAngle":6.2832,"counterclockwise":0})", i * step,
+                       value(i)));
+        add("fill");
+    }
+    // 柱状
+    for (int i = 0; i < 20; i++) {
+        add("fillStyle", i % 2 ? R"({"style":"#FF9933"})" : R"({"style":"#33CC99"})");
+        float x = i * 30 + 5;
+        float h = 40 + (i * 37) % 90;
+        add("beginPath");
+        add("moveTo", Fmt(R"({"x":%g,"y":300})", x));
+        add("lineTo", Fmt(R"({"x":%g,"y":%g})", x, 300 - h));
+        add("quadraticCurveTo", Fmt(R"({"cpx":%g,"cpy":%g,"x":%g,"y":%g})", x + 10, 300 - h - 8, x + 20, 300 - h));
+        add("lineTo", Fmt(R"({"x":%g,"y":300})", x + 20));
+        add("closePath");
+        add("fill");
+    }
+    add("restore");
+    return ops;
+}
+
+template <typename Canvas>
+static uint64_t DrawFrame(Canvas &canvas, int *draw_calls = nullptr) {
+    FakeCanvas fake;
+    canvas.OnDraw(fake);
+    if (draw_calls) {
+        *draw_calls = fake.draw_calls;
+    }
+    return fake.hash;
+}
+
+// A: 多帧回放结果一致
+static void TestEquivalence(const OpList &ops) {
+    LegacyCanvas legacy;
+    CompiledCanvas compiled;
+    for (auto &op : ops) {
+        legacy.AddOp(op.first, op.second);
+        compiled.AddOp(op.first, op.second);
+    }
+    int legacy_draws = 0;
+    int compiled_draws = 0;
+    bool same = true;
+    for (int frame = 0; frame < 3; frame++) {
+        same = same && DrawFrame(legacy, &legacy_draws) == DrawFrame(compiled, &compiled_draws);
+    }
+    CHECK("A", same);
+    CHECK("A", legacy_draws == compiled_draws && compiled_draws > 0);
+}
+
+// B: 分批到达 + 参数语义
+static void TestIncremental(const OpList &ops) {
+    LegacyCanvas legacy;
+    CompiledCanvas compiled;
+    bool same = true;
+    size_t batches = 0;
+    // 批次边界落在路径段中间, 未结束的路径段跨批次增长
+    for (size_t begin = 0; begin < ops.size(); begin += 333, batches++) {
+        size_t end = std::min(ops.size(), begin + 333);
+        for (size_t i = begin; i < end; i++) {
+            legacy.AddOp(ops[i].first, ops[i].second);
+            compiled.AddOp(ops[i].first, ops[i].second);
+        }
+        same = same && DrawFrame(legacy) == DrawFrame(compiled);
+    }
+    CHECK("B", batches > 3 && same);
+
+    KRCanvasDisplayList list;
+    list.Append("drawImage", R"({"cacheKey":"img","sx":1,"sy":2,"dx":3,"dy":4})");
+    list.Append("drawImage", R"({"cacheKey":"img","sx":1,"sy":2,"sWidth":10,"sHeight":20,"dx":3,"dy":4,"dWidth":5})");
+    const float *a0 = list.Args(list.Ops()[0]);
+    const float *a1 = list.Args(list.Ops()[1]);
+    CHECK("B", a0[2] == -1 && a0[3] == -1 && std::isnan(a0[6]) && std::isnan(a0[7]));
+    CHECK("B", a1[2] == 10 && a1[6] == 5 && std::isnan(a1[7]));
+    CHECK("B", list.Ops()[0].ref == list.Ops()[1].ref && list.StringCount() == 1);
+    CHECK("B", !list.Append("createLinearGradient", "{}") && !list.Append("textAlign", "justify"));
+    CHECK("B", !list.Append("transform", R"({"values":[1,0,0,0,1,0]})") && list.Ops().size() == 2);
+}
+
+// C: reset 释放全部对象
+static void TestReset(const OpList &ops) {
+    {
+        CompiledCanvas compiled;
+        for (int round = 0; round < 3; round++) {
+            for (auto &op : ops) {
+                compiled.AddOp(op.first, op.second);
+            }
+            DrawFrame(compiled);
+            compiled.Reset();
+            CHECK("C", compiled.DisplayList().Empty() && compiled.DisplayList().StringCount() == 0);
+            CHECK("C", g_live_paths == 0 && g_live_shaders == 0 && g_live_effects == 0);
+        }
+    }
+    CHECK("C", g_live_paths == 0 && g_live_shaders == 0 && g_live_effects == 0);
+}
+
+struct BenchResult {
+    double us_per_frame = 0;
+    double creates_per_frame = 0;
+    uint64_t hash = 0;
+};
+
+template <typename Canvas>
+static BenchResult Bench(Canvas &canvas, int frames) {
+    DrawFrame(canvas);  // 预热: 编译后实现在首帧创建平台对象
+    long creates = g_native_creates;
+    BenchResult result;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        result.hash ^= DrawFrame(canvas) + i;
+    }
+    auto cost = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    result.us_per_frame = cost / frames;
+    result.creates_per_frame = static_cast<double>(g_native_creates - creates) / frames;
+    return result;
+}
+
+int main(int argc, char **argv) {
+    int frames = argc > 1 ? atoi(argv[1]) : 300;
+    auto ops = RecordChart(640);
+
+    TestEquivalence(ops);
+    TestIncremental(ops);
+    TestReset(ops);
+
+    LegacyCanvas legacy;
+    CompiledCanvas compiled;
+    for (auto &op : ops) {
+        legacy.AddOp(op.first, op.second);
+    }
+    auto compile_start = std::chrono::steady_clock::now();
+    for (auto &op : ops) {
+        compiled.AddOp(op.first, op.second);
+    }
+    auto compile_us =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - compile_start).count();
+
+    auto legacy_result = Bench(legacy, frames);
+    auto compiled_result = Bench(compiled, frames);
+    CHECK("D", legacy_result.hash == compiled_result.hash);
+    // 只剩 stroke 后直接追加路径时的写时复制
+    CHECK("D", compiled_result.creates_per_frame * 100 < legacy_result.creates_per_frame);
+    CHECK("D", compiled_result.us_per_frame < legacy_result.us_per_frame);
+
+    printf("ops=%zu frames=%d compiled_ops=%zu path_runs=%zu compile=%.1f us (once)\n", ops.size(), frames,
+           compiled.DisplayList().Ops().size(), compiled.DisplayList().PathRunCount(), compile_us);
+    printf("%-10s %12s %16s\n", "impl", "us/frame", "creates/frame");
+    printf("%-10s %12.1f %16.1f\n", "legacy", legacy_result.us_per_frame, legacy_result.creates_per_frame);
+    printf("%-10s %12.1f %16.1f\n", "compiled", compiled_result.us_per_frame, compiled_result.creates_per_frame);
+    printf("speedup x%.1f\n", legacy_result.us_per_frame / compiled_result.us_per_frame);
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
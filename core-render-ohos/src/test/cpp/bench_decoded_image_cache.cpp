@@ -0,0 +1,567 @@
+// 测试+基准: bench_decoded_image_cache
+//
+// 目标:
+//   验证 KRDecodedImageCache (本地图片按视图尺寸降采样解码 + 进程级缓存) 的正确性,
+//   并模拟 1000 行图片列表上下滚动, 对比解码次数与常驻位图字节数:
+//   1) 旧实现: 每次复用 cell 绑定新数据都按原图分辨率重新解码, 位图由 cell 独占;
+//   2) 新实现: 以 (uri, 目标像素尺寸, 像素格式) 为 key 查缓存, 按视图像素尺寸降采样解码,
+//      同 key 的并发解码合并为一次, 按字节预算 LRU 淘汰。
+//
+// 说明:
+//   KRDecodedImageCache.h 只依赖标准库, 这里直接包含生产实现;
+//   OH_ImageSource 解码用 FakeDecoder 模拟: 按 ComputeDecodeSize 计算解码尺寸, 对每个像素做少量计算模拟解码开销,
+//   通过 KRDecodedImage 的析构统计常驻字节。load_executor 为 2 线程的 WorkerPool, callback_executor 为单线程的
+//   WorkerPool (模拟主线程), 每滚动一行等待解码和回调完成 (模拟帧间隔)。
+//   每行包含一个 40x40 vp 头像 (原图 400x400, 20 个用户循环出现) 和一张 160x90 vp 配图 (原图 1280x720, 每行不同),
+//   dpi = 3。滚动方式为滚到底再滚回顶部, 往返多次。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_decoded_image_cache.cpp -o bench_decoded_image_cache
+//   运行:
+//   ./bench_decoded_image_cache            # 默认 1000 行, 往返滚动 2 次
+//   ./bench_decoded_image_cache 5000 3
+//
+// 验证项:
+//   A. 解码尺寸: 等比缩放到恰好覆盖视图像素尺寸, 不放大; key 区分目标尺寸与像素格式; svg uri 识别为矢量图
+//   B. 请求合并: 同 key 的并发请求只解码一次, 回调收到同一对象; DecodeSync 命中缓存不再解码;
+//                IsCached 区分仍在缓存中与已淘汰的位图, 缓存与外部持有者的字节统计不重复
+//   C. 字节预算: 滚动过程中缓存字节不超过预算, 超出时按 LRU 淘汰
+//   E. 动图/解码失败: Fetch 缓存 passthrough 条目, 再次绑定直接回调空且不重复解码; DecodeSync 不受其影响
+//   D. 滚动列表: 新实现解码次数、解码输出字节与常驻字节均显著少于旧实现, 每个可见 cell 最终显示正确的图片
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/expand/components/image/KRDecodedImageCache.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+// ---------------------------------------------------------------------------
+// 0. 执行器与模拟解码
+// ---------------------------------------------------------------------------
+class WorkerPool {
+ public:
+    explicit WorkerPool(int thread_count) {
+        for (int i = 0; i < thread_count; i++) {
+            threads_.emplace_back([this] { Run(); });
+        }
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopped_ = true;
+        }
+        cv_.notify_all();
+        for (auto &thread : threads_) {
+            thread.join();
+        }
+    }
+
+    void Post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    void Drain() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_cv_.wait(lock, [this] { return tasks_.empty() && running_ == 0; });
+    }
+
+ private:
+    void Run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this] { return stopped_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            running_++;
+            lock.unlock();
+            task();
+            task = nullptr;
+            lock.lock();
+            running_--;
+            if (tasks_.empty() && running_ == 0) {
+                idle_cv_.notify_all();
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable idle_cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> threads_;
+    int running_ = 0;
+    bool stopped_ = false;
+};
+
+struct SourceImage {
+    int32_t width;
+    int32_t height;
+};
+
+// 原图尺寸由 uri 决定: avatar_* 为 400x400, cover_* 为 1280x720; broken_* 模拟动图或解码失败
+static SourceImage SourceOf(const std::string &uri) {
+    return uri.compare(0, 7, "avatar_") == 0 ? SourceImage{400, 400} : SourceImage{1280, 720};
+}
+
+static std::atomic<uint64_t> g_decode_count{0};
+static std::atomic<uint64_t> g_decoded_bytes{0};
+static std::atomic<int64_t> g_live_bytes{0};
+static std::atomic<int64_t> g_peak_live_bytes{0};
+static std::atomic<uint64_t> g_sink{0};
+
+static void TrackLiveBytes(int64_t delta) {
+    int64_t now = g_live_bytes.fetch_add(delta) + delta;
+    int64_t peak = g_peak_live_bytes.load();
+    while (now > peak && !g_peak_live_bytes.compare_exchange_weak(peak, now)) {
+    }
+}
+
+static void ResetCounters() {
+    g_decode_count = 0;
+    g_decoded_bytes = 0;
+    g_live_bytes = 0;
+    g_peak_live_bytes = 0;
+}
+
+// 模拟 OH_ImageSourceNative 解码: 目标尺寸为 0 时按原图解码, 否则按 ComputeDecodeSize 降采样
+static KRDecodedImageCache::ImagePtr FakeDecode(const std::string &uri, int32_t target_width, int32_t target_height,
+                                                int32_t) {
+    g_decode_count++;
+    if (uri.compare(0, 7, "broken_") == 0) {
+        return nullptr;
+    }
+    auto source = SourceOf(uri);
+    auto size = KRDecodedImageCache::ComputeDecodeSize(source.width, source.height, target_width, target_height);
+    size_t bytes = static_cast<size_t>(size.width) * size.height * 4;
+    g_decoded_bytes += bytes;
+    // 解码开销与输出像素数成正比 (降采样解码器按块跳读)
+    uint64_t h = std::hash<std::string>()(uri);
+    for (size_t i = 0; i < bytes / 16; i++) {
+        h = h * 1099511628211ULL + i;
+    }
+    g_sink += h;
+    auto *image = new KRDecodedImage();
+    image->width = size.width;
+    image->height = size.height;
+    image->source_width = source.width;
+    image->source_height = source.height;
+    image->byte_count = bytes;
+    TrackLiveBytes(static_cast<int64_t>(bytes));
+    return KRDecodedImageCache::ImagePtr(image, [](KRDecodedImage *p) {
+        TrackLiveBytes(-static_cast<int64_t>(p->byte_count));
+        delete p;
+    });
+}
+
+static KRDecodedImageCache::Executor PoolExecutor(WorkerPool &pool) {
+    return [&pool](std::function<void()> task) { pool.Post(std::move(task)); };
+}
+
+// ---------------------------------------------------------------------------
+// A. 解码尺寸与 key
+// ---------------------------------------------------------------------------
+static void TestDecodeSize() {
+    printf("\n===== A. 解码尺寸与 key =====\n");
+    auto s = KRDecodedImageCache::ComputeDecodeSize(400, 400, 120, 120);
+    CHECK("A", s.width == 120 && s.height == 120);
+    // 16:9 原图放进 1:1 视图: 短边对齐视图, 长边按比例 (覆盖 cover 裁剪区域)
+    s = KRDecodedImageCache::ComputeDecodeSize(1280, 720, 120, 120);
+    CHECK("A", s.height == 120 && s.width == 214);
+    // 放进细长视图: 宽度对齐视图
+    s = KRDecodedImageCache::ComputeDecodeSize(1280, 720, 640, 60);
+    CHECK("A", s.width == 640 && s.height == 360);
+    // 不放大
+    s = KRDecodedImageCache::ComputeDecodeSize(100, 50, 300, 300);
+    CHECK("A", s.width == 100 && s.height == 50);
+    s = KRDecodedImageCache::ComputeDecodeSize(400, 400, 0, 0);
+    CHECK("A", s.width == 400 && s.height == 400);
+    // 解码尺寸始终覆盖目标尺寸
+    bool covers = true;
+    for (int sw = 1; sw <= 600; sw += 7) {
+        for (int tw = 1; tw <= 300; tw += 11) {
+            auto r = KRDecodedImageCache::ComputeDecodeSize(sw, 480, tw, 97);
+            covers = covers && r.width >= std::min(sw, tw) && r.height >= 97 && r.width <= sw && r.height <= 480;
+        }
+    }
+    CHECK("A", covers);
+    CHECK("A", KRDecodedImageCache::ToPixelSize(40, 3.0) == 120);
+    CHECK("A", KRDecodedImageCache::ToPixelSize(40.1, 3.0) == 121);
+    CHECK("A", KRDecodedImageCache::ToPixelSize(33.333333, 3.0) == 100);
+    CHECK("A", KRDecodedImageCache::ToPixelSize(0, 3.0) == 0);
+
+    auto k1 = KRDecodedImageCache::MakeCacheKey("file://a.png", 120, 120, KRDecodedImageCache::kPixelFormatRGBA8888);
+    auto k2 = KRDecodedImageCache::MakeCacheKey("file://a.png", 121, 120, KRDecodedImageCache::kPixelFormatRGBA8888);
+    auto k3 = KRDecodedImageCache::MakeCacheKey("file://a.png", 120, 120, KRDecodedImageCache::kPixelFormatAuto);
+    auto k4 = KRDecodedImageCache::MakeCacheKey("file://a.png", 120, 120, KRDecodedImageCache::kPixelFormatRGBA8888);
+    CHECK("A", k1 != k2 && k1 != k3 && k1 == k4);
+    // 尺寸前缀不会与 uri 内容混淆
+    CHECK("A", KRDecodedImageCache::MakeCacheKey("2x3@3|u", 1, 1, 3) != KRDecodedImageCache::MakeCacheKey("u", 1, 1, 3));
+    // 矢量图不走位图解码
+    CHECK("A", KRDecodedImageCache::IsVectorImageUri("file://data/icon.svg"));
+    CHECK("A", KRDecodedImageCache::IsVectorImageUri("file://data/ICON.SVG?v=2"));
+    CHECK("A", KRDecodedImageCache::IsVectorImageUri("resource://rawfile/a.svg#frag"));
+    CHECK("A", !KRDecodedImageCache::IsVectorImageUri("file://data/icon.png"));
+    CHECK("A", !KRDecodedImageCache::IsVectorImageUri("file://data/icon.svgz.png"));
+    CHECK("A", !KRDecodedImageCache::IsVectorImageUri("svg"));
+}
+
+// ---------------------------------------------------------------------------
+// E. 动图/解码失败
+// ---------------------------------------------------------------------------
+static void TestPassthrough() {
+    printf("\n===== E. 动图/解码失败 =====\n");
+    ResetCounters();
+    WorkerPool loader(2);
+    WorkerPool main_thread(1);
+    {
+        KRDecodedImageCache cache(8 << 20, FakeDecode, PoolExecutor(loader), PoolExecutor(main_thread));
+        const auto format = KRDecodedImageCache::kPixelFormatAuto;
+        std::atomic<int> callbacks{0};
+        std::atomic<int> non_null{0};
+        auto completion = [&](KRDecodedImageCache::ImagePtr image) {
+            non_null += image ? 1 : 0;
+            callbacks++;
+        };
+        for (int i = 0; i < 4; i++) {
+            cache.Fetch("broken_1", 120, 120, format, completion);
+        }
+        loader.Drain();
+        main_thread.Drain();
+        CHECK("E", callbacks.load() == 4 && non_null.load() == 0 && g_decode_count.load() == 1);
+        // 复用 cell 再次绑定: 命中 passthrough 条目, 同步回调空, 不再解码
+        uint64_t request_id = cache.Fetch("broken_1", 120, 120, format, completion);
+        CHECK("E", request_id == 0 && callbacks.load() == 5 && non_null.load() == 0 && g_decode_count.load() == 1);
+        auto stats = cache.GetStats();
+        CHECK("E", stats.hit_count == 1 && stats.bytes < 1024);
+        // 占位条目不会作为位图交给同步调用方, 失败结果也不写入缓存
+        CHECK("E", cache.DecodeSync("broken_1", 120, 120, format) == nullptr && g_decode_count.load() == 2);
+        CHECK("E", cache.DecodeSync("broken_2", 0, 0, format) == nullptr);
+        CHECK("E", cache.DecodeSync("broken_2", 0, 0, format) == nullptr && g_decode_count.load() == 4);
+    }
+    CHECK("E", g_live_bytes.load() == 0);
+}
+
+// ---------------------------------------------------------------------------
+// B. 请求合并
+// ---------------------------------------------------------------------------
+static void TestCoalescing() {
+    printf("\n===== B. 请求合并 =====\n");
+    ResetCounters();
+    WorkerPool loaders(2);
+    WorkerPool main_thread(1);
+    std::mutex gate_mutex;
+    std::condition_variable gate_cv;
+    bool gate_open = false;
+    auto blocking_decoder = [&](const std::string &uri, int32_t w, int32_t h, int32_t format) {
+        std::unique_lock<std::mutex> lock(gate_mutex);
+        gate_cv.wait(lock, [&] { return gate_open; });
+        lock.unlock();
+        return FakeDecode(uri, w, h, format);
+    };
+    {
+        KRDecodedImageCache cache(8 << 20, blocking_decoder, PoolExecutor(loaders), PoolExecutor(main_thread));
+        std::mutex results_mutex;
+        std::vector<KRDecodedImageCache::ImagePtr> results;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 16; t++) {
+            threads.emplace_back([&] {
+                cache.Fetch("avatar_1", 120, 120, KRDecodedImageCache::kPixelFormatRGBA8888,
+                            [&](KRDecodedImageCache::ImagePtr image) {
+                                std::lock_guard<std::mutex> lock(results_mutex);
+                                results.push_back(image);
+                            });
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        {
+            std::lock_guard<std::mutex> lock(gate_mutex);
+            gate_open = true;
+        }
+        gate_cv.notify_all();
+        loaders.Drain();
+        main_thread.Drain();
+        bool same = results.size() == 16 && results[0] != nullptr;
+        for (const auto &image : results) {
+            same = same && image == results[0];
+        }
+        auto stats = cache.GetStats();
+        CHECK("B", g_decode_count.load() == 1);
+        CHECK("B", same && results[0]->width == 120 && results[0]->byte_count == 120 * 120 * 4);
+        CHECK("B", stats.load_count == 1 && stats.coalesced_count == 15);
+
+        auto sync_image = cache.DecodeSync("avatar_1", 120, 120, KRDecodedImageCache::kPixelFormatRGBA8888);
+        CHECK("B", sync_image == results[0] && g_decode_count.load() == 1);
+        auto full = cache.DecodeSync("avatar_1", 0, 0, KRDecodedImageCache::kPixelFormatAuto);
+        CHECK("B", full && full->width == 400 && g_decode_count.load() == 2);
+        CHECK("B", cache.DecodeSync("avatar_1", 0, 0, KRDecodedImageCache::kPixelFormatAuto) == full);
+        CHECK("B", cache.GetStats().bytes == 120 * 120 * 4 + 400 * 400 * 4);
+
+        // 与 KRMemoryCacheModule 的统计一致: 外部持有者只统计已被淘汰的位图, 两边合计不重复
+        auto holder_bytes = [&cache](const std::vector<KRDecodedImageCache::ImagePtr> &held) {
+            size_t bytes = 0;
+            for (const auto &image : held) {
+                bytes += cache.IsCached(image) ? 0 : image->byte_count;
+            }
+            return bytes;
+        };
+        std::vector<KRDecodedImageCache::ImagePtr> held = {full};
+        CHECK("B", cache.IsCached(full) && cache.IsCached(sync_image));
+        CHECK("B", holder_bytes(held) + cache.GetStats().bytes == 120 * 120 * 4 + 400 * 400 * 4);
+        cache.TrimToBytes(0);
+        CHECK("B", !cache.IsCached(full) && cache.GetStats().bytes == 0);
+        CHECK("B", holder_bytes(held) + cache.GetStats().bytes == 400 * 400 * 4);
+        // 重新解码得到新对象, 旧对象仍不算在缓存中
+        auto refreshed = cache.DecodeSync("avatar_1", 0, 0, KRDecodedImageCache::kPixelFormatAuto);
+        CHECK("B", cache.IsCached(refreshed) && !cache.IsCached(full) && !cache.IsCached(nullptr));
+    }
+    CHECK("B", g_live_bytes.load() == 0);
+}
+
+// ---------------------------------------------------------------------------
+// C/D. 滚动列表
+// ---------------------------------------------------------------------------
+struct ListConfig {
+    int row_count = 1000;
+    int round_trips = 2;
+    int visible_rows = 8;       // 一屏可见行数
+    int avatar_users = 20;
+    double dpi = 3.0;
+    double avatar_vp = 40;
+    double cover_width_vp = 160;
+    double cover_height_vp = 90;
+};
+
+struct ScrollResult {
+    uint64_t binds = 0;
+    uint64_t decodes = 0;
+    uint64_t decoded_bytes = 0;
+    int64_t peak_bytes = 0;
+    size_t peak_cache_bytes = 0;
+    double ms = 0;
+    bool all_correct = true;
+    KRDecodedImageCache::Stats stats;
+};
+
+static std::string AvatarUri(int row, const ListConfig &config) {
+    return "avatar_" + std::to_string(row % config.avatar_users);
+}
+
+static std::string CoverUri(int row, const ListConfig &) {
+    return "cover_" + std::to_string(row);
+}
+
+// 按滚动顺序产生每一步需要绑定的行: 先向下滚到底, 再滚回顶部, 重复 round_trips 次
+template <typename BindRow>
+static void ScrollList(const ListConfig &config, BindRow &&bind_row) {
+    for (int row = 0; row < config.visible_rows; row++) {
+        bind_row(row);
+    }
+    for (int trip = 0; trip < config.round_trips; trip++) {
+        for (int top = 1; top + config.visible_rows <= config.row_count; top++) {
+            bind_row(top + config.visible_rows - 1);
+        }
+        for (int top = config.row_count - config.visible_rows - 1; top >= 0; top--) {
+            bind_row(top);
+        }
+    }
+}
+
+struct Cell {
+    int row = -1;
+    KRDecodedImageCache::ImagePtr avatar;
+    KRDecodedImageCache::ImagePtr cover;
+    uint64_t avatar_request = 0;
+    uint64_t cover_request = 0;
+};
+
+// 旧实现: cell 复用时按原图分辨率重新解码, 位图由 cell 独占
+static ScrollResult RunEager(const ListConfig &config) {
+    ResetCounters();
+    ScrollResult result;
+    auto start = std::chrono::steady_clock::now();
+    {
+        std::vector<Cell> cells(config.visible_rows + 1);
+        ScrollList(config, [&](int row) {
+            Cell &cell = cells[row % cells.size()];
+            cell.row = row;
+            cell.avatar = nullptr;
+            cell.cover = nullptr;
+            cell.avatar = FakeDecode(AvatarUri(row, config), 0, 0, 0);
+            cell.cover = FakeDecode(CoverUri(row, config), 0, 0, 0);
+            result.binds++;
+        });
+    }
+    result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    result.decodes = g_decode_count.load();
+    result.decoded_bytes = g_decoded_bytes.load();
+    result.peak_bytes = g_peak_live_bytes.load();
+    return result;
+}
+
+static ScrollResult RunCached(const ListConfig &config, size_t capacity_bytes) {
+    ResetCounters();
+    ScrollResult result;
+    auto start = std::chrono::steady_clock::now();
+    {
+        WorkerPool loaders(2);
+        WorkerPool main_thread(1);
+        KRDecodedImageCache cache(capacity_bytes, FakeDecode, PoolExecutor(loaders), PoolExecutor(main_thread));
+        int32_t avatar_px = KRDecodedImageCache::ToPixelSize(config.avatar_vp, config.dpi);
+        int32_t cover_w_px = KRDecodedImageCache::ToPixelSize(config.cover_width_vp, config.dpi);
+        int32_t cover_h_px = KRDecodedImageCache::ToPixelSize(config.cover_height_vp, config.dpi);
+        // cells 只在 main_thread 上访问
+        std::vector<Cell> cells(config.visible_rows + 1);
+
+        auto fetch = [&](Cell &cell, const std::string &uri, int32_t w, int32_t h, bool is_avatar) {
+            int row = cell.row;
+            Cell *target = &cell;
+            uint64_t id = cache.Fetch(uri, w, h, KRDecodedImageCache::kPixelFormatRGBA8888,
+                                      [target, row, is_avatar](KRDecodedImageCache::ImagePtr image) {
+                                          if (target->row != row) {
+                                              return;
+                                          }
+                                          (is_avatar ? target->avatar : target->cover) = image;
+                                          (is_avatar ? target->avatar_request : target->cover_request) = 0;
+                                      });
+            if (id != 0) {
+                (is_avatar ? cell.avatar_request : cell.cover_request) = id;
+            }
+        };
+
+        ScrollList(config, [&](int row) {
+            main_thread.Post([&, row] {
+                Cell &cell = cells[row % cells.size()];
+                // 复用 cell: 取消旧数据未完成的请求 (对应 KRImageView::ResetDecodedImage)
+                cache.Cancel(cell.avatar_request);
+                cache.Cancel(cell.cover_request);
+                cell.avatar_request = 0;
+                cell.cover_request = 0;
+                cell.avatar = nullptr;
+                cell.cover = nullptr;
+                cell.row = row;
+                fetch(cell, AvatarUri(row, config), avatar_px, avatar_px, true);
+                fetch(cell, CoverUri(row, config), cover_w_px, cover_h_px, false);
+            });
+            result.binds++;
+            // 帧间隔内解码完成并回调
+            main_thread.Drain();
+            loaders.Drain();
+            main_thread.Drain();
+            result.peak_cache_bytes = std::max(result.peak_cache_bytes, cache.GetStats().bytes);
+        });
+
+        // 校验可见 cell 显示的图片
+        main_thread.Post([&] {
+            for (const auto &cell : cells) {
+                if (cell.row < 0) {
+                    continue;
+                }
+                auto avatar_source = SourceOf(AvatarUri(cell.row, config));
+                auto expect_avatar = KRDecodedImageCache::ComputeDecodeSize(avatar_source.width, avatar_source.height,
+                                                                            avatar_px, avatar_px);
+                bool ok = cell.avatar && cell.cover && cell.avatar->width == expect_avatar.width &&
+                          cell.cover->width >= cover_w_px && cell.cover->height >= cover_h_px &&
+                          cell.cover->width < 1280;
+                result.all_correct = result.all_correct && ok;
+            }
+        });
+        main_thread.Drain();
+        result.stats = cache.GetStats();
+    }
+    result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    result.decodes = g_decode_count.load();
+    result.decoded_bytes = g_decoded_bytes.load();
+    result.peak_bytes = g_peak_live_bytes.load();
+    return result;
+}
+
+static void PrintResult(const char *name, const ScrollResult &r) {
+    printf("  %-28s 绑定 %5llu 次, 解码 %5llu 次, 解码输出 %8.1f MB, 常驻位图峰值 %6.2f MB, 耗时 %7.1f ms\n", name,
+           static_cast<unsigned long long>(r.binds), static_cast<unsigned long long>(r.decodes),
+           r.decoded_bytes / 1048576.0, r.peak_bytes / 1048576.0, r.ms);
+    if (r.stats.miss_count > 0) {
+        printf("  %-28s hit %5llu, miss %5llu, evict %5llu, 缓存峰值 %6.2f MB\n", "",
+               static_cast<unsigned long long>(r.stats.hit_count), static_cast<unsigned long long>(r.stats.miss_count),
+               static_cast<unsigned long long>(r.stats.eviction_count), r.peak_cache_bytes / 1048576.0);
+    }
+}
+
+int main(int argc, char **argv) {
+    ListConfig config;
+    if (argc > 1) {
+        config.row_count = std::max(atoi(argv[1]), config.visible_rows + 1);
+    }
+    if (argc > 2) {
+        config.round_trips = std::max(atoi(argv[2]), 1);
+    }
+
+    TestDecodeSize();
+    TestCoalescing();
+    TestPassthrough();
+
+    printf("\n===== C/D. 滚动 %d 行列表, 往返 %d 次, 一屏 %d 行 =====\n", config.row_count, config.round_trips,
+           config.visible_rows);
+    auto eager = RunEager(config);
+    PrintResult("旧实现(原图, 每次绑定解码)", eager);
+    const size_t kCapacity = 32 << 20;
+    auto cached = RunCached(config, kCapacity);
+    PrintResult("新实现(降采样 + 32MB 缓存)", cached);
+    const size_t kSmallCapacity = 8 << 20;
+    auto small = RunCached(config, kSmallCapacity);
+    PrintResult("新实现(降采样 + 8MB 缓存)", small);
+
+    // C. 字节预算
+    CHECK("C", cached.peak_cache_bytes <= kCapacity);
+    CHECK("C", small.peak_cache_bytes <= kSmallCapacity);
+    CHECK("C", cached.stats.eviction_count > 0 && small.stats.eviction_count > 0);
+    CHECK("C", g_live_bytes.load() == 0);
+
+    // D. 滚动列表: 头像每个用户只解码一次, 配图在预算内回滚时命中; 降采样后解码输出大幅减少
+    CHECK("D", cached.all_correct && small.all_correct);
+    CHECK("D", eager.decodes == eager.binds * 2);
+    CHECK("D", cached.decodes <= eager.binds + config.avatar_users);
+    CHECK("D", cached.decodes <= small.decodes);
+    CHECK("D", cached.stats.hit_count >= eager.binds - config.avatar_users);
+    CHECK("D", cached.decoded_bytes * 5 < eager.decoded_bytes);
+    CHECK("D", small.decoded_bytes * 5 < eager.decoded_bytes);
+    CHECK("D", small.peak_bytes * 3 < eager.peak_bytes);
+    CHECK("D", cached.peak_bytes <= static_cast<int64_t>(kCapacity) + eager.peak_bytes / 4);
+
+    if (g_fail == 0) {
+        printf("\n>>> ALL PASS <<<\n");
+        return 0;
+    }
+    printf("\n>>> %d FAILED <<<\n", g_fail);
+    exit(1);
+}
@@ -0,0 +1,467 @@
+// 压测 + 基准: bench_file_io_executor
+//
+// 目标:
+//   验证 KRFileIOExecutor (KRFileModule 的文件写入执行器) 在并发写入下的顺序与内容正确性, 并对比旧实现的追加吞吐:
+//   旧实现每次 writeFile / appendFile 都起一条 detached 线程 fopen / fwrite / fclose, 同一文件的多次追加互不排序;
+//   新实现按路径串行、跨路径并行, 排队中的连续追加合并为一次 writev, 排队字节数有上限。
+//
+// 说明:
+//   直接编译生产实现 KRFileIOExecutor.cpp; 后台线程池用测试内的 WorkerPool 注入 (生产环境为 KRExecutor 的 Background 全局队列)。
+//   所有文件写在 mkdtemp 创建的临时目录中。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_file_io_executor.cpp
+//       ../../main/cpp/libohos_render/expand/modules/file/KRFileIOExecutor.cpp
+//       ../../main/cpp/libohos_render/foundation/thread/KRExecutor.cpp
+//       ../../main/cpp/libohos_render/foundation/thread/KRDispatchQueue.cpp -o bench_file_io_executor
+//   运行:
+//   ./bench_file_io_executor
+//
+// 验证项:
+//   A. 顺序与内容: 8 个写线程并发追加到 4 个共享文件, 每行完整不交错, 每个写线程在每个文件内的序号连续递增;
+//                  同一文件的完成回调按提交顺序触发
+//   B. 合并写    : 排队中的追加合并为少量 writev; 覆盖写与追加写混排时结果等于按序执行
+//   C. 背压      : 队列满时超时拒绝并回调 "queue full"; 等待期间腾出空间则提交成功
+//   D. fsync 策略: kNone / kBatch / kPeriodic 与单个请求的 sync 标记; 打开失败时回调错误
+//   E. 基准      : 追加吞吐 (1 个文件 / 4 个文件), 旧实现 vs 执行器
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/expand/modules/file/KRFileIOExecutor.h"
+
+using kuikly::module::KRFileIOExecutor;
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+static std::string g_dir;
+
+// 固定线程数的线程池; paused 时只排队不执行, 用于制造积压
+class WorkerPool {
+ public:
+    explicit WorkerPool(int thread_count) {
+        for (int i = 0; i < thread_count; ++i) {
+            threads_.emplace_back([this] { Run(); });
+        }
+    }
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+            paused_ = false;
+        }
+        cv_.notify_all();
+        for (auto &thread : threads_) {
+            thread.join();
+        }
+    }
+    KRFileIOExecutor::Dispatcher Dispatcher() {
+        return [this](std::function<void()> task) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                tasks_.push_back(std::move(task));
+            }
+            cv_.notify_one();
+        };
+    }
+    void SetPaused(bool paused) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            paused_ = paused;
+        }
+        cv_.notify_all();
+    }
+
+ private:
+    void Run() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stop_ || (!paused_ && !tasks_.empty()); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stop_ = false;
+    bool paused_ = false;
+    std::vector<std::thread> threads_;
+};
+
+static std::string ReadFile(const std::string &path) {
+    std::string content;
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (fp == nullptr) {
+        return content;
+    }
+    char buffer[8192];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+        content.append(buffer, n);
+    }
+    fclose(fp);
+    return content;
+}
+
+static std::string MakeLine(int writer, int seq, size_t size) {
+    auto line = "w" + std::to_string(writer) + " s" + std::to_string(seq) + " ";
+    while (line.size() + 1 < size) {
+        line.push_back(static_cast<char>('a' + (writer + seq + line.size()) % 26));
+    }
+    return line + "\n";
+}
+
+// ---------------------------------------------------------------------------
+// A. 顺序与内容
+// ---------------------------------------------------------------------------
+static void TestOrdering() {
+    printf("\n=== A. 顺序与内容 ===\n");
+    constexpr int kWriters = 8;
+    constexpr int kFiles = 4;
+    constexpr int kLinesPerFile = 1500;
+    std::vector<std::string> paths;
+    for (int f = 0; f < kFiles; ++f) {
+        paths.push_back(g_dir + "/order_" + std::to_string(f) + ".jsonl");
+    }
+
+    std::mutex completion_mutex;
+    // 每个文件、每个写线程最近一次完成的序号
+    std::vector<std::vector<int>> last_completed(kFiles, std::vector<int>(kWriters, -1));
+    int completion_out_of_order = 0;
+    {
+        WorkerPool pool(4);
+        KRFileIOExecutor executor(pool.Dispatcher(), KRFileIOExecutor::Options());
+        std::vector<std::thread> writers;
+        for (int w = 0; w < kWriters; ++w) {
+            writers.emplace_back([&, w] {
+                for (int i = 0; i < kLinesPerFile; ++i) {
+                    for (int f = 0; f < kFiles; ++f) {
+                        executor.Append(paths[f], MakeLine(w, i, 24 + (i * 7 + w) % 100), false,
+                                        [&, f, w, i](bool success, const std::string &) {
+                                            std::lock_guard<std::mutex> lock(completion_mutex);
+                                            if (!success || last_completed[f][w] != i - 1) {
+                                                completion_out_of_order++;
+                                            }
+                                            last_completed[f][w] = i;
+                                        });
+                    }
+                }
+            });
+        }
+        for (auto &writer : writers) {
+            writer.join();
+        }
+        executor.Drain();
+        auto stats = executor.GetStats();
+        printf("  %llu appends -> %llu batches, %llu writev\n", static_cast<unsigned long long>(stats.submitted),
+               static_cast<unsigned long long>(stats.batches), static_cast<unsigned long long>(stats.writev_calls));
+        CHECK("A", stats.completed == static_cast<uint64_t>(kWriters * kFiles * kLinesPerFile));
+        CHECK("A", stats.pending_bytes == 0);
+    }
+    CHECK("A", completion_out_of_order == 0);
+
+    int broken_lines = 0;
+    int order_errors = 0;
+    int count_errors = 0;
+    for (int f = 0; f < kFiles; ++f) {
+        auto content = ReadFile(paths[f]);
+        std::vector<int> next_seq(kWriters, 0);
+        size_t begin = 0;
+        while (begin < content.size()) {
+            auto end = content.find('\n', begin);
+            if (end == std::string::npos) {
+                broken_lines++;
+                break;
+            }
+            auto line = content.substr(begin, end + 1 - begin);
+            begin = end + 1;
+            int writer = -1;
+            int seq = -1;
+            if (sscanf(line.c_str(), "w%d s%d", &writer, &seq) != 2 || writer < 0 || writer >= kWriters ||
+                line != MakeLine(writer, seq, 24 + (seq * 7 + writer) % 100)) {
+                broken_lines++;
+                continue;
+            }
+            if (seq != next_seq[writer]) {
+                order_errors++;
+            }
+            next_seq[writer] = seq + 1;
+        }
+        for (int w = 0; w < kWriters; ++w) {
+            count_errors += next_seq[w] == kLinesPerFile ? 0 : 1;
+        }
+    }
+    CHECK("A", broken_lines == 0);
+    CHECK("A", order_errors == 0);
+    CHECK("A", count_errors == 0);
+}
+
+// ---------------------------------------------------------------------------
+// B. 合并写
+// ---------------------------------------------------------------------------
+static void TestCoalescing() {
+    printf("\n=== B. 合并写 ===\n");
+    WorkerPool pool(2);
+    KRFileIOExecutor executor(pool.Dispatcher(), KRFileIOExecutor::Options());
+    auto path = g_dir + "/coalesce.jsonl";
+    std::string expected;
+    pool.SetPaused(true);
+    for (int i = 0; i < 1000; ++i) {
+        auto line = MakeLine(0, i, 64);
+        expected += line;
+        executor.Append(path, line, false, nullptr);
+    }
+    pool.SetPaused(false);
+    executor.Drain();
+    auto stats = executor.GetStats();
+    printf("  1000 queued appends -> %llu batches, %llu writev\n", static_cast<unsigned long long>(stats.batches),
+           static_cast<unsigned long long>(stats.writev_calls));
+    CHECK("B", stats.writev_calls <= 1000 / KRFileIOExecutor::Options().max_batch_requests + 1);
+    CHECK("B", ReadFile(path) == expected);
+
+    // 覆盖写与追加写混排
+    auto mixed = g_dir + "/mixed.json";
+    pool.SetPaused(true);
+    executor.Append(mixed, "stale\n", false, nullptr);
+    executor.Write(mixed, "{report:1}\n", false, nullptr);
+    executor.Append(mixed, "a\n", false, nullptr);
+    executor.Append(mixed, "b\n", false, nullptr);
+    executor.Write(mixed, "{report:2}\n", false, nullptr);
+    executor.Append(mixed, "c\n", false, nullptr);
+    pool.SetPaused(false);
+    executor.Drain();
+    CHECK("B", ReadFile(mixed) == "{report:2}\nc\n");
+    auto batches = executor.GetStats().batches - stats.batches;
+    CHECK("B", batches == 3);
+}
+
+// ---------------------------------------------------------------------------
+// C. 背压
+// ---------------------------------------------------------------------------
+static void TestBackPressure() {
+    printf("\n=== C. 背压 ===\n");
+    WorkerPool pool(2);
+    KRFileIOExecutor::Options options;
+    options.max_pending_bytes = 64 * 1024;
+    options.block_timeout_ms = 5;
+    KRFileIOExecutor executor(pool.Dispatcher(), options);
+    auto path = g_dir + "/bounded.jsonl";
+    std::string line(1024 - 1, 'x');
+    line += "\n";
+
+    pool.SetPaused(true);
+    int accepted = 0;
+    int rejected_callbacks = 0;
+    std::atomic<int> accepted_callbacks{0};
+    for (int i = 0; i < 100; ++i) {
+        bool ok = executor.Append(path, line, false, [&](bool success, const std::string &error) {
+            if (success) {
+                accepted_callbacks++;
+            } else if (error == "queue full") {
+                rejected_callbacks++;
+            }
+        });
+        accepted += ok ? 1 : 0;
+    }
+    auto stats = executor.GetStats();
+    printf("  accepted=%d rejected=%llu pending=%zu\n", accepted, static_cast<unsigned long long>(stats.rejected),
+           stats.pending_bytes);
+    CHECK("C", accepted == 64);
+    CHECK("C", stats.rejected == 36 && rejected_callbacks == 36);
+    CHECK("C", stats.pending_bytes <= options.max_pending_bytes);
+
+    // 等待期间腾出空间: 提交应在超时前成功
+    KRFileIOExecutor::Options wait_options = options;
+    wait_options.block_timeout_ms = 2000;
+    KRFileIOExecutor waiting(pool.Dispatcher(), wait_options);
+    for (int i = 0; i < 64; ++i) {
+        waiting.Append(g_dir + "/waiting.jsonl", line, false, nullptr);
+    }
+    std::thread releaser([&pool] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        pool.SetPaused(false);
+    });
+    auto begin = std::chrono::steady_clock::now();
+    bool ok = waiting.Append(g_dir + "/waiting.jsonl", line, false, nullptr);
+    auto waited_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    releaser.join();
+    printf("  blocked submit waited %.1f ms\n", waited_ms);
+    CHECK("C", ok && waiting.GetStats().blocked == 1);
+    executor.Drain();
+    waiting.Drain();
+    CHECK("C", accepted_callbacks == 64);
+    CHECK("C", ReadFile(path).size() == 64 * line.size());
+    CHECK("C", ReadFile(g_dir + "/waiting.jsonl").size() == 65 * line.size());
+}
+
+// ---------------------------------------------------------------------------
+// D. fsync 策略
+// ---------------------------------------------------------------------------
+static KRFileIOExecutor::Stats RunPolicy(KRFileIOExecutor::FsyncPolicy policy, const std::string &name,
+                                         bool sync_last) {
+    WorkerPool pool(1);
+    KRFileIOExecutor::Options options;
+    options.fsync_policy = policy;
+    options.fsync_interval_ms = 60 * 60 * 1000;
+    KRFileIOExecutor executor(pool.Dispatcher(), options);
+    auto path = g_dir + "/" + name;
+    for (int i = 0; i < 10; ++i) {
+        executor.Append(path, MakeLine(0, i, 32), sync_last && i == 9, nullptr);
+        executor.Drain();
+    }
+    return executor.GetStats();
+}
+
+static void TestFsyncPolicy() {
+    printf("\n=== D. fsync 策略 ===\n");
+    using Policy = KRFileIOExecutor::FsyncPolicy;
+    auto none = RunPolicy(Policy::kNone, "none.jsonl", false);
+    auto batch = RunPolicy(Policy::kBatch, "batch.jsonl", false);
+    auto periodic = RunPolicy(Policy::kPeriodic, "periodic.jsonl", false);
+    auto none_sync = RunPolicy(Policy::kNone, "none_sync.jsonl", true);
+    printf("  fsync: none=%llu batch=%llu periodic=%llu none+sync=%llu (10 batches each)\n",
+           static_cast<unsigned long long>(none.fsync_calls), static_cast<unsigned long long>(batch.fsync_calls),
+           static_cast<unsigned long long>(periodic.fsync_calls),
+           static_cast<unsigned long long>(none_sync.fsync_calls));
+    CHECK("D", none.fsync_calls == 0);
+    CHECK("D", batch.fsync_calls == batch.batches);
+    CHECK("D", periodic.fsync_calls == 1);
+    CHECK("D", none_sync.fsync_calls == 1);
+
+    WorkerPool pool(1);
+    KRFileIOExecutor executor(pool.Dispatcher(), KRFileIOExecutor::Options());
+    std::mutex mutex;
+    std::string error;
+    bool success = true;
+    executor.Write(g_dir + "/missing_dir/report.json", "{}", true, [&](bool ok, const std::string &message) {
+        std::lock_guard<std::mutex> lock(mutex);
+        success = ok;
+        error = message;
+    });
+    executor.Drain();
+    std::lock_guard<std::mutex> lock(mutex);
+    CHECK("D", !success && error.rfind("open failed", 0) == 0);
+    CHECK("D", executor.GetStats().failed == 1);
+}
+
+// ---------------------------------------------------------------------------
+// E. 基准: 追加吞吐
+// ---------------------------------------------------------------------------
+// 旧实现: 每次追加起一条 detached 线程
+static double LegacyAppend(const std::vector<std::string> &paths, int total, const std::string &line) {
+    std::atomic<int> done{0};
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < total; ++i) {
+        auto path = paths[i % paths.size()];
+        std::thread([path, line, &done]() {
+            FILE *fp = fopen(path.c_str(), "a");
+            if (fp) {
+                fwrite(line.c_str(), 1, line.size() - 1, fp);
+                fwrite("\n", 1, 1, fp);
+                fclose(fp);
+            }
+            done++;
+        }).detach();
+    }
+    while (done.load() < total) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+static double ExecutorAppend(const std::vector<std::string> &paths, int total, const std::string &line,
+                             KRFileIOExecutor::Stats *stats) {
+    WorkerPool pool(4);
+    KRFileIOExecutor executor(pool.Dispatcher(), KRFileIOExecutor::Options());
+    std::atomic<int> done{0};
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < total; ++i) {
+        executor.Append(paths[i % paths.size()], line, false, [&done](bool, const std::string &) { done++; });
+    }
+    executor.Drain();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    *stats = executor.GetStats();
+    return seconds;
+}
+
+static void Benchmark() {
+    printf("\n=== E. 基准: 追加吞吐 (200 字节/行) ===\n");
+    constexpr int kTotal = 20000;
+    auto line = MakeLine(0, 0, 200);
+    printf("  %6s | %16s | %16s %10s %8s\n", "files", "legacy lines/s", "executor lines/s", "writev", "fsync");
+    for (int file_count : {1, 4}) {
+        std::vector<std::string> legacy_paths;
+        std::vector<std::string> executor_paths;
+        for (int f = 0; f < file_count; ++f) {
+            legacy_paths.push_back(g_dir + "/bench_legacy_" + std::to_string(file_count) + "_" + std::to_string(f));
+            executor_paths.push_back(g_dir + "/bench_exec_" + std::to_string(file_count) + "_" + std::to_string(f));
+        }
+        double legacy_seconds = LegacyAppend(legacy_paths, kTotal, line);
+        KRFileIOExecutor::Stats stats;
+        double executor_seconds = ExecutorAppend(executor_paths, kTotal, line, &stats);
+        printf("  %6d | %16.0f | %16.0f %10llu %8llu\n", file_count, kTotal / legacy_seconds,
+               kTotal / executor_seconds, static_cast<unsigned long long>(stats.writev_calls),
+               static_cast<unsigned long long>(stats.fsync_calls));
+        size_t executor_bytes = 0;
+        for (const auto &path : executor_paths) {
+            executor_bytes += ReadFile(path).size();
+        }
+        CHECK("E", executor_bytes == kTotal * line.size());
+        CHECK("E", executor_seconds < legacy_seconds);
+    }
+}
+
+int main() {
+    char dir_template[] = "/tmp/kr_file_io_XXXXXX";
+    if (mkdtemp(dir_template) == nullptr) {
+        printf("mkdtemp failed\n");
+        return 1;
+    }
+    g_dir = dir_template;
+    TestOrdering();
+    TestCoalescing();
+    TestBackPressure();
+    TestFsyncPolicy();
+    Benchmark();
+    std::string cleanup = "rm -rf " + g_dir;
+    if (system(cleanup.c_str()) != 0) {
+        printf("cleanup %s failed\n", g_dir.c_str());
+    }
+
+    if (g_fail == 0) {
+        printf("\n>>> ALL PASS <<<\n");
+        return 0;
+    }
+    printf("\n>>> %d FAILED <<<\n", g_fail);
+    exit(1);
+}
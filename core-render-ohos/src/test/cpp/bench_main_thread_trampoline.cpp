@@ -0,0 +1,323 @@
+// 测试+基准: bench_main_thread_trampoline
+//
+// 目标:
+//   验证 KRTaskTrampoline (KRMainThread::RunOnMainThread 的合并唤醒蹦床) 的正确性,
+//   并对比改造前后 threadsafe function 调用次数与突发任务期间的输入事件延迟:
+//   1) 旧实现: 每个任务 new 一个 MainThreadTask 并单独 napi_call_threadsafe_function;
+//   2) 新实现: 任务入无锁队列, 只在队列由空变非空时 signal 一次, 主线程按 8ms 预算批量执行。
+//
+// 说明:
+//   KRTaskTrampoline.h 只依赖标准库, 这里直接包含生产实现;
+//   napi threadsafe function + libuv 事件循环用 FakeMainLoop 模拟: 每次 threadsafe 调用 = 加锁入队一个事件并唤醒,
+//   事件循环按到达顺序处理事件, 输入事件与 threadsafe 事件排在同一个队列中。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_main_thread_trampoline.cpp -o bench_trampoline
+//   运行:
+//   ./bench_trampoline               # 默认 4 个生产者, 每个 50000 个小任务
+//   ./bench_trampoline 8 100000
+//
+// 验证项:
+//   A. 所有任务恰好执行一次, 同一生产者的任务保持提交顺序 (含主线程内重入投递)
+//   B. 突发投递时 signal 次数远小于任务数, 且不会丢失唤醒 (最后一个任务一定被执行)
+//   C. 超过时间预算时让出主线程, 突发长任务期间输入事件延迟受预算约束
+//   D. 统计数据自洽
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRTaskTrampoline.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+constexpr auto kBudget = std::chrono::milliseconds(8);
+
+static void BusyFor(std::chrono::microseconds duration) {
+    auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+    }
+}
+
+// 模拟主线程事件循环: threadsafe function 回调与输入事件共用一个 FIFO
+class FakeMainLoop {
+ public:
+    FakeMainLoop() {
+        thread_ = std::thread([this] { Loop(); });
+    }
+    ~FakeMainLoop() {
+        Post(nullptr);
+        thread_.join();
+    }
+    // 等价一次 napi_call_threadsafe_function / 输入事件到达
+    void Post(std::function<void()> event) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            events_.push_back(std::move(event));
+        }
+        condition_.notify_one();
+    }
+
+ private:
+    void Loop() {
+        while (true) {
+            std::function<void()> event;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                condition_.wait(lock, [this] { return !events_.empty(); });
+                event = std::move(events_.front());
+                events_.pop_front();
+            }
+            if (!event) {
+                break;
+            }
+            event();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::function<void()>> events_;
+    std::thread thread_;
+};
+
+// 旧实现: 每个任务一次 threadsafe 调用
+class LegacyMainThread {
+ public:
+    explicit LegacyMainThread(FakeMainLoop &loop) : loop_(loop) {}
+    void RunOnMainThread(std::function<void()> task) {
+        auto *main_task = new std::function<void()>(std::move(task));
+        signals_++;
+        loop_.Post([main_task] {
+            (*main_task)();
+            delete main_task;
+        });
+    }
+    uint64_t Signals() const {
+        return signals_.load();
+    }
+
+ private:
+    FakeMainLoop &loop_;
+    std::atomic<uint64_t> signals_{0};
+};
+
+// 新实现: 与 KRMainThread.cpp 一致
+class TrampolineMainThread {
+ public:
+    explicit TrampolineMainThread(FakeMainLoop &loop)
+        : trampoline_([this] { loop_.Post([this] { trampoline_.Drain(kBudget); }); }), loop_(loop) {}
+    void RunOnMainThread(KRTask task) {
+        trampoline_.Post(std::move(task));
+    }
+    uint64_t Signals() const {
+        return trampoline_.GetStats().signal_count;
+    }
+
+ private:
+    KRTaskTrampoline trampoline_;
+    FakeMainLoop &loop_;
+};
+
+struct Result {
+    double ms = 0;
+    uint64_t signals = 0;
+    bool ordered = true;
+    int64_t executed = 0;
+};
+
+// 生产者突发投递小任务; 其中每 1000 个任务在主线程内重入投递一个任务
+template <typename MainThread>
+static Result RunBurst(int producers, int per_producer) {
+    FakeMainLoop loop;
+    MainThread main_thread(loop);
+    std::vector<int> last(producers, -1);
+    std::atomic<bool> ordered{true};
+    std::atomic<int64_t> executed{0};
+    std::mutex done_mutex;
+    std::condition_variable done_condition;
+    int64_t reentrant = producers * ((per_producer + 999) / 1000);
+    int64_t expected = static_cast<int64_t>(producers) * per_producer + reentrant;
+    auto finish_one = [&] {
+        if (executed.fetch_add(1) + 1 == expected) {
+            std::lock_guard<std::mutex> lock(done_mutex);
+            done_condition.notify_all();
+        }
+    };
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < per_producer; ++i) {
+                main_thread.RunOnMainThread([&, p, i] {
+                    if (last[p] != i - 1) {
+                        ordered = false;
+                    }
+                    last[p] = i;
+                    if (i % 1000 == 0) {
+                        main_thread.RunOnMainThread([&] { finish_one(); });
+                    }
+                    finish_one();
+                });
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    {
+        std::unique_lock<std::mutex> lock(done_mutex);
+        done_condition.wait_for(lock, std::chrono::seconds(30), [&] { return executed.load() == expected; });
+    }
+    Result result;
+    result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    result.signals = main_thread.Signals();
+    result.ordered = ordered.load();
+    result.executed = executed.load() - expected;  // 0 表示恰好全部执行
+    return result;
+}
+
+// 一次性投递 kTasks 个 200us 的长任务后到达一个输入事件, 测输入事件等待时间
+template <typename MainThread>
+static double RunInputLatency(int tasks) {
+    FakeMainLoop loop;
+    MainThread main_thread(loop);
+    std::atomic<int> done{0};
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool gate_open = false;
+    // 先阻塞主线程, 保证所有任务与输入事件在同一时刻排队
+    loop.Post([&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&] { return gate_open; });
+    });
+    for (int i = 0; i < tasks; ++i) {
+        main_thread.RunOnMainThread([&] {
+            BusyFor(std::chrono::microseconds(200));
+            done++;
+        });
+    }
+    std::chrono::steady_clock::time_point input_handled;
+    std::atomic<bool> input_done{false};
+    auto input_posted = std::chrono::steady_clock::now();
+    loop.Post([&] {
+        input_handled = std::chrono::steady_clock::now();
+        input_done = true;
+    });
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        gate_open = true;
+        input_posted = std::chrono::steady_clock::now();
+    }
+    condition.notify_all();
+    while (done.load() < tasks || !input_done.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return std::chrono::duration<double, std::milli>(input_handled - input_posted).count();
+}
+
+// 模拟目标线程被唤醒后反复 Drain 直到队列清空, 返回 Drain 次数 (每次 Drain 至少执行一个任务, 次数不超过任务数)
+static int DrainAll(KRTaskTrampoline &trampoline, std::chrono::steady_clock::duration budget, int64_t tasks) {
+    int hops = 0;
+    int64_t executed = 0;
+    while (executed < tasks && hops < tasks) {
+        auto n = trampoline.Drain(budget);
+        hops++;
+        if (n <= 0) {
+            break;
+        }
+        executed += n;
+    }
+    return executed == tasks ? hops : -1;
+}
+
+static void TestSignalProtocol() {
+    // 单线程驱动: signal 只在由空变非空时触发; 预算内执行完与否取决于调度时序, 只校验让出次数的上界
+    int signals = 0;
+    KRTaskTrampoline trampoline([&signals] { signals++; });
+    std::vector<int> order;
+    for (int i = 0; i < 5; ++i) {
+        trampoline.Post([&order, i] { order.push_back(i); });
+    }
+    CHECK("B", signals == 1);
+    int hops = DrainAll(trampoline, kBudget, 5);
+    CHECK("D", hops >= 1 && hops <= 5 && order == std::vector<int>({0, 1, 2, 3, 4}));
+    // 每次因预算让出时剩余任务重新 signal 一次
+    CHECK("B", signals == hops);
+    int total_hops = hops;
+    int expected_signals = signals;
+    // 执行中投递的任务排在队尾, 不在执行中额外 signal
+    trampoline.Post([&] {
+        trampoline.Post([&order] { order.push_back(6); });
+        order.push_back(5);
+    });
+    CHECK("B", signals == expected_signals + 1);
+    hops = DrainAll(trampoline, kBudget, 2);
+    total_hops += hops;
+    expected_signals += hops;
+    CHECK("D", hops >= 1 && hops <= 2 && order.size() == 7 && order[5] == 5 && order[6] == 6);
+    CHECK("B", signals == expected_signals);
+    // 超出预算时让出: 3ms 的任务在 1ms 预算下每轮只执行一个
+    for (int i = 7; i < 10; ++i) {
+        trampoline.Post([&order, i] {
+            BusyFor(std::chrono::microseconds(3000));
+            order.push_back(i);
+        });
+    }
+    hops = DrainAll(trampoline, std::chrono::milliseconds(1), 3);
+    total_hops += hops;
+    expected_signals += hops;
+    CHECK("C", hops == 3 && order.size() == 10 && order[7] == 7 && order[8] == 8 && order[9] == 9);
+    CHECK("C", signals == expected_signals);
+    auto stats = trampoline.GetStats();
+    CHECK("D", stats.task_count == 10 && stats.drain_count == static_cast<uint64_t>(total_hops) &&
+                   stats.budget_exceeded_count >= 3 && stats.signal_count == static_cast<uint64_t>(signals));
+}
+
+int main(int argc, char **argv) {
+    int producers = argc > 1 ? atoi(argv[1]) : 4;
+    int per_producer = argc > 2 ? atoi(argv[2]) : 50000;
+
+    TestSignalProtocol();
+
+    auto legacy = RunBurst<LegacyMainThread>(producers, per_producer);
+    auto batched = RunBurst<TrampolineMainThread>(producers, per_producer);
+    CHECK("A", legacy.ordered && legacy.executed == 0);
+    CHECK("A", batched.ordered && batched.executed == 0);
+    CHECK("B", batched.signals * 10 < static_cast<uint64_t>(producers) * per_producer);
+
+    const int kLongTasks = 500;  // 共约 100ms
+    auto legacy_latency = RunInputLatency<LegacyMainThread>(kLongTasks);
+    auto batched_latency = RunInputLatency<TrampolineMainThread>(kLongTasks);
+    CHECK("C", batched_latency < 50);
+
+    printf("producers=%d tasks/producer=%d (+1 reentrant post per 1000)\n", producers, per_producer);
+    printf("%-12s %10s %12s %20s\n", "impl", "total ms", "tsfn calls", "input latency ms");
+    printf("%-12s %10.1f %12llu %20.1f\n", "legacy", legacy.ms, static_cast<unsigned long long>(legacy.signals),
+           legacy_latency);
+    printf("%-12s %10.1f %12llu %20.1f\n", "trampoline", batched.ms,
+           static_cast<unsigned long long>(batched.signals), batched_latency);
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
@@ -0,0 +1,347 @@
+// 测试+基准: bench_prop_key_dispatch
+//
+// 目标:
+//   验证 KRPropKeyTable (进程级属性名驻留表 + 完美哈希查找) / KRPropKeySet / KRPropKeyJumpTable 的正确性,
+//   并对比列表 cell 设置属性时两种分发方式的开销:
+//   1) 旧路径: KRBasePropsHandler 的 strcmp 链 -> KRBaseEventHandler 的 isEqual 链 -> 组件 isEqual 链,
+//      did_set_props_ 为 std::vector<std::string> + std::find;
+//   2) 新路径: 每层一次完美哈希查找 + 按 id 索引的分发表, did_set_props_ 为 id 位图。
+//
+// 说明:
+//   KRPropKeyTable.h/.cpp 只依赖标准库, 这里直接编译生产实现;
+//   Handler 本身依赖 ArkUI, 用只修改成员变量的最小替身代替, 属性名与生产代码保持一致。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_prop_key_dispatch.cpp
+//       ../../main/cpp/libohos_render/foundation/KRPropKeyTable.cpp -o bench_pkd
+//   运行:
+//   ./bench_pkd                 # 默认 10000 个 cell, 20 轮
+//   ./bench_pkd 10000 50        # cell 数, 轮数
+//
+// 验证项:
+//   A. 已注册属性名 Find/Intern/KeyOf 往返一致, id 稠密且从 1 开始
+//   B. 未注册属性名 Find 返回无效 id, 不会误命中 (含前缀/同长度变体)
+//   C. 多线程并发 Intern 同一批属性名得到相同 id, 无重复分配
+//   D. KRPropKeySet 插入/遍历/清空行为正确
+//   E. 两条路径作用到替身状态上的结果一致
+//   F. 逐个驻留上万个新属性名: id 稳定可查, 并发读线程始终命中已驻留 id, 哈希表重建次数不超过 kMaxSnapshots
+//   G. 驻留表容量耗尽后 Intern 返回无效 id, KRPropKeySet 按属性名兜底记录, 不丢属性
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "libohos_render/foundation/KRPropKeyTable.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+// 与 KRBasePropsHandler / KRBaseEventHandler / KRView 中的属性名一致
+static const char *kBaseKeys[] = {"backgroundColor", "frame",   "borderRadius", "border",        "backgroundImage",
+                                  "transform",       "opacity", "visibility",   "overflow",      "zIndex",
+                                  "touchEnable",     "accessibility", "boxShadow", "animation", "animationCompletion",
+                                  "clipPath"};
+static const char *kEventKeys[] = {"click", "doubleClick", "longPress", "pan", "pinch", "capture"};
+static const char *kViewKeys[] = {"touchDown",     "touchMove",             "touchUp",   "preventTouch",
+                                  "superTouch",    "hit-test-ohos",         "stop-propagation-ohos",
+                                  "selectable",    "selectStart",           "selectEnd", "selectChange",
+                                  "selectCancel"};
+
+// 替身: 每个属性写入一个槽位
+struct FakeView {
+    int values[64] = {0};
+};
+
+// ---------------------------------------------------------------------------
+// 旧路径
+// ---------------------------------------------------------------------------
+static bool LegacyChain(const char *const *keys, size_t count, int base, FakeView &view, const std::string &key,
+                        int value) {
+    for (size_t i = 0; i < count; ++i) {
+        if (strcmp(key.c_str(), keys[i]) == 0) {
+            view.values[base + i] = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void LegacySetProp(FakeView &view, std::vector<std::string> &did_set_props, const std::string &key,
+                          int value) {
+    if (std::find(did_set_props.begin(), did_set_props.end(), key) == did_set_props.end()) {
+        did_set_props.push_back(key);
+    }
+    if (LegacyChain(kBaseKeys, sizeof(kBaseKeys) / sizeof(kBaseKeys[0]), 0, view, key, value)) {
+        return;
+    }
+    if (LegacyChain(kEventKeys, sizeof(kEventKeys) / sizeof(kEventKeys[0]), 20, view, key, value)) {
+        return;
+    }
+    LegacyChain(kViewKeys, sizeof(kViewKeys) / sizeof(kViewKeys[0]), 30, view, key, value);
+}
+
+// ---------------------------------------------------------------------------
+// 新路径
+// ---------------------------------------------------------------------------
+using Setter = void (*)(FakeView &view, int value);
+
+template <int N>
+static void SetSlot(FakeView &view, int value) {
+    view.values[N] = value;
+}
+
+template <int Base, size_t... I>
+static KRPropKeyJumpTable<Setter> MakeTable(const char *const *keys, std::index_sequence<I...>) {
+    return KRPropKeyJumpTable<Setter>({{keys[I], &SetSlot<Base + static_cast<int>(I)>}...});
+}
+
+static const KRPropKeyJumpTable<Setter> &BaseTable() {
+    static const auto gTable = MakeTable<0>(kBaseKeys, std::make_index_sequence<16>());
+    return gTable;
+}
+static const KRPropKeyJumpTable<Setter> &EventTable() {
+    static const auto gTable = MakeTable<20>(kEventKeys, std::make_index_sequence<6>());
+    return gTable;
+}
+static const KRPropKeyJumpTable<Setter> &ViewTable() {
+    static const auto gTable = MakeTable<30>(kViewKeys, std::make_index_sequence<12>());
+    return gTable;
+}
+
+static void TableSetProp(FakeView &view, KRPropKeySet &did_set_props, const std::string &key, int value) {
+    auto &table = KRPropKeyTable::GetInstance();
+    auto prop_id = table.Find(key);
+    did_set_props.Insert(prop_id != kKRInvalidPropKeyId ? prop_id : table.Intern(key), key);
+    // 与生产代码一致: 每层 handler 各自以字符串查找一次
+    if (auto setter = BaseTable().Find(key)) {
+        setter(view, value);
+        return;
+    }
+    if (auto setter = EventTable().Find(key)) {
+        setter(view, value);
+        return;
+    }
+    if (auto setter = ViewTable().Find(key)) {
+        setter(view, value);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 正确性
+// ---------------------------------------------------------------------------
+static void TestTable() {
+    BaseTable();
+    EventTable();
+    ViewTable();
+    auto &table = KRPropKeyTable::GetInstance();
+    CHECK("A", table.Size() == 34);
+    bool round_trip = true;
+    bool dense = true;
+    std::vector<bool> seen(table.Size() + 1, false);
+    for (auto keys : {std::vector<const char *>(std::begin(kBaseKeys), std::end(kBaseKeys)),
+                      std::vector<const char *>(std::begin(kEventKeys), std::end(kEventKeys)),
+                      std::vector<const char *>(std::begin(kViewKeys), std::end(kViewKeys))}) {
+        for (auto key : keys) {
+            auto id = table.Find(key);
+            round_trip = round_trip && id != kKRInvalidPropKeyId && table.Intern(key) == id && table.KeyOf(id) == key;
+            dense = dense && id <= table.Size() && !seen[id];
+            if (id <= table.Size()) {
+                seen[id] = true;
+            }
+        }
+    }
+    CHECK("A", round_trip);
+    CHECK("A", dense);
+
+    bool no_false_hit = true;
+    for (auto key : {"", "b", "backgroundColo", "backgroundColorX", "Frame", "fram", "framf", "click ", "zindex"}) {
+        no_false_hit = no_false_hit && table.Find(key) == kKRInvalidPropKeyId;
+    }
+    CHECK("B", no_false_hit);
+    CHECK("B", table.KeyOf(kKRInvalidPropKeyId).empty());
+    CHECK("B", table.KeyOf(60000).empty());
+
+    // 并发驻留 500 个动态属性名
+    const int kThreads = 4;
+    const int kKeys = 500;
+    std::vector<std::vector<KRPropKeyId>> ids(kThreads, std::vector<KRPropKeyId>(kKeys));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([t, &ids, &table] {
+            for (int i = 0; i < kKeys; ++i) {
+                int k = (i * 7 + t * 131) % kKeys;
+                ids[t][k] = table.Intern("dynamic_prop_" + std::to_string(k));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    bool consistent = true;
+    for (int i = 0; i < kKeys; ++i) {
+        for (int t = 1; t < kThreads; ++t) {
+            consistent = consistent && ids[t][i] == ids[0][i];
+        }
+        consistent = consistent && ids[0][i] != kKRInvalidPropKeyId &&
+                     table.Find("dynamic_prop_" + std::to_string(i)) == ids[0][i];
+    }
+    CHECK("C", consistent);
+    CHECK("C", table.Size() == 34 + kKeys);
+    CHECK("C", table.SnapshotCount() <= KRPropKeyTable::kMaxSnapshots);
+
+    KRPropKeySet set;
+    CHECK("D", set.Empty());
+    set.Insert(3);
+    set.Insert(64);
+    set.Insert(3);
+    set.Insert(517);
+    set.Insert(kKRInvalidPropKeyId);
+    std::vector<KRPropKeyId> visited;
+    set.ForEach([&visited](KRPropKeyId id) { visited.push_back(id); });
+    CHECK("D", (visited == std::vector<KRPropKeyId>{3, 64, 517}));
+    CHECK("D", set.Contains(64) && !set.Contains(65) && !set.Contains(5000));
+    set.Erase(64);
+    CHECK("D", !set.Contains(64));
+    set.Clear();
+    CHECK("D", set.Empty());
+}
+
+// 逐个驻留新属性名 (每个未知属性名首次出现都走 Intern), 同时并发读取已驻留的属性名
+static void TestGrowth() {
+    auto &table = KRPropKeyTable::GetInstance();
+    const int kKeys = 20000;
+    auto base_size = table.Size();
+    std::atomic<bool> stop{false};
+    std::atomic<int> reader_misses{0};
+    std::thread reader([&table, &stop, &reader_misses] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            for (int i = 0; i < 500; ++i) {
+                auto key = "dynamic_prop_" + std::to_string(i);
+                auto id = table.Find(key);
+                if (id == kKRInvalidPropKeyId || table.KeyOf(id) != key) {
+                    reader_misses.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+    });
+    std::vector<KRPropKeyId> ids(kKeys);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < kKeys; ++i) {
+        ids[i] = table.Intern("growth_prop_" + std::to_string(i));
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    stop = true;
+    reader.join();
+
+    bool stable = true;
+    for (int i = 0; i < kKeys; ++i) {
+        auto key = "growth_prop_" + std::to_string(i);
+        stable = stable && ids[i] == base_size + 1 + i && table.Find(key) == ids[i] && table.KeyOf(ids[i]) == key;
+    }
+    CHECK("F", stable);
+    CHECK("F", reader_misses.load() == 0);
+    CHECK("F", table.Size() == base_size + kKeys);
+    CHECK("F", table.SnapshotCount() <= KRPropKeyTable::kMaxSnapshots);
+    printf("intern %d keys one by one: %.3f ms, snapshots=%zu\n", kKeys,
+           std::chrono::duration<double, std::milli>(t1 - t0).count(), table.SnapshotCount());
+}
+
+// 写满驻留表, 需放在最后执行 (驻留表为进程级单例)
+static void TestExhaustion() {
+    auto &table = KRPropKeyTable::GetInstance();
+    for (size_t i = table.Size(); i < KRPropKeyTable::kMaxKeys; ++i) {
+        table.Intern("filler_prop_" + std::to_string(i));
+    }
+    CHECK("G", table.Size() == KRPropKeyTable::kMaxKeys);
+    CHECK("G", table.SnapshotCount() <= KRPropKeyTable::kMaxSnapshots);
+    CHECK("G", table.Intern("overflow_prop") == kKRInvalidPropKeyId);
+    CHECK("G", table.Find("frame") != kKRInvalidPropKeyId && table.Find("growth_prop_19999") != kKRInvalidPropKeyId);
+    CHECK("G", table.Find("filler_prop_" + std::to_string(KRPropKeyTable::kMaxKeys - 1)) == KRPropKeyTable::kMaxKeys);
+
+    // 生产代码 CollectReuseKeyIfNeed 的路径
+    KRPropKeySet set;
+    set.Insert(table.Intern("overflow_prop"), "overflow_prop");
+    set.Insert(table.Intern("overflow_prop"), "overflow_prop");
+    set.Insert(table.Intern("overflow_prop_2"), "overflow_prop_2");
+    set.Insert(table.Find("frame"), "frame");
+    CHECK("G", !set.Empty());
+    std::vector<std::string> unkeyed;
+    set.ForEachUnkeyed([&unkeyed](const std::string &key) { unkeyed.push_back(key); });
+    CHECK("G", (unkeyed == std::vector<std::string>{"overflow_prop", "overflow_prop_2"}));
+    CHECK("G", set.Contains(table.Find("frame")));
+    set.Erase(table.Find("frame"));
+    CHECK("G", !set.Empty());
+    set.Clear();
+    CHECK("G", set.Empty());
+    unkeyed.clear();
+    set.ForEachUnkeyed([&unkeyed](const std::string &key) { unkeyed.push_back(key); });
+    CHECK("G", unkeyed.empty());
+}
+
+// ---------------------------------------------------------------------------
+// 基准: 每个 cell 设置一组典型属性, 然后复用重置
+// ---------------------------------------------------------------------------
+int main(int argc, char **argv) {
+    int cells = argc > 1 ? atoi(argv[1]) : 10000;
+    int rounds = argc > 2 ? atoi(argv[2]) : 20;
+
+    TestTable();
+
+    const std::vector<std::string> cell_props = {"frame",     "backgroundColor", "borderRadius", "opacity",
+                                                 "click",     "touchDown",       "selectable",   "clipPath",
+                                                 "boxShadow", "zIndex",          "custom_prop",  "superTouch"};
+
+    FakeView legacy_view;
+    FakeView table_view;
+    double legacy_ms = 0;
+    double table_ms = 0;
+    for (int r = 0; r < rounds; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (int c = 0; c < cells; ++c) {
+            std::vector<std::string> did_set_props;
+            for (size_t i = 0; i < cell_props.size(); ++i) {
+                LegacySetProp(legacy_view, did_set_props, cell_props[i], c + static_cast<int>(i));
+            }
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        for (int c = 0; c < cells; ++c) {
+            KRPropKeySet did_set_props;
+            for (size_t i = 0; i < cell_props.size(); ++i) {
+                TableSetProp(table_view, did_set_props, cell_props[i], c + static_cast<int>(i));
+            }
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        legacy_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+        table_ms += std::chrono::duration<double, std::milli>(t2 - t1).count();
+    }
+    CHECK("E", memcmp(legacy_view.values, table_view.values, sizeof(legacy_view.values)) == 0);
+
+    TestGrowth();
+    TestExhaustion();
+
+    printf("cells=%d props/cell=%zu rounds=%d\n", cells, cell_props.size(), rounds);
+    printf("strcmp chain : %8.3f ms/round\n", legacy_ms / rounds);
+    printf("jump table   : %8.3f ms/round (%.2fx)\n", table_ms / rounds, legacy_ms / table_ms);
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
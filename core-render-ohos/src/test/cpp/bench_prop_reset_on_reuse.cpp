@@ -0,0 +1,405 @@
+// 测试+基准: bench_prop_reset_on_reuse
+//
+// 目标:
+//   对比列表 cell 复用时三种属性重置方式的每次复用耗时 (重置 + 新 cell 设置属性):
+//   1) 旧路径: did_set_props_ 为 std::vector<std::string> + std::find 收集,
+//      重置时按字符串依次走 KRBasePropsHandler / KRBaseEventHandler / 组件的 strcmp 链;
+//   2) 位图 + 字符串重置: did_set_props_ 为 KRPropKeySet, 但重置时 KeyOf 取回字符串, 每层 handler 再哈希查找一次;
+//   3) 新路径: 位图一次遍历, 按 id 分发重置; 自身无耦合的基础属性延迟到插入父节点前重置,
+//      新 cell 会再次设置的直接跳过 (与 IKRRenderViewExport::ToReuse / ApplyPendingResetProps 一致)。
+//
+// 说明:
+//   KRPropKeyTable.h/.cpp 只依赖标准库, 这里直接编译生产实现;
+//   Handler 依赖 ArkUI, 用只修改槽位的最小替身代替, 属性名与生产代码保持一致。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_prop_reset_on_reuse.cpp
+//       ../../main/cpp/libohos_render/foundation/KRPropKeyTable.cpp -o bench_prr
+//   运行:
+//   ./bench_prr                 # 默认 20000 次复用, 10 轮
+//   ./bench_prr 20000 30        # 复用次数, 轮数
+//
+// 验证项:
+//   A. 三条路径复用后 (重置 + 设置新 cell 属性 + 插入) 的替身状态完全一致
+//   B. 新 cell 与旧 cell 属性集合相同时, 延迟重置全部被跳过
+//   C. 新 cell 未设置的延迟属性在插入前被重置, 非延迟属性在复用时立即重置
+//   D. 同类型 cell 复用时新路径实际执行的重置次数少于旧路径
+//   E. 换绑到其它页面 (ToAdopt) 的 view 在换新处理器前完成延迟重置, 上屏前状态干净
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "libohos_render/foundation/KRPropKeyTable.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+// 与 KRBasePropsHandler / KRBaseEventHandler / KRView 中的属性名一致
+static const char *kBaseKeys[] = {"backgroundColor", "frame",   "borderRadius", "border",        "backgroundImage",
+                                  "transform",       "opacity", "visibility",   "overflow",      "zIndex",
+                                  "touchEnable",     "accessibility", "boxShadow", "animation", "animationCompletion",
+                                  "clipPath"};
+static const char *kEventKeys[] = {"click", "doubleClick", "longPress", "pan", "pinch", "capture"};
+static const char *kViewKeys[] = {"touchDown",     "touchMove",             "touchUp",   "preventTouch",
+                                  "superTouch",    "hit-test-ohos",         "stop-propagation-ohos",
+                                  "selectable",    "selectStart",           "selectEnd", "selectChange",
+                                  "selectCancel"};
+// 与 KRBasePropsHandler::IsSelfContainedReset 一致
+static const char *kSelfContainedKeys[] = {"backgroundColor", "frame",  "border",      "backgroundImage", "opacity",
+                                           "visibility",      "zIndex", "touchEnable", "accessibility"};
+
+constexpr size_t kBaseCount = sizeof(kBaseKeys) / sizeof(kBaseKeys[0]);
+constexpr size_t kEventCount = sizeof(kEventKeys) / sizeof(kEventKeys[0]);
+constexpr size_t kViewCount = sizeof(kViewKeys) / sizeof(kViewKeys[0]);
+constexpr int kEventBase = 20;
+constexpr int kViewBase = 30;
+
+// 替身: 每个属性一个槽位, 0 为默认值
+struct FakeView {
+    int values[64] = {0};
+    int reset_count = 0;
+};
+
+// ---------------------------------------------------------------------------
+// 旧路径: strcmp 链
+// ---------------------------------------------------------------------------
+static bool LegacyChain(const char *const *keys, size_t count, int base, FakeView &view, const std::string &key,
+                        int value) {
+    for (size_t i = 0; i < count; ++i) {
+        if (strcmp(key.c_str(), keys[i]) == 0) {
+            view.values[base + i] = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void LegacyApply(FakeView &view, const std::string &key, int value) {
+    if (LegacyChain(kBaseKeys, kBaseCount, 0, view, key, value)) {
+        return;
+    }
+    if (LegacyChain(kEventKeys, kEventCount, kEventBase, view, key, value)) {
+        return;
+    }
+    LegacyChain(kViewKeys, kViewCount, kViewBase, view, key, value);
+}
+
+struct LegacyCell {
+    FakeView view;
+    std::vector<std::string> did_set_props;
+
+    void SetProp(const std::string &key, int value) {
+        if (std::find(did_set_props.begin(), did_set_props.end(), key) == did_set_props.end()) {
+            did_set_props.push_back(key);
+        }
+        LegacyApply(view, key, value);
+    }
+    void Reuse() {
+        for (const auto &key : did_set_props) {
+            LegacyApply(view, key, 0);
+            view.reset_count++;
+        }
+        did_set_props.clear();
+    }
+    void Insert() {}
+};
+
+// ---------------------------------------------------------------------------
+// 分发表 (位图路径共用)
+// ---------------------------------------------------------------------------
+using Setter = void (*)(FakeView &view, int value);
+
+template <int N>
+static void SetSlot(FakeView &view, int value) {
+    view.values[N] = value;
+}
+
+template <int Base, size_t... I>
+static KRPropKeyJumpTable<Setter> MakeTable(const char *const *keys, std::index_sequence<I...>) {
+    return KRPropKeyJumpTable<Setter>({{keys[I], &SetSlot<Base + static_cast<int>(I)>}...});
+}
+
+static const KRPropKeyJumpTable<Setter> &BaseTable() {
+    static const auto gTable = MakeTable<0>(kBaseKeys, std::make_index_sequence<kBaseCount>());
+    return gTable;
+}
+static const KRPropKeyJumpTable<Setter> &EventTable() {
+    static const auto gTable = MakeTable<kEventBase>(kEventKeys, std::make_index_sequence<kEventCount>());
+    return gTable;
+}
+static const KRPropKeyJumpTable<Setter> &ViewTable() {
+    static const auto gTable = MakeTable<kViewBase>(kViewKeys, std::make_index_sequence<kViewCount>());
+    return gTable;
+}
+
+static bool IsSelfContainedReset(KRPropKeyId prop_id) {
+    static const KRPropKeySet gSelfContained = [] {
+        KRPropKeySet set;
+        for (auto key : kSelfContainedKeys) {
+            set.Insert(KRPropKeyTable::GetInstance().Intern(key));
+        }
+        return set;
+    }();
+    return gSelfContained.Contains(prop_id);
+}
+
+static void TableSet(FakeView &view, KRPropKeyId prop_id, int value) {
+    if (auto setter = BaseTable().Find(prop_id)) {
+        setter(view, value);
+    } else if (auto setter = EventTable().Find(prop_id)) {
+        setter(view, value);
+    } else if (auto setter = ViewTable().Find(prop_id)) {
+        setter(view, value);
+    }
+}
+
+static KRPropKeyId CollectId(const std::string &key) {
+    auto &table = KRPropKeyTable::GetInstance();
+    auto prop_id = table.Find(key);
+    return prop_id != kKRInvalidPropKeyId ? prop_id : table.Intern(key);
+}
+
+// ---------------------------------------------------------------------------
+// 位图 + 字符串重置 (重置时每层 handler 以字符串再查找一次)
+// ---------------------------------------------------------------------------
+struct BitsetStringCell {
+    FakeView view;
+    KRPropKeySet did_set_props;
+
+    void SetProp(const std::string &key, int value) {
+        auto prop_id = CollectId(key);
+        did_set_props.Insert(prop_id);
+        TableSet(view, prop_id, value);
+    }
+    void Reuse() {
+        auto &table = KRPropKeyTable::GetInstance();
+        did_set_props.ForEach([this, &table](KRPropKeyId prop_id) {
+            const auto &key = table.KeyOf(prop_id);
+            if (auto setter = BaseTable().Find(key)) {
+                setter(view, 0);
+            } else if (auto setter = EventTable().Find(key)) {
+                setter(view, 0);
+            } else if (auto setter = ViewTable().Find(key)) {
+                setter(view, 0);
+            }
+            view.reset_count++;
+        });
+        did_set_props.Clear();
+    }
+    void Insert() {}
+};
+
+// ---------------------------------------------------------------------------
+// 新路径: 按 id 重置 + 延迟并跳过新 cell 会覆盖的属性
+// ---------------------------------------------------------------------------
+struct DiffResetCell {
+    FakeView view;
+    KRPropKeySet did_set_props;
+    KRPropKeySet pending_reset_props;
+    int handler_generation = 0;
+
+    void SetProp(const std::string &key, int value) {
+        auto prop_id = CollectId(key);
+        did_set_props.Insert(prop_id);
+        if (!pending_reset_props.Empty()) {
+            pending_reset_props.Erase(prop_id);
+        }
+        TableSet(view, prop_id, value);
+    }
+    void Reuse() {
+        did_set_props.ForEach([this](KRPropKeyId prop_id) {
+            if (IsSelfContainedReset(prop_id)) {
+                pending_reset_props.Insert(prop_id);
+            } else {
+                TableSet(view, prop_id, 0);
+                view.reset_count++;
+            }
+        });
+        did_set_props.Clear();
+    }
+    void Insert() {
+        if (pending_reset_props.Empty()) {
+            return;
+        }
+        pending_reset_props.ForEach([this](KRPropKeyId prop_id) {
+            TableSet(view, prop_id, 0);
+            view.reset_count++;
+        });
+        pending_reset_props.Clear();
+    }
+    // 与 IKRRenderViewExport::RebindRootView 一致: 换绑到其它页面前先完成延迟重置, 再换新处理器
+    void Adopt() {
+        Insert();
+        handler_generation++;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// 列表 cell 模型
+// ---------------------------------------------------------------------------
+using PropList = std::vector<std::string>;
+
+// 三类 cell, 每类 20~30 个属性 (基础 + 事件 + 组件 + 自定义)
+static std::vector<PropList> MakeCellKinds() {
+    PropList text_cell = {"frame",      "backgroundColor", "borderRadius", "border",      "opacity",
+                          "visibility", "zIndex",          "touchEnable",  "accessibility", "overflow",
+                          "click",      "longPress",       "touchDown",    "touchMove",   "touchUp",
+                          "superTouch", "selectable",      "custom_title", "custom_subtitle", "custom_badge"};
+    PropList image_cell = text_cell;
+    for (auto key : {"backgroundImage", "transform", "boxShadow", "clipPath", "doubleClick", "hit-test-ohos",
+                     "custom_src", "custom_placeholder"}) {
+        image_cell.emplace_back(key);
+    }
+    PropList card_cell = image_cell;
+    for (auto key : {"pan", "capture"}) {
+        card_cell.emplace_back(key);
+    }
+    return {text_cell, image_cell, card_cell};
+}
+
+template <typename Cell>
+static void RunReuse(Cell &cell, const PropList &next_props, int seed) {
+    cell.Reuse();
+    for (size_t i = 0; i < next_props.size(); ++i) {
+        cell.SetProp(next_props[i], seed + static_cast<int>(i) + 1);
+    }
+    cell.Insert();
+}
+
+static void TestBehavior(const std::vector<PropList> &kinds) {
+    // A/C: 不同类型之间复用, 状态一致
+    LegacyCell legacy;
+    BitsetStringCell bitset;
+    DiffResetCell diff;
+    std::mt19937 rng(7);
+    bool equal = true;
+    for (int i = 0; i < 2000; ++i) {
+        const auto &props = kinds[rng() % kinds.size()];
+        RunReuse(legacy, props, i);
+        RunReuse(bitset, props, i);
+        RunReuse(diff, props, i);
+        equal = equal && memcmp(legacy.view.values, bitset.view.values, sizeof(legacy.view.values)) == 0 &&
+                memcmp(legacy.view.values, diff.view.values, sizeof(legacy.view.values)) == 0;
+    }
+    CHECK("A", equal);
+
+    // B: 同类型复用, 延迟属性全部跳过
+    DiffResetCell same;
+    RunReuse(same, kinds[0], 0);
+    same.view.reset_count = 0;
+    same.Reuse();
+    int eager_resets = same.view.reset_count;
+    for (size_t i = 0; i < kinds[0].size(); ++i) {
+        same.SetProp(kinds[0][i], 100);
+    }
+    CHECK("B", same.pending_reset_props.Empty());
+    same.Insert();
+    CHECK("B", same.view.reset_count == eager_resets);
+    CHECK("B", eager_resets == static_cast<int>(kinds[0].size()) - 8);  // text cell 含 8 个延迟属性
+
+    // C: 新 cell 只设置 frame, 其余延迟属性插入前重置; borderRadius 复用时立即重置
+    DiffResetCell partial;
+    RunReuse(partial, kinds[0], 0);
+    partial.Reuse();
+    CHECK("C", partial.view.values[2] == 0);  // borderRadius
+    CHECK("C", partial.view.values[0] != 0);  // backgroundColor 尚未重置
+    partial.SetProp("frame", 42);
+    partial.Insert();
+    CHECK("C", partial.view.values[1] == 42);
+    CHECK("C", partial.view.values[0] == 0 && partial.view.values[6] == 0);  // backgroundColor / opacity
+    CHECK("C", partial.pending_reset_props.Empty());
+
+    // E: 复用池中的 view 被其它页面取用, 延迟的 backgroundColor / frame / border 在换新处理器前已重置
+    DiffResetCell adopted;
+    RunReuse(adopted, kinds[0], 0);
+    adopted.Reuse();
+    CHECK("E", !adopted.pending_reset_props.Empty());
+    adopted.Adopt();
+    CHECK("E", adopted.pending_reset_props.Empty() && adopted.handler_generation == 1);
+    CHECK("E", adopted.view.values[0] == 0 && adopted.view.values[1] == 0 && adopted.view.values[3] == 0);
+}
+
+// ---------------------------------------------------------------------------
+// 基准: 列表滚动, cell 多数复用为同类型
+// ---------------------------------------------------------------------------
+int main(int argc, char **argv) {
+    int reuses = argc > 1 ? atoi(argv[1]) : 20000;
+    int rounds = argc > 2 ? atoi(argv[2]) : 10;
+
+    BaseTable();
+    EventTable();
+    ViewTable();
+    auto kinds = MakeCellKinds();
+    TestBehavior(kinds);
+
+    // 80% 同类型复用
+    std::vector<size_t> sequence(reuses);
+    std::mt19937 rng(42);
+    size_t current = 0;
+    for (auto &kind : sequence) {
+        if (rng() % 5 == 0) {
+            current = rng() % kinds.size();
+        }
+        kind = current;
+    }
+
+    LegacyCell legacy;
+    BitsetStringCell bitset;
+    DiffResetCell diff;
+    double legacy_ms = 0;
+    double bitset_ms = 0;
+    double diff_ms = 0;
+    for (int r = 0; r < rounds; ++r) {
+        legacy.view.reset_count = bitset.view.reset_count = diff.view.reset_count = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < reuses; ++i) {
+            RunReuse(legacy, kinds[sequence[i]], i);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        for (int i = 0; i < reuses; ++i) {
+            RunReuse(bitset, kinds[sequence[i]], i);
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        for (int i = 0; i < reuses; ++i) {
+            RunReuse(diff, kinds[sequence[i]], i);
+        }
+        auto t3 = std::chrono::steady_clock::now();
+        legacy_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+        bitset_ms += std::chrono::duration<double, std::milli>(t2 - t1).count();
+        diff_ms += std::chrono::duration<double, std::milli>(t3 - t2).count();
+    }
+    CHECK("A", memcmp(legacy.view.values, diff.view.values, sizeof(legacy.view.values)) == 0);
+    CHECK("D", diff.view.reset_count < legacy.view.reset_count);
+    CHECK("D", bitset.view.reset_count == legacy.view.reset_count);
+
+    auto per_reuse_ns = [reuses, rounds](double ms) { return ms * 1e6 / (static_cast<double>(reuses) * rounds); };
+    printf("reuses=%d rounds=%d props/cell=%zu~%zu\n", reuses, rounds, kinds.front().size(), kinds.back().size());
+    printf("vector<string> + strcmp : %8.1f ns/reuse, resets/reuse %.1f\n", per_reuse_ns(legacy_ms),
+           static_cast<double>(legacy.view.reset_count) / reuses);
+    printf("bitset + string reset   : %8.1f ns/reuse, resets/reuse %.1f (%.2fx)\n", per_reuse_ns(bitset_ms),
+           static_cast<double>(bitset.view.reset_count) / reuses, legacy_ms / bitset_ms);
+    printf("bitset + id + diff      : %8.1f ns/reuse, resets/reuse %.1f (%.2fx)\n", per_reuse_ns(diff_ms),
+           static_cast<double>(diff.view.reset_count) / reuses, legacy_ms / diff_ms);
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
@@ -0,0 +1,476 @@
+// 基准测试: bench_render_command_buffer
+//
+// 目标:
+//   对比 Kotlin -> Native 渲染指令的两种派发方式在 5k 节点合成树上的开销:
+//   1) 逐条派发: 复刻 com_tencent_kuikly_CallNative -> DispatchCallNative -> KRRenderCore::OnCallNative
+//      的每条指令成本(instanceId std::string + 加锁 map 查找 + 6 个堆分配的参数值 + std::function 闭包);
+//   2) 批量派发: 直接使用生产代码 KRRenderCommandBuffer.h 编码/解码, 整批一次查找、一次拷贝、一个闭包,
+//      属性值按 KRRenderCore 的做法用生产代码 KRChunkAllocator.h 成块分配。
+//
+// 说明:
+//   KRRenderCommandBuffer.h / KRChunkAllocator.h 只依赖标准库, 因此这里直接 include 生产实现;
+//   KRRenderValue / KRRenderLayerHandler 依赖 OHOS 运行时, 用等价语义的最小替身代替。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_render_command_buffer.cpp -o bench_rcb
+//   运行:
+//   ./bench_rcb                 # 默认 5000 节点, 20 轮
+//   ./bench_rcb 5000 50         # 节点数, 轮数
+//
+// 验证项:
+//   A. 两条路径作用到 layer 上的最终状态一致 (节点数 / 父子关系 / 属性数 / frame 校验和)
+//   B. 非法 buffer (截断) 能被识别, 不越界
+//   C. 成块分配的属性值堆分配次数少于逐个 make_shared; 被长期持有的值只保活自己所在的块
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "libohos_render/context/KRRenderCommandBuffer.h"
+#include "libohos_render/foundation/KRChunkAllocator.h"
+
+// 统计堆分配次数
+static std::atomic<uint64_t> g_heap_allocs{0};
+void *operator new(size_t size) {
+    g_heap_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+void operator delete(void *p, size_t) noexcept {
+    std::free(p);
+}
+
+// ---------------------------------------------------------------------------
+// 0. 替身: KRRenderValue / spinlock map / layer
+// ---------------------------------------------------------------------------
+class MiniSpinLock {
+ public:
+    void lock() {
+        while (flag_.test_and_set(std::memory_order_acquire)) {
+        }
+    }
+    void unlock() { flag_.clear(std::memory_order_release); }
+
+ private:
+    std::atomic_flag flag_ = ATOMIC_FLAG_INIT;
+};
+
+struct MockValue {
+    std::variant<std::monostate, int32_t, int64_t, float, double, bool, std::string> value;
+    explicit MockValue() = default;
+    template <typename T>
+    explicit MockValue(T v) : value(std::move(v)) {}
+    int32_t ToInt() const {
+        if (auto p = std::get_if<int32_t>(&value)) return *p;
+        if (auto p = std::get_if<double>(&value)) return static_cast<int32_t>(*p);
+        if (auto p = std::get_if<float>(&value)) return static_cast<int32_t>(*p);
+        return 0;
+    }
+    float ToFloat() const {
+        if (auto p = std::get_if<float>(&value)) return *p;
+        if (auto p = std::get_if<double>(&value)) return static_cast<float>(*p);
+        if (auto p = std::get_if<int32_t>(&value)) return static_cast<float>(*p);
+        return 0;
+    }
+    std::string ToString() const {
+        if (auto p = std::get_if<std::string>(&value)) return *p;
+        return "";
+    }
+};
+using MockAnyValue = std::shared_ptr<MockValue>;
+
+struct MockView {
+    std::string name;
+    int parent = -2;
+    int index = -1;
+    std::unordered_map<std::string, MockAnyValue> props;
+    float frame[4] = {0, 0, 0, 0};
+};
+
+struct MockLayer {
+    std::unordered_map<int, MockView> views;
+
+    void CreateRenderView(int tag, const std::string &name) { views[tag].name = name; }
+    void RemoveRenderView(int tag) { views.erase(tag); }
+    void InsertSubRenderView(int parent, int child, int index) {
+        auto &v = views[child];
+        v.parent = parent;
+        v.index = index;
+    }
+    void SetProp(int tag, const std::string &key, const MockAnyValue &value) { views[tag].props[key] = value; }
+    void SetFrame(int tag, float x, float y, float w, float h) {
+        auto &v = views[tag];
+        v.frame[0] = x;
+        v.frame[1] = y;
+        v.frame[2] = w;
+        v.frame[3] = h;
+    }
+
+    uint64_t Checksum() const {
+        uint64_t sum = views.size();
+        for (const auto &it : views) {
+            sum = sum * 31 + static_cast<uint64_t>(it.first);
+            sum += static_cast<uint64_t>(it.second.parent + 7) * 131 + static_cast<uint64_t>(it.second.index + 3);
+            sum += it.second.props.size() * 17;
+            for (float f : it.second.frame) sum += static_cast<uint64_t>(f * 100);
+        }
+        return sum;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// 1. 合成树: 4 叉树, 每个节点 create + 4 个属性 + frame + insert
+// ---------------------------------------------------------------------------
+struct SyntheticOp {
+    SyntheticOp(int m, int t) : method(m), tag(t) {}
+    int method;  // KuiklyRenderNativeMethod
+    int tag;
+    int i1 = 0;
+    int i2 = 0;
+    std::string s1;
+    MockAnyValue value;  // setViewProp 的值
+    float f[4] = {0, 0, 0, 0};
+};
+
+static std::vector<SyntheticOp> BuildTree(int nodes) {
+    std::vector<SyntheticOp> ops;
+    ops.reserve(nodes * 7);
+    static const char *kViewNames[] = {"KRView", "KRRichTextView", "KRImageView"};
+    for (int i = 0; i < nodes; ++i) {
+        SyntheticOp create{1, i};
+        create.s1 = kViewNames[i % 3];
+        ops.push_back(create);
+
+        SyntheticOp bg{4, i};
+        bg.s1 = "backgroundColor";
+        bg.value = std::make_shared<MockValue>(std::string("4294967295"));
+        ops.push_back(bg);
+        SyntheticOp radius{4, i};
+        radius.s1 = "borderRadius";
+        radius.value = std::make_shared<MockValue>(std::string("8.0,8.0,8.0,8.0"));
+        ops.push_back(radius);
+        SyntheticOp opacity{4, i};
+        opacity.s1 = "opacity";
+        opacity.value = std::make_shared<MockValue>(0.5f);
+        ops.push_back(opacity);
+        SyntheticOp zindex{4, i};
+        zindex.s1 = "zIndex";
+        zindex.value = std::make_shared<MockValue>(int32_t(i % 5));
+        ops.push_back(zindex);
+
+        SyntheticOp frame{5, i};
+        frame.f[0] = static_cast<float>(i % 10);
+        frame.f[1] = static_cast<float>(i / 10);
+        frame.f[2] = 100;
+        frame.f[3] = 44;
+        ops.push_back(frame);
+
+        SyntheticOp insert{3, i == 0 ? -1 : (i - 1) / 4};
+        insert.i1 = i;
+        insert.i2 = i == 0 ? 0 : (i - 1) % 4;
+        ops.push_back(insert);
+    }
+    return ops;
+}
+
+// ---------------------------------------------------------------------------
+// 2. 逐条派发路径替身
+// ---------------------------------------------------------------------------
+struct PerOpDispatcher {
+    MiniSpinLock lock;
+    std::unordered_map<std::string, int> handler_map;  // instanceId -> handler
+    std::vector<std::function<void()>> main_tasks;
+    MockLayer *layer;
+
+    static MockAnyValue MakeArg(const SyntheticOp &op, int index) {
+        // 复刻 KRRenderValue::Make(KRRenderCValue) : 6 个参数每个都堆分配
+        switch (index) {
+        case 0: return std::make_shared<MockValue>(std::string("page_1024"));
+        case 1: return std::make_shared<MockValue>(int32_t(op.tag));
+        case 2: return op.method == 4 || op.method == 1 ? std::make_shared<MockValue>(op.s1)
+                                                        : std::make_shared<MockValue>(op.method == 5 ? op.f[0] : float(op.i1));
+        case 3: return op.method == 4 ? op.value : std::make_shared<MockValue>(op.method == 5 ? op.f[1] : float(op.i2));
+        case 4: return std::make_shared<MockValue>(op.method == 5 ? op.f[2] : 0.0f);
+        default: return std::make_shared<MockValue>(op.method == 5 ? op.f[3] : 0.0f);
+        }
+    }
+
+    void CallNative(const char *pager_id, const SyntheticOp &op) {
+        std::string instance_id(pager_id);
+        {
+            lock.lock();
+            auto it = handler_map.find(instance_id);
+            bool found = it != handler_map.end();
+            lock.unlock();
+            if (!found) return;
+        }
+        auto a0 = MakeArg(op, 0);
+        auto a1 = MakeArg(op, 1);
+        auto a2 = MakeArg(op, 2);
+        auto a3 = MakeArg(op, 3);
+        auto a4 = MakeArg(op, 4);
+        auto a5 = MakeArg(op, 5);
+        int method = op.method;
+        MockLayer *l = layer;
+        main_tasks.emplace_back([l, method, a1, a2, a3, a4, a5] {
+            switch (method) {
+            case 1: l->CreateRenderView(a1->ToInt(), a2->ToString()); break;
+            case 3: l->InsertSubRenderView(a1->ToInt(), a2->ToInt(), a3->ToInt()); break;
+            case 4: l->SetProp(a1->ToInt(), a2->ToString(), a3); break;
+            case 5: l->SetFrame(a1->ToInt(), a2->ToFloat(), a3->ToFloat(), a4->ToFloat(), a5->ToFloat()); break;
+            default: break;
+            }
+        });
+    }
+
+    void Flush() {
+        for (auto &t : main_tasks) t();
+        main_tasks.clear();
+    }
+};
+
+// ---------------------------------------------------------------------------
+// 3. 批量派发路径 (生产编解码)
+// ---------------------------------------------------------------------------
+// 同 KRRenderCore: 对象与控制块在块内分配
+static constexpr size_t kCommandValueBlockSize = sizeof(MockValue) + 64;
+
+template <typename T>
+static MockAnyValue MakeArenaValue(KRChunkArena &arena, T &&value) {
+    KRChunkAllocator<MockValue> allocator(arena.Reserve(kCommandValueBlockSize));
+    return std::allocate_shared<MockValue>(allocator, std::forward<T>(value));
+}
+
+static MockAnyValue MakeCommandValue(KRChunkArena &arena, const KRRenderCommandValue &value) {
+    switch (value.type) {
+    case KRRenderCValue::Type::INT: return MakeArenaValue(arena, static_cast<int32_t>(value.int_value));
+    case KRRenderCValue::Type::FLOAT: return MakeArenaValue(arena, static_cast<float>(value.double_value));
+    case KRRenderCValue::Type::DOUBLE: return MakeArenaValue(arena, value.double_value);
+    case KRRenderCValue::Type::STRING: return MakeArenaValue(arena, std::string(value.bytes));
+    default: return std::allocate_shared<MockValue>(KRChunkAllocator<MockValue>(arena.Reserve(kCommandValueBlockSize)));
+    }
+}
+
+struct LayerVisitor {
+    MockLayer *layer;
+    KRChunkArena arena{};
+    void OnCreateRenderView(int32_t tag, std::string_view name) { layer->CreateRenderView(tag, std::string(name)); }
+    void OnRemoveRenderView(int32_t tag) { layer->RemoveRenderView(tag); }
+    void OnInsertSubRenderView(int32_t p, int32_t c, int32_t i) { layer->InsertSubRenderView(p, c, i); }
+    void OnSetViewProp(int32_t tag, std::string_view key, const KRRenderCommandValue &v) {
+        layer->SetProp(tag, std::string(key), MakeCommandValue(arena, v));
+    }
+    void OnSetRenderViewFrame(int32_t tag, float x, float y, float w, float h) { layer->SetFrame(tag, x, y, w, h); }
+    void OnCreateShadow(int32_t, std::string_view) {}
+    void OnRemoveShadow(int32_t) {}
+    void OnSetShadowProp(int32_t, std::string_view, const KRRenderCommandValue &) {}
+    void OnSetShadowForView(int32_t) {}
+};
+
+static void Encode(const std::vector<SyntheticOp> &ops, KRRenderCommandBufferWriter &writer) {
+    writer.Reset();
+    for (const auto &op : ops) {
+        switch (op.method) {
+        case 1: writer.CreateRenderView(op.tag, op.s1); break;
+        case 3: writer.InsertSubRenderView(op.tag, op.i1, op.i2); break;
+        case 4: {
+            const auto &v = op.value->value;
+            if (auto p = std::get_if<std::string>(&v)) {
+                writer.SetViewProp(op.tag, op.s1, *p);
+            } else if (auto p = std::get_if<float>(&v)) {
+                writer.SetViewProp(op.tag, op.s1, *p);
+            } else if (auto p = std::get_if<int32_t>(&v)) {
+                writer.SetViewProp(op.tag, op.s1, *p);
+            }
+            break;
+        }
+        case 5: writer.SetRenderViewFrame(op.tag, op.f[0], op.f[1], op.f[2], op.f[3]); break;
+        default: break;
+        }
+    }
+}
+
+struct BatchDispatcher {
+    MiniSpinLock lock;
+    std::unordered_map<std::string, int> handler_map;
+    std::vector<std::function<void()>> main_tasks;
+    MockLayer *layer;
+
+    void CallNativeBatch(const char *pager_id, const uint8_t *data, size_t size) {
+        std::string instance_id(pager_id);
+        {
+            lock.lock();
+            bool found = handler_map.find(instance_id) != handler_map.end();
+            lock.unlock();
+            if (!found) return;
+        }
+        auto buffer = std::make_shared<std::vector<uint8_t>>(data, data + size);
+        MockLayer *l = layer;
+        main_tasks.emplace_back([l, buffer] {
+            KRRenderCommandBufferReader reader(buffer->data(), buffer->size());
+            LayerVisitor visitor{l};
+            reader.Decode(visitor);
+        });
+    }
+
+    void Flush() {
+        for (auto &t : main_tasks) t();
+        main_tasks.clear();
+    }
+};
+
+// ---------------------------------------------------------------------------
+// 4. 主流程
+// ---------------------------------------------------------------------------
+static double Median(std::vector<double> v) {
+    std::sort(v.begin(), v.end());
+    return v[v.size() / 2];
+}
+
+int main(int argc, char **argv) {
+    int nodes = 5000;
+    int rounds = 20;
+    if (argc >= 2) nodes = std::atoi(argv[1]);
+    if (argc >= 3) rounds = std::atoi(argv[2]);
+
+    std::printf("\n=== Bench: render command buffer (%d nodes, %d rounds) ===\n", nodes, rounds);
+    auto ops = BuildTree(nodes);
+    const char *pager_id = "page_1024";
+
+    std::vector<double> per_op_ms, encode_ms, batch_ms;
+    uint64_t per_op_sum = 0, batch_sum = 0;
+    uint64_t per_op_allocs = 0, batch_allocs = 0;
+    size_t buffer_size = 0;
+    KRRenderCommandBufferWriter writer;
+
+    for (int r = 0; r < rounds; ++r) {
+        MockLayer layer_a;
+        PerOpDispatcher per_op;
+        per_op.layer = &layer_a;
+        per_op.handler_map[pager_id] = 1;
+        auto allocs0 = g_heap_allocs.load();
+        auto t0 = std::chrono::steady_clock::now();
+        for (const auto &op : ops) per_op.CallNative(pager_id, op);
+        per_op.Flush();
+        auto t1 = std::chrono::steady_clock::now();
+        per_op_allocs = g_heap_allocs.load() - allocs0;
+        per_op_ms.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+        per_op_sum = layer_a.Checksum();
+
+        MockLayer layer_b;
+        BatchDispatcher batch;
+        batch.layer = &layer_b;
+        batch.handler_map[pager_id] = 1;
+        auto t2 = std::chrono::steady_clock::now();
+        Encode(ops, writer);
+        const auto &buffer = writer.Finish();
+        auto allocs3 = g_heap_allocs.load();
+        auto t3 = std::chrono::steady_clock::now();
+        batch.CallNativeBatch(pager_id, buffer.data(), buffer.size());
+        batch.Flush();
+        auto t4 = std::chrono::steady_clock::now();
+        batch_allocs = g_heap_allocs.load() - allocs3;
+        encode_ms.push_back(std::chrono::duration<double, std::milli>(t3 - t2).count());
+        batch_ms.push_back(std::chrono::duration<double, std::milli>(t4 - t3).count());
+        batch_sum = layer_b.Checksum();
+        buffer_size = buffer.size();
+    }
+
+    double per_op = Median(per_op_ms);
+    double encode = Median(encode_ms);
+    double batch = Median(batch_ms);
+    std::printf("------------------------------------------------------------\n");
+    std::printf("Ops                : %zu\n", ops.size());
+    std::printf("Buffer size        : %zu bytes\n", buffer_size);
+    std::printf("Per-op dispatch    : %.3f ms (median)\n", per_op);
+    std::printf("Batch encode       : %.3f ms (median, Kotlin 侧成本)\n", encode);
+    std::printf("Batch dispatch     : %.3f ms (median)\n", batch);
+    std::printf("Heap allocs        : per-op %llu, batch %llu (含 layer 自身)\n", (unsigned long long)per_op_allocs,
+                (unsigned long long)batch_allocs);
+    std::printf("Speedup (dispatch) : %.2fx\n", batch > 0 ? per_op / batch : 0.0);
+    std::printf("Speedup (e2e)      : %.2fx\n", (batch + encode) > 0 ? per_op / (batch + encode) : 0.0);
+
+    bool ok = true;
+    if (per_op_sum != batch_sum) {
+        std::printf("[FAIL A] layer checksum mismatch: per-op=%llu batch=%llu\n", (unsigned long long)per_op_sum,
+                    (unsigned long long)batch_sum);
+        ok = false;
+    } else {
+        std::printf("[PASS A] layer state identical\n");
+    }
+
+    // 截断的 buffer 必须被识别
+    Encode(ops, writer);
+    const auto &full = writer.Finish();
+    bool truncated_rejected = true;
+    for (size_t cut : {size_t(0), size_t(5), kKRRenderCommandBufferHeaderSize, full.size() / 2, full.size() - 1}) {
+        MockLayer layer;
+        LayerVisitor visitor{&layer};
+        KRRenderCommandBufferReader reader(full.data(), cut);
+        if (reader.Decode(visitor)) {
+            truncated_rejected = false;
+        }
+    }
+    if (!truncated_rejected) {
+        std::printf("[FAIL B] truncated buffer decoded as valid\n");
+        ok = false;
+    } else {
+        std::printf("[PASS B] truncated buffers rejected\n");
+    }
+
+    // 属性值成块分配: 分配次数按块计; 单个值被长期持有时只保活所在的块
+    {
+        const int kValues = 1000;
+        std::vector<MockAnyValue> values;
+        values.reserve(kValues);
+        auto allocs0 = g_heap_allocs.load();
+        for (int i = 0; i < kValues; ++i) {
+            values.push_back(std::make_shared<MockValue>(int32_t(i)));
+        }
+        auto shared_allocs = g_heap_allocs.load() - allocs0;
+        values.clear();
+
+        std::weak_ptr<KRChunkArena::Chunk> first_chunk;
+        std::weak_ptr<KRChunkArena::Chunk> last_chunk;
+        MockAnyValue kept;
+        uint64_t arena_allocs = 0;
+        {
+            KRChunkArena arena;
+            first_chunk = arena.Reserve(kCommandValueBlockSize);
+            allocs0 = g_heap_allocs.load();
+            for (int i = 0; i < kValues; ++i) {
+                values.push_back(MakeArenaValue(arena, int32_t(i)));
+            }
+            arena_allocs = g_heap_allocs.load() - allocs0;
+            last_chunk = arena.Reserve(0);
+            kept = values[0];
+            values.clear();
+        }
+        bool c_ok = arena_allocs * 4 < shared_allocs && !first_chunk.expired() && last_chunk.expired() &&
+                    kept->ToInt() == 0;
+        kept.reset();
+        c_ok = c_ok && first_chunk.expired();
+        std::printf("[%s C] %d values: make_shared %llu allocs, chunk arena %llu allocs; held value keeps one chunk\n",
+                    c_ok ? "PASS" : "FAIL", kValues, (unsigned long long)shared_allocs,
+                    (unsigned long long)arena_allocs);
+        ok = ok && c_ok;
+    }
+
+    std::printf("%s\n", ok ? ">>> ALL PASS <<<" : ">>> FAILED <<<");
+    std::printf("------------------------------------------------------------\n\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,358 @@
+// 测试+基准: bench_render_value_parse_cache
+//
+// 目标:
+//   对比 KRRenderValue map/array 取值的两种方式在富文本密集页面上的开销:
+//   1) 旧路径: toMap()/toArray() 每次调用都返回完整拷贝, 字符串形式的值每次重新 cJSON_Parse;
+//   2) 新路径: 字符串形式的值首次访问时解析并缓存 (双重检查锁定, 与 toCValue() 相同),
+//      toMapRef()/toArrayRef()/valueForKey()/valueAtIndex() 借用返回, 不拷贝。
+//
+// 说明:
+//   KRRenderValue.h 依赖 NAPI/JSVM 运行时, 这里用等价语义的最小替身复刻 map/array/string 分支
+//   以及解析缓存的实现; cJSON 直接使用仓库内 thirdparty 源码。
+//   场景一复刻 KRRichTextShadow::MeasureTextSize 每个 span 取 18 个样式 key;
+//   场景二复刻 KRAnyDataGetMapValue / KRAnyDataGetArrayElement 对字符串形式值的逐 key 访问。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_render_value_parse_cache.cpp
+//       -x c ../../main/cpp/thirdparty/cJSON/cJSON.c -o bench_rvpc
+//   运行:
+//   ./bench_rvpc                # 默认 500 个文本节点 x 6 span, 10 轮测量
+//   ./bench_rvpc 500 20         # 文本节点数, 轮数
+//
+// 验证项:
+//   A. 旧/新两条路径取到的值一致
+//   B. 多线程并发首次访问同一个字符串值, 只解析一次且所有线程拿到同一份结果
+//   C. 借用的元素指针在多次调用间保持稳定 (旧路径下 KRAnyDataGetArrayElement 返回的是临时拷贝中的指针)
+//   D. 非法 JSON / 非 map 类型返回空结构, 查找不存在的 key/越界下标返回空指针
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "thirdparty/cJSON/cJSON.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+static std::atomic<int> g_parse_count{0};
+
+// ---------------------------------------------------------------------------
+// 替身: 只保留 map/array/string/double 分支
+// ---------------------------------------------------------------------------
+class MiniValue {
+ public:
+    using Map = std::unordered_map<std::string, std::shared_ptr<MiniValue>>;
+    using Array = std::vector<std::shared_ptr<MiniValue>>;
+
+    MiniValue() = default;
+    explicit MiniValue(double v) : value_(v) {}
+    explicit MiniValue(const std::string &v) : value_(v) {}
+    explicit MiniValue(Map v) : value_(std::move(v)) {}
+    explicit MiniValue(Array v) : value_(std::move(v)) {}
+    ~MiniValue() {
+        delete parsed_map_.load(std::memory_order_relaxed);
+        delete parsed_array_.load(std::memory_order_relaxed);
+    }
+
+    bool isMap() const { return std::holds_alternative<Map>(value_); }
+    bool isArray() const { return std::holds_alternative<Array>(value_); }
+    bool isString() const { return std::holds_alternative<std::string>(value_); }
+
+    std::string toString() const {
+        if (isString()) {
+            return std::get<std::string>(value_);
+        }
+        if (std::holds_alternative<double>(value_)) {
+            return std::to_string(std::get<double>(value_));
+        }
+        return "";
+    }
+
+    // 旧实现
+    Map toMapLegacy() const {
+        if (isMap()) {
+            return std::get<Map>(value_);
+        } else if (isString()) {
+            Map map;
+            ParseInto(&map, nullptr);
+            return map;
+        }
+        return Map();
+    }
+
+    Array toArrayLegacy() const {
+        if (isArray()) {
+            return std::get<Array>(value_);
+        } else if (isString()) {
+            Array array;
+            ParseInto(nullptr, &array);
+            return array;
+        }
+        return Array();
+    }
+
+    // 新实现 (与 KRRenderValue::toMapRef / toArrayRef 一致)
+    const Map &toMapRef() const {
+        if (isMap()) {
+            return std::get<Map>(value_);
+        }
+        if (!isString()) {
+            static const Map kEmptyMap;
+            return kEmptyMap;
+        }
+        if (auto parsed = parsed_map_.load(std::memory_order_acquire)) {
+            return *parsed;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto parsed = parsed_map_.load(std::memory_order_relaxed);
+        if (parsed == nullptr) {
+            parsed = new Map();
+            ParseInto(parsed, nullptr);
+            parsed_map_.store(parsed, std::memory_order_release);
+        }
+        return *parsed;
+    }
+
+    const Array &toArrayRef() const {
+        if (isArray()) {
+            return std::get<Array>(value_);
+        }
+        if (!isString()) {
+            static const Array kEmptyArray;
+            return kEmptyArray;
+        }
+        if (auto parsed = parsed_array_.load(std::memory_order_acquire)) {
+            return *parsed;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto parsed = parsed_array_.load(std::memory_order_relaxed);
+        if (parsed == nullptr) {
+            parsed = new Array();
+            ParseInto(nullptr, parsed);
+            parsed_array_.store(parsed, std::memory_order_release);
+        }
+        return *parsed;
+    }
+
+    const std::shared_ptr<MiniValue> &valueForKey(const std::string &key) const {
+        static const std::shared_ptr<MiniValue> kEmpty;
+        const auto &map = toMapRef();
+        auto it = map.find(key);
+        return it != map.end() ? it->second : kEmpty;
+    }
+
+    const std::shared_ptr<MiniValue> &valueAtIndex(size_t index) const {
+        static const std::shared_ptr<MiniValue> kEmpty;
+        const auto &array = toArrayRef();
+        return index < array.size() ? array[index] : kEmpty;
+    }
+
+ private:
+    static std::shared_ptr<MiniValue> FromJson(const cJSON *item) {
+        if (cJSON_IsNumber(item)) {
+            return std::make_shared<MiniValue>(cJSON_GetNumberValue(item));
+        } else if (cJSON_IsString(item)) {
+            return std::make_shared<MiniValue>(std::string(cJSON_GetStringValue(item)));
+        } else if (cJSON_IsObject(item)) {
+            Map map;
+            for (cJSON *child = item->child; child != NULL; child = child->next) {
+                map[child->string] = FromJson(child);
+            }
+            return std::make_shared<MiniValue>(std::move(map));
+        } else if (cJSON_IsArray(item)) {
+            Array array;
+            for (cJSON *child = item->child; child != NULL; child = child->next) {
+                array.push_back(FromJson(child));
+            }
+            return std::make_shared<MiniValue>(std::move(array));
+        }
+        return std::make_shared<MiniValue>();
+    }
+
+    void ParseInto(Map *map, Array *array) const {
+        g_parse_count.fetch_add(1, std::memory_order_relaxed);
+        cJSON *cjson = cJSON_Parse(std::get<std::string>(value_).c_str());
+        if (cjson == nullptr) {
+            return;
+        }
+        for (cJSON *item = cjson->child; item != NULL; item = item->next) {
+            if (map) {
+                (*map)[item->string] = FromJson(item);
+            } else {
+                array->push_back(FromJson(item));
+            }
+        }
+        cJSON_Delete(cjson);
+    }
+
+    std::variant<std::monostate, double, std::string, Map, Array> value_;
+    mutable std::mutex mutex_;
+    mutable std::atomic<Map *> parsed_map_{nullptr};
+    mutable std::atomic<Array *> parsed_array_{nullptr};
+};
+
+static const char *kSpanKeys[] = {"fontSize",      "value",       "text",          "fontWeight",     "color",
+                                  "backgroundImage", "fontFamily", "lineHeight",    "lineSpacing",    "textAlign",
+                                  "textDecoration", "fontStyle",  "letterSpacing", "textShadow",     "strokeWidth",
+                                  "strokeColor",   "placeholderWidth", "placeholderHeight"};
+
+static std::string MakeSpanJson(int i) {
+    char buf[512];
+    snprintf(buf, sizeof(buf),
+             "{\"value\":\"span text %d with some content\",\"fontSize\":%d,\"color\":\"rgba(0,0,0,1)\","
+             "\"fontWeight\":400,\"lineHeight\":20,\"textAlign\":\"left\",\"fontFamily\":\"HarmonyOS Sans\","
+             "\"letterSpacing\":0.5,\"textDecoration\":\"none\",\"fontStyle\":\"normal\"}",
+             i, 12 + i % 6);
+    return buf;
+}
+
+// GetKRValue 替身: 先查 span, 再查 props; 只统计命中, 排除 toString() 本身的开销
+template <typename M>
+static double Lookup(const M &span, const M &props, const char *key) {
+    auto it = span.find(key);
+    if (it != span.end()) {
+        return 1;
+    }
+    return props.find(key) != props.end() ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    int text_nodes = argc > 1 ? atoi(argv[1]) : 500;
+    int rounds = argc > 2 ? atoi(argv[2]) : 10;
+    const int spans_per_node = 6;
+
+    // 每个文本节点: values 为 JSON 字符串 (与 Kotlin 侧下发一致), props 为 map
+    std::vector<std::shared_ptr<MiniValue>> values;
+    for (int n = 0; n < text_nodes; ++n) {
+        std::string json = "[";
+        for (int s = 0; s < spans_per_node; ++s) {
+            json += (s ? "," : "") + MakeSpanJson(n * spans_per_node + s);
+        }
+        json += "]";
+        values.push_back(std::make_shared<MiniValue>(json));
+    }
+    MiniValue::Map props;
+    props["numberOfLines"] = std::make_shared<MiniValue>(2.0);
+    props["color"] = std::make_shared<MiniValue>(std::string("rgba(0,0,0,1)"));
+
+    // --- 场景一: 富文本测量, 每轮每个 span 取 18 个 key ---
+    double legacy_sum = 0;
+    double ref_sum = 0;
+    // SetProp 时 values_ = prop_value->toArray(), 两条路径相同, 不计入测量
+    std::vector<MiniValue::Array> shadow_values;
+    for (const auto &value : values) {
+        shadow_values.push_back(value->toArrayLegacy());
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        for (const auto &values_ : shadow_values) {
+            // 旧: 测量时 spans = values_ 拷贝, 每个 span->toMap() 整体拷贝
+            auto spans = values_;
+            for (const auto &span : spans) {
+                auto span_map = span->toMapLegacy();
+                for (auto key : kSpanKeys) {
+                    legacy_sum += Lookup(span_map, props, key);
+                }
+            }
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        for (const auto &values_ : shadow_values) {
+            auto spans = values_;
+            for (const auto &span : spans) {
+                const auto &span_map = span->toMapRef();
+                for (auto key : kSpanKeys) {
+                    ref_sum += Lookup(span_map, props, key);
+                }
+            }
+        }
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    CHECK("A", legacy_sum == ref_sum);
+
+    // --- 场景二: KRAnyData 对字符串形式 map 逐 key 访问 ---
+    auto string_map = std::make_shared<MiniValue>(MakeSpanJson(7));
+    const int lookups = 20000;
+    double legacy_hits = 0;
+    double ref_hits = 0;
+    auto t3 = std::chrono::steady_clock::now();
+    for (int i = 0; i < lookups; ++i) {
+        auto map = string_map->toMapLegacy();
+        auto it = map.find(kSpanKeys[i % 18]);
+        legacy_hits += it != map.end() ? 1 : 0;
+    }
+    auto t4 = std::chrono::steady_clock::now();
+    for (int i = 0; i < lookups; ++i) {
+        ref_hits += string_map->valueForKey(kSpanKeys[i % 18]) != nullptr ? 1 : 0;
+    }
+    auto t5 = std::chrono::steady_clock::now();
+    CHECK("A", legacy_hits == ref_hits);
+
+    // --- B: 并发首次访问 ---
+    auto shared = std::make_shared<MiniValue>(MakeSpanJson(42));
+    g_parse_count = 0;
+    std::vector<const MiniValue::Map *> seen(8, nullptr);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([t, &seen, &shared] {
+            for (int i = 0; i < 1000; ++i) {
+                seen[t] = &shared->toMapRef();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    bool same = true;
+    for (auto p : seen) {
+        same = same && p == seen[0];
+    }
+    CHECK("B", g_parse_count.load() == 1);
+    CHECK("B", same);
+    CHECK("B", shared->toMapRef().size() == 10);
+
+    // --- C: 借用元素稳定 ---
+    const auto *first = values[0]->valueAtIndex(0).get();
+    CHECK("C", first != nullptr && first == values[0]->valueAtIndex(0).get());
+    CHECK("C", values[0]->valueAtIndex(0)->valueForKey("fontSize")->toString() == std::to_string(12.0));
+
+    // --- D: 边界 ---
+    auto bad = std::make_shared<MiniValue>(std::string("{not json"));
+    auto number = std::make_shared<MiniValue>(1.0);
+    CHECK("D", bad->toMapRef().empty() && bad->toArrayRef().empty());
+    CHECK("D", number->toMapRef().empty() && number->valueForKey("x") == nullptr);
+    CHECK("D", values[0]->valueAtIndex(spans_per_node) == nullptr);
+    CHECK("D", string_map->valueForKey("missing") == nullptr);
+
+    auto ms = [](auto a, auto b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+    printf("rich text: nodes=%d spans/node=%d keys/span=18 rounds=%d\n", text_nodes, spans_per_node, rounds);
+    printf("  map copy       : %8.3f ms/round\n", ms(t0, t1) / rounds);
+    printf("  memoized ref   : %8.3f ms/round (%.2fx)\n", ms(t1, t2) / rounds, ms(t0, t1) / ms(t1, t2));
+    printf("string map lookup x%d\n", lookups);
+    printf("  reparse        : %8.3f ms\n", ms(t3, t4));
+    printf("  memoized ref   : %8.3f ms (%.2fx)\n", ms(t4, t5), ms(t3, t4) / ms(t4, t5));
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
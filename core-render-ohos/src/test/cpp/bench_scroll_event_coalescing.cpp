@@ -0,0 +1,401 @@
+// 基准 + 回放测试: bench_scroll_event_coalescing
+//
+// 目标:
+//   验证 KRScrollEventCoalescer (KRScrollerView 的 scroll 事件按帧合并) 在一条滚动轨迹回放下的行为:
+//   1) 120Hz 下一帧内 2~3 次 ON_SCROLL 只投递最新偏移一次, 统计收到/投递数;
+//   2) 拖拽开始/将结束/结束、滚动结束等离散事件一个不丢, 且投递时业务侧已看到最新偏移;
+//   3) 进出边界的偏移立即投递, 不被合并。
+//
+// 说明:
+//   KRScrollEventCoalescer.h 只依赖标准库, 这里直接包含生产实现。
+//   轨迹按真机滚动日志的节奏合成 (固定种子): 120Hz VSync, 拖拽阶段触摸采样 240Hz (每帧 2 次 ON_SCROLL),
+//   惯性阶段 ON_SCROLL + 内容区域变化补发 (每帧 2~3 次), 惯性滚到底部后越界回弹, 最后停止。
+//   FakeVSync 模拟 KRVSyncDispatcher + KRMainThread: 请求的帧回调在下一次 VSync 时刻执行。
+//   "投递成本" 以逐个把事件序列化为与 GetCommonScrollParams 相同字段的 JSON 估算 (对应 context 线程与 Kotlin 侧开销)。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -I ../../main/cpp bench_scroll_event_coalescing.cpp -o bench_scroll_event_coalescing
+//   运行:
+//   ./bench_scroll_event_coalescing
+//
+// 验证项:
+//   A. 按帧合并  : 每个 VSync 最多投递一次 scroll, 投递的是该帧内最后收到的偏移; 惯性阶段收到/投递 >= 2
+//   B. 离散事件  : dragBegin/willDragEnd/dragEnd/scrollEnd 全部按序投递, 投递前最后一次 scroll 即最新偏移
+//   C. 边界      : 首次到达底部与离开底部的偏移在收到时立即投递; 结束时最后投递的偏移等于最后收到的偏移
+//   D. 兜底/重置 : VSync 不可用时逐个投递; Reset 丢弃待投递事件, 过期的帧回调被忽略
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libohos_render/expand/components/scroller/KRScrollEventCoalescer.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+constexpr int64_t kFrameUs = 8333;  // 120Hz
+constexpr float kViewHeight = 2000;
+constexpr float kContentHeight = 10000;
+constexpr float kMaxOffset = kContentHeight - kViewHeight;
+
+// ---------------------------------------------------------------------------
+// 0. 轨迹
+// ---------------------------------------------------------------------------
+enum class TraceKind { kScroll, kDragBegin, kWillDragEnd, kDragEnd, kScrollEnd };
+
+struct TraceEvent {
+    int64_t t_us;
+    TraceKind kind;
+    float offset_y;
+};
+
+static std::vector<TraceEvent> BuildTrace() {
+    std::vector<TraceEvent> trace;
+    std::mt19937 rng(20251018);
+    std::uniform_int_distribution<int> jitter(-400, 400);
+    float y = 6000;
+    int64_t t = 1000;
+    trace.push_back({t, TraceKind::kDragBegin, y});
+    // 拖拽 40 帧, 每帧 2 次, 速度逐渐加快
+    for (int frame = 0; frame < 40; ++frame) {
+        for (int i = 0; i < 2; ++i) {
+            y += 3.0f + frame * 0.5f;
+            trace.push_back({t + i * kFrameUs / 2 + jitter(rng), TraceKind::kScroll, y});
+        }
+        t += kFrameUs;
+    }
+    trace.push_back({t, TraceKind::kWillDragEnd, y});
+    trace.push_back({t, TraceKind::kDragEnd, y});
+    // 惯性: 每帧 2~3 次, 速度指数衰减, 到底部后越界 60px 再回弹到底
+    float velocity = 45;  // px / 半帧
+    bool overscrolled = false;
+    for (int frame = 0; frame < 180; ++frame) {
+        int count = 2 + static_cast<int>(rng() % 2);
+        for (int i = 0; i < count; ++i) {
+            if (!overscrolled) {
+                y += velocity / count * 2;
+                if (y > kMaxOffset + 60) {
+                    y = kMaxOffset + 60;
+                    overscrolled = true;
+                }
+            } else {
+                y = std::max(kMaxOffset, y - 2.5f);
+            }
+            trace.push_back({t + 1000 + i * kFrameUs / (count + 1) + jitter(rng) / 4, TraceKind::kScroll, y});
+        }
+        velocity *= 0.97f;
+        t += kFrameUs;
+    }
+    // 离开底部往回拖一小段
+    trace.push_back({t, TraceKind::kDragBegin, y});
+    for (int frame = 0; frame < 20; ++frame) {
+        for (int i = 0; i < 2; ++i) {
+            y -= 4;
+            trace.push_back({t + i * kFrameUs / 2 + 500, TraceKind::kScroll, y});
+        }
+        t += kFrameUs;
+    }
+    trace.push_back({t, TraceKind::kWillDragEnd, y});
+    trace.push_back({t, TraceKind::kDragEnd, y});
+    trace.push_back({t + 1, TraceKind::kScrollEnd, y});
+    return trace;
+}
+
+static KRScrollEventFrame MakeFrame(float offset_y, bool dragging) {
+    KRScrollEventFrame frame;
+    frame.offset_y = offset_y;
+    frame.view_width = 1080;
+    frame.view_height = kViewHeight;
+    frame.content_width = 1080;
+    frame.content_height = kContentHeight;
+    frame.has_content = true;
+    frame.is_dragging = dragging;
+    return frame;
+}
+
+// ---------------------------------------------------------------------------
+// 1. 回放: FakeVSync 在每个帧边界执行已请求的帧回调
+// ---------------------------------------------------------------------------
+struct Delivery {
+    KRScrollEventType type;
+    float offset_y;
+    float latest_received;  // 投递时刻最后收到的 scroll 偏移
+    int64_t t_us;
+};
+
+struct ReplayResult {
+    std::vector<Delivery> deliveries;
+    std::vector<int> scroll_deliveries_per_tick;
+    KRScrollEventCoalescer::Stats stats;
+    double serialize_ms = 0;
+    size_t serialized_bytes = 0;
+};
+
+static size_t SerializeParams(const KRScrollEventFrame &frame, char *buffer, size_t size) {
+    int n = snprintf(buffer, size,
+                     "{\"offsetX\":%g,\"offsetY\":%g,\"viewWidth\":%g,\"viewHeight\":%g,\"contentWidth\":%g,"
+                     "\"contentHeight\":%g,\"isDragging\":%d,\"velocityX\":%g,\"velocityY\":%g}",
+                     frame.offset_x, frame.offset_y, frame.view_width, frame.view_height, frame.content_width,
+                     frame.content_height, frame.is_dragging ? 1 : 0, frame.velocity_x, frame.velocity_y);
+    return n > 0 ? static_cast<size_t>(n) : 0;
+}
+
+static ReplayResult Replay(const std::vector<TraceEvent> &trace, bool coalesce) {
+    ReplayResult result;
+    int64_t now = 0;
+    float last_received = NAN;
+    std::vector<std::function<void()>> requested;
+    char buffer[512];
+    auto deliver = [&](KRScrollEventType type, const KRScrollEventFrame &frame) {
+        auto begin = std::chrono::steady_clock::now();
+        result.serialized_bytes += SerializeParams(frame, buffer, sizeof(buffer));
+        result.serialize_ms +=
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        result.deliveries.push_back({type, frame.offset_y, last_received, now});
+    };
+    auto requester = [&](std::function<void()> on_frame) {
+        if (!coalesce) {
+            return false;
+        }
+        requested.push_back(std::move(on_frame));
+        return true;
+    };
+    KRScrollEventCoalescer coalescer(deliver, requester);
+
+    int64_t next_tick = kFrameUs;
+    bool dragging = false;
+    auto run_ticks_until = [&](int64_t t_us) {
+        while (next_tick <= t_us) {
+            now = next_tick;
+            size_t before = result.deliveries.size();
+            auto callbacks = std::move(requested);
+            requested.clear();
+            for (auto &callback : callbacks) {
+                callback();
+            }
+            int scrolls = 0;
+            for (size_t i = before; i < result.deliveries.size(); ++i) {
+                scrolls += result.deliveries[i].type == KRScrollEventType::kScroll ? 1 : 0;
+            }
+            result.scroll_deliveries_per_tick.push_back(scrolls);
+            next_tick += kFrameUs;
+        }
+    };
+
+    for (const auto &event : trace) {
+        run_ticks_until(event.t_us);
+        now = event.t_us;
+        switch (event.kind) {
+            case TraceKind::kScroll:
+                last_received = event.offset_y;
+                coalescer.OnScroll(MakeFrame(event.offset_y, dragging));
+                break;
+            case TraceKind::kDragBegin:
+                dragging = true;
+                coalescer.OnDiscreteEvent(KRScrollEventType::kDragBegin, MakeFrame(event.offset_y, dragging));
+                break;
+            case TraceKind::kWillDragEnd:
+                dragging = false;
+                coalescer.OnDiscreteEvent(KRScrollEventType::kWillDragEnd, MakeFrame(event.offset_y, dragging));
+                break;
+            case TraceKind::kDragEnd:
+                coalescer.OnDiscreteEvent(KRScrollEventType::kDragEnd, MakeFrame(event.offset_y, dragging));
+                break;
+            case TraceKind::kScrollEnd:
+                coalescer.OnDiscreteEvent(KRScrollEventType::kScrollEnd, MakeFrame(event.offset_y, dragging));
+                break;
+        }
+    }
+    run_ticks_until(trace.back().t_us + 2 * kFrameUs);
+    result.stats = coalescer.GetStats();
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// A/B/C. 回放校验
+// ---------------------------------------------------------------------------
+static void TestReplay(const std::vector<TraceEvent> &trace) {
+    auto eager = Replay(trace, false);
+    auto coalesced = Replay(trace, true);
+
+    printf("\n=== A. 按帧合并 ===\n");
+    size_t scroll_events = 0;
+    for (const auto &event : trace) {
+        scroll_events += event.kind == TraceKind::kScroll ? 1 : 0;
+    }
+    int max_per_tick = 0;
+    for (int scrolls : coalesced.scroll_deliveries_per_tick) {
+        max_per_tick = std::max(max_per_tick, scrolls);
+    }
+    // 每次投递的 scroll 必须是投递时刻最后收到的偏移
+    bool latest_ok = true;
+    for (const auto &delivery : coalesced.deliveries) {
+        if (delivery.type == KRScrollEventType::kScroll) {
+            latest_ok = latest_ok && delivery.offset_y == delivery.latest_received;
+        }
+    }
+    printf("  scroll received=%llu  eager delivered=%llu  coalesced delivered=%llu (edge flush %llu)\n",
+           static_cast<unsigned long long>(coalesced.stats.scroll_received),
+           static_cast<unsigned long long>(eager.stats.scroll_delivered),
+           static_cast<unsigned long long>(coalesced.stats.scroll_delivered),
+           static_cast<unsigned long long>(coalesced.stats.edge_flush_count));
+    printf("  payload: eager %zu bytes / %.3f ms, coalesced %zu bytes / %.3f ms\n", eager.serialized_bytes,
+           eager.serialize_ms, coalesced.serialized_bytes, coalesced.serialize_ms);
+    CHECK("A", coalesced.stats.scroll_received == scroll_events);
+    CHECK("A", eager.stats.scroll_delivered == scroll_events);
+    CHECK("A", max_per_tick <= 1);
+    CHECK("A", latest_ok);
+    CHECK("A", coalesced.stats.scroll_received >= 2 * coalesced.stats.scroll_delivered);
+    CHECK("A", coalesced.serialized_bytes * 2 <= eager.serialized_bytes);
+
+    printf("\n=== B. 离散事件 ===\n");
+    std::vector<KRScrollEventType> expected;
+    for (const auto &event : trace) {
+        switch (event.kind) {
+            case TraceKind::kDragBegin:
+                expected.push_back(KRScrollEventType::kDragBegin);
+                break;
+            case TraceKind::kWillDragEnd:
+                expected.push_back(KRScrollEventType::kWillDragEnd);
+                break;
+            case TraceKind::kDragEnd:
+                expected.push_back(KRScrollEventType::kDragEnd);
+                break;
+            case TraceKind::kScrollEnd:
+                expected.push_back(KRScrollEventType::kScrollEnd);
+                break;
+            default:
+                break;
+        }
+    }
+    std::vector<KRScrollEventType> discrete;
+    bool fresh_before_discrete = true;
+    float last_scroll = NAN;
+    for (const auto &delivery : coalesced.deliveries) {
+        if (delivery.type == KRScrollEventType::kScroll) {
+            last_scroll = delivery.offset_y;
+        } else {
+            discrete.push_back(delivery.type);
+            if (!std::isnan(delivery.latest_received)) {
+                fresh_before_discrete = fresh_before_discrete && last_scroll == delivery.latest_received;
+            }
+        }
+    }
+    printf("  discrete expected=%zu delivered=%zu\n", expected.size(), discrete.size());
+    CHECK("B", discrete == expected);
+    CHECK("B", coalesced.stats.discrete_delivered == expected.size());
+    CHECK("B", fresh_before_discrete);
+
+    printf("\n=== C. 边界 ===\n");
+    float last_trace_scroll = NAN;
+    int64_t first_bottom_t = -1;
+    int64_t leave_bottom_t = -1;
+    for (const auto &event : trace) {
+        if (event.kind != TraceKind::kScroll) {
+            continue;
+        }
+        if (first_bottom_t < 0 && event.offset_y >= kMaxOffset) {
+            first_bottom_t = event.t_us;
+        }
+        if (first_bottom_t >= 0 && leave_bottom_t < 0 && event.offset_y < kMaxOffset) {
+            leave_bottom_t = event.t_us;
+        }
+        last_trace_scroll = event.offset_y;
+    }
+    bool bottom_immediate = false;
+    bool leave_immediate = false;
+    float last_delivered = NAN;
+    for (const auto &delivery : coalesced.deliveries) {
+        if (delivery.type != KRScrollEventType::kScroll) {
+            continue;
+        }
+        bottom_immediate = bottom_immediate || (delivery.t_us == first_bottom_t && delivery.offset_y >= kMaxOffset);
+        leave_immediate = leave_immediate || (delivery.t_us == leave_bottom_t && delivery.offset_y < kMaxOffset);
+        last_delivered = delivery.offset_y;
+    }
+    printf("  first bottom at %lldus, leave bottom at %lldus\n", static_cast<long long>(first_bottom_t),
+           static_cast<long long>(leave_bottom_t));
+    CHECK("C", first_bottom_t > 0 && leave_bottom_t > first_bottom_t);
+    CHECK("C", bottom_immediate);
+    CHECK("C", leave_immediate);
+    CHECK("C", last_delivered == last_trace_scroll);
+    CHECK("C", KRScrollEventCoalescer::EdgeMask(MakeFrame(0, false)) == (1u | 1u << 1 | 1u << 2));
+    CHECK("C", KRScrollEventCoalescer::EdgeMask(MakeFrame(kMaxOffset, false)) == (1u | 1u << 1 | 1u << 3));
+}
+
+// ---------------------------------------------------------------------------
+// D. 兜底与重置
+// ---------------------------------------------------------------------------
+static void TestFallbackAndReset() {
+    printf("\n=== D. 兜底与重置 ===\n");
+    std::vector<float> delivered;
+    std::vector<std::function<void()>> requested;
+    bool vsync_available = true;
+    KRScrollEventCoalescer coalescer(
+        [&](KRScrollEventType, const KRScrollEventFrame &frame) { delivered.push_back(frame.offset_y); },
+        [&](std::function<void()> on_frame) {
+            if (!vsync_available) {
+                return false;
+            }
+            requested.push_back(std::move(on_frame));
+            return true;
+        });
+
+    coalescer.OnScroll(MakeFrame(100, true));  // 首个事件 (边界状态未知) 立即投递
+    coalescer.OnScroll(MakeFrame(110, true));
+    coalescer.OnScroll(MakeFrame(120, true));
+    CHECK("D", delivered.size() == 1 && delivered[0] == 100);
+    CHECK("D", requested.size() == 1 && coalescer.HasPending());
+
+    // Reset 丢弃待投递事件, 之前请求的帧回调到达时不投递
+    coalescer.Reset();
+    requested[0]();
+    requested.clear();
+    CHECK("D", delivered.size() == 1 && !coalescer.HasPending());
+
+    // Reset 之后重新请求帧
+    coalescer.OnScroll(MakeFrame(130, true));
+    coalescer.OnScroll(MakeFrame(140, true));
+    CHECK("D", delivered.size() == 2 && delivered[1] == 130);
+    CHECK("D", requested.size() == 1);
+    requested[0]();
+    requested.clear();
+    CHECK("D", delivered.size() == 3 && delivered[2] == 140);
+
+    // VSync 不可用时逐个投递
+    vsync_available = false;
+    for (int i = 0; i < 5; ++i) {
+        coalescer.OnScroll(MakeFrame(200 + i, true));
+    }
+    CHECK("D", delivered.size() == 8 && delivered.back() == 204);
+    CHECK("D", coalescer.GetStats().scroll_received == 10);
+    CHECK("D", coalescer.GetStats().scroll_delivered == 8);
+}
+
+int main() {
+    auto trace = BuildTrace();
+    printf("trace: %zu events over %.1f ms\n", trace.size(), trace.back().t_us / 1000.0);
+    TestReplay(trace);
+    TestFallbackAndReset();
+
+    if (g_fail == 0) {
+        printf("\n>>> ALL PASS <<<\n");
+        return 0;
+    }
+    printf("\n>>> %d FAILED <<<\n", g_fail);
+    exit(1);
+}
@@ -0,0 +1,390 @@
+// 测试+基准: bench_speculative_layout
+//
+// 目标:
+//   验证 KRSpeculativeTask (KRRichTextShadow 预测性文本布局的认领/等待协议) 的正确性,
+//   并对比 N 个文本 shadow 的页面首屏布局耗时:
+//   1) 旧实现: context 线程按 calculateRenderViewSize 的调用顺序逐个同步测量;
+//   2) 新实现: 布局开始时 (第一次 calculateRenderViewSize) 把其余属性已更新的 shadow 以相同约束提交到布局线程池,
+//      之后的 calculateRenderViewSize 只需 Join: 已完成直接取结果, 执行中则等待, 尚未开始则取消并同步测量,
+//      约束与预测不一致时同步重新测量。
+//
+// 说明:
+//   KRSpeculativeTask.h 只依赖标准库, 这里直接包含生产实现; ffrt 并发队列用固定个数的 std::thread 工作线程模拟。
+//   真实线程部分用于验证正确性 (耗时受运行机器核数影响, 仅打印);
+//   耗时对比使用确定性的离散事件模拟: 4 个布局线程 + 1 个 context 线程, 每个 shadow 的测量耗时由文本长度决定,
+//   同样的参数每次运行得到相同的结果。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_speculative_layout.cpp -o bench_speculative_layout
+//   运行:
+//   ./bench_speculative_layout            # 默认模拟 4 个布局线程
+//   ./bench_speculative_layout 8
+//
+// 验证项:
+//   A. 预测性布局的结果与逐个同步测量完全一致 (含约束不一致需重新测量的节点)
+//   B. 尚未开始的任务被立即取消, 不等待排队; 被取消的任务之后不会再执行
+//   C. 执行中的任务 Join 时等待其结束, 结果对所有者可见; 属性更新会先 Join 再使预测结果失效
+//   D. 确定性模拟中 N = 100 / 300 / 1000 的页面布局耗时均明显低于串行测量
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRSpeculativeTask.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+// 模拟 ffrt 并发队列
+class FakeConcurrentQueue {
+ public:
+    explicit FakeConcurrentQueue(int workers) {
+        for (int i = 0; i < workers; ++i) {
+            threads_.emplace_back([this] { Loop(); });
+        }
+    }
+    ~FakeConcurrentQueue() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_all();
+        for (auto &thread : threads_) {
+            thread.join();
+        }
+    }
+    void Async(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        condition_.notify_one();
+    }
+
+ private:
+    void Loop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::function<void()>> tasks_;
+    bool stop_ = false;
+    std::vector<std::thread> threads_;
+};
+
+static uint64_t MeasureText(const std::string &text, double width) {
+    uint64_t hash = 1469598103934665603ULL ^ static_cast<uint64_t>(width);
+    for (unsigned char c : text) {
+        for (int i = 0; i < 300; ++i) {  // 模拟 shaping + Layout
+            hash = (hash ^ (c + i)) * 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+// 与 KRRichTextShadow 相同的协议: context 线程访问测量状态前 Join
+class FakeTextShadow : public std::enable_shared_from_this<FakeTextShadow> {
+ public:
+    void SetProp(const std::string &text) {
+        JoinSpeculativeLayout();
+        speculative_valid_ = false;
+        text_ = text;
+    }
+    void StartSpeculativeLayout(FakeConcurrentQueue &queue, double width) {
+        JoinSpeculativeLayout();
+        if (has_last_width_) {
+            width = last_width_;
+        }
+        speculative_valid_ = false;
+        speculative_width_ = width;
+        std::weak_ptr<FakeTextShadow> weak_self = shared_from_this();
+        auto task = std::make_shared<KRSpeculativeTask>([weak_self, width] {
+            if (auto self = weak_self.lock()) {
+                self->speculative_result_ = self->Measure(width);
+                self->speculative_valid_ = true;
+            }
+        });
+        speculative_ = task;
+        queue.Async([task] { task->Run(); });
+    }
+    uint64_t CalculateRenderViewSize(double width) {
+        JoinSpeculativeLayout();
+        if (speculative_valid_) {
+            speculative_valid_ = false;
+            if (width == speculative_width_) {
+                speculative_hits_++;
+                return speculative_result_;
+            }
+        }
+        return Measure(width);
+    }
+    int speculative_hits_ = 0;
+
+ private:
+    uint64_t Measure(double width) {
+        has_last_width_ = true;
+        last_width_ = width;
+        return MeasureText(text_, width);
+    }
+    void JoinSpeculativeLayout() {
+        if (speculative_ == nullptr) {
+            return;
+        }
+        auto task = std::move(speculative_);
+        task->CancelOrWait();
+    }
+
+    std::string text_;
+    std::shared_ptr<KRSpeculativeTask> speculative_;
+    bool speculative_valid_ = false;
+    double speculative_width_ = 0;
+    uint64_t speculative_result_ = 0;
+    bool has_last_width_ = false;
+    double last_width_ = 0;
+};
+
+static std::string MakeText(int index) {
+    std::string text = "shadow" + std::to_string(index) + " ";
+    uint32_t seed = static_cast<uint32_t>(index) * 2654435761U;
+    int length = 8 + static_cast<int>(seed % 120);
+    for (int i = 0; i < length; ++i) {
+        text.push_back(static_cast<char>('a' + (seed >> (i % 24)) % 26));
+    }
+    return text;
+}
+
+// 每 10 个 shadow 有 1 个的实际约束与预测不同 (如固定宽度的按钮文本)
+static double ConstraintOf(int index) {
+    return index % 10 == 9 ? 120 : 343;
+}
+
+static void TestPageCorrectness(int workers, int count) {
+    std::vector<uint64_t> expected(count);
+    for (int i = 0; i < count; ++i) {
+        expected[i] = MeasureText(MakeText(i), ConstraintOf(i));
+    }
+    FakeConcurrentQueue queue(workers);
+    std::vector<std::shared_ptr<FakeTextShadow>> shadows;
+    for (int i = 0; i < count; ++i) {
+        shadows.push_back(std::make_shared<FakeTextShadow>());
+        shadows.back()->SetProp(MakeText(i));
+    }
+    auto start = std::chrono::steady_clock::now();
+    // 布局开始: 以第一个节点的约束为预测值提交其余节点 (与 KRRenderLayerHandler::StartSpeculativeLayoutIfNeed 一致)
+    for (int i = 1; i < count; ++i) {
+        shadows[i]->StartSpeculativeLayout(queue, ConstraintOf(0));
+    }
+    bool same = true;
+    for (int i = 0; i < count; ++i) {
+        same = same && shadows[i]->CalculateRenderViewSize(ConstraintOf(i)) == expected[i];
+    }
+    auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    int hits = 0;
+    for (auto &shadow : shadows) {
+        hits += shadow->speculative_hits_;
+    }
+    CHECK("A", same);
+    // 第二轮: 属性更新后以上次的约束预测, 约束一致的节点全部可复用
+    for (int i = 0; i < count; i += 2) {
+        shadows[i]->SetProp(MakeText(i + count));
+        expected[i] = MeasureText(MakeText(i + count), ConstraintOf(i));
+    }
+    for (int i = 1; i < count; ++i) {
+        shadows[i]->StartSpeculativeLayout(queue, ConstraintOf(0));
+    }
+    same = true;
+    for (int i = 0; i < count; ++i) {
+        same = same && shadows[i]->CalculateRenderViewSize(ConstraintOf(i)) == expected[i];
+    }
+    CHECK("A", same);
+    printf("real threads: workers=%d shadows=%d first pass %.1f ms, speculative hits %d (hardware_concurrency=%u)\n",
+           workers, count, ms, hits, std::thread::hardware_concurrency());
+}
+
+static void TestCancelAndWait() {
+    // 尚未开始: 立即取消, 之后 Run 不执行
+    int runs = 0;
+    KRSpeculativeTask pending([&runs] { runs++; });
+    auto start = std::chrono::steady_clock::now();
+    CHECK("B", !pending.CancelOrWait());
+    CHECK("B", std::chrono::steady_clock::now() - start < std::chrono::milliseconds(5));
+    pending.Run();
+    CHECK("B", runs == 0 && !pending.CancelOrWait());
+
+    // 执行中: 等待结束, 写入的数据可见
+    std::atomic<bool> started{false};
+    int result = 0;
+    KRSpeculativeTask running([&] {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        result = 42;
+    });
+    std::thread worker([&running] { running.Run(); });
+    while (!started.load()) {
+        std::this_thread::yield();
+    }
+    CHECK("C", running.CancelOrWait() && result == 42);
+    worker.join();
+    // 已完成: 立即返回
+    CHECK("C", running.CancelOrWait());
+
+    // 属性更新: Join 执行中的预测后使其失效, 之后按新属性测量
+    FakeConcurrentQueue queue(1);
+    auto shadow = std::make_shared<FakeTextShadow>();
+    shadow->SetProp(MakeText(1));
+    shadow->StartSpeculativeLayout(queue, 343);
+    shadow->SetProp(MakeText(2));
+    CHECK("C", shadow->CalculateRenderViewSize(343) == MeasureText(MakeText(2), 343) && shadow->speculative_hits_ == 0);
+
+    // shadow 被移除后尚未执行的预测任务放弃执行
+    std::weak_ptr<FakeTextShadow> weak;
+    {
+        FakeConcurrentQueue blocked(1);
+        std::mutex gate;
+        gate.lock();
+        blocked.Async([&gate] { std::lock_guard<std::mutex> lock(gate); });
+        auto removed = std::make_shared<FakeTextShadow>();
+        removed->SetProp(MakeText(3));
+        removed->StartSpeculativeLayout(blocked, 343);
+        weak = removed;
+        removed.reset();
+        gate.unlock();
+    }
+    CHECK("B", weak.expired());
+}
+
+// ---------------- 确定性离散事件模拟 ----------------
+
+struct SimResult {
+    double serial_ms = 0;
+    double speculative_ms = 0;
+    int joined_done = 0;     // Join 时已完成
+    int joined_running = 0;  // Join 时执行中, 等待
+    int cancelled = 0;       // Join 时尚未开始, 取消并同步测量
+    int mismatched = 0;      // 约束与预测不一致, 重新测量
+};
+
+static SimResult Simulate(int workers, int count) {
+    const double kSubmitUs = 2;  // context 线程提交一个任务的开销
+    const double kJoinUs = 1;
+    std::vector<double> cost(count);
+    for (int i = 0; i < count; ++i) {
+        cost[i] = 20 + static_cast<double>(MakeText(i).size()) * 2.5;  // 与文本长度成正比, 约 45 ~ 365us
+    }
+    SimResult result;
+    for (auto c : cost) {
+        result.serial_ms += c;
+    }
+    result.serial_ms /= 1000;
+
+    // 第一个节点触发批量提交后同步测量
+    double now = 0;
+    std::vector<double> submit(count, 0), start(count, -1), finish(count, 0);
+    std::vector<bool> cancelled(count, false);
+    for (int i = 1; i < count; ++i) {
+        now += kSubmitUs;
+        submit[i] = now;
+    }
+    now += cost[0];
+    std::vector<double> worker_free(workers, 0);
+    int next = 1;  // 布局线程按提交顺序取任务
+    auto advance_workers_to = [&](double time) {
+        while (next < count) {
+            if (cancelled[next]) {
+                next++;
+                continue;
+            }
+            auto worker = std::min_element(worker_free.begin(), worker_free.end());
+            double begin = std::max(*worker, submit[next]);
+            if (begin > time) {
+                return;
+            }
+            start[next] = begin;
+            finish[next] = begin + cost[next];
+            *worker = finish[next];
+            next++;
+        }
+    };
+    for (int i = 1; i < count; ++i) {
+        advance_workers_to(now);
+        bool mismatch = ConstraintOf(i) != ConstraintOf(0);
+        if (start[i] >= 0) {
+            if (finish[i] <= now) {
+                result.joined_done++;
+            } else {
+                result.joined_running++;
+                now = finish[i];
+            }
+            now += kJoinUs;
+            if (mismatch) {
+                result.mismatched++;
+                now += cost[i];
+            }
+        } else {
+            cancelled[i] = true;
+            result.cancelled++;
+            now += kJoinUs + cost[i];
+        }
+    }
+    result.speculative_ms = now / 1000;
+    return result;
+}
+
+int main(int argc, char **argv) {
+    int workers = argc > 1 ? atoi(argv[1]) : 4;
+
+    TestCancelAndWait();
+    TestPageCorrectness(workers, 300);
+
+    printf("deterministic simulation: %d layout workers + context thread, 10%% constraint mismatch\n", workers);
+    printf("%8s %12s %12s %8s %8s %8s %8s %8s\n", "shadows", "serial ms", "spec ms", "speedup", "done", "waited",
+           "cancel", "remeas");
+    for (int count : {100, 300, 1000}) {
+        auto sim = Simulate(workers, count);
+        auto again = Simulate(workers, count);
+        CHECK("D", sim.speculative_ms == again.speculative_ms);
+        CHECK("D", sim.speculative_ms * 2 < sim.serial_ms);
+        printf("%8d %12.2f %12.2f %7.2fx %8d %8d %8d %8d\n", count, sim.serial_ms, sim.speculative_ms,
+               sim.serial_ms / sim.speculative_ms, sim.joined_done, sim.joined_running, sim.cancelled,
+               sim.mismatched);
+    }
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
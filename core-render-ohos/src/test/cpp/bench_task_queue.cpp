@@ -0,0 +1,318 @@
+// 测试+基准: bench_task_queue
+//
+// 目标:
+//   验证 KRTask (小对象优化、只可移动的任务闭包) 与 KRMpscQueue / KRBlockingMpscQueue (无锁 MPSC 队列),
+//   并对比 KRThread 任务队列改造前后在 4 生产者 / 1 消费者下的吞吐:
+//   1) 旧实现: std::mutex + std::queue<std::function<void()>>, 每次入队加锁并 notify, 消费者整批 swap;
+//   2) 新实现: KRTaskQueue (KRBlockingMpscQueue<KRTask>), 入队无锁, 仅消费者挂起时加锁唤醒。
+//
+// 说明:
+//   KRTask.h / KRMpscQueue.h / KRBlockingMpscQueue.h / KRTimerQueue.h 只依赖标准库, 这里直接包含生产实现;
+//   KRThread.h 依赖 hilog 日志, 队列部分与其 Worker 一致, 这里只对比队列本身。
+//   任务闭包捕获 this + 计数器指针 + 一个 shared_ptr (与 KRRenderCore 中常见的 [weakSelf, ...] 闭包大小相当),
+//   超出 libstdc++/libc++ std::function 的内联缓冲, 旧实现每个任务都要分配一次堆内存。
+//   吞吐结论取决于核数, 不能一概而论:
+//   - 单核沙箱上新实现约快 10%~30%;
+//   - 多核设备上曾测得新实现更慢 (267ms vs 215ms)。旧实现的消费者一次加锁 swap 走整批任务,
+//     新实现逐个出队, 节点由生产者分配、消费者释放 (跨线程 free), 且与生产者争用队头缓存行。
+//   新实现稳定的收益是每个任务的堆分配次数减半, 以及生产者入队不再加锁;
+//   改动 KRThread 队列前请在目标设备上实测。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_task_queue.cpp -o bench_task_queue
+//   运行:
+//   ./bench_task_queue              # 默认 4 个生产者, 共 1000000 个任务
+//   ./bench_task_queue 8 4000000    # 生产者数, 任务总数
+//
+// 验证项:
+//   A. KRTask 小闭包内联存放, 大闭包堆分配, 移动后源对象为空, 空 std::function 构造出空任务
+//   B. MPSC 队列中每个任务恰好出队一次, 同一生产者的任务保持提交顺序
+//   C. KRTimerQueue 按到期时间执行, 到期时间相同时按提交顺序执行
+//   D. 两种实现执行的任务数与结果一致; 同时统计每个任务的堆分配次数
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRBlockingMpscQueue.h"
+#include "libohos_render/foundation/thread/KRMpscQueue.h"
+#include "libohos_render/foundation/thread/KRTask.h"
+#include "libohos_render/foundation/thread/KRTimerQueue.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+// 统计堆分配次数
+static std::atomic<uint64_t> g_allocations{0};
+void *operator new(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept {
+    free(p);
+}
+void operator delete(void *p, size_t) noexcept {
+    free(p);
+}
+
+// ---------------------------------------------------------------------------
+// 正确性
+// ---------------------------------------------------------------------------
+static void TestTask() {
+    int counter = 0;
+    auto shared = std::make_shared<int>(1);
+    KRTask small([&counter, shared] { counter += *shared; });
+    CHECK("A", small.IsInline());
+    small();
+    CHECK("A", counter == 1);
+
+    KRTask moved(std::move(small));
+    CHECK("A", !small && moved && moved.IsInline());
+    moved();
+    CHECK("A", counter == 2);
+    moved.Reset();
+    CHECK("A", shared.use_count() == 1);
+
+    // 超过内联缓冲的闭包放到堆上
+    char big[128] = {3};
+    KRTask large([big, &counter] { counter += big[0]; });
+    CHECK("A", large && !large.IsInline());
+    large();
+    CHECK("A", counter == 5);
+
+    // std::function 可隐式转换; 空的 std::function 构造出空任务
+    std::function<void()> function = [&counter] { counter++; };
+    KRTask from_function(function);
+    from_function();
+    CHECK("A", counter == 6 && from_function.IsInline());
+    CHECK("A", !KRTask(std::function<void()>()));
+
+    // 只可移动的闭包
+    auto unique = std::make_unique<int>(7);
+    KRTask move_only([p = std::move(unique), &counter] { counter += *p; });
+    move_only();
+    CHECK("A", counter == 13);
+}
+
+static void TestMpscOrdering() {
+    const int kProducers = 4;
+    const int kPerProducer = 200000;
+    KRTaskQueue queue;
+    std::vector<int> last(kProducers, -1);
+    bool ordered = true;
+    int consumed = 0;
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < kPerProducer; ++i) {
+                queue.Push([&, p, i] {
+                    ordered = ordered && last[p] == i - 1;
+                    last[p] = i;
+                    consumed++;
+                });
+            }
+        });
+    }
+    KRTask task;
+    while (consumed < kProducers * kPerProducer) {
+        if (!queue.Pop(task)) {
+            queue.Wait();
+            continue;
+        }
+        task();
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    CHECK("B", ordered);
+    CHECK("B", consumed == kProducers * kPerProducer);
+    CHECK("B", queue.Empty() && !queue.Pop(task));
+
+    // 未出队的元素随队列析构释放
+    auto shared = std::make_shared<int>(0);
+    {
+        KRMpscQueue<KRTask> pending;
+        for (int i = 0; i < 10; ++i) {
+            pending.Push([shared] {});
+        }
+    }
+    CHECK("B", shared.use_count() == 1);
+}
+
+static void TestTimerQueue() {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<int> order;
+    {
+        KRTimerQueue timer_queue("bench_timer");
+        auto record = [&](int value) {
+            return [&, value] {
+                std::lock_guard<std::mutex> lock(mutex);
+                order.push_back(value);
+                condition.notify_all();
+            };
+        };
+        timer_queue.Schedule(record(3), 30);
+        timer_queue.Schedule(record(2), 10);
+        for (int i = 0; i < 5; ++i) {
+            timer_queue.Schedule(record(i == 0 ? 0 : 10 + i), 0);
+        }
+        timer_queue.Schedule(record(1), 1);
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait_for(lock, std::chrono::seconds(5), [&] { return order.size() == 8; });
+    }
+    CHECK("C", (order == std::vector<int>{0, 11, 12, 13, 14, 1, 2, 3}));
+}
+
+// ---------------------------------------------------------------------------
+// 基准
+// ---------------------------------------------------------------------------
+// 旧实现: 与改造前 KRThread 的 m_tasks / m_mutex / m_condition 一致
+class LegacyQueue {
+ public:
+    void Push(const std::function<void()> task) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            tasks_.emplace(task);
+        }
+        condition_.notify_one();
+    }
+    // 消费者: 整批取出后执行
+    template <typename Done>
+    void Consume(const Done &done) {
+        while (!done()) {
+            std::queue<std::function<void()>> tasks;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                condition_.wait(lock, [this] { return !tasks_.empty(); });
+                std::swap(tasks, tasks_);
+            }
+            while (!tasks.empty()) {
+                tasks.front()();
+                tasks.pop();
+            }
+        }
+    }
+
+ private:
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+};
+
+class NewQueue {
+ public:
+    void Push(KRTask task) {
+        queue_.Push(std::move(task));
+    }
+    template <typename Done>
+    void Consume(const Done &done) {
+        KRTask task;
+        while (!done()) {
+            if (!queue_.Pop(task)) {
+                queue_.Wait();
+                continue;
+            }
+            task();
+            task.Reset();
+        }
+    }
+
+ private:
+    KRTaskQueue queue_;
+};
+
+struct BenchResult {
+    double ms = 0;
+    double allocations_per_task = 0;
+    uint64_t sum = 0;
+    int64_t executed = 0;
+};
+
+template <typename Queue>
+static BenchResult RunBench(int producers, int total) {
+    Queue queue;
+    auto token = std::make_shared<int>(1);
+    uint64_t sum = 0;
+    int64_t executed = 0;
+    int per_producer = total / producers;
+    int64_t expected = static_cast<int64_t>(per_producer) * producers;
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+    auto allocations = g_allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < per_producer; ++i) {
+                uint64_t value = static_cast<uint64_t>(p) * per_producer + i;
+                queue.Push([&sum, &executed, token, value] {
+                    sum += value ^ static_cast<uint64_t>(*token);
+                    executed++;
+                });
+            }
+        });
+    }
+    queue.Consume([&] { return executed >= expected; });
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    BenchResult result;
+    result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    result.allocations_per_task = static_cast<double>(g_allocations.load() - allocations) / expected;
+    result.sum = sum;
+    result.executed = executed;
+    return result;
+}
+
+int main(int argc, char **argv) {
+    int producers = argc > 1 ? atoi(argv[1]) : 4;
+    int total = argc > 2 ? atoi(argv[2]) : 1000000;
+
+    TestTask();
+    TestMpscOrdering();
+    TestTimerQueue();
+
+    // 预热一次, 避免首轮受 malloc 初始化影响
+    RunBench<LegacyQueue>(producers, total / 10);
+    RunBench<NewQueue>(producers, total / 10);
+    auto legacy = RunBench<LegacyQueue>(producers, total);
+    auto mpsc = RunBench<NewQueue>(producers, total);
+    CHECK("D", legacy.executed == mpsc.executed && legacy.sum == mpsc.sum);
+
+    printf("producers=%d consumer=1 tasks=%d hw_concurrency=%u\n", producers, total,
+           std::thread::hardware_concurrency());
+    printf("%-34s %10s %14s %12s\n", "queue", "total ms", "tasks/s", "allocs/task");
+    auto print = [](const char *name, const BenchResult &r) {
+        printf("%-34s %10.1f %14.0f %12.2f\n", name, r.ms, r.executed * 1000.0 / r.ms, r.allocations_per_task);
+    };
+    print("mutex + std::queue<std::function>", legacy);
+    print("KRTaskQueue (MPSC + KRTask)", mpsc);
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
@@ -0,0 +1,301 @@
+// 测试+基准: bench_text_measure_cache
+//
+// 目标:
+//   验证 KRTextMeasureCache (KRRichTextShadow 跨 shadow 文本测量缓存) 的正确性,
+//   并模拟 10k 个 cell 的信息流列表, 对比逐个测量与使用缓存时 context 线程的测量耗时:
+//   1) 旧实现: 每个文本 shadow 每次 CalculateRenderViewSize 都重新构建 typography 并 Layout;
+//   2) 新实现: 以 "内容 + 样式 + 约束" 为 key 查缓存, 命中时直接恢复尺寸与行信息,
+//      typography 只有在缓存为唯一持有者时才被取用, 否则在 SetShadow 前重建。
+//
+// 说明:
+//   KRTextMeasureCache.h 只依赖标准库, 这里直接包含生产实现;
+//   OH_Drawing typography 用 FakeTypography 模拟: 按字符宽度贪心断行, 并对每个字符做一段哈希计算模拟 shaping 开销。
+//   cell 由昵称/时间/按钮文案/正文组成, 昵称、时间与按钮在列表中大量重复, 正文大多唯一, 与真实信息流分布接近。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_text_measure_cache.cpp -o bench_text_measure_cache
+//   运行:
+//   ./bench_text_measure_cache            # 默认 10000 个 cell, 每个 cell 测量 2 轮 (flex 布局常见的二次测量)
+//   ./bench_text_measure_cache 20000 3
+//
+// 验证项:
+//   A. 命中结果与重新测量结果完全一致 (尺寸 / 行数 / 是否超出最大行数)
+//   B. 字体配置版本号变化后整体失效, 不会返回旧字体下的测量结果
+//   C. 字节预算生效: 超出预算时按 LRU 淘汰, 总字节不超过预算
+//   D. typography 同一时刻最多被一个持有者取用 (多线程并发 Get/Put/Visit 下成立), 统计数据自洽
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/expand/components/richtext/KRTextMeasureCache.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+struct FakeTypography {
+    double layout_width = 0;
+    std::atomic<int> owners{0};  // 同时取用者个数, 用于验证独占
+};
+using FakeTypographyHandle = std::shared_ptr<FakeTypography>;
+
+// 与 KRRichTextShadow::MeasureResult 对应的简化版本
+struct FakeMeasureResult {
+    double width = 0;
+    double height = 0;
+    int line_count = 0;
+    bool did_exceed_max_lines = false;
+    FakeTypographyHandle typography;
+};
+
+struct TextStyle {
+    std::string text;
+    float font_size = 15;
+    int max_lines = 0;
+};
+
+static volatile uint64_t g_sink = 0;
+
+// 模拟 OH_Drawing_CreateTypography + TypographyLayout: shaping 开销与字符数成正比
+static FakeMeasureResult Measure(const TextStyle &style, double constraint_width, float font_scale) {
+    FakeMeasureResult result;
+    double line_width = 0;
+    double longest = 0;
+    int lines = 1;
+    uint64_t hash = 1469598103934665603ULL;
+    for (unsigned char c : style.text) {
+        for (int i = 0; i < 200; ++i) {  // shaping
+            hash = (hash ^ (c + i)) * 1099511628211ULL;
+        }
+        double advance = style.font_size * font_scale * (c == ' ' ? 0.3 : (c & 0x80 ? 1.0 : 0.55));
+        if (line_width + advance > constraint_width) {
+            longest = std::max(longest, line_width);
+            lines++;
+            line_width = 0;
+        }
+        line_width += advance;
+    }
+    g_sink = g_sink + hash;
+    longest = std::max(longest, line_width);
+    int shown = style.max_lines > 0 ? std::min(lines, style.max_lines) : lines;
+    result.width = std::ceil(longest);
+    result.height = shown * style.font_size * font_scale * 1.2;
+    result.line_count = shown;
+    result.did_exceed_max_lines = style.max_lines > 0 && lines > style.max_lines;
+    result.typography = std::make_shared<FakeTypography>();
+    result.typography->layout_width = constraint_width;
+    return result;
+}
+
+static std::string MakeKey(const TextStyle &style, double constraint_width, float font_scale) {
+    char buffer[96];
+    std::snprintf(buffer, sizeof(buffer), "%.4f|%.4f|%.1f|%d|", constraint_width, font_scale, style.font_size,
+                  style.max_lines);
+    return std::string(buffer) + std::to_string(style.text.size()) + ":" + style.text;
+}
+
+// 一个 cell 内的文本, 与信息流 item 的组成接近
+static std::vector<std::pair<TextStyle, double>> MakeCell(int index) {
+    static const char *kNames[] = {"kuikly", "tencent_dev", "小明", "design_team", "前端组", "ohos", "render_core",
+                                   "feed_bot"};
+    static const char *kTimes[] = {"刚刚", "1分钟前", "5分钟前", "1小时前", "昨天", "3天前"};
+    static const char *kButtons[] = {"点赞", "评论", "分享", "关注"};
+    std::vector<std::pair<TextStyle, double>> texts;
+    texts.push_back({TextStyle{std::string(kNames[(index * 7) % 40 % 8]) + std::to_string(index % 40), 15, 1}, 200});
+    texts.push_back({TextStyle{kTimes[index % 6], 12, 1}, 100});
+    for (int b = 0; b < 4; ++b) {
+        texts.push_back({TextStyle{kButtons[b], 13, 1}, 80});
+    }
+    std::string body = "这是第" + std::to_string(index) + "条动态 KuiklyUI cross platform text measure benchmark ";
+    if (index % 5 == 0) {
+        body = "置顶公告: 欢迎使用 KuiklyUI";  // 每 5 个 cell 出现一次的重复正文
+    }
+    texts.push_back({TextStyle{body, 15, 3}, 343});
+    return texts;
+}
+
+struct FeedResult {
+    double ms = 0;
+    uint64_t measures = 0;  // 真正执行 Measure 的次数
+    bool consistent = true;
+};
+
+// passes: 每个 cell 的测量轮数; 每轮结束后模拟 SetShadow 取用 typography, cell 滑出后释放
+static FeedResult RunFeed(int cells, int passes, KRTextMeasureCache<FakeMeasureResult> *cache) {
+    FeedResult feed;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<FakeTypographyHandle> on_screen;  // 屏幕上 view 持有的 typography
+    const size_t kScreenTexts = 8 * 7;            // 一屏约 8 个 cell
+    for (int c = 0; c < cells; ++c) {
+        for (auto &[style, width] : MakeCell(c)) {
+            FakeMeasureResult measured;
+            std::string key;
+            for (int pass = 0; pass < passes; ++pass) {
+                if (cache == nullptr) {
+                    measured = Measure(style, width, 1.0f);
+                    feed.measures++;
+                    continue;
+                }
+                key = MakeKey(style, width, 1.0f);
+                if (auto hit = cache->Get(key, 0)) {
+                    measured = *hit;
+                    measured.typography = nullptr;
+                    continue;
+                }
+                measured = Measure(style, width, 1.0f);
+                feed.measures++;
+                cache->Put(key, std::make_shared<FakeMeasureResult>(measured), 256 + key.size() * 33, 0);
+            }
+            if (cache != nullptr && measured.typography == nullptr) {
+                // 与 EnsureContextTypography 相同: 缓存为唯一持有者时取用, 否则重建
+                cache->Visit(key, [&measured](FakeMeasureResult &result) {
+                    if (result.typography && result.typography.use_count() == 1) {
+                        measured.typography = result.typography;
+                    }
+                });
+                if (measured.typography == nullptr) {
+                    measured.typography = Measure(style, width, 1.0f).typography;
+                    feed.measures++;
+                }
+            }
+            if (c % 97 == 0) {
+                auto expected = Measure(style, width, 1.0f);
+                feed.consistent = feed.consistent && expected.width == measured.width &&
+                                  expected.height == measured.height &&
+                                  expected.line_count == measured.line_count &&
+                                  expected.did_exceed_max_lines == measured.did_exceed_max_lines;
+            }
+            on_screen.push_back(std::move(measured.typography));
+            if (on_screen.size() > kScreenTexts) {
+                on_screen.erase(on_screen.begin());  // 滑出屏幕, view 释放 typography
+            }
+        }
+    }
+    feed.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return feed;
+}
+
+static void TestGeneration() {
+    KRTextMeasureCache<FakeMeasureResult> cache(1 << 20);
+    TextStyle style{"font generation", 15, 0};
+    auto key = MakeKey(style, 300, 1.0f);
+    cache.Put(key, std::make_shared<FakeMeasureResult>(Measure(style, 300, 1.0f)), 100, 0);
+    CHECK("B", cache.Get(key, 0) != nullptr);
+    // 注册自定义字体后版本号递增: 旧结果不可再命中
+    CHECK("B", cache.Get(key, 1) == nullptr);
+    auto stats = cache.GetStats();
+    CHECK("B", stats.invalidation_count == 1 && stats.entry_count == 0 && stats.bytes == 0);
+    // 旧版本号的写入同样会先触发失效, 不会与新版本混存
+    cache.Put(key, std::make_shared<FakeMeasureResult>(), 100, 1);
+    CHECK("B", cache.Get(key, 1) != nullptr);
+}
+
+static void TestBudget() {
+    KRTextMeasureCache<FakeMeasureResult> cache(1000);
+    for (int i = 0; i < 10; ++i) {
+        cache.Put("key" + std::to_string(i), std::make_shared<FakeMeasureResult>(), 100, 0);
+    }
+    cache.Get("key0", 0);  // key0 变为最近访问
+    cache.Put("key10", std::make_shared<FakeMeasureResult>(), 300, 0);
+    auto stats = cache.GetStats();
+    CHECK("C", stats.bytes <= 1000 && stats.eviction_count == 3);
+    CHECK("C", cache.Get("key0", 0) != nullptr && cache.Get("key1", 0) == nullptr && cache.Get("key4", 0) != nullptr);
+    // 单条超过预算时不写入
+    cache.Put("huge", std::make_shared<FakeMeasureResult>(), 2000, 0);
+    CHECK("C", cache.Get("huge", 0) == nullptr);
+    // 同 key 覆盖不重复计算字节
+    cache.Put("key10", std::make_shared<FakeMeasureResult>(), 100, 0);
+    CHECK("C", cache.GetStats().bytes == 800);
+}
+
+static void TestExclusiveTypography() {
+    KRTextMeasureCache<FakeMeasureResult> cache(64 * 1024);
+    const int kKeys = 16;
+    for (int i = 0; i < kKeys; ++i) {
+        auto result = std::make_shared<FakeMeasureResult>();
+        result->typography = std::make_shared<FakeTypography>();
+        cache.Put("k" + std::to_string(i), result, 100, 0);
+    }
+    std::atomic<bool> shared_detected{false};
+    std::atomic<int> takes{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 20000; ++i) {
+                auto key = "k" + std::to_string((i * 7 + t) % kKeys);
+                if (cache.Get(key, 0) == nullptr) {
+                    continue;
+                }
+                FakeTypographyHandle typography;
+                cache.Visit(key, [&typography](FakeMeasureResult &result) {
+                    if (result.typography && result.typography.use_count() == 1) {
+                        typography = result.typography;
+                    }
+                });
+                if (typography == nullptr) {
+                    continue;
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (typography->owners.fetch_add(1) != 0) {
+                    shared_detected = true;
+                }
+                typography->layout_width = i;  // 模拟主线程重新 Layout
+                takes++;
+                typography->owners.fetch_sub(1);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    CHECK("D", !shared_detected.load());
+    CHECK("D", takes.load() > 0);
+}
+
+int main(int argc, char **argv) {
+    int cells = argc > 1 ? atoi(argv[1]) : 10000;
+    int passes = argc > 2 ? atoi(argv[2]) : 2;
+
+    TestGeneration();
+    TestBudget();
+    TestExclusiveTypography();
+
+    auto legacy = RunFeed(cells, passes, nullptr);
+    KRTextMeasureCache<FakeMeasureResult> cache(4 * 1024 * 1024);
+    auto cached = RunFeed(cells, passes, &cache);
+    auto stats = cache.GetStats();
+    CHECK("A", legacy.consistent && cached.consistent);
+    CHECK("A", cached.measures * 2 < legacy.measures);
+    CHECK("C", stats.bytes <= 4 * 1024 * 1024);
+    CHECK("D", stats.hit_count + stats.miss_count == static_cast<uint64_t>(cells) * 7 * passes);
+
+    printf("cells=%d texts/cell=7 passes=%d\n", cells, passes);
+    printf("%-8s %10s %10s %10s %10s %10s\n", "impl", "total ms", "measures", "hit rate", "entries", "KB");
+    printf("%-8s %10.1f %10llu %10s %10s %10s\n", "legacy", legacy.ms,
+           static_cast<unsigned long long>(legacy.measures), "-", "-", "-");
+    printf("%-8s %10.1f %10llu %9.1f%% %10zu %10zu\n", "cached", cached.ms,
+           static_cast<unsigned long long>(cached.measures), stats.HitRate() * 100, stats.entry_count,
+           stats.bytes / 1024);
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
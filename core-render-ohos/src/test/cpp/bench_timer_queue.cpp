@@ -0,0 +1,491 @@
+// 测试+基准: bench_timer_queue
+//
+// 目标:
+//   验证 KRTimerQueue (全局共享、可取消的延时任务队列) 的正确性,
+//   并对比 setTimeout 改造前后 "大部分定时器在到期前被 clearTimeout" 场景下的线程唤醒次数:
+//   1) 旧实现: 延时线程 priority_queue, 无法取消, 已清除的定时器仍到期并转发到 context 线程后才被丢弃;
+//   2) 新实现: clearTimeout 直接从 KRTimerQueue 中 Cancel, 到期时只转发仍存活的定时器。
+//
+// 说明:
+//   KRTimerQueue.h / KRBlockingMpscQueue.h 只依赖标准库, 这里直接包含生产实现;
+//   context 线程用 KRTaskQueue + 消费线程模拟, Kotlin 侧的 callback 表用带锁的 set 模拟
+//   (旧实现中 clearTimeout 只从该表删除 callback, 到期转发后查不到 callback 即丢弃)。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp bench_timer_queue.cpp -o bench_timer_queue
+//   运行:
+//   ./bench_timer_queue              # 默认 8 个页面, 每页 2000 个定时器, 90% 在到期前清除
+//   ./bench_timer_queue 16 5000 95
+//
+// 验证项:
+//   A. Cancel 后任务不执行且闭包立即释放; 已执行或不存在的 id 返回 false
+//   B. CancelGroup 只取消该分组, 返回时该分组没有正在执行的任务
+//   C. 大量取消后墓碑被压缩, 不随取消次数增长
+//   D. 取消成功的定时器从不执行, 其余定时器恰好执行一次且按到期顺序执行; 新实现只把到期的定时器转发到 context 线程
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRBlockingMpscQueue.h"
+#include "libohos_render/foundation/thread/KRTimerQueue.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+// ---------------------------------------------------------------------------
+// 正确性
+// ---------------------------------------------------------------------------
+static void TestCancel() {
+    KRTimerQueue timer_queue("bench_timer");
+    std::atomic<int> fired{0};
+    auto token = std::make_shared<int>(0);
+    auto id = timer_queue.Schedule([token, &fired] { fired++; }, 20);
+    CHECK("A", id != 0 && token.use_count() == 2);
+    CHECK("A", timer_queue.Cancel(id));
+    CHECK("A", token.use_count() == 1);
+    CHECK("A", !timer_queue.Cancel(id) && !timer_queue.Cancel(12345));
+
+    auto done = std::make_shared<std::atomic<bool>>(false);
+    auto fired_id = timer_queue.Schedule([done] { done->store(true); }, 1);
+    while (!done->load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    CHECK("A", fired.load() == 0 && !timer_queue.Cancel(fired_id));
+    auto stats = timer_queue.GetStats();
+    CHECK("A", stats.scheduled_count == 2 && stats.fired_count == 1 && stats.cancelled_count == 1 &&
+                   stats.pending_count == 0);
+}
+
+static void TestCancelGroup() {
+    KRTimerQueue timer_queue("bench_timer");
+    std::atomic<int> page_a{0};
+    std::atomic<int> page_b{0};
+    for (int i = 0; i < 100; ++i) {
+        timer_queue.Schedule([&page_a] { page_a++; }, 10 + i % 10, "page_a");
+        timer_queue.Schedule([&page_b] { page_b++; }, 10 + i % 10, "page_b");
+    }
+    CHECK("B", timer_queue.CancelGroup("page_a") == 100);
+    CHECK("B", timer_queue.CancelGroup("page_a") == 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    CHECK("B", page_a.load() == 0 && page_b.load() == 100);
+
+    // 分组任务正在执行时 CancelGroup 等待其结束
+    std::atomic<bool> started{false};
+    std::atomic<bool> finished{false};
+    timer_queue.Schedule(
+        [&] {
+            started = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            finished = true;
+        },
+        0, "page_c");
+    while (!started.load()) {
+        std::this_thread::yield();
+    }
+    timer_queue.CancelGroup("page_c");
+    CHECK("B", finished.load());
+
+    // 调度线程内取消自身分组不等待
+    std::atomic<bool> reentrant_done{false};
+    timer_queue.Schedule(
+        [&] {
+            timer_queue.CancelGroup("page_d");
+            reentrant_done = true;
+        },
+        0, "page_d");
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!reentrant_done.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    CHECK("B", reentrant_done.load());
+}
+
+static void TestCompaction() {
+    KRTimerQueue timer_queue("bench_timer");
+    std::vector<KRTimerId> ids;
+    for (int round = 0; round < 10; ++round) {
+        ids.clear();
+        for (int i = 0; i < 10000; ++i) {
+            ids.push_back(timer_queue.Schedule([] {}, 60000));
+        }
+        for (auto id : ids) {
+            timer_queue.Cancel(id);
+        }
+    }
+    auto stats = timer_queue.GetStats();
+    CHECK("C", stats.pending_count == 0 && stats.cancelled_count == 100000);
+    CHECK("C", stats.compaction_count > 0);
+    // 压缩后仍能正常到期
+    std::atomic<bool> fired{false};
+    timer_queue.Schedule([&fired] { fired = true; }, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    CHECK("C", fired.load());
+}
+
+// ---------------------------------------------------------------------------
+// 基准
+// ---------------------------------------------------------------------------
+// 模拟 context 线程: 记录唤醒执行的任务数
+class FakeContextThread {
+ public:
+    FakeContextThread() {
+        thread_ = std::thread([this] {
+            KRTask task;
+            while (!stop_.load()) {
+                if (!queue_.Pop(task)) {
+                    queue_.Wait();
+                    continue;
+                }
+                task();
+                task.Reset();
+                executed_++;
+            }
+        });
+    }
+    ~FakeContextThread() {
+        queue_.Push([this] { stop_ = true; });
+        thread_.join();
+    }
+    void Post(KRTask task) {
+        queue_.Push(std::move(task));
+    }
+    uint64_t Executed() const {
+        return executed_.load();
+    }
+
+ private:
+    KRTaskQueue queue_;
+    std::atomic<bool> stop_{false};
+    std::atomic<uint64_t> executed_{0};
+    std::thread thread_;
+};
+
+// Kotlin 侧 GlobalFunctions 表
+class CallbackTable {
+ public:
+    void Add(const std::string &id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callbacks_.insert(id);
+    }
+    void Remove(const std::string &id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callbacks_.erase(id);
+    }
+    bool Fire(const std::string &id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return callbacks_.erase(id) > 0;
+    }
+
+ private:
+    std::mutex mutex_;
+    std::unordered_set<std::string> callbacks_;
+};
+
+// 旧实现: 与改造前 KRDelayThread 一致, 每个 KRThread 一个延时线程, 任务不可取消
+class LegacyDelayThread {
+ public:
+    LegacyDelayThread() {
+        thread_ = std::thread([this] { Dispatcher(); });
+    }
+    ~LegacyDelayThread() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_one();
+        thread_.join();
+    }
+    void DispatchAsync(KRTask task, int delay_ms) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push(Task{std::chrono::steady_clock::now() + std::chrono::milliseconds(delay_ms), seq_++,
+                             std::make_shared<KRTask>(std::move(task))});
+        }
+        condition_.notify_one();
+    }
+    uint64_t Fired() const {
+        return fired_.load();
+    }
+
+ private:
+    struct Task {
+        std::chrono::steady_clock::time_point time;
+        uint64_t seq;
+        std::shared_ptr<KRTask> func;
+        bool operator<(const Task &other) const {
+            return time != other.time ? time > other.time : seq > other.seq;
+        }
+    };
+    void Dispatcher() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stop_) {
+            if (tasks_.empty()) {
+                condition_.wait(lock);
+                continue;
+            }
+            if (std::chrono::steady_clock::now() < tasks_.top().time) {
+                condition_.wait_until(lock, tasks_.top().time);
+                continue;
+            }
+            auto func = tasks_.top().func;
+            tasks_.pop();
+            fired_++;
+            lock.unlock();
+            (*func)();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::priority_queue<Task> tasks_;
+    uint64_t seq_ = 0;
+    bool stop_ = false;
+    std::atomic<uint64_t> fired_{0};
+    std::thread thread_;
+};
+
+struct BenchResult {
+    double ms = 0;
+    uint64_t timer_wakeups = 0;    // 延时线程执行的定时器数
+    uint64_t context_wakeups = 0;  // 转发到 context 线程的任务数
+    int64_t callbacks = 0;         // 实际触发的 Kotlin callback 数
+};
+
+struct Plan {
+    std::string id;
+    int delay_ms;
+    bool cleared;
+};
+
+static std::vector<std::vector<Plan>> MakePlans(int pages, int per_page, int clear_percent) {
+    std::mt19937 rng(42);
+    std::vector<std::vector<Plan>> plans(pages);
+    for (int p = 0; p < pages; ++p) {
+        for (int i = 0; i < per_page; ++i) {
+            plans[p].push_back(Plan{"p" + std::to_string(p) + "_" + std::to_string(i),
+                                    50 + static_cast<int>(rng() % 50), static_cast<int>(rng() % 100) < clear_percent});
+        }
+    }
+    return plans;
+}
+
+static void WaitIdle(const FakeContextThread &context, uint64_t expected) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (context.Executed() < expected && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+}
+
+static BenchResult RunLegacy(const std::vector<std::vector<Plan>> &plans, uint64_t total) {
+    BenchResult result;
+    std::atomic<int64_t> callbacks{0};
+    CallbackTable table;
+    auto start = std::chrono::steady_clock::now();
+    {
+        FakeContextThread context;
+        LegacyDelayThread delay_thread;
+        std::vector<std::thread> pages;
+        for (auto &page : plans) {
+            pages.emplace_back([&] {
+                for (auto &plan : page) {
+                    table.Add(plan.id);
+                    delay_thread.DispatchAsync(
+                        [&, id = plan.id] {
+                            context.Post([&, id] {
+                                if (table.Fire(id)) {
+                                    callbacks++;
+                                }
+                            });
+                        },
+                        plan.delay_ms);
+                }
+                // clearTimeout: 旧实现只能从 callback 表删除
+                for (auto &plan : page) {
+                    if (plan.cleared) {
+                        table.Remove(plan.id);
+                    }
+                }
+            });
+        }
+        for (auto &thread : pages) {
+            thread.join();
+        }
+        WaitIdle(context, total);
+        result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        result.timer_wakeups = delay_thread.Fired();
+        result.context_wakeups = context.Executed();
+    }
+    result.callbacks = callbacks.load();
+    return result;
+}
+
+// 新实现的到期记录: 按到期顺序记录 (页面, 序号), 以及 Cancel 返回 true 的定时器
+struct TimerQueueTrace {
+    std::mutex mutex;
+    std::vector<std::pair<size_t, size_t>> fired;
+    std::vector<std::vector<char>> cancelled;
+};
+
+static BenchResult RunTimerQueue(const std::vector<std::vector<Plan>> &plans, TimerQueueTrace &trace) {
+    BenchResult result;
+    std::atomic<int64_t> callbacks{0};
+    CallbackTable table;
+    trace.cancelled.assign(plans.size(), {});
+    auto start = std::chrono::steady_clock::now();
+    {
+        FakeContextThread context;
+        KRTimerQueue timer_queue("bench_timer");
+        std::vector<std::thread> pages;
+        for (size_t p = 0; p < plans.size(); ++p) {
+            trace.cancelled[p].assign(plans[p].size(), 0);
+            pages.emplace_back([&, p] {
+                std::string group = "page" + std::to_string(p);
+                std::vector<KRTimerId> ids;
+                for (size_t i = 0; i < plans[p].size(); ++i) {
+                    table.Add(plans[p][i].id);
+                    ids.push_back(timer_queue.Schedule(
+                        [&, p, i, id = plans[p][i].id] {
+                            {
+                                std::lock_guard<std::mutex> lock(trace.mutex);
+                                trace.fired.emplace_back(p, i);
+                            }
+                            context.Post([&, id] {
+                                if (table.Fire(id)) {
+                                    callbacks++;
+                                }
+                            });
+                        },
+                        plans[p][i].delay_ms, group));
+                }
+                // clearTimeout: 同时取消定时器; 调度线程繁忙时可能已到期, 此时 Cancel 返回 false
+                for (size_t i = 0; i < plans[p].size(); ++i) {
+                    if (plans[p][i].cleared) {
+                        table.Remove(plans[p][i].id);
+                        trace.cancelled[p][i] = timer_queue.Cancel(ids[i]) ? 1 : 0;
+                    }
+                }
+            });
+        }
+        for (auto &thread : pages) {
+            thread.join();
+        }
+        uint64_t expected = 0;
+        for (size_t p = 0; p < plans.size(); ++p) {
+            expected += std::count(trace.cancelled[p].begin(), trace.cancelled[p].end(), 0);
+        }
+        WaitIdle(context, expected);
+        result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        // 等已取消的定时器原定到期时间过去, 确认没有多余的唤醒
+        std::this_thread::sleep_for(std::chrono::milliseconds(110));
+        result.timer_wakeups = timer_queue.GetStats().fired_count;
+        result.context_wakeups = context.Executed();
+    }
+    result.callbacks = callbacks.load();
+    return result;
+}
+
+// 同一页面内先添加且延时不大于后者的定时器 (到期时间不晚于后者) 必须先执行
+static bool FiredInDeadlineOrder(const std::vector<std::vector<Plan>> &plans, const TimerQueueTrace &trace) {
+    std::vector<std::vector<size_t>> fired_by_page(plans.size());
+    for (auto &fire : trace.fired) {
+        fired_by_page[fire.first].push_back(fire.second);
+    }
+    for (size_t p = 0; p < plans.size(); ++p) {
+        const auto &order = fired_by_page[p];
+        for (size_t a = 0; a < order.size(); ++a) {
+            for (size_t b = a + 1; b < order.size(); ++b) {
+                if (order[b] < order[a] && plans[p][order[b]].delay_ms <= plans[p][order[a]].delay_ms) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    int pages = argc > 1 ? atoi(argv[1]) : 8;
+    int per_page = argc > 2 ? atoi(argv[2]) : 2000;
+    int clear_percent = argc > 3 ? atoi(argv[3]) : 90;
+
+    TestCancel();
+    TestCancelGroup();
+    TestCompaction();
+
+    auto plans = MakePlans(pages, per_page, clear_percent);
+    uint64_t total = static_cast<uint64_t>(pages) * per_page;
+    uint64_t alive = 0;
+    for (auto &page : plans) {
+        alive += std::count_if(page.begin(), page.end(), [](const Plan &plan) { return !plan.cleared; });
+    }
+    auto legacy = RunLegacy(plans, total);
+    TimerQueueTrace trace;
+    auto timer = RunTimerQueue(plans, trace);
+    // 不依赖调度时序的不变量: 取消成功的定时器从不执行, 其余每个恰好执行一次且按到期顺序执行
+    std::vector<std::vector<int>> fire_counts(plans.size());
+    for (size_t p = 0; p < plans.size(); ++p) {
+        fire_counts[p].assign(plans[p].size(), 0);
+    }
+    for (auto &fire : trace.fired) {
+        fire_counts[fire.first][fire.second]++;
+    }
+    bool cancelled_never_fired = true;
+    bool others_fired_once = true;
+    for (size_t p = 0; p < plans.size(); ++p) {
+        for (size_t i = 0; i < plans[p].size(); ++i) {
+            if (trace.cancelled[p][i]) {
+                cancelled_never_fired = cancelled_never_fired && fire_counts[p][i] == 0;
+            } else {
+                others_fired_once = others_fired_once && fire_counts[p][i] == 1;
+            }
+        }
+    }
+    uint64_t fired = trace.fired.size();
+    CHECK("D", cancelled_never_fired);
+    CHECK("D", others_fired_once);
+    CHECK("D", FiredInDeadlineOrder(plans, trace));
+    // 只转发到期的定时器, 未清除的定时器 callback 一定触发
+    CHECK("D", timer.timer_wakeups == fired && timer.context_wakeups == fired);
+    CHECK("D", legacy.context_wakeups == total && timer.context_wakeups <= legacy.context_wakeups);
+    CHECK("D", timer.callbacks >= static_cast<int64_t>(alive) && timer.callbacks <= static_cast<int64_t>(fired));
+    CHECK("D", legacy.callbacks >= static_cast<int64_t>(alive) && legacy.callbacks <= static_cast<int64_t>(total));
+
+    printf("pages=%d timers/page=%d cleared=%d%% alive=%llu hw_concurrency=%u\n", pages, per_page, clear_percent,
+           static_cast<unsigned long long>(alive), std::thread::hardware_concurrency());
+    printf("%-14s %10s %16s %18s %12s\n", "impl", "total ms", "timer wakeups", "context wakeups", "callbacks");
+    auto print = [](const char *name, const BenchResult &r) {
+        printf("%-14s %10.1f %16llu %18llu %12lld\n", name, r.ms, static_cast<unsigned long long>(r.timer_wakeups),
+               static_cast<unsigned long long>(r.context_wakeups), static_cast<long long>(r.callbacks));
+    };
+    print("legacy", legacy);
+    print("KRTimerQueue", timer);
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
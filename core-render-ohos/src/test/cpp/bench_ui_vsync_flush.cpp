@@ -0,0 +1,188 @@
+// 测试+基准: bench_ui_vsync_flush
+//
+// 目标:
+//   对比 KRUIScheduler 两种 flush 模式在流式更新 (聊天/行情) 场景下的 flush 次数:
+//   1) Immediate: 首个 UI 任务入队即调度一次 flush (原实现);
+//   2) VSync: 合并到下一帧 VSync 再 flush, VSync 停止 (页面在后台) 时按截止时间兜底。
+//
+// 说明:
+//   KRUIFlushStats.h 只依赖标准库, 这里直接使用生产实现统计 tasks/flush、flushes/frame;
+//   KRUIScheduler 依赖 napi / OH_NativeVSync, 这里用离散时间模拟其调度策略:
+//   任务到达、context 线程 hop (0.3ms)、VSync 节拍 (16.67ms) 都在同一时间轴上推进, 结果可复现。
+//   VSync 模式与 KRUIScheduler::ScheduleFrameAlignedFlush 一致: 每次 flush 请求带 generation,
+//   VSync 与兜底定时两个触发源先到者执行, 后到者发现 generation 已失效直接丢弃。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -I ../../main/cpp bench_ui_vsync_flush.cpp -o bench_vsync_flush
+//   运行:
+//   ./bench_vsync_flush            # 默认模拟 10 秒, 平均每 3ms 到达一批 UI 任务
+//   ./bench_vsync_flush 30 2       # 模拟秒数, 平均到达间隔毫秒
+//
+// 验证项:
+//   A. 两种模式下所有 UI 任务恰好 flush 一次
+//   B. VSync 模式下每帧至多一次 flush (即一次 layout + 一次主线程同步)
+//   C. VSync 停止期间由兜底定时 flush, 单次等待不超过截止时间
+//   D. KRUIFlushStats 分桶统计自洽
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "libohos_render/scheduler/KRUIFlushStats.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+constexpr int64_t kMs = 1000000;
+constexpr int64_t kFrame = KRUIFlushStats::kFrameIntervalNanos;
+constexpr int64_t kHop = kMs * 3 / 10;   // 切到 context 线程的调度延迟
+constexpr int64_t kDeadline = 32 * kMs;  // 与 KRUIScheduler 默认截止时间一致
+
+enum class Mode { kImmediate, kVSync };
+
+struct Event {
+    enum Kind { kTask, kFlush } kind;
+    uint64_t generation;
+    bool deadline;
+};
+
+struct SimResult {
+    KRUIFlushStats stats;
+    uint64_t tasks_arrived = 0;
+    int64_t max_latency = 0;  // 任务入队到 flush 的最长等待
+};
+
+// VSync 在 [pause_begin, pause_end) 内停止 (模拟页面退到后台)
+static SimResult Simulate(Mode mode, int64_t duration, int64_t mean_interval, int64_t pause_begin,
+                          int64_t pause_end) {
+    std::mt19937_64 rng(42);
+    std::exponential_distribution<double> gap(1.0 / static_cast<double>(mean_interval));
+    std::uniform_int_distribution<int> batch(1, 4);
+    std::multimap<int64_t, Event> timeline;
+    for (int64_t t = static_cast<int64_t>(gap(rng)); t < duration; t += static_cast<int64_t>(gap(rng)) + 1) {
+        timeline.emplace(t, Event{Event::kTask, 0, false});
+    }
+
+    SimResult result;
+    std::vector<int64_t> pending;  // 等待 flush 的任务入队时间
+    bool need_flush = false;       // 对应 m_need_sync_main_queue_tasks_block_
+    uint64_t generation = 0;
+    auto flush = [&](int64_t now) {
+        for (auto enqueued : pending) {
+            result.max_latency = std::max(result.max_latency, now - enqueued);
+        }
+        result.stats.RecordFlush(pending.size(), now);
+        pending.clear();
+        need_flush = false;
+    };
+    auto next_vsync = [&](int64_t now) -> int64_t {
+        auto tick = (now / kFrame + 1) * kFrame;
+        return tick >= pause_begin && tick < pause_end ? -1 : tick;
+    };
+
+    while (!timeline.empty()) {
+        auto it = timeline.begin();
+        auto now = it->first;
+        auto event = it->second;
+        timeline.erase(it);
+        if (event.kind == Event::kTask) {
+            int count = batch(rng);
+            result.tasks_arrived += count;
+            for (int i = 0; i < count; ++i) {
+                pending.push_back(now);
+            }
+            if (need_flush) {
+                continue;
+            }
+            need_flush = true;
+            generation++;
+            if (mode == Mode::kImmediate) {
+                timeline.emplace(now + kHop, Event{Event::kFlush, generation, false});
+            } else {
+                auto vsync = next_vsync(now);
+                if (vsync > 0) {
+                    timeline.emplace(vsync + kHop, Event{Event::kFlush, generation, false});
+                }
+                timeline.emplace(now + kDeadline + kHop, Event{Event::kFlush, generation, true});
+            }
+            continue;
+        }
+        if (event.generation != generation || !need_flush) {
+            continue;
+        }
+        if (mode == Mode::kVSync) {
+            if (event.deadline) {
+                result.stats.deadline_flush_count++;
+            } else {
+                result.stats.vsync_flush_count++;
+            }
+        }
+        flush(now);
+    }
+    return result;
+}
+
+int main(int argc, char **argv) {
+    int64_t seconds = argc > 1 ? atoi(argv[1]) : 10;
+    int64_t mean_interval_ms = argc > 2 ? atoi(argv[2]) : 3;
+    int64_t duration = seconds * 1000 * kMs;
+    // 中间 1 秒 VSync 停止
+    int64_t pause_begin = duration / 2;
+    int64_t pause_end = pause_begin + 1000 * kMs;
+
+    auto immediate = Simulate(Mode::kImmediate, duration, mean_interval_ms * kMs, pause_begin, pause_end);
+    auto vsync = Simulate(Mode::kVSync, duration, mean_interval_ms * kMs, pause_begin, pause_end);
+
+    CHECK("A", immediate.stats.task_count == immediate.tasks_arrived);
+    CHECK("A", vsync.stats.task_count == vsync.tasks_arrived);
+    CHECK("B", vsync.stats.max_flushes_per_frame == 1);
+    CHECK("B", immediate.stats.max_flushes_per_frame > 1);
+    CHECK("C", vsync.stats.deadline_flush_count > 0);
+    CHECK("C", vsync.max_latency <= kDeadline + kHop);
+    CHECK("D", vsync.stats.vsync_flush_count + vsync.stats.deadline_flush_count == vsync.stats.flush_count);
+    CHECK("D", vsync.stats.frame_count == vsync.stats.flush_count);
+    CHECK("D", vsync.stats.flush_count < immediate.stats.flush_count);
+
+    // 同一帧内连续 flush 计入同一桶, 跨帧重新计数
+    KRUIFlushStats stats;
+    stats.RecordFlush(3, 0);
+    stats.RecordFlush(5, kFrame - 1);
+    stats.RecordFlush(1, kFrame);
+    CHECK("D", stats.frame_count == 2 && stats.max_flushes_per_frame == 2 && stats.max_tasks_per_flush == 5);
+    CHECK("D", stats.TasksPerFlush() == 3.0 && stats.FlushesPerFrame() == 1.5);
+
+    printf("simulated %llds, mean arrival %lldms, vsync paused for 1s\n", static_cast<long long>(seconds),
+           static_cast<long long>(mean_interval_ms));
+    printf("%-10s %8s %12s %15s %19s %16s\n", "mode", "flushes", "tasks/flush", "flushes/frame", "max flushes/frame",
+           "max latency ms");
+    auto print = [](const char *name, const SimResult &r) {
+        printf("%-10s %8llu %12.2f %15.2f %19llu %16.1f\n", name, static_cast<unsigned long long>(r.stats.flush_count),
+               r.stats.TasksPerFlush(), r.stats.FlushesPerFrame(),
+               static_cast<unsigned long long>(r.stats.max_flushes_per_frame),
+               static_cast<double>(r.max_latency) / kMs);
+    };
+    print("immediate", immediate);
+    print("vsync", vsync);
+    printf("vsync flushes: %llu by vsync, %llu by deadline\n",
+           static_cast<unsigned long long>(vsync.stats.vsync_flush_count),
+           static_cast<unsigned long long>(vsync.stats.deadline_flush_count));
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
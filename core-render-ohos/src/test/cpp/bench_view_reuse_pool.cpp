@@ -0,0 +1,592 @@
+// 基准 + 正确性测试: bench_view_reuse_pool
+//
+// 目标:
+//   验证进程级 view 复用池 KRReusePool (KRViewReusePool 的核心) 的正确性, 并对比跨页面复用带来的冷创建减少:
+//   1) 按类型上限与总数上限 LRU 淘汰, 同类型 LIFO 取用, 被淘汰的对象全部交给 destroyer;
+//   2) 按会话学习各类型的预热数量, 学习表可序列化后在下次启动载入;
+//   3) 页面依次打开 / 销毁的场景下, 全局池 (+ 预热) 的命中率明显高于旧的每页独立复用队列;
+//   4) 从池中取出的其它页面的 view 经 ToAdopt 换绑后, 组件内部自建的子 view 也随之换绑。
+//
+// 说明:
+//   KRReusePool.h 只依赖标准库, 这里直接包含生产实现, 用 FakeView 代替 IKRRenderViewExport。
+//   "页面级队列" 模拟改造前 KRRenderLayerHandler::view_reuse_queue_: 只在本页内复用, 页面销毁时全部销毁。
+//   E 项中 IKRRenderViewExport 依赖 ArkUI, 用 AdoptableView 替身模拟 ToInit / ToAdopt / RebindRootView / DidAdopt
+//   的换绑流程 (根视图、instance id、按页面创建的基础处理器), WrapperView 对应 KRImageViewWrapper。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -I ../../main/cpp bench_view_reuse_pool.cpp -o bench_view_reuse_pool
+//   运行:
+//   ./bench_view_reuse_pool            # 默认依次打开 40 个页面
+//   ./bench_view_reuse_pool 200
+//
+// 验证项:
+//   A. 上限淘汰  : 类型上限淘汰本类型最旧对象, 总数上限淘汰全局最旧对象, 同类型最近放入的先取出, 统计自洽
+//   B. 裁剪      : TrimTo 按 LRU 淘汰到指定数量, Clear 清空, 所有离开池子的对象恰好销毁一次或被取用一次
+//   C. 预热学习  : 只学习放入过池子的类型, 滑动平均与衰减正确, 预热计划受类型上限与剩余容量约束,
+//                  超出计划的预热被拒绝; 学习表序列化往返一致, 格式错误时忽略
+//   D. 跨页复用  : 多页面顺序打开的模拟中, 全局池命中率高于页面级队列, 预热后新进程首个页面也能命中
+//   E. 跨页换绑  : 页面 A 回收的组合 view 被页面 B 取用后, 外层与内部子 view 均绑定到 B, A 的处理器全部释放,
+//                  内部子 view 仍挂在外层下; 没有 DidAdopt 换绑的组件会残留在 A 上 (反例);
+//                  目标页面已销毁时 ToAdopt 失败
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "libohos_render/foundation/KRReusePool.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+struct FakeView {
+    explicit FakeView(int id, std::string type) : id(id), type(std::move(type)) {}
+    int id;
+    std::string type;
+    bool destroyed = false;
+};
+
+using Pool = KRReusePool<FakeView>;
+
+struct Harness {
+    explicit Harness(const Pool::Options &options)
+        : pool(options, [this](const std::shared_ptr<FakeView> &view) {
+              if (view->destroyed) {
+                  double_destroy = true;
+              }
+              view->destroyed = true;
+              destroyed_ids.push_back(view->id);
+          }) {}
+
+    std::shared_ptr<FakeView> Make(const std::string &type) {
+        return std::make_shared<FakeView>(next_id++, type);
+    }
+
+    std::vector<int> destroyed_ids;
+    bool double_destroy = false;
+    int next_id = 1;
+    Pool pool;  // 最后声明: 析构时 destroyer 仍可访问上面的成员
+};
+
+// ---------------------------------------------------------------------------
+// A. 上限淘汰
+// ---------------------------------------------------------------------------
+static void TestCaps() {
+    printf("\n--- A. 上限淘汰 ---\n");
+    Pool::Options options;
+    options.max_total = 5;
+    options.default_max_per_type = 3;
+    options.max_per_type["Disabled"] = 0;
+    Harness h(options);
+
+    auto a1 = h.Make("A"), a2 = h.Make("A"), a3 = h.Make("A"), a4 = h.Make("A");
+    h.pool.Recycle("A", a1);
+    h.pool.Recycle("A", a2);
+    h.pool.Recycle("A", a3);
+    h.pool.Recycle("A", a4);  // 类型上限 3: 淘汰 a1
+    CHECK("A", h.pool.Size("A") == 3);
+    CHECK("A", h.destroyed_ids == std::vector<int>{a1->id});
+
+    auto b1 = h.Make("B"), b2 = h.Make("B"), b3 = h.Make("B");
+    h.pool.Recycle("B", b1);
+    h.pool.Recycle("B", b2);
+    h.pool.Recycle("B", b3);  // 总数上限 5: 淘汰全局最旧 a2
+    CHECK("A", h.pool.Size() == 5);
+    CHECK("A", (h.destroyed_ids == std::vector<int>{a1->id, a2->id}));
+
+    CHECK("A", !h.pool.Recycle("Disabled", h.Make("Disabled")));
+    CHECK("A", h.destroyed_ids.size() == 3);
+
+    CHECK("A", h.pool.Acquire("B") == b3);  // LIFO
+    CHECK("A", h.pool.Acquire("A") == a4);
+    CHECK("A", h.pool.Acquire("C") == nullptr);
+    h.pool.Recycle("C", h.Make("C"));
+    h.pool.Recycle("C", h.Make("C"));
+    h.pool.Recycle("C", h.Make("C"));  // 总数 5: 淘汰 a3 (此时全局最旧)
+    CHECK("A", a3->destroyed);
+    CHECK("A", !b1->destroyed && !b2->destroyed);
+
+    auto stats = h.pool.GetStats();
+    CHECK("A", stats.hit_count == 2);
+    CHECK("A", stats.miss_count == 1);
+    CHECK("A", stats.recycle_count == 10);
+    CHECK("A", stats.eviction_count == 3);
+    CHECK("A", stats.size == 5);
+    CHECK("A", h.pool.GetStats("A").eviction_count == 3);
+    CHECK("A", !h.double_destroy);
+    printf("report: %s\n", h.pool.FormatReport().c_str());
+}
+
+// ---------------------------------------------------------------------------
+// B. 裁剪
+// ---------------------------------------------------------------------------
+static void TestTrim() {
+    printf("\n--- B. 裁剪 ---\n");
+    Pool::Options options;
+    options.max_total = 1000;
+    options.default_max_per_type = 1000;
+    std::unordered_set<int> acquired;
+    size_t made = 0;
+    {
+        Harness h(options);
+        std::mt19937 rng(7);
+        const char *types[] = {"KRView", "KRImageView", "KRRichTextView", "KRHoverView"};
+        for (int round = 0; round < 20000; ++round) {
+            const std::string type = types[rng() % 4];
+            switch (rng() % 4) {
+                case 0:
+                case 1:
+                    h.pool.Recycle(type, h.Make(type));
+                    made++;
+                    break;
+                case 2:
+                    if (auto view = h.pool.Acquire(type)) {
+                        acquired.insert(view->id);
+                        if (view->destroyed) {
+                            h.double_destroy = true;
+                        }
+                    }
+                    break;
+                default:
+                    if (rng() % 50 == 0) {
+                        h.pool.TrimTo(rng() % 200);
+                    }
+                    break;
+            }
+        }
+        h.pool.TrimTo(10);
+        CHECK("B", h.pool.Size() == 10);
+        size_t before = h.destroyed_ids.size();
+        h.pool.Clear();
+        CHECK("B", h.pool.Size() == 0);
+        CHECK("B", h.destroyed_ids.size() == before + 10);
+
+        // 每个放入的对象要么被取用, 要么被销毁, 不会两者兼有
+        std::unordered_set<int> destroyed(h.destroyed_ids.begin(), h.destroyed_ids.end());
+        bool disjoint = true;
+        for (int id : acquired) {
+            disjoint = disjoint && destroyed.count(id) == 0;
+        }
+        CHECK("B", destroyed.size() == h.destroyed_ids.size());
+        CHECK("B", disjoint);
+        CHECK("B", acquired.size() + destroyed.size() == made);
+        CHECK("B", !h.double_destroy);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// C. 预热学习
+// ---------------------------------------------------------------------------
+static void TestLearning() {
+    printf("\n--- C. 预热学习 ---\n");
+    Pool::Options options;
+    options.max_total = 100;
+    options.default_max_per_type = 40;
+    options.max_per_type["KRView"] = 60;
+    Harness h(options);
+
+    h.pool.Recycle("KRView", h.Make("KRView"));
+    h.pool.Recycle("KRImageView", h.Make("KRImageView"));
+    h.pool.Acquire("KRView");
+    h.pool.Acquire("KRImageView");
+
+    h.pool.LearnSession({{"KRView", 80}, {"KRImageView", 20}, {"KRListView", 5}});
+    CHECK("C", h.pool.LearnedCount("KRView") == 80);
+    CHECK("C", h.pool.LearnedCount("KRImageView") == 20);
+    CHECK("C", h.pool.LearnedCount("KRListView") == 0);  // 从未放入过池子
+
+    h.pool.LearnSession({{"KRView", 40}});
+    CHECK("C", h.pool.LearnedCount("KRView") == 70);       // (80*3 + 40 + 3) / 4
+    CHECK("C", h.pool.LearnedCount("KRImageView") == 15);  // 20 * 3 / 4
+
+    auto plan = h.pool.PrewarmPlan();
+    CHECK("C", plan.size() == 2);
+    CHECK("C", plan.size() == 2 && plan[0].first == "KRView" && plan[0].second == 60);  // 类型上限 60
+    CHECK("C", plan.size() == 2 && plan[1].first == "KRImageView" && plan[1].second == 15);
+
+    for (int i = 0; i < 60; ++i) {
+        h.pool.Prewarm("KRView", h.Make("KRView"));
+    }
+    CHECK("C", !h.pool.Prewarm("KRView", h.Make("KRView")));  // 已满足学习值
+    CHECK("C", h.pool.PrewarmDeficit("KRView") == 0);
+    for (int i = 0; i < 10; ++i) {
+        h.pool.Recycle("KRHoverView", h.Make("KRHoverView"));
+    }
+    plan = h.pool.PrewarmPlan();
+    CHECK("C", plan.size() == 1 && plan[0].second == 15);
+    for (int i = 0; i < 20; ++i) {
+        h.pool.Recycle("KRHoverView", h.Make("KRHoverView"));
+    }
+    plan = h.pool.PrewarmPlan();
+    CHECK("C", plan.size() == 1 && plan[0].second == 100 - 90);  // 剩余容量约束
+
+    CHECK("C", h.pool.Acquire("KRView") != nullptr);
+    CHECK("C", h.pool.GetStats("KRView").prewarm_hit_count == 1);
+    CHECK("C", h.pool.GetStats().prewarm_count == 60);
+
+    auto profile = h.pool.SerializeProfile();
+    Harness next(options);
+    CHECK("C", next.pool.LoadProfile(profile));
+    CHECK("C", next.pool.LearnedCount("KRView") == 70);
+    CHECK("C", next.pool.LearnedCount("KRImageView") == 15);
+    CHECK("C", next.pool.SerializeProfile().size() == profile.size());
+    CHECK("C", !next.pool.LoadProfile("garbage\nKRView 10\n"));
+    CHECK("C", next.pool.LearnedCount("KRView") == 70);
+
+    next.pool.Forget("KRImageView");
+    CHECK("C", next.pool.PrewarmDeficit("KRImageView") == 0);
+    next.pool.LearnSession({{"KRImageView", 30}});
+    CHECK("C", next.pool.LearnedCount("KRImageView") == 0);  // 已标记不可复用
+}
+
+// ---------------------------------------------------------------------------
+// D. 跨页复用
+// ---------------------------------------------------------------------------
+struct PageShape {
+    std::string type;
+    int count;
+};
+
+struct SimResult {
+    uint64_t requests = 0;
+    uint64_t cold_creates = 0;
+    uint64_t first_page_hits = 0;
+    double elapsed_ms = 0;
+};
+
+// 模拟一个页面: 创建全部 view, 期间列表滚动删除并重建一部分, 最后销毁页面
+// page_scoped 为 true 时模拟页面级队列 (页面销毁时清空), 否则为全局池; first_page_hits 只统计首屏创建阶段
+static void RunPage(Pool &pool, const std::vector<PageShape> &shape, std::mt19937 &rng, bool page_scoped,
+                    Harness &h, SimResult *result, bool first_page) {
+    std::vector<std::shared_ptr<FakeView>> live;
+    auto create = [&](const std::string &type, bool initial) {
+        result->requests++;
+        auto view = pool.Acquire(type);
+        if (view == nullptr) {
+            result->cold_creates++;
+            // 冷创建的代价: 模拟创建 ArkUI 节点与属性初始化
+            volatile int sink = 0;
+            for (int i = 0; i < 2000; ++i) {
+                sink = sink + i;
+            }
+            view = h.Make(type);
+        } else if (first_page && initial) {
+            result->first_page_hits++;
+        }
+        live.push_back(view);
+    };
+    for (const auto &entry : shape) {
+        int count = entry.count + static_cast<int>(rng() % (entry.count / 4 + 1));
+        for (int i = 0; i < count; ++i) {
+            create(entry.type, true);
+        }
+    }
+    // 滚动: 删除 30% 再创建同样数量
+    std::shuffle(live.begin(), live.end(), rng);
+    size_t scrolled = live.size() * 3 / 10;
+    for (size_t i = 0; i < scrolled; ++i) {
+        pool.Recycle(live.back()->type, live.back());
+        live.pop_back();
+    }
+    for (size_t i = 0; i < scrolled; ++i) {
+        create(shape[rng() % shape.size()].type, false);
+    }
+    std::unordered_map<std::string, size_t> demand;
+    for (auto &view : live) {
+        demand[view->type]++;
+        pool.Recycle(view->type, view);  // 页面销毁: 可复用节点放回池中
+    }
+    if (page_scoped) {
+        pool.Clear();
+    } else {
+        pool.LearnSession(demand);
+    }
+}
+
+static void Prewarm(Pool &pool, Harness &h) {
+    for (const auto &entry : pool.PrewarmPlan()) {
+        for (size_t i = 0; i < entry.second; ++i) {
+            pool.Prewarm(entry.first, h.Make(entry.first));
+        }
+    }
+}
+
+static SimResult Simulate(int pages, bool page_scoped, const std::string &profile, std::string *profile_out) {
+    Pool::Options options;
+    options.max_total = 256;
+    options.default_max_per_type = 64;
+    options.max_per_type["KRView"] = 128;
+    Harness h(options);
+    if (!profile.empty()) {
+        h.pool.LoadProfile(profile);
+        Prewarm(h.pool, h);  // 新进程启动后空闲预热
+    }
+    std::mt19937 rng(42);
+    std::vector<std::vector<PageShape>> shapes = {
+        {{"KRView", 120}, {"KRRichTextView", 60}, {"KRImageView", 40}},
+        {{"KRView", 90}, {"KRRichTextView", 40}, {"KRImageView", 60}, {"KRHoverView", 4}},
+        {{"KRView", 150}, {"KRRichTextView", 30}, {"KRImageView", 20}},
+    };
+    SimResult result;
+    auto begin = std::chrono::steady_clock::now();
+    for (int page = 0; page < pages; ++page) {
+        RunPage(h.pool, shapes[page % shapes.size()], rng, page_scoped, h, &result, page == 0);
+        if (!page_scoped) {
+            Prewarm(h.pool, h);  // 页面之间的空闲期
+        }
+    }
+    result.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    if (profile_out) {
+        *profile_out = h.pool.SerializeProfile();
+    }
+    printf("%s\n", h.pool.FormatReport().c_str());
+    return result;
+}
+
+static void TestCrossPage(int pages) {
+    printf("\n--- D. 跨页复用 (%d pages) ---\n", pages);
+    auto page_scoped = Simulate(pages, true, "", nullptr);
+    std::string profile;
+    auto global = Simulate(pages, false, "", &profile);
+    auto warm_start = Simulate(pages, false, profile, nullptr);
+
+    auto rate = [](const SimResult &r) { return 100.0 * (r.requests - r.cold_creates) / r.requests; };
+    printf("%-22s %10s %12s %10s %12s\n", "mode", "requests", "cold_create", "hit_rate", "elapsed_ms");
+    printf("%-22s %10llu %12llu %9.1f%% %12.2f\n", "page-scoped queue",
+           static_cast<unsigned long long>(page_scoped.requests),
+           static_cast<unsigned long long>(page_scoped.cold_creates), rate(page_scoped), page_scoped.elapsed_ms);
+    printf("%-22s %10llu %12llu %9.1f%% %12.2f\n", "global pool", static_cast<unsigned long long>(global.requests),
+           static_cast<unsigned long long>(global.cold_creates), rate(global), global.elapsed_ms);
+    printf("%-22s %10llu %12llu %9.1f%% %12.2f\n", "global + profile",
+           static_cast<unsigned long long>(warm_start.requests),
+           static_cast<unsigned long long>(warm_start.cold_creates), rate(warm_start), warm_start.elapsed_ms);
+    printf("first page hits: page-scoped=%llu global=%llu warm-start=%llu\n",
+           static_cast<unsigned long long>(page_scoped.first_page_hits),
+           static_cast<unsigned long long>(global.first_page_hits),
+           static_cast<unsigned long long>(warm_start.first_page_hits));
+
+    CHECK("D", page_scoped.requests == global.requests);
+    CHECK("D", global.cold_creates * 2 < page_scoped.cold_creates);
+    CHECK("D", rate(global) > rate(page_scoped));
+    CHECK("D", warm_start.cold_creates <= global.cold_creates);
+    CHECK("D", global.first_page_hits == 0);
+    CHECK("D", warm_start.first_page_hits > 0);
+}
+
+// ---------------------------------------------------------------------------
+// E. 跨页换绑
+// ---------------------------------------------------------------------------
+struct FakePage {
+    std::string instance_id;
+};
+
+// 对应按页面创建的 KRBasePropsHandler / KRBaseEventHandler: 记录创建时绑定的页面
+struct FakeHandler {
+    explicit FakeHandler(const std::string &instance_id) : instance_id(instance_id) {}
+    std::string instance_id;
+    bool destroyed = false;
+};
+
+class AdoptableView : public std::enable_shared_from_this<AdoptableView> {
+ public:
+    virtual ~AdoptableView() = default;
+
+    void SetRootView(std::weak_ptr<FakePage> root_view, const std::string &instance_id) {
+        root_view_ = std::move(root_view);
+        instance_id_ = instance_id;
+    }
+
+    void ToInit() {
+        auto root = root_view_.lock();
+        if (root == nullptr) {
+            return;
+        }
+        handler_ = CreateHandler(root);
+        DidInit();
+    }
+
+    bool ToAdopt(std::weak_ptr<FakePage> root_view, const std::string &instance_id) {
+        if (!RebindRootView(root_view, instance_id)) {
+            return false;
+        }
+        parent_.reset();
+        DidAdopt();
+        return true;
+    }
+
+    bool RebindRootView(std::weak_ptr<FakePage> root_view, const std::string &instance_id) {
+        auto root = root_view.lock();
+        if (root == nullptr) {
+            return false;
+        }
+        root_view_ = root_view;
+        instance_id_ = instance_id;
+        handler_->destroyed = true;
+        handler_ = CreateHandler(root);
+        return true;
+    }
+
+    void InsertSubView(const std::shared_ptr<AdoptableView> &child) {
+        child->parent_ = shared_from_this();
+    }
+
+    // 自身及内部子 view 是否都绑定到 page，且处理器为该页面创建
+    virtual bool BoundTo(const std::shared_ptr<FakePage> &page) const {
+        return root_view_.lock() == page && instance_id_ == page->instance_id && !handler_->destroyed &&
+               handler_->instance_id == page->instance_id;
+    }
+
+    std::shared_ptr<AdoptableView> Parent() const {
+        return parent_.lock();
+    }
+
+    static std::vector<std::shared_ptr<FakeHandler>> &AllHandlers() {
+        static std::vector<std::shared_ptr<FakeHandler>> handlers;
+        return handlers;
+    }
+
+ protected:
+    virtual void DidInit() {}
+    virtual void DidAdopt() {}
+
+    std::weak_ptr<FakePage> root_view_;
+    std::string instance_id_;
+
+ private:
+    static std::shared_ptr<FakeHandler> CreateHandler(const std::shared_ptr<FakePage> &root) {
+        auto handler = std::make_shared<FakeHandler>(root->instance_id);
+        AllHandlers().push_back(handler);
+        return handler;
+    }
+
+    std::shared_ptr<FakeHandler> handler_;
+    std::weak_ptr<AdoptableView> parent_;
+};
+
+// 对应 KRImageViewWrapper: DidInit 中自建占位图与图片两个子 view，rebind_children 为 false 时不重写 DidAdopt 的换绑
+class WrapperView : public AdoptableView {
+ public:
+    explicit WrapperView(bool rebind_children) : rebind_children_(rebind_children) {}
+
+    bool BoundTo(const std::shared_ptr<FakePage> &page) const override {
+        return AdoptableView::BoundTo(page) && place_holder_->BoundTo(page) && image_->BoundTo(page);
+    }
+
+    bool ChildrenAttached() {
+        return place_holder_->Parent().get() == this && image_->Parent().get() == this;
+    }
+
+ protected:
+    void DidInit() override {
+        place_holder_ = std::make_shared<AdoptableView>();
+        image_ = std::make_shared<AdoptableView>();
+        for (auto &child : {place_holder_, image_}) {
+            child->SetRootView(root_view_, instance_id_);
+            child->ToInit();
+            InsertSubView(child);
+        }
+    }
+
+    void DidAdopt() override {
+        if (rebind_children_) {
+            place_holder_->RebindRootView(root_view_, instance_id_);
+            image_->RebindRootView(root_view_, instance_id_);
+        }
+    }
+
+ private:
+    bool rebind_children_;
+    std::shared_ptr<AdoptableView> place_holder_;
+    std::shared_ptr<AdoptableView> image_;
+};
+
+static void TestAdopt() {
+    printf("\n--- E. 跨页换绑 ---\n");
+    using AdoptPool = KRReusePool<AdoptableView>;
+    AdoptPool pool(AdoptPool::Options(), [](const std::shared_ptr<AdoptableView> &) {});
+    // 与 KRViewReusePool::Acquire 一致: 来自其它页面的 view 经 ToAdopt 换绑，失败时丢弃
+    auto acquire = [&pool](const std::string &type, const std::shared_ptr<FakePage> &page) {
+        auto view = pool.Acquire(type);
+        if (view != nullptr && !view->ToAdopt(page, page->instance_id)) {
+            view = nullptr;
+        }
+        return view;
+    };
+
+    auto page_a = std::make_shared<FakePage>(FakePage{"page_a"});
+    auto page_b = std::make_shared<FakePage>(FakePage{"page_b"});
+    auto wrapper = std::make_shared<WrapperView>(true);
+    wrapper->SetRootView(page_a, page_a->instance_id);
+    wrapper->ToInit();
+    auto legacy = std::make_shared<WrapperView>(false);
+    legacy->SetRootView(page_a, page_a->instance_id);
+    legacy->ToInit();
+    auto outer_parent = std::make_shared<AdoptableView>();
+    outer_parent->SetRootView(page_a, page_a->instance_id);
+    outer_parent->ToInit();
+    outer_parent->InsertSubView(wrapper);
+    CHECK("E", wrapper->BoundTo(page_a) && legacy->BoundTo(page_a) && wrapper->Parent() == outer_parent);
+
+    // 页面 A 删除 cell 后回收，随后 A 销毁
+    pool.Recycle("KRWrapperImageView", wrapper);
+    pool.Recycle("KRWrapperImageViewLegacy", legacy);
+    std::weak_ptr<FakePage> weak_a = page_a;
+    page_a.reset();
+    outer_parent.reset();
+    CHECK("E", weak_a.expired());
+
+    auto adopted = std::static_pointer_cast<WrapperView>(acquire("KRWrapperImageView", page_b));
+    CHECK("E", adopted == wrapper && adopted->BoundTo(page_b));
+    CHECK("E", adopted->Parent() == nullptr && adopted->ChildrenAttached());
+    // A 的处理器: wrapper 外层与 2 个子 view 共 3 个已释放; legacy 尚未取用, 4 个均未释放
+    size_t released = 0;
+    size_t alive = 0;
+    for (const auto &handler : AdoptableView::AllHandlers()) {
+        if (handler->instance_id == "page_a") {
+            (handler->destroyed ? released : alive)++;
+        }
+    }
+    CHECK("E", released == 3 && alive == 3 + 1);  // legacy 3 个 + outer_parent 1 个 (替身不模拟销毁)
+
+    auto stale = std::static_pointer_cast<WrapperView>(acquire("KRWrapperImageViewLegacy", page_b));
+    CHECK("E", stale == legacy && !stale->BoundTo(page_b));  // 反例: 内部子 view 仍绑定在已销毁的 A 上
+
+    // 目标页面已销毁: ToAdopt 失败，view 不再可用
+    auto page_c = std::make_shared<FakePage>(FakePage{"page_c"});
+    pool.Recycle("KRWrapperImageView", adopted);
+    std::weak_ptr<FakePage> weak_c = page_c;
+    page_c.reset();
+    auto view = pool.Acquire("KRWrapperImageView");
+    CHECK("E", view == wrapper && !view->ToAdopt(weak_c, "page_c") && view->BoundTo(page_b));
+}
+
+int main(int argc, char **argv) {
+    int pages = argc > 1 ? atoi(argv[1]) : 40;
+
+    TestCaps();
+    TestTrim();
+    TestLearning();
+    TestCrossPage(pages);
+    TestAdopt();
+
+    if (g_fail == 0) {
+        printf("\n>>> ALL PASS <<<\n");
+        return 0;
+    }
+    printf("\n>>> %d FAILED <<<\n", g_fail);
+    exit(1);
+}
@@ -0,0 +1,514 @@
+// 压测程序: stress_asset_cache
+//
+// 目标:
+//   验证 KRAssetCache (APNG 等资源的进程级异步缓存) 在多线程下的正确性:
+//   1) 同一 key 的并发请求只触发一次加载, 所有等待者拿到同一个对象;
+//   2) 请求可取消, 等待者全部取消后加载被放弃且结果不写入缓存;
+//   3) 按字节预算 LRU 淘汰, 命中/未命中/淘汰统计自洽。
+//
+// 说明:
+//   KRAssetCache.h 只依赖标准库, 这里直接包含生产实现;
+//   load_executor 用 4 线程的 WorkerPool 模拟后台执行器, callback_executor 用单线程的 WorkerPool 模拟主线程。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp stress_asset_cache.cpp -o stress_asset_cache
+//   开启 TSAN:
+//   clang++ -std=c++17 -O1 -g -pthread -fsanitize=thread -I ../../main/cpp stress_asset_cache.cpp -o stress_asset_cache_tsan
+//   运行:
+//   ./stress_asset_cache             # 默认 8 个请求线程, 每个线程 20000 次请求
+//   ./stress_asset_cache 16 50000
+//
+// 验证项:
+//   A. 请求合并  : 加载阻塞期间同 key 的并发请求只加载一次, 回调收到同一对象, coalesced_count 正确
+//   B. 取消      : 全部取消时加载函数观察到 cancelled() 且不回调、不入缓存; 部分取消时剩余请求照常回调;
+//                  加载完成后、回调派发前取消, 回调不再发生
+//   C. 字节预算  : 按 LRU 淘汰, 超出预算的单个条目不入缓存, SetCapacityBytes 缩小预算时立即淘汰, 统计自洽
+//   D. 并发压测  : 多线程随机请求/取消下, 未取消的请求恰好回调一次且值正确, 已取消的请求不回调,
+//                  任意时刻 bytes 不超过预算 (TSAN 下无 warning)
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/KRAssetCache.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+// ---------------------------------------------------------------------------
+// 0. 执行器: N 个线程共享一个任务队列 (N = 1 时即串行的 "主线程")
+// ---------------------------------------------------------------------------
+class WorkerPool {
+ public:
+    explicit WorkerPool(int thread_count) {
+        for (int i = 0; i < thread_count; i++) {
+            threads_.emplace_back([this] { Run(); });
+        }
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopped_ = true;
+        }
+        cv_.notify_all();
+        for (auto &thread : threads_) {
+            thread.join();
+        }
+    }
+
+    void Post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    // 等待队列清空且没有正在执行的任务
+    void Drain() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_cv_.wait(lock, [this] { return tasks_.empty() && running_ == 0; });
+    }
+
+ private:
+    void Run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this] { return stopped_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            running_++;
+            lock.unlock();
+            task();
+            task = nullptr;
+            lock.lock();
+            running_--;
+            if (tasks_.empty() && running_ == 0) {
+                idle_cv_.notify_all();
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable idle_cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> threads_;
+    int running_ = 0;
+    bool stopped_ = false;
+};
+
+// 可手动打开的闸门, 用于让加载函数阻塞在固定位置
+class Gate {
+ public:
+    void Open() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            open_ = true;
+        }
+        cv_.notify_all();
+    }
+    void Wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return open_; });
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool open_ = false;
+};
+
+struct Asset {
+    std::string key;
+    explicit Asset(std::string k) : key(std::move(k)) {}
+};
+
+using Cache = KRAssetCache<Asset>;
+
+static Cache::Executor PoolExecutor(WorkerPool &pool) {
+    return [&pool](std::function<void()> task) { pool.Post(std::move(task)); };
+}
+
+// ---------------------------------------------------------------------------
+// A. 请求合并
+// ---------------------------------------------------------------------------
+static void TestCoalescing() {
+    printf("\n===== A. 请求合并 =====\n");
+    WorkerPool loaders(4);
+    WorkerPool main_thread(1);
+    Cache cache(1 << 20, PoolExecutor(loaders), PoolExecutor(main_thread));
+
+    Gate gate;
+    std::atomic<int> loader_calls{0};
+    auto loader = [&](const std::function<bool()> &, size_t &cost) {
+        loader_calls++;
+        gate.Wait();
+        cost = 100;
+        return std::make_shared<Asset>("a.png");
+    };
+
+    const int kRequesters = 8;
+    const int kPerRequester = 16;
+    std::mutex results_mutex;
+    std::vector<std::shared_ptr<Asset>> results;
+    std::vector<std::thread> requesters;
+    for (int t = 0; t < kRequesters; t++) {
+        requesters.emplace_back([&] {
+            for (int i = 0; i < kPerRequester; i++) {
+                cache.Fetch("a.png", loader, [&](std::shared_ptr<Asset> value) {
+                    std::lock_guard<std::mutex> lock(results_mutex);
+                    results.push_back(value);
+                });
+            }
+        });
+    }
+    for (auto &thread : requesters) {
+        thread.join();
+    }
+    auto stats = cache.GetStats();
+    CHECK("A", stats.inflight_count == 1);
+    gate.Open();
+    loaders.Drain();
+    main_thread.Drain();
+
+    const size_t total = kRequesters * kPerRequester;
+    stats = cache.GetStats();
+    CHECK("A", loader_calls.load() == 1 && stats.load_count == 1);
+    CHECK("A", stats.miss_count == total && stats.coalesced_count == total - 1);
+    CHECK("A", results.size() == total);
+    bool same = !results.empty() && results[0] != nullptr;
+    for (const auto &value : results) {
+        same = same && value == results[0];
+    }
+    CHECK("A", same);
+
+    // 加载完成后命中缓存: 同步回调, 返回 0
+    std::shared_ptr<Asset> hit;
+    uint64_t id = cache.Fetch("a.png", loader, [&](std::shared_ptr<Asset> value) { hit = value; });
+    CHECK("A", id == 0 && hit == results[0]);
+    stats = cache.GetStats();
+    CHECK("A", stats.hit_count == 1 && stats.inflight_count == 0 && stats.entry_count == 1 && stats.bytes == 100);
+}
+
+// ---------------------------------------------------------------------------
+// B. 取消
+// ---------------------------------------------------------------------------
+static void TestCancel() {
+    printf("\n===== B. 取消 =====\n");
+    WorkerPool loaders(2);
+    WorkerPool main_thread(1);
+    Cache cache(1 << 20, PoolExecutor(loaders), PoolExecutor(main_thread));
+
+    // 1) 等待者全部取消: 加载函数观察到 cancelled(), 不回调, 不入缓存
+    {
+        Gate gate;
+        std::atomic<bool> started{false};
+        std::atomic<bool> observed_cancel{false};
+        std::atomic<int> callbacks{0};
+        auto loader = [&](const std::function<bool()> &cancelled, size_t &cost) -> std::shared_ptr<Asset> {
+            started = true;
+            gate.Wait();
+            if (cancelled()) {
+                observed_cancel = true;
+                return nullptr;
+            }
+            cost = 10;
+            return std::make_shared<Asset>("b.png");
+        };
+        uint64_t id1 = cache.Fetch("b.png", loader, [&](std::shared_ptr<Asset>) { callbacks++; });
+        uint64_t id2 = cache.Fetch("b.png", loader, [&](std::shared_ptr<Asset>) { callbacks++; });
+        CHECK("B", id1 != 0 && id2 != 0 && id1 != id2);
+        while (!started.load()) {  // 确保加载函数已在执行, 才能观察到中途取消
+            std::this_thread::yield();
+        }
+        cache.Cancel(id1);
+        CHECK("B", cache.GetStats().inflight_count == 1);
+        cache.Cancel(id2);
+        cache.Cancel(id2);  // 重复取消忽略
+        auto stats = cache.GetStats();
+        CHECK("B", stats.inflight_count == 0 && stats.cancel_count == 1);
+        gate.Open();
+        loaders.Drain();
+        main_thread.Drain();
+        stats = cache.GetStats();
+        CHECK("B", observed_cancel.load() && callbacks.load() == 0);
+        CHECK("B", stats.entry_count == 0 && stats.load_failure_count == 0);
+    }
+
+    // 2) 取消后同 key 再请求: 重新发起加载, 不合并到已取消的加载上
+    {
+        Gate gate;
+        std::atomic<int> loader_calls{0};
+        auto loader = [&](const std::function<bool()> &cancelled, size_t &cost) -> std::shared_ptr<Asset> {
+            loader_calls++;
+            gate.Wait();
+            if (cancelled()) {
+                return nullptr;
+            }
+            cost = 10;
+            return std::make_shared<Asset>("c.png");
+        };
+        std::shared_ptr<Asset> got;
+        uint64_t old_id = cache.Fetch("c.png", loader, [&](std::shared_ptr<Asset>) { CHECK("B", false); });
+        while (loader_calls.load() == 0) {  // 旧加载已在执行后再取消, 否则可能在开始前就被丢弃而不调用加载函数
+            std::this_thread::yield();
+        }
+        cache.Cancel(old_id);
+        uint64_t keep_id = cache.Fetch("c.png", loader, [&](std::shared_ptr<Asset> v) { got = v; });
+        uint64_t drop_id = cache.Fetch("c.png", loader, [&](std::shared_ptr<Asset>) { CHECK("B", false); });
+        cache.Cancel(drop_id);  // 部分取消, keep_id 仍在等待
+        CHECK("B", keep_id != 0 && cache.GetStats().inflight_count == 1);
+        gate.Open();
+        loaders.Drain();
+        main_thread.Drain();
+        auto stats = cache.GetStats();
+        CHECK("B", loader_calls.load() == 2 && got != nullptr && got->key == "c.png");
+        CHECK("B", stats.entry_count == 1 && stats.cancel_count == 2);
+    }
+
+    // 3) 加载已完成、回调尚在主线程队列中时取消: 不再回调
+    {
+        Gate main_blocked;
+        main_thread.Post([&] { main_blocked.Wait(); });
+        Gate load_blocked;  // 两个请求都发起后再完成加载, 确保合并
+        std::atomic<int> callbacks{0};
+        auto loader = [&](const std::function<bool()> &, size_t &cost) {
+            load_blocked.Wait();
+            cost = 10;
+            return std::make_shared<Asset>("d.png");
+        };
+        uint64_t cancel_id = cache.Fetch("d.png", loader, [&](std::shared_ptr<Asset>) { callbacks++; });
+        uint64_t keep_id = cache.Fetch("d.png", loader, [&](std::shared_ptr<Asset>) { callbacks += 10; });
+        load_blocked.Open();
+        loaders.Drain();  // 加载完成, 回调已派发到被阻塞的主线程
+        CHECK("B", cache.GetStats().entry_count == 2);
+        cache.Cancel(cancel_id);
+        main_blocked.Open();
+        main_thread.Drain();
+        CHECK("B", keep_id != 0 && callbacks.load() == 10);
+        CHECK("B", cache.GetStats().cancel_count == 2);  // 已完成的加载不计入取消
+    }
+
+    // 4) 加载失败不缓存, 下次请求重新加载
+    {
+        std::atomic<int> loader_calls{0};
+        auto loader = [&](const std::function<bool()> &, size_t &) -> std::shared_ptr<Asset> {
+            loader_calls++;
+            return nullptr;
+        };
+        int null_callbacks = 0;
+        for (int i = 0; i < 2; i++) {
+            cache.Fetch("e.png", loader, [&](std::shared_ptr<Asset> v) { null_callbacks += v == nullptr; });
+            loaders.Drain();
+            main_thread.Drain();
+        }
+        auto stats = cache.GetStats();
+        CHECK("B", loader_calls.load() == 2 && null_callbacks == 2 && stats.load_failure_count == 2);
+        CHECK("B", cache.Get("e.png") == nullptr);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// C. 字节预算
+// ---------------------------------------------------------------------------
+static void TestBudget() {
+    printf("\n===== C. 字节预算 =====\n");
+    // 同步执行器: 便于精确断言顺序
+    auto inline_executor = [](std::function<void()> task) { task(); };
+    Cache cache(1000, inline_executor, inline_executor);
+    auto loader_with_cost = [](size_t c) {
+        return [c](const std::function<bool()> &, size_t &cost) {
+            cost = c;
+            return std::make_shared<Asset>("x");
+        };
+    };
+    auto ignore = [](std::shared_ptr<Asset>) {};
+
+    for (int i = 0; i < 5; i++) {
+        cache.Fetch("key" + std::to_string(i), loader_with_cost(200), ignore);
+    }
+    auto stats = cache.GetStats();
+    CHECK("C", stats.bytes == 1000 && stats.entry_count == 5 && stats.eviction_count == 0);
+
+    cache.Fetch("key0", loader_with_cost(200), ignore);       // 命中, key0 移到最近
+    cache.Fetch("key5", loader_with_cost(300), ignore);       // 淘汰 key1, key2
+    stats = cache.GetStats();
+    CHECK("C", stats.bytes <= 1000 && stats.eviction_count == 2);
+    CHECK("C", cache.Get("key0") != nullptr && cache.Get("key1") == nullptr && cache.Get("key2") == nullptr);
+    CHECK("C", cache.Get("key3") != nullptr && cache.Get("key5") != nullptr);
+
+    std::shared_ptr<Asset> huge;
+    cache.Fetch("huge", loader_with_cost(5000), [&](std::shared_ptr<Asset> v) { huge = v; });
+    CHECK("C", huge != nullptr && cache.Get("huge") == nullptr);  // 照常回调, 但不入缓存
+    CHECK("C", cache.GetStats().bytes == 900);
+
+    cache.SetCapacityBytes(400);
+    stats = cache.GetStats();
+    CHECK("C", stats.bytes <= 400 && cache.Get("key5") != nullptr);
+
+    cache.Remove("key5");
+    stats = cache.GetStats();
+    CHECK("C", cache.Get("key5") == nullptr && stats.bytes == stats.entry_count * 200);
+    cache.Clear();
+    stats = cache.GetStats();
+    CHECK("C", stats.bytes == 0 && stats.entry_count == 0);
+    CHECK("C", stats.hit_count + stats.miss_count == 8);
+}
+
+// ---------------------------------------------------------------------------
+// D. 并发压测
+// ---------------------------------------------------------------------------
+static void TestStress(int requester_count, int requests_per_thread) {
+    printf("\n===== D. 并发压测: %d 线程 x %d 次请求 =====\n", requester_count, requests_per_thread);
+    const size_t kCapacity = 64 * 1024;
+    const int kKeyCount = 64;
+    WorkerPool loaders(4);
+    WorkerPool main_thread(1);
+    Cache cache(kCapacity, PoolExecutor(loaders), PoolExecutor(main_thread));
+
+    struct Record {
+        std::string key;
+        std::atomic<int> callbacks{0};
+        std::atomic<bool> wrong_value{false};
+        bool cancelled = false;  // 只由发起线程读写
+        uint64_t id = 0;
+    };
+    std::vector<std::vector<std::unique_ptr<Record>>> records(requester_count);
+    std::atomic<bool> over_budget{false};
+    std::atomic<uint64_t> loads{0};
+
+    auto loader_for = [&](const std::string &key) {
+        return [&, key](const std::function<bool()> &cancelled, size_t &cost) -> std::shared_ptr<Asset> {
+            loads++;
+            std::this_thread::yield();
+            if (cancelled()) {
+                return nullptr;
+            }
+            cost = 1024 * (1 + std::hash<std::string>()(key) % 8);
+            return std::make_shared<Asset>(key);
+        };
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> requesters;
+    for (int t = 0; t < requester_count; t++) {
+        requesters.emplace_back([&, t] {
+            std::mt19937 rng(1234 + t);
+            auto &mine = records[t];
+            mine.reserve(requests_per_thread);
+            for (int i = 0; i < requests_per_thread; i++) {
+                auto record = std::make_unique<Record>();
+                Record *r = record.get();
+                r->key = "asset_" + std::to_string(rng() % kKeyCount);
+                r->id = cache.Fetch(r->key, loader_for(r->key), [r](std::shared_ptr<Asset> value) {
+                    r->callbacks++;
+                    if (!value || value->key != r->key) {
+                        r->wrong_value = true;
+                    }
+                });
+                mine.push_back(std::move(record));
+                // 随机取消之前的一个请求 (可能已回调, 此时取消无效)
+                if (rng() % 4 == 0) {
+                    Record *victim = mine[rng() % mine.size()].get();
+                    if (victim->id != 0 && !victim->cancelled) {
+                        cache.Cancel(victim->id);
+                        victim->cancelled = true;
+                    }
+                }
+                if (rng() % 64 == 0) {
+                    cache.SetCapacityBytes(kCapacity / 2 + rng() % (kCapacity / 2));
+                }
+                if (cache.GetStats().bytes > kCapacity) {
+                    over_budget = true;
+                }
+            }
+        });
+    }
+    for (auto &thread : requesters) {
+        thread.join();
+    }
+    loaders.Drain();
+    main_thread.Drain();
+    loaders.Drain();
+    main_thread.Drain();
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t served = 0;
+    uint64_t cancelled = 0;
+    bool exactly_once = true;
+    bool at_most_once = true;
+    bool values_ok = true;
+    for (auto &mine : records) {
+        for (auto &r : mine) {
+            int n = r->callbacks.load();
+            if (r->cancelled) {
+                cancelled++;
+                at_most_once = at_most_once && n <= 1;  // 取消发生在回调之后时允许已回调一次
+            } else {
+                exactly_once = exactly_once && n == 1;
+            }
+            served += n;
+            values_ok = values_ok && !r->wrong_value.load();
+        }
+    }
+    auto stats = cache.GetStats();
+    uint64_t total = static_cast<uint64_t>(requester_count) * requests_per_thread;
+    printf("  耗时 %.1f ms, 请求 %llu, 回调 %llu, 取消 %llu, 实际加载 %llu\n", ms,
+           static_cast<unsigned long long>(total), static_cast<unsigned long long>(served),
+           static_cast<unsigned long long>(cancelled), static_cast<unsigned long long>(loads.load()));
+    printf("  hit %llu, miss %llu, coalesced %llu, load %llu, cancel %llu, evict %llu, bytes %zu\n",
+           static_cast<unsigned long long>(stats.hit_count), static_cast<unsigned long long>(stats.miss_count),
+           static_cast<unsigned long long>(stats.coalesced_count), static_cast<unsigned long long>(stats.load_count),
+           static_cast<unsigned long long>(stats.cancel_count), static_cast<unsigned long long>(stats.eviction_count),
+           stats.bytes);
+
+    CHECK("D", exactly_once);
+    CHECK("D", at_most_once);
+    CHECK("D", values_ok);
+    CHECK("D", !over_budget.load());
+    CHECK("D", stats.inflight_count == 0);
+    CHECK("D", stats.hit_count + stats.miss_count == total);
+    CHECK("D", stats.load_count + stats.coalesced_count == stats.miss_count);
+    CHECK("D", loads.load() <= stats.load_count);  // 执行前已取消的加载不会调用加载函数
+    CHECK("D", stats.load_failure_count == 0);
+}
+
+int main(int argc, char **argv) {
+    int requester_count = argc > 1 ? atoi(argv[1]) : 8;
+    int requests_per_thread = argc > 2 ? atoi(argv[2]) : 20000;
+
+    TestCoalescing();
+    TestCancel();
+    TestBudget();
+    TestStress(requester_count, requests_per_thread);
+
+    if (g_fail == 0) {
+        printf("\n>>> ALL PASS <<<\n");
+        return 0;
+    }
+    printf("\n>>> %d FAILED <<<\n", g_fail);
+    exit(1);
+}
@@ -0,0 +1,389 @@
+// 压测程序: stress_cache_budget_coordinator
+//
+// 目标:
+//   验证 KRCacheBudgetCoordinator (进程级缓存预算协调器) 的裁剪顺序与线程安全:
+//   1) 总占用超出全局预算时按优先级从低到高裁剪, 刚好回到预算内即停止, 高优先级缓存不受影响;
+//   2) moderate 裁剪到预算的一半, critical 清空所有可裁剪缓存, 只统计的缓存 (pinned) 不被裁剪;
+//   3) 接入的真实缓存 (KRAssetCache / KRTextMeasureCache) 的 TrimToBytes 按 LRU 淘汰, 不改变原有预算。
+//
+// 说明:
+//   KRCacheBudgetCoordinator.h / KRAssetCache.h / KRTextMeasureCache.h 只依赖标准库, 这里直接包含生产实现;
+//   FakeCache 模拟页面级/进程级缓存: 按条目计字节, 裁剪时从最旧的条目开始丢弃, 并记录被裁剪的顺序。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp stress_cache_budget_coordinator.cpp -o stress_cache_budget
+//   开启 TSAN:
+//   clang++ -std=c++17 -O1 -g -pthread -fsanitize=thread -I ../../main/cpp stress_cache_budget_coordinator.cpp -o stress_cache_budget_tsan
+//   运行:
+//   ./stress_cache_budget             # 默认 4 个线程, 每个线程 20000 次操作
+//   ./stress_cache_budget 8 50000
+//
+// 验证项:
+//   A. 预算裁剪  : 设定预算后按优先级从低到高裁剪, 边界缓存只裁掉超出部分, 更高优先级缓存不动, 未超预算时不裁剪
+//   B. 压力级别  : PSS 阈值/系统内存级别映射正确; moderate 后总量 <= 预算/2; critical 后可裁剪缓存清空, pinned 保留;
+//                  驻留报告按名称合并多实例并按优先级排序
+//   C. 真实缓存  : KRAssetCache / KRTextMeasureCache 注册后按 LRU 裁剪, 最近访问的条目保留, 预算不变
+//   D. 并发压测  : 多线程注册/注销/写入缓存的同时主线程反复 EnforceBudget / Report, 裁剪回调中注销其他缓存被安全跳过
+//                  (TSAN 下无 warning)
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/expand/components/richtext/KRTextMeasureCache.h"
+#include "libohos_render/foundation/KRAssetCache.h"
+#include "libohos_render/foundation/KRCacheBudgetCoordinator.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+constexpr size_t kKB = 1024;
+
+// ---------------------------------------------------------------------------
+// 0. FakeCache: 条目为固定大小的块, 裁剪从最旧的条目开始, 记录全局裁剪顺序
+// ---------------------------------------------------------------------------
+class FakeCache {
+ public:
+    FakeCache(std::string name, std::vector<std::string> *trim_log) : name_(std::move(name)), trim_log_(trim_log) {}
+
+    void Add(size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        blocks_.push_back(bytes);
+        bytes_ += bytes;
+    }
+
+    size_t Bytes() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return bytes_;
+    }
+
+    void Trim(size_t target_bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (trim_log_) {
+            trim_log_->push_back(name_);
+        }
+        while (bytes_ > target_bytes && !blocks_.empty()) {
+            bytes_ -= blocks_.front();
+            blocks_.pop_front();
+        }
+    }
+
+    uint64_t Register(KRCacheBudgetCoordinator &coordinator, int priority, bool trimmable = true) {
+        KRCacheBudgetCoordinator::TrimFn trim;
+        if (trimmable) {
+            trim = [this](size_t target_bytes) { Trim(target_bytes); };
+        }
+        return coordinator.Register(name_, priority, [this] { return Bytes(); }, std::move(trim));
+    }
+
+ private:
+    std::string name_;
+    std::vector<std::string> *trim_log_;
+    std::mutex mutex_;
+    std::deque<size_t> blocks_;
+    size_t bytes_ = 0;
+};
+
+static size_t TotalBytes(KRCacheBudgetCoordinator &coordinator) {
+    size_t total = 0;
+    for (const auto &item : coordinator.Report()) {
+        total += item.bytes;
+    }
+    return total;
+}
+
+// ---------------------------------------------------------------------------
+// A. 预算裁剪顺序
+// ---------------------------------------------------------------------------
+static void TestBudgetOrder() {
+    printf("\n=== A. 预算裁剪顺序 ===\n");
+    KRCacheBudgetCoordinator coordinator(1000 * kKB);
+    std::vector<std::string> trim_log;
+    // 故意打乱注册顺序, 验证按优先级而不是注册顺序裁剪
+    FakeCache text("text_measure", &trim_log);
+    FakeCache reuse("view_reuse", &trim_log);
+    FakeCache decoded("decoded_image", &trim_log);
+    FakeCache apng("apng_asset", &trim_log);
+    text.Register(coordinator, KRCacheBudgetCoordinator::kPriorityTextMeasure);
+    reuse.Register(coordinator, KRCacheBudgetCoordinator::kPriorityViewReuse);
+    decoded.Register(coordinator, KRCacheBudgetCoordinator::kPriorityDecodedImage);
+    apng.Register(coordinator, KRCacheBudgetCoordinator::kPriorityAPNGAsset);
+    for (int i = 0; i < 10; ++i) {
+        text.Add(20 * kKB);     // 200KB
+        reuse.Add(10 * kKB);    // 100KB
+        decoded.Add(50 * kKB);  // 500KB
+        apng.Add(30 * kKB);     // 300KB
+    }
+    printf("  before: %s\n", KRCacheBudgetCoordinator::FormatReport(coordinator.Report()).c_str());
+
+    // 总量 1100KB, 预算 1000KB: 只需裁掉 view_reuse 的 100KB
+    size_t trimmed = coordinator.EnforceBudget();
+    CHECK("A", trimmed == 100 * kKB);
+    CHECK("A", reuse.Bytes() == 0);
+    CHECK("A", apng.Bytes() == 300 * kKB && decoded.Bytes() == 500 * kKB && text.Bytes() == 200 * kKB);
+    CHECK("A", trim_log.size() == 1 && trim_log[0] == "view_reuse");
+
+    // 未超预算时不裁剪
+    trim_log.clear();
+    CHECK("A", coordinator.EnforceBudget() == 0);
+    CHECK("A", trim_log.empty());
+
+    // 预算降到 600KB: 超出 400KB, apng (优先级 10) 整个裁掉 300KB 后, decoded (20) 只裁掉剩余的 100KB
+    coordinator.SetBudgetBytes(600 * kKB);
+    trimmed = coordinator.EnforceBudget();
+    printf("  after : %s\n", KRCacheBudgetCoordinator::FormatReport(coordinator.Report()).c_str());
+    CHECK("A", trimmed == 400 * kKB);
+    CHECK("A", apng.Bytes() == 0);
+    CHECK("A", decoded.Bytes() == 400 * kKB);
+    CHECK("A", text.Bytes() == 200 * kKB);
+    CHECK("A", TotalBytes(coordinator) <= 600 * kKB);
+    CHECK("A", trim_log == (std::vector<std::string>{"apng_asset", "decoded_image"}));
+    auto stats = coordinator.GetStats();
+    CHECK("A", stats.trim_count == 2 && stats.trimmed_bytes == 500 * kKB);
+    CHECK("A", stats.last_level == KRMemoryTrimLevel::kNone);
+}
+
+// ---------------------------------------------------------------------------
+// B. 压力级别与驻留报告
+// ---------------------------------------------------------------------------
+static void TestTrimLevels() {
+    printf("\n=== B. 压力级别与驻留报告 ===\n");
+    KRCacheBudgetCoordinator coordinator(1000 * kKB);
+    coordinator.SetPssThresholds(500LL * 1024 * 1024, 800LL * 1024 * 1024);
+    CHECK("B", coordinator.LevelForPss(100LL * 1024 * 1024) == KRMemoryTrimLevel::kNone);
+    CHECK("B", coordinator.LevelForPss(600LL * 1024 * 1024) == KRMemoryTrimLevel::kModerate);
+    CHECK("B", coordinator.LevelForPss(900LL * 1024 * 1024) == KRMemoryTrimLevel::kCritical);
+    coordinator.SetPssThresholds(0, 0);
+    CHECK("B", coordinator.LevelForPss(900LL * 1024 * 1024) == KRMemoryTrimLevel::kNone);
+    CHECK("B", KRCacheBudgetCoordinator::LevelForSystemMemoryLevel(0) == KRMemoryTrimLevel::kModerate);
+    CHECK("B", KRCacheBudgetCoordinator::LevelForSystemMemoryLevel(1) == KRMemoryTrimLevel::kCritical);
+    CHECK("B", KRCacheBudgetCoordinator::LevelForSystemMemoryLevel(2) == KRMemoryTrimLevel::kCritical);
+
+    std::vector<std::string> trim_log;
+    FakeCache snapshot_page1("snapshot", &trim_log);
+    FakeCache snapshot_page2("snapshot", &trim_log);
+    FakeCache emoji("emoji_pixmap", &trim_log);
+    FakeCache text("text_measure", &trim_log);
+    FakeCache module("memory_cache_module", &trim_log);
+    snapshot_page1.Register(coordinator, KRCacheBudgetCoordinator::kPrioritySnapshot);
+    snapshot_page2.Register(coordinator, KRCacheBudgetCoordinator::kPrioritySnapshot);
+    emoji.Register(coordinator, KRCacheBudgetCoordinator::kPriorityEmojiPixmap);
+    text.Register(coordinator, KRCacheBudgetCoordinator::kPriorityTextMeasure);
+    module.Register(coordinator, KRCacheBudgetCoordinator::kPriorityPinned, false);
+    for (int i = 0; i < 10; ++i) {
+        snapshot_page1.Add(10 * kKB);  // 100KB
+        snapshot_page2.Add(10 * kKB);  // 100KB
+        emoji.Add(20 * kKB);           // 200KB
+        text.Add(30 * kKB);            // 300KB
+        module.Add(20 * kKB);          // 200KB, 不可裁剪
+    }
+
+    auto report = coordinator.Report();
+    printf("  before: %s\n", KRCacheBudgetCoordinator::FormatReport(report).c_str());
+    CHECK("B", report.size() == 4);
+    CHECK("B", report[0].name == "snapshot" && report[0].instance_count == 2 && report[0].bytes == 200 * kKB);
+    CHECK("B", report[1].name == "emoji_pixmap" && report[2].name == "text_measure");
+    CHECK("B", report[3].name == "memory_cache_module" && !report[3].trimmable && report[3].bytes == 200 * kKB);
+
+    // 总量 900KB 未超预算, moderate 仍需裁到 500KB: 两个 snapshot 实例 (200KB) + emoji 200KB
+    coordinator.Trim(KRMemoryTrimLevel::kModerate);
+    printf("  moderate: %s\n", KRCacheBudgetCoordinator::FormatReport(coordinator.Report()).c_str());
+    CHECK("B", TotalBytes(coordinator) <= 500 * kKB);
+    CHECK("B", snapshot_page1.Bytes() == 0 && snapshot_page2.Bytes() == 0);
+    CHECK("B", emoji.Bytes() == 0);
+    CHECK("B", text.Bytes() == 300 * kKB && module.Bytes() == 200 * kKB);
+    CHECK("B", trim_log == (std::vector<std::string>{"snapshot", "snapshot", "emoji_pixmap"}));
+    CHECK("B", coordinator.GetStats().last_level == KRMemoryTrimLevel::kModerate);
+
+    // critical: 可裁剪的全部清空, pinned 保留
+    trim_log.clear();
+    coordinator.Trim(KRMemoryTrimLevel::kCritical);
+    printf("  critical: %s\n", KRCacheBudgetCoordinator::FormatReport(coordinator.Report()).c_str());
+    CHECK("B", text.Bytes() == 0);
+    CHECK("B", module.Bytes() == 200 * kKB);
+    CHECK("B", trim_log == (std::vector<std::string>{"text_measure"}));  // 已为空的缓存不再回调
+    CHECK("B", coordinator.GetStats().last_level == KRMemoryTrimLevel::kCritical);
+}
+
+// ---------------------------------------------------------------------------
+// C. 真实缓存接入
+// ---------------------------------------------------------------------------
+struct Blob {
+    int id;
+};
+
+struct Measure {
+    int id;
+};
+
+static void TestRealCaches() {
+    printf("\n=== C. 真实缓存接入 ===\n");
+    KRCacheBudgetCoordinator coordinator(1000 * kKB);
+    auto inline_executor = [](std::function<void()> task) { task(); };
+    KRAssetCache<Blob> asset_cache(800 * kKB, inline_executor, inline_executor);
+    KRTextMeasureCache<Measure> measure_cache(800 * kKB);
+    coordinator.Register(
+        "apng_asset", KRCacheBudgetCoordinator::kPriorityAPNGAsset, [&] { return asset_cache.GetStats().bytes; },
+        [&](size_t target_bytes) { asset_cache.TrimToBytes(target_bytes); });
+    coordinator.Register(
+        "text_measure", KRCacheBudgetCoordinator::kPriorityTextMeasure,
+        [&] { return measure_cache.GetStats().bytes; },
+        [&](size_t target_bytes) { measure_cache.TrimToBytes(target_bytes); });
+
+    for (int i = 0; i < 8; ++i) {
+        asset_cache.Put("apng_" + std::to_string(i), std::make_shared<Blob>(Blob{i}), 100 * kKB);
+        measure_cache.Put("text_" + std::to_string(i), std::make_shared<Measure>(Measure{i}), 50 * kKB, 1);
+    }
+    // 访问最旧的两个条目, 使其成为最近使用
+    CHECK("C", asset_cache.Get("apng_0") != nullptr);
+    CHECK("C", measure_cache.Get("text_0", 1) != nullptr);
+
+    // 总量 800 + 400 = 1200KB, 预算 1000KB: asset 裁掉 2 条最久未访问 (apng_1, apng_2)
+    coordinator.EnforceBudget();
+    CHECK("C", asset_cache.GetStats().bytes == 600 * kKB);
+    CHECK("C", asset_cache.Get("apng_0") != nullptr);
+    CHECK("C", asset_cache.Get("apng_1") == nullptr && asset_cache.Get("apng_2") == nullptr);
+    CHECK("C", asset_cache.Get("apng_3") != nullptr);
+    CHECK("C", measure_cache.GetStats().bytes == 400 * kKB);
+
+    // critical 后全部清空, 原有预算不变: 之后仍可写满 800KB
+    coordinator.Trim(KRMemoryTrimLevel::kCritical);
+    CHECK("C", asset_cache.GetStats().bytes == 0 && asset_cache.GetStats().entry_count == 0);
+    CHECK("C", measure_cache.GetStats().bytes == 0);
+    for (int i = 0; i < 8; ++i) {
+        asset_cache.Put("apng_" + std::to_string(i), std::make_shared<Blob>(Blob{i}), 100 * kKB);
+    }
+    CHECK("C", asset_cache.GetStats().bytes == 800 * kKB);
+    printf("  after refill: %s\n", KRCacheBudgetCoordinator::FormatReport(coordinator.Report()).c_str());
+}
+
+// ---------------------------------------------------------------------------
+// D. 并发压测
+// ---------------------------------------------------------------------------
+static void TestStress(int thread_count, int ops_per_thread) {
+    printf("\n=== D. 并发压测 (%d 线程 x %d 次) ===\n", thread_count, ops_per_thread);
+    KRCacheBudgetCoordinator coordinator(512 * kKB);
+
+    // 裁剪回调中注销排在后面的缓存: 协调器需要跳过它
+    FakeCache victim("victim", nullptr);
+    std::atomic<uint64_t> victim_id{0};
+    std::atomic<int> victim_trimmed{0};
+    FakeCache killer("killer", nullptr);
+    coordinator.Register(
+        "killer", 0, [&] { return killer.Bytes(); },
+        [&](size_t target_bytes) {
+            killer.Trim(target_bytes);
+            coordinator.Unregister(victim_id.load());
+        });
+    victim_id = coordinator.Register(
+        "victim", 1, [&] { return victim.Bytes(); },
+        [&](size_t target_bytes) {
+            victim_trimmed++;
+            victim.Trim(target_bytes);
+        });
+    killer.Add(64 * kKB);
+    victim.Add(1024 * kKB);
+    coordinator.EnforceBudget();
+    CHECK("D", victim_trimmed.load() == 0);
+    CHECK("D", killer.Bytes() == 0);
+
+    // 常驻缓存 + 工作线程中反复注册/注销的页面级缓存
+    std::vector<std::unique_ptr<FakeCache>> resident;
+    for (int i = 0; i < 4; ++i) {
+        resident.push_back(std::make_unique<FakeCache>("resident_" + std::to_string(i), nullptr));
+        resident.back()->Register(coordinator, i * 10);
+    }
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < thread_count; ++t) {
+        workers.emplace_back([&, t] {
+            std::mt19937 rng(t + 1);
+            for (int i = 0; i < ops_per_thread; ++i) {
+                switch (rng() % 3) {
+                    case 0:
+                        resident[rng() % resident.size()]->Add((rng() % 16 + 1) * kKB);
+                        break;
+                    case 1: {
+                        // 页面级缓存只读统计, 注销后即销毁
+                        auto page = std::make_shared<FakeCache>("page", nullptr);
+                        page->Add(8 * kKB);
+                        auto id = coordinator.Register(
+                            "page", KRCacheBudgetCoordinator::kPriorityPinned, [page] { return page->Bytes(); }, nullptr);
+                        coordinator.Unregister(id);
+                        break;
+                    }
+                    default:
+                        coordinator.SetBudgetBytes((rng() % 4 + 1) * 256 * kKB);
+                        break;
+                }
+            }
+        });
+    }
+    uint64_t rounds = 0;
+    std::thread main_thread([&] {
+        while (!stop.load()) {
+            coordinator.EnforceBudget();
+            coordinator.Report();
+            rounds++;
+        }
+    });
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    stop = true;
+    main_thread.join();
+
+    coordinator.SetBudgetBytes(256 * kKB);
+    coordinator.EnforceBudget();
+    size_t total = 0;
+    for (auto &cache : resident) {
+        total += cache->Bytes();
+    }
+    auto stats = coordinator.GetStats();
+    printf("  rounds=%llu trim_count=%llu trimmed=%lluKB final=%s\n", static_cast<unsigned long long>(rounds),
+           static_cast<unsigned long long>(stats.trim_count),
+           static_cast<unsigned long long>(stats.trimmed_bytes / kKB),
+           KRCacheBudgetCoordinator::FormatReport(coordinator.Report()).c_str());
+    CHECK("D", total <= 256 * kKB);
+    CHECK("D", stats.trim_count > 0);
+    bool no_page_left = true;
+    for (const auto &item : coordinator.Report()) {
+        if (item.name == "page" || item.name == "victim") {
+            no_page_left = false;
+        }
+    }
+    CHECK("D", no_page_left);
+}
+
+int main(int argc, char **argv) {
+    int thread_count = argc > 1 ? atoi(argv[1]) : 4;
+    int ops_per_thread = argc > 2 ? atoi(argv[2]) : 20000;
+
+    TestBudgetOrder();
+    TestTrimLevels();
+    TestRealCaches();
+    TestStress(thread_count, ops_per_thread);
+
+    if (g_fail == 0) {
+        printf("\n>>> ALL PASS <<<\n");
+        return 0;
+    }
+    printf("\n>>> %d FAILED <<<\n", g_fail);
+    exit(1);
+}
@@ -0,0 +1,564 @@
+// 压测程序: stress_executor
+//
+// 目标:
+//   验证统一后台执行器 KRExecutor + KRDispatchQueue 的语义:
+//   1) 串行队列严格 FIFO, 并发队列不超过 max_concurrency, 延时任务按到期时间执行;
+//   2) 未开始的任务 / 未到期的延时任务可取消, 取消后闭包立即释放;
+//   3) 多线程持续提交时 Shutdown: 每个被接受的任务恰好执行一次或被计为取消, Shutdown 返回后不再有任务执行;
+//   4) 后端线程数不超过上限, 高 QoS 作业优先, 任务异常不影响后续任务。
+//
+// 说明:
+//   直接编译生产实现 KRExecutor.cpp / KRDispatchQueue.cpp; 主机上未定义 KR_EXECUTOR_USE_FFRT,
+//   后端为 KRThreadPoolBackend。每个用例创建独立的 KRExecutor, 便于观察后端统计。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp stress_executor.cpp
+//       ../../main/cpp/libohos_render/foundation/thread/KRExecutor.cpp
+//       ../../main/cpp/libohos_render/foundation/thread/KRDispatchQueue.cpp -o stress_executor
+//   开启 TSAN: 把 -O2 换成 -O1 -g -fsanitize=thread
+//   运行:
+//   ./stress_executor            # 默认 8 个提交线程, Shutdown 前持续提交 100ms
+//   ./stress_executor 16 300
+//
+// 验证项:
+//   A. 顺序      : 多生产者向串行队列提交, 每个生产者的任务按提交顺序执行且互不重叠;
+//                  并发队列同时执行数不超过 max_concurrency; 延时任务按到期先后执行
+//   B. 取消      : 阻塞期间取消一半排队任务, 只执行未取消的; 已执行 / 无效 id 取消失败;
+//                  延时任务取消后不执行; 取消与 Shutdown 都在返回前释放闭包
+//   C. 关闭      : 多线程持续向多个队列提交时 Shutdown, 接受的任务 = 执行 + 取消, 之后提交被拒绝,
+//                  Shutdown 返回后执行计数不再变化; 超时关闭时丢弃剩余任务并返回 false
+//   D. 线程上限  : 大量队列同时提交时后端线程数与同时执行数不超过上限; 单线程后端先执行高 QoS 作业;
+//                  任务抛异常后队列继续执行后续任务
+//   E. QoS 名额  : Background 阻塞 (模拟 fsync / msync) 占满可用名额时, Utility 与 UserInitiated 作业仍能执行;
+//                  Background 同时执行数不超过一半名额, Default 及以下为 UserInitiated 保留一个名额
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRDispatchQueue.h"
+#include "libohos_render/foundation/thread/KRExecutor.h"
+
+using kuikly::dispatch::KRDispatchQueue;
+using kuikly::dispatch::KRDispatchTaskId;
+using kuikly::dispatch::KRExecutor;
+using kuikly::dispatch::KRThreadPoolBackend;
+using kuikly::dispatch::QoS;
+using kuikly::dispatch::QueueType;
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+// ---------------------------------------------------------------------------
+// 0. 工具: 闸门 (阻塞 worker 直到 Open) 与带后端统计的执行器
+// ---------------------------------------------------------------------------
+class Gate {
+ public:
+    void Wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        entered_ = true;
+        condition_.notify_all();
+        condition_.wait(lock, [this] { return open_; });
+    }
+    void WaitEntered() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return entered_; });
+    }
+    void Open() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open_ = true;
+        condition_.notify_all();
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool entered_ = false;
+    bool open_ = false;
+};
+
+struct TestExecutor {
+    explicit TestExecutor(size_t threads) {
+        auto backend = std::make_unique<KRThreadPoolBackend>(threads, "stressexec");
+        pool = backend.get();
+        executor = std::make_unique<KRExecutor>(std::move(backend));
+    }
+    KRThreadPoolBackend *pool;  // 由 executor 持有
+    std::unique_ptr<KRExecutor> executor;
+};
+
+static void SleepMs(int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// ---------------------------------------------------------------------------
+// A. 顺序
+// ---------------------------------------------------------------------------
+static void TestOrdering() {
+    printf("\n--- A. 顺序 ---\n");
+    TestExecutor env(4);
+
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 5000;
+    {
+        KRDispatchQueue serial("stress.serial", QueueType::Serial, QoS::Default, 4, env.executor.get());
+        std::vector<int> last(kProducers, -1);  // 只在串行队列的任务中访问
+        std::atomic<int> running{0};
+        std::atomic<bool> overlapped{false};
+        std::atomic<bool> out_of_order{false};
+        std::atomic<int> executed{0};
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p) {
+            producers.emplace_back([&, p] {
+                for (int seq = 0; seq < kPerProducer; ++seq) {
+                    serial.Async([&, p, seq] {
+                        if (running.fetch_add(1) != 0) {
+                            overlapped = true;
+                        }
+                        if (last[p] != seq - 1) {
+                            out_of_order = true;
+                        }
+                        last[p] = seq;
+                        executed++;
+                        running.fetch_sub(1);
+                    });
+                }
+            });
+        }
+        for (auto &t : producers) {
+            t.join();
+        }
+        serial.Drain();
+        auto stats = serial.GetStats();
+        CHECK("A", executed.load() == kProducers * kPerProducer);
+        CHECK("A", !out_of_order.load());
+        CHECK("A", !overlapped.load());
+        CHECK("A", stats.max_running == 1);
+        CHECK("A", stats.submitted == stats.executed);
+    }
+
+    {
+        constexpr int kConcurrency = 3;
+        KRDispatchQueue concurrent("stress.concurrent", QueueType::Concurrent, QoS::Default, kConcurrency,
+                                   env.executor.get());
+        std::atomic<int> running{0};
+        std::atomic<int> peak{0};
+        for (int i = 0; i < 200; ++i) {
+            concurrent.Async([&] {
+                int now = running.fetch_add(1) + 1;
+                int prev = peak.load();
+                while (now > prev && !peak.compare_exchange_weak(prev, now)) {
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                running.fetch_sub(1);
+            });
+        }
+        concurrent.Drain();
+        printf("concurrent peak=%d (limit %d)\n", peak.load(), kConcurrency);
+        CHECK("A", peak.load() <= kConcurrency);
+        CHECK("A", concurrent.GetStats().max_running <= static_cast<size_t>(kConcurrency));
+        CHECK("A", concurrent.GetStats().executed == 200);
+    }
+
+    {
+        KRDispatchQueue serial("stress.delayed", QueueType::Serial, QoS::Default, 4, env.executor.get());
+        std::mutex mutex;
+        std::vector<int> order;
+        for (int delay : {60, 20, 40, 0}) {
+            serial.AsyncAfter(delay, [&, delay] {
+                std::lock_guard<std::mutex> lock(mutex);
+                order.push_back(delay);
+            });
+        }
+        SleepMs(200);
+        serial.Drain();
+        std::lock_guard<std::mutex> lock(mutex);
+        CHECK("A", (order == std::vector<int>{0, 20, 40, 60}));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// B. 取消
+// ---------------------------------------------------------------------------
+static void TestCancel() {
+    printf("\n--- B. 取消 ---\n");
+    TestExecutor env(2);
+    KRDispatchQueue serial("stress.cancel", QueueType::Serial, QoS::Default, 4, env.executor.get());
+
+    Gate gate;
+    auto gate_id = serial.Async([&] { gate.Wait(); });
+    gate.WaitEntered();
+
+    constexpr int kTasks = 100;
+    std::mutex mutex;
+    std::vector<int> ran;
+    std::vector<KRDispatchTaskId> ids;
+    for (int i = 0; i < kTasks; ++i) {
+        ids.push_back(serial.Async([&, i] {
+            std::lock_guard<std::mutex> lock(mutex);
+            ran.push_back(i);
+        }));
+    }
+    bool cancel_ok = true;
+    for (int i = 0; i < kTasks; i += 2) {
+        cancel_ok = serial.Cancel(ids[i]) && cancel_ok;
+    }
+    CHECK("B", cancel_ok);
+    CHECK("B", !serial.Cancel(gate_id));  // 正在执行
+    CHECK("B", !serial.Cancel(ids[0]));   // 重复取消
+    gate.Open();
+    serial.Drain();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        bool only_odd = ran.size() == kTasks / 2;
+        for (size_t k = 0; k < ran.size() && only_odd; ++k) {
+            only_odd = ran[k] == static_cast<int>(2 * k + 1);
+        }
+        CHECK("B", only_odd);
+    }
+    CHECK("B", !serial.Cancel(ids[1]));  // 已执行
+    CHECK("B", !serial.Cancel(0));
+    CHECK("B", !serial.Cancel(1u << 30));
+
+    // 取消在返回前释放闭包
+    auto token = std::make_shared<int>(0);
+    Gate gate2;
+    serial.Async([&] { gate2.Wait(); });
+    gate2.WaitEntered();
+    auto pending_id = serial.Async([token] {});
+    CHECK("B", token.use_count() == 2);
+    CHECK("B", serial.Cancel(pending_id));
+    CHECK("B", token.use_count() == 1);
+    gate2.Open();
+
+    // 延时任务取消
+    std::atomic<bool> delayed_ran{false};
+    auto delayed_id = serial.AsyncAfter(80, [&delayed_ran, token] { delayed_ran = true; });
+    CHECK("B", token.use_count() == 2);
+    CHECK("B", serial.Cancel(delayed_id));
+    CHECK("B", token.use_count() == 1);
+    SleepMs(150);
+    serial.Drain();
+    CHECK("B", !delayed_ran.load());
+
+    auto stats = serial.GetStats();
+    CHECK("B", stats.cancelled == kTasks / 2 + 2);
+    CHECK("B", stats.submitted == stats.executed + stats.cancelled);
+
+    // Shutdown 取消未到期的延时任务
+    {
+        KRDispatchQueue queue("stress.cancel.shutdown", QueueType::Serial, QoS::Default, 4, env.executor.get());
+        std::atomic<bool> ran_late{false};
+        queue.AsyncAfter(10000, [&ran_late, token] { ran_late = true; });
+        CHECK("B", token.use_count() == 2);
+        auto begin = std::chrono::steady_clock::now();
+        queue.Shutdown(false);
+        auto elapsed = std::chrono::steady_clock::now() - begin;
+        CHECK("B", elapsed < std::chrono::seconds(1));
+        CHECK("B", token.use_count() == 1);
+        CHECK("B", queue.Async([] {}) == 0);
+        CHECK("B", queue.AsyncAfter(10, [] {}) == 0);
+        CHECK("B", queue.GetStats().rejected == 2);
+        CHECK("B", !ran_late.load());
+    }
+}
+
+// ---------------------------------------------------------------------------
+// C. 持续提交时关闭
+// ---------------------------------------------------------------------------
+static void TestShutdownUnderLoad(int producer_count, int load_ms) {
+    printf("\n--- C. 关闭 ---\n");
+    TestExecutor env(4);
+    std::vector<std::unique_ptr<KRDispatchQueue>> queues;
+    queues.push_back(std::make_unique<KRDispatchQueue>("stress.load.s0", QueueType::Serial, QoS::Utility, 4,
+                                                       env.executor.get()));
+    queues.push_back(std::make_unique<KRDispatchQueue>("stress.load.s1", QueueType::Serial, QoS::Background, 4,
+                                                       env.executor.get()));
+    queues.push_back(std::make_unique<KRDispatchQueue>("stress.load.c0", QueueType::Concurrent,
+                                                       QoS::UserInitiated, 3, env.executor.get()));
+    queues.push_back(std::make_unique<KRDispatchQueue>("stress.load.c1", QueueType::Concurrent, QoS::Default, 2,
+                                                       env.executor.get()));
+    std::vector<KRDispatchQueue *> targets;
+    for (auto &queue : queues) {
+        targets.push_back(queue.get());
+    }
+    targets.push_back(&env.executor->Global(QoS::Utility));
+
+    std::atomic<uint64_t> accepted{0};
+    std::atomic<uint64_t> rejected{0};
+    std::atomic<uint64_t> executed{0};
+    std::atomic<uint64_t> accepted_after_shutdown{0};
+    std::atomic<bool> shutdown_returned{false};
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producer_count; ++p) {
+        producers.emplace_back([&, p] {
+            std::mt19937 rng(p * 7919 + 1);
+            while (!stop.load()) {
+                auto *queue = targets[rng() % targets.size()];
+                bool after = shutdown_returned.load();
+                KRDispatchTaskId id;
+                if (rng() % 8 == 0) {
+                    id = queue->AsyncAfter(rng() % 5, [&] { executed++; });
+                } else {
+                    id = queue->Async([&] {
+                        volatile int sink = 0;
+                        for (int i = 0; i < 200; ++i) {
+                            sink = sink + i;
+                        }
+                        executed++;
+                    });
+                }
+                if (id == 0) {
+                    rejected++;
+                } else {
+                    accepted++;
+                    if (after) {
+                        accepted_after_shutdown++;
+                    }
+                }
+            }
+        });
+    }
+
+    SleepMs(load_ms);
+    bool drained = env.executor->Shutdown(std::chrono::milliseconds(5000));
+    uint64_t executed_at_return = executed.load();
+    shutdown_returned = true;
+    SleepMs(50);  // 生产者继续提交, 应全部被拒绝
+    stop = true;
+    for (auto &t : producers) {
+        t.join();
+    }
+    SleepMs(50);  // 若有漏网的延时任务, 此时已经执行
+
+    uint64_t cancelled = 0;
+    uint64_t queue_executed = 0;
+    uint64_t queue_rejected = 0;
+    for (auto *queue : targets) {
+        auto stats = queue->GetStats();
+        cancelled += stats.cancelled;
+        queue_executed += stats.executed;
+        queue_rejected += stats.rejected;
+        CHECK("C", queue->IsShutdown());
+    }
+    printf("accepted=%llu executed=%llu cancelled=%llu rejected=%llu drained=%d\n",
+           static_cast<unsigned long long>(accepted.load()), static_cast<unsigned long long>(executed.load()),
+           static_cast<unsigned long long>(cancelled), static_cast<unsigned long long>(rejected.load()), drained);
+
+    CHECK("C", env.executor->IsShutdown());
+    CHECK("C", accepted.load() > 0);
+    CHECK("C", rejected.load() > 0);
+    CHECK("C", accepted_after_shutdown.load() == 0);
+    CHECK("C", executed.load() == executed_at_return);
+    CHECK("C", executed.load() == queue_executed);
+    CHECK("C", accepted.load() == queue_executed + cancelled);
+    CHECK("C", rejected.load() == queue_rejected);
+    CHECK("C", env.pool->GetStats().peak_running <= 4);
+
+    // 执行器关闭后新建的队列直接处于关闭状态
+    KRDispatchQueue late("stress.load.late", QueueType::Serial, QoS::Default, 4, env.executor.get());
+    CHECK("C", late.IsShutdown());
+    CHECK("C", late.Async([] {}) == 0);
+
+    // 超时关闭: 丢弃剩余任务
+    TestExecutor slow_env(1);
+    KRDispatchQueue slow("stress.load.slow", QueueType::Serial, QoS::Default, 4, slow_env.executor.get());
+    std::atomic<int> slow_executed{0};
+    for (int i = 0; i < 1000; ++i) {
+        slow.Async([&] {
+            SleepMs(1);
+            slow_executed++;
+        });
+    }
+    auto begin = std::chrono::steady_clock::now();
+    bool slow_drained = slow_env.executor->Shutdown(std::chrono::milliseconds(20));
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+    int executed_after = slow_executed.load();
+    SleepMs(20);
+    auto slow_stats = slow.GetStats();
+    printf("timeout shutdown: executed=%d cancelled=%llu elapsed=%lldms\n", executed_after,
+           static_cast<unsigned long long>(slow_stats.cancelled),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()));
+    CHECK("C", !slow_drained);
+    CHECK("C", elapsed < std::chrono::milliseconds(500));
+    CHECK("C", slow_executed.load() == executed_after);
+    CHECK("C", slow_stats.executed + slow_stats.cancelled == 1000);
+    CHECK("C", slow_stats.cancelled > 0);
+}
+
+// ---------------------------------------------------------------------------
+// D. 线程上限 / QoS / 异常
+// ---------------------------------------------------------------------------
+static void TestThreadCapAndQoS() {
+    printf("\n--- D. 线程上限 ---\n");
+    {
+        constexpr size_t kCap = 3;
+        TestExecutor env(kCap);
+        std::vector<std::unique_ptr<KRDispatchQueue>> queues;
+        std::atomic<int> executed{0};
+        for (int q = 0; q < 20; ++q) {
+            queues.push_back(std::make_unique<KRDispatchQueue>("stress.cap." + std::to_string(q),
+                                                               QueueType::Concurrent, QoS::Default, 4,
+                                                               env.executor.get()));
+        }
+        for (int i = 0; i < 50; ++i) {
+            for (auto &queue : queues) {
+                queue->Async([&] {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                    executed++;
+                });
+            }
+        }
+        for (auto &queue : queues) {
+            queue->Drain();
+        }
+        auto stats = env.pool->GetStats();
+        printf("threads=%zu peak_running=%zu jobs=%llu\n", stats.thread_count, stats.peak_running,
+               static_cast<unsigned long long>(stats.executed));
+        CHECK("D", executed.load() == 20 * 50);
+        CHECK("D", stats.thread_count <= kCap);
+        CHECK("D", stats.peak_running <= kCap);
+        CHECK("D", stats.thread_count >= 1);
+    }
+
+    {
+        // 单线程后端: 闸门打开后先执行 UserInteractive 队列, 再执行 Background 队列
+        TestExecutor env(1);
+        KRDispatchQueue gate_queue("stress.qos.gate", QueueType::Serial, QoS::Default, 4, env.executor.get());
+        KRDispatchQueue background("stress.qos.bg", QueueType::Serial, QoS::Background, 4, env.executor.get());
+        KRDispatchQueue interactive("stress.qos.ui", QueueType::Serial, QoS::UserInteractive, 4,
+                                    env.executor.get());
+        Gate gate;
+        gate_queue.Async([&] { gate.Wait(); });
+        gate.WaitEntered();
+        std::mutex mutex;
+        std::string order;
+        for (int i = 0; i < 5; ++i) {
+            background.Async([&] {
+                std::lock_guard<std::mutex> lock(mutex);
+                order.push_back('b');
+            });
+        }
+        for (int i = 0; i < 5; ++i) {
+            interactive.Async([&] {
+                std::lock_guard<std::mutex> lock(mutex);
+                order.push_back('i');
+            });
+        }
+        gate.Open();
+        background.Drain();
+        interactive.Drain();
+        std::lock_guard<std::mutex> lock(mutex);
+        printf("qos order=%s\n", order.c_str());
+        CHECK("D", order == "iiiiibbbbb");
+        CHECK("D", env.pool->GetStats().thread_count == 1);
+    }
+
+    {
+        TestExecutor env(2);
+        CHECK("D", &env.executor->Global(QoS::Inherit) == &env.executor->Global(QoS::Default));
+        CHECK("D", &env.executor->Global(QoS::Background) != &env.executor->Global(QoS::UserInteractive));
+        auto &queue = env.executor->Global(QoS::Utility);
+        std::atomic<int> after{0};
+        queue.Async([] { throw std::runtime_error("expected test exception"); });
+        queue.Async([] { throw 42; });
+        queue.Async([&] { after++; });
+        queue.Drain();
+        CHECK("D", after.load() == 1);
+        CHECK("D", queue.GetStats().executed == 3);
+        CHECK("D", env.executor->Shutdown(std::chrono::milliseconds(1000)));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// E. QoS 名额
+// ---------------------------------------------------------------------------
+static void TestQoSReservation() {
+    printf("\n--- E. QoS 名额 ---\n");
+    kuikly::dispatch::KRQoSSlots slots(4);
+    CHECK("E", slots.Limit(0) == 2 && slots.Limit(1) == 3 && slots.Limit(2) == 3 && slots.Limit(3) == 4);
+    CHECK("E", kuikly::dispatch::KRQoSSlots(1).Limit(0) == 1);
+
+    constexpr size_t kCap = 4;
+    TestExecutor env(kCap);
+    KRDispatchQueue io("stress.qos.io", QueueType::Concurrent, QoS::Background, 8, env.executor.get());
+    KRDispatchQueue decode("stress.qos.decode", QueueType::Concurrent, QoS::Utility, 8, env.executor.get());
+    KRDispatchQueue layout("stress.qos.layout", QueueType::Serial, QoS::UserInitiated, 4, env.executor.get());
+    Gate io_gate;
+    std::atomic<int> io_running{0};
+    std::atomic<int> io_peak{0};
+    for (int i = 0; i < 8; ++i) {
+        io.Async([&] {
+            auto running = ++io_running;
+            int peak = io_peak.load();
+            while (running > peak && !io_peak.compare_exchange_weak(peak, running)) {
+            }
+            io_gate.Wait();
+            io_running--;
+        });
+    }
+    io_gate.WaitEntered();
+    SleepMs(20);
+
+    // 阻塞的 Background 作业不能占满名额, 解码与排版照常执行
+    Gate decode_gate;
+    std::atomic<int> decoded{0};
+    decode.Async([&] {
+        decode_gate.Wait();
+        decoded++;
+    });
+    decode_gate.WaitEntered();
+    std::atomic<bool> laid_out{false};
+    layout.Async([&] { laid_out = true; });
+    auto start = std::chrono::steady_clock::now();
+    while (!laid_out && std::chrono::steady_clock::now() - start < std::chrono::seconds(2)) {
+        SleepMs(1);
+    }
+    CHECK("E", laid_out.load());
+    CHECK("E", io_peak.load() == 2);
+    decode_gate.Open();
+    io_gate.Open();
+    io.Drain();
+    decode.Drain();
+    layout.Drain();
+    CHECK("E", decoded.load() == 1);
+    CHECK("E", env.pool->GetStats().peak_running <= kCap);
+    CHECK("E", env.executor->Shutdown(std::chrono::milliseconds(1000)));
+}
+
+int main(int argc, char **argv) {
+    int producer_count = argc > 1 ? atoi(argv[1]) : 8;
+    int load_ms = argc > 2 ? atoi(argv[2]) : 100;
+
+    TestOrdering();
+    TestCancel();
+    TestShutdownUnderLoad(producer_count, load_ms);
+    TestThreadCapAndQoS();
+    TestQoSReservation();
+
+    if (g_fail == 0) {
+        printf("\n>>> ALL PASS <<<\n");
+        return 0;
+    }
+    printf("\n>>> %d FAILED <<<\n", g_fail);
+    exit(1);
+}
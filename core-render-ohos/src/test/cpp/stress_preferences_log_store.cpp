@@ -0,0 +1,641 @@
+// 压测 + 基准: stress_preferences_log_store
+//
+// 目标:
+//   验证 KRPreferencesLogStore (DataPreferences 的追加写存储) 的崩溃一致性与写入开销:
+//   1) 日志在任意字节处被截断 (断电时写到一半) 后重新打开, 状态恰好等于最后一条完整记录之后的状态;
+//   2) 截断处后面残留随机内容时同样能识别并丢弃, 之后的追加写不受影响;
+//   3) 与旧实现 (每次 Flush 整文件重写 XML) 对比 100 / 1k / 10k 个键时单次修改的落盘耗时。
+//
+// 说明:
+//   直接编译生产实现 KRPreferencesLogStore.cpp / KRPreferences.cpp, 以及其依赖的 KRPixelKernels.cpp (crc32)、
+//   KRExecutor.cpp / KRDispatchQueue.cpp (后台提交)
+//   和 thirdparty/tinyXml (旧格式迁移与基线)。所有文件写在 mkdtemp 创建的临时目录中。
+//   基线 legacy 复刻旧 DataPreferences::FlushSync: 拷贝整张表, tinyxml2 生成 XML, fopen("w") 整文件重写。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp stress_preferences_log_store.cpp
+//       ../../main/cpp/libohos_render/expand/modules/preferences/KRPreferencesLogStore.cpp
+//       ../../main/cpp/libohos_render/expand/modules/preferences/KRPreferences.cpp
+//       ../../main/cpp/libohos_render/utils/KRPixelKernels.cpp
+//       ../../main/cpp/libohos_render/foundation/thread/KRExecutor.cpp
+//       ../../main/cpp/libohos_render/foundation/thread/KRDispatchQueue.cpp
+//       ../../main/cpp/thirdparty/tinyXml/tinyxml2.cpp -o stress_preferences_log_store
+//   运行:
+//   ./stress_preferences_log_store
+//
+// 验证项:
+//   A. 基本语义  : 读写/覆盖/删除/重新打开一致; 排队中的多次 Flush 合并为一次提交;
+//                  文件已被另一个 store 加锁 (含压缩换文件后) 或映射失败时 Open 返回 false, 只在内存中读写, 已有文件不变
+//   B. 崩溃一致性: 逐字节截断、截断后追加随机垃圾两种情况下回放结果都等于最长完整前缀; 恢复后继续写入再打开仍正确
+//   C. 压缩      : 反复覆盖触发自动压缩, 日志回落且内容不变, 不残留临时文件
+//   D. 并发 + 迁移: 4 线程并发写 + 后台提交后内容完整; 旧 XML 文件迁移一次后改名, 再次打开只读新日志
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "libohos_render/expand/modules/preferences/KRPreferences.h"
+#include "libohos_render/expand/modules/preferences/KRPreferencesLogStore.h"
+#include "thirdparty/tinyXml/tinyxml2.h"
+
+using kuikly::util::DataPreferences;
+using kuikly::util::KRPreferencesLogStore;
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+static std::string g_dir;
+
+using State = std::map<std::string, std::string>;
+
+// 单线程串行 I/O 队列, 模拟后台提交线程
+class SerialQueue {
+ public:
+    SerialQueue() : thread_([this] { Run(); }) {}
+    ~SerialQueue() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_one();
+        thread_.join();
+    }
+    void Dispatch(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+            dispatched_++;
+        }
+        cv_.notify_one();
+    }
+    int Dispatched() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dispatched_;
+    }
+    void SetTaskDelayMs(int delay_ms) {
+        delay_ms_ = delay_ms;
+    }
+
+ private:
+    void Run() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            if (delay_ms_ > 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms_));
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stop_ = false;
+    int dispatched_ = 0;
+    std::atomic<int> delay_ms_{0};
+    std::thread thread_;
+};
+
+static State ReadState(KRPreferencesLogStore &store, const std::vector<std::string> &keys) {
+    State state;
+    for (const auto &key : keys) {
+        std::string value;
+        if (store.Get(key, &value)) {
+            state[key] = value;
+        }
+    }
+    return state;
+}
+
+static std::vector<uint8_t> ReadFileBytes(const std::string &path) {
+    std::vector<uint8_t> bytes;
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (fp == nullptr) {
+        return bytes;
+    }
+    uint8_t buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+        bytes.insert(bytes.end(), buffer, buffer + n);
+    }
+    fclose(fp);
+    return bytes;
+}
+
+static void WriteFileBytes(const std::string &path, const uint8_t *data, size_t size) {
+    FILE *fp = fopen(path.c_str(), "wb");
+    if (size > 0) {
+        fwrite(data, 1, size, fp);
+    }
+    fclose(fp);
+}
+
+static bool FileExists(const std::string &path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0;
+}
+
+// ---------------------------------------------------------------------------
+// A. 基本语义
+// ---------------------------------------------------------------------------
+static void TestBasic() {
+    printf("\n=== A. 基本语义 ===\n");
+    auto path = g_dir + "/basic.krkv";
+    {
+        KRPreferencesLogStore store(path, nullptr);
+        CHECK("A", store.Open());
+        store.Put("name", "kuikly");
+        store.Put("count", "1");
+        store.Put("count", "2");
+        store.Put("empty", "");
+        store.Put("gone", "x");
+        store.Remove("gone");
+        CHECK("A", store.FlushSync());
+    }
+    {
+        KRPreferencesLogStore store(path, nullptr);
+        CHECK("A", store.Open());
+        auto state = ReadState(store, {"name", "count", "empty", "gone"});
+        CHECK("A", (state == State{{"name", "kuikly"}, {"count", "2"}, {"empty", ""}}));
+        CHECK("A", store.GetStats().recovered_records == 6);
+        CHECK("A", !store.GetStats().tail_discarded);
+        // 值不变的 Put 不产生记录
+        store.Put("name", "kuikly");
+        CHECK("A", store.FlushSync());
+        CHECK("A", store.GetStats().committed_records == 0);
+    }
+
+    // 排队中的提交合并 (group commit)
+    SerialQueue queue;
+    queue.SetTaskDelayMs(20);
+    {
+        KRPreferencesLogStore store(g_dir + "/group.krkv", [&queue](std::function<void()> task) {
+            queue.Dispatch(std::move(task));
+        });
+        CHECK("A", store.Open());
+        for (int i = 0; i < 200; ++i) {
+            store.Put("key" + std::to_string(i % 10), std::to_string(i));
+            store.Flush();
+        }
+        // 析构等待排队中的提交
+    }
+    printf("  200 x (Put + Flush) -> %d commit tasks\n", queue.Dispatched());
+    CHECK("A", queue.Dispatched() < 20);
+    KRPreferencesLogStore reopened(g_dir + "/group.krkv", nullptr);
+    CHECK("A", reopened.Open());
+    std::string value;
+    CHECK("A", reopened.Get("key9", &value) && value == "199");
+    CHECK("A", reopened.Size() == 10);
+}
+
+static bool SanitizerBuild() {
+#if defined(__SANITIZE_THREAD__) || defined(__SANITIZE_ADDRESS__)
+    return true;
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer) || __has_feature(address_sanitizer)
+    return true;
+#else
+    return false;
+#endif
+#else
+    return false;
+#endif
+}
+
+// 当前进程虚拟地址空间大小 (字节), 取不到时返回 0
+static size_t CurrentVmSize() {
+    FILE *fp = fopen("/proc/self/status", "r");
+    if (fp == nullptr) {
+        return 0;
+    }
+    char line[256];
+    size_t kb = 0;
+    while (fgets(line, sizeof(line), fp) != nullptr) {
+        if (strncmp(line, "VmSize:", 7) == 0) {
+            kb = strtoull(line + 7, nullptr, 10);
+            break;
+        }
+    }
+    fclose(fp);
+    return kb * 1024;
+}
+
+static void TestOpenFailures() {
+    // 同一文件只允许一个 store 写入, 后打开的只在内存中读写
+    auto path = g_dir + "/locked.krkv";
+    {
+        KRPreferencesLogStore owner(path, nullptr);
+        CHECK("A", owner.Open());
+        owner.Put("owner", "1");
+        CHECK("A", owner.FlushSync());
+        {
+            KRPreferencesLogStore other(path, nullptr);
+            CHECK("A", !other.Open());
+            other.Put("other", "2");
+            std::string value;
+            CHECK("A", other.Get("other", &value) && value == "2");
+            CHECK("A", !other.FlushSync());
+        }
+        // 压缩用新文件替换日志后锁仍然有效
+        owner.Put("owner", "3");
+        CHECK("A", owner.Compact());
+        KRPreferencesLogStore after_compact(path, nullptr);
+        CHECK("A", !after_compact.Open());
+    }
+    {
+        KRPreferencesLogStore reopened(path, nullptr);
+        CHECK("A", reopened.Open());
+        auto state = ReadState(reopened, {"owner", "other"});
+        CHECK("A", (state == State{{"owner", "3"}}));
+    }
+
+    // 映射失败 (地址空间不足) 不能清空已有日志
+#if defined(__linux__)
+    size_t vm_size = CurrentVmSize();
+    if (SanitizerBuild() || vm_size == 0) {
+        printf("  skip mmap failure case (sanitizer build or no /proc)\n");
+        return;
+    }
+    auto big_path = g_dir + "/map_fail.krkv";
+    {
+        KRPreferencesLogStore store(big_path, nullptr);
+        CHECK("A", store.Open());
+        store.Put("keep", "me");
+        CHECK("A", store.FlushSync());
+    }
+    // 稀疏扩展到 1GB, 回放时需要映射整个文件
+    constexpr off_t kBigSize = 1024LL * 1024 * 1024;
+    CHECK("A", truncate(big_path.c_str(), kBigSize) == 0);
+    auto before = ReadFileBytes(big_path);
+    struct rlimit old_limit;
+    getrlimit(RLIMIT_AS, &old_limit);
+    struct rlimit limit = old_limit;
+    limit.rlim_cur = vm_size + 256 * 1024 * 1024;
+    bool opened = true;
+    if (setrlimit(RLIMIT_AS, &limit) == 0) {
+        KRPreferencesLogStore store(big_path, nullptr);
+        opened = store.Open();
+        store.Put("memory", "only");
+        std::string value;
+        CHECK("A", store.Get("memory", &value) && value == "only");
+        setrlimit(RLIMIT_AS, &old_limit);
+    }
+    CHECK("A", !opened);
+    struct stat st;
+    CHECK("A", stat(big_path.c_str(), &st) == 0 && st.st_size == kBigSize);
+    CHECK("A", ReadFileBytes(big_path) == before);
+    before.clear();
+    before.shrink_to_fit();
+    KRPreferencesLogStore store(big_path, nullptr);
+    CHECK("A", store.Open());
+    std::string value;
+    CHECK("A", store.Get("keep", &value) && value == "me" && !store.Get("memory", &value));
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// B. 崩溃一致性
+// ---------------------------------------------------------------------------
+static void TestCrashConsistency() {
+    printf("\n=== B. 崩溃一致性 ===\n");
+    auto path = g_dir + "/crash.krkv";
+    std::mt19937 rng(7);
+    std::vector<std::string> keys;
+    for (int i = 0; i < 12; ++i) {
+        keys.push_back("k" + std::to_string(i));
+    }
+    keys.push_back("after");
+
+    // 逐条提交, 记录每条记录结束时的日志长度与当时的状态
+    std::vector<size_t> boundaries;
+    std::vector<State> states;
+    {
+        KRPreferencesLogStore store(path, nullptr);
+        store.Open();
+        State state;
+        boundaries.push_back(KRPreferencesLogStore::kHeaderSize);
+        states.push_back(state);
+        for (int op = 0; op < 60; ++op) {
+            auto &key = keys[rng() % 12];
+            if (op % 7 == 6 && state.count(key)) {
+                store.Remove(key);
+                state.erase(key);
+            } else {
+                std::string value(rng() % 40, static_cast<char>('a' + op % 26));
+                if (state.count(key) && state[key] == value) {
+                    value += "!";
+                }
+                store.Put(key, value);
+                state[key] = value;
+            }
+            store.FlushSync();
+            boundaries.push_back(store.GetStats().log_bytes);
+            states.push_back(state);
+        }
+    }
+    auto full = ReadFileBytes(path);
+    size_t log_size = boundaries.back();
+    printf("  %zu records, %zu log bytes, file %zu bytes\n", boundaries.size() - 1, log_size, full.size());
+
+    auto expected_for = [&](size_t cut) -> State {
+        State expected;
+        for (size_t i = 0; i < boundaries.size(); ++i) {
+            if (boundaries[i] <= cut) {
+                expected = states[i];
+            }
+        }
+        return expected;
+    };
+
+    int truncate_mismatch = 0;
+    int garbage_mismatch = 0;
+    int resume_mismatch = 0;
+    int tail_flag_mismatch = 0;
+    for (size_t cut = 0; cut <= log_size; ++cut) {
+        // 1) 截断
+        WriteFileBytes(path, full.data(), cut);
+        {
+            KRPreferencesLogStore store(path, nullptr);
+            store.Open();
+            if (ReadState(store, keys) != expected_for(cut)) {
+                truncate_mismatch++;
+            }
+            // 恢复后继续写入
+            store.Put("after", std::to_string(cut));
+            store.FlushSync();
+        }
+        {
+            KRPreferencesLogStore store(path, nullptr);
+            store.Open();
+            auto expected = expected_for(cut);
+            expected["after"] = std::to_string(cut);
+            if (ReadState(store, keys) != expected) {
+                resume_mismatch++;
+            }
+        }
+        // 2) 截断后残留随机内容 (写了一半的下一条记录)
+        std::vector<uint8_t> torn(full.begin(), full.begin() + cut);
+        size_t garbage = 1 + rng() % 32;
+        for (size_t i = 0; i < garbage; ++i) {
+            torn.push_back(static_cast<uint8_t>(rng()));
+        }
+        WriteFileBytes(path, torn.data(), torn.size());
+        {
+            KRPreferencesLogStore store(path, nullptr);
+            store.Open();
+            if (cut >= KRPreferencesLogStore::kHeaderSize && ReadState(store, keys) != expected_for(cut)) {
+                garbage_mismatch++;
+            }
+            bool dirty_tail = false;
+            for (size_t i = cut; i < torn.size(); ++i) {
+                dirty_tail = dirty_tail || torn[i] != 0;
+            }
+            if (cut >= KRPreferencesLogStore::kHeaderSize && dirty_tail && !store.GetStats().tail_discarded) {
+                tail_flag_mismatch++;
+            }
+        }
+    }
+    printf("  %zu cut points checked\n", log_size + 1);
+    CHECK("B", truncate_mismatch == 0);
+    CHECK("B", resume_mismatch == 0);
+    CHECK("B", garbage_mismatch == 0);
+    CHECK("B", tail_flag_mismatch == 0);
+}
+
+// ---------------------------------------------------------------------------
+// C. 压缩
+// ---------------------------------------------------------------------------
+static void TestCompaction() {
+    printf("\n=== C. 压缩 ===\n");
+    auto path = g_dir + "/compact.krkv";
+    std::vector<std::string> keys;
+    {
+        KRPreferencesLogStore store(path, nullptr);
+        store.Open();
+        for (int i = 0; i < 5000; ++i) {
+            auto key = "key" + std::to_string(i % 20);
+            store.Put(key, std::string(200, static_cast<char>('a' + i % 26)) + std::to_string(i));
+            if (i % 10 == 9) {
+                store.FlushSync();
+            }
+        }
+        store.FlushSync();
+        auto stats = store.GetStats();
+        printf("  compactions=%llu log=%zu live=%zu\n", static_cast<unsigned long long>(stats.compaction_count),
+               stats.log_bytes, stats.live_bytes);
+        CHECK("C", stats.compaction_count > 0);
+        CHECK("C", stats.log_bytes <= KRPreferencesLogStore::kCompactMinBytes * 2);
+
+        store.Remove("key0");
+        CHECK("C", store.Compact());
+        CHECK("C", store.GetStats().log_bytes == store.GetStats().live_bytes);
+    }
+    KRPreferencesLogStore store(path, nullptr);
+    store.Open();
+    std::string value;
+    CHECK("C", store.Size() == 19);
+    CHECK("C", store.Get("key19", &value) && value == std::string(200, 'a' + 4999 % 26) + "4999");
+    CHECK("C", !FileExists(path + ".compact"));
+}
+
+// ---------------------------------------------------------------------------
+// D. 并发 + 迁移
+// ---------------------------------------------------------------------------
+static void TestConcurrencyAndMigration() {
+    printf("\n=== D. 并发 + 迁移 ===\n");
+    auto path = g_dir + "/concurrent.krkv";
+    {
+        SerialQueue queue;
+        KRPreferencesLogStore store(path, [&queue](std::function<void()> task) { queue.Dispatch(std::move(task)); });
+        store.Open();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&store, t] {
+                for (int i = 0; i < 2000; ++i) {
+                    store.Put("t" + std::to_string(t) + "_" + std::to_string(i % 100), std::to_string(i));
+                    store.Flush();
+                    if (i % 500 == 0) {
+                        store.FlushSync();
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        store.FlushSync();
+        printf("  commits=%llu records=%llu\n", static_cast<unsigned long long>(store.GetStats().commit_count),
+               static_cast<unsigned long long>(store.GetStats().committed_records));
+    }
+    KRPreferencesLogStore store(path, nullptr);
+    store.Open();
+    bool all_ok = store.Size() == 400;
+    for (int t = 0; t < 4; ++t) {
+        for (int k = 0; k < 100; ++k) {
+            std::string value;
+            all_ok = all_ok && store.Get("t" + std::to_string(t) + "_" + std::to_string(k), &value) &&
+                     value == std::to_string(1900 + k);
+        }
+    }
+    CHECK("D", all_ok);
+
+    // 旧格式 XML 迁移
+    auto xml_path = g_dir + "/KRSharedPreferencesModule";
+    {
+        tinyxml2::XMLDocument doc;
+        doc.InsertFirstChild(doc.NewDeclaration());
+        auto *root = doc.NewElement("preferences");
+        root->SetAttribute("version", "1.0");
+        doc.InsertEndChild(root);
+        for (int i = 0; i < 50; ++i) {
+            auto *element = doc.NewElement("string");
+            element->SetAttribute("key", ("legacy" + std::to_string(i)).c_str());
+            element->SetText(("value<&>" + std::to_string(i)).c_str());
+            root->InsertEndChild(element);
+        }
+        doc.SaveFile(xml_path.c_str());
+    }
+    {
+        DataPreferences preferences(g_dir, "KRSharedPreferencesModule");
+        CHECK("D", preferences.GetSync("legacy7", "") == "value<&>7");
+        CHECK("D", preferences.GetSync("missing", "default") == "default");
+        CHECK("D", !FileExists(xml_path) && FileExists(xml_path + ".migrated"));
+        preferences.SetSync("legacy7", "changed");
+        preferences.FlushSync();
+    }
+    {
+        DataPreferences preferences(g_dir, "KRSharedPreferencesModule");
+        CHECK("D", preferences.GetSync("legacy7", "") == "changed");
+        CHECK("D", preferences.GetSync("legacy49", "") == "value<&>49");
+    }
+}
+
+// ---------------------------------------------------------------------------
+// E. 基准: 单次修改 + 落盘
+// ---------------------------------------------------------------------------
+static size_t LegacyFlush(const std::string &path, const std::unordered_map<std::string, std::string> &map) {
+    tinyxml2::XMLDocument doc;
+    doc.InsertFirstChild(doc.NewDeclaration());
+    auto *root = doc.NewElement("preferences");
+    root->SetAttribute("version", "1.0");
+    doc.InsertEndChild(root);
+    auto copy_map = map;
+    for (const auto &pair : copy_map) {
+        auto *element = doc.NewElement("string");
+        element->SetAttribute("key", pair.first.c_str());
+        element->SetText(pair.second.c_str());
+        root->InsertEndChild(element);
+    }
+    FILE *fp = fopen(path.c_str(), "w");
+    doc.SaveFile(fp);
+    long size = ftell(fp);
+    fflush(fp);
+    fsync(fileno(fp));
+    fclose(fp);
+    return static_cast<size_t>(size);
+}
+
+static void Benchmark() {
+    printf("\n=== E. 基准: 修改一个键并落盘 ===\n");
+    printf("  %6s | %14s %12s | %14s %12s\n", "keys", "legacy us/op", "bytes/op", "log us/op", "bytes/op");
+    for (int key_count : {100, 1000, 10000}) {
+        std::unordered_map<std::string, std::string> legacy_map;
+        auto log_path = g_dir + "/bench_" + std::to_string(key_count) + ".krkv";
+        KRPreferencesLogStore store(log_path, nullptr);
+        store.Open();
+        for (int i = 0; i < key_count; ++i) {
+            auto key = "pref.key." + std::to_string(i);
+            auto value = "value-" + std::to_string(i * 7919);
+            legacy_map[key] = value;
+            store.Put(key, value);
+        }
+        store.FlushSync();
+
+        int iterations = key_count >= 10000 ? 50 : 200;
+        auto legacy_path = g_dir + "/bench_" + std::to_string(key_count) + ".xml";
+        size_t legacy_bytes = 0;
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            legacy_map["pref.flag"] = i % 2 ? "true" : "false";
+            legacy_bytes += LegacyFlush(legacy_path, legacy_map);
+        }
+        double legacy_us =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count() / iterations;
+
+        auto before = store.GetStats().log_bytes;
+        begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            store.Put("pref.flag", i % 2 ? "true" : "false");
+            store.FlushSync();
+        }
+        double log_us =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count() / iterations;
+        auto stats = store.GetStats();
+        // 期间发生压缩时日志长度会回落, 改用单条记录的编码长度
+        std::vector<uint8_t> record;
+        KRPreferencesLogStore::EncodeRecord(&record, KRPreferencesLogStore::kRecordPut, "pref.flag", "false");
+        size_t log_bytes = stats.compaction_count > 0 ? record.size() : (stats.log_bytes - before) / iterations;
+        printf("  %6d | %14.1f %12zu | %14.1f %12zu\n", key_count, legacy_us, legacy_bytes / iterations, log_us,
+               log_bytes);
+        CHECK("E", log_bytes * 100 < legacy_bytes / iterations);
+    }
+}
+
+int main() {
+    char dir_template[] = "/tmp/kr_prefs_XXXXXX";
+    if (mkdtemp(dir_template) == nullptr) {
+        printf("mkdtemp failed\n");
+        return 1;
+    }
+    g_dir = dir_template;
+    TestBasic();
+    TestOpenFailures();
+    TestCrashConsistency();
+    TestCompaction();
+    TestConcurrencyAndMigration();
+    Benchmark();
+    std::string cleanup = "rm -rf " + g_dir;
+    if (system(cleanup.c_str()) != 0) {
+        printf("cleanup %s failed\n", g_dir.c_str());
+    }
+
+    if (g_fail == 0) {
+        printf("\n>>> ALL PASS <<<\n");
+        return 0;
+    }
+    printf("\n>>> %d FAILED <<<\n", g_fail);
+    exit(1);
+}
@@ -0,0 +1,430 @@
+// 压测: stress_thread_baton
+//
+// 目标:
+//   验证 KRThread 改用 KRThreadBaton 后 DirectRunOnCurThread 与工作线程之间的执行权交接,
+//   并对比旧实现 (TaskMutex/SyncMainTaskMutex 忙轮询最多 100ms) 在主线程上消耗的 CPU 时间。
+//
+// 说明:
+//   KRThread.h 依赖 hilog 日志, 无法在主机上编译; 其任务队列、工作线程循环与执行权交接都在只依赖标准库的
+//   KRBatonTaskRunner.h 中, 这里直接包含生产实现, 替身只保留 KRThread 自身的线程创建与获取失败转异步两行;
+//   旧实现按原代码复刻。"主线程" 用一个服务线程模拟, 工作线程可同步等待它执行任务。
+//
+// 编译(macOS/Linux 均可):
+//   clang++ -std=c++17 -O2 -pthread -I ../../main/cpp stress_thread_baton.cpp -o stress_baton
+//   运行:
+//   ./stress_baton              # 默认 4 个生产者, 每个 20000 个异步任务, 主线程 5000 次同步任务
+//   ./stress_baton 8 50000 10000
+//
+// 验证项:
+//   A. 任意时刻至多一个线程在执行任务 (工作线程与 DirectRun 调用方互斥)
+//   B. 所有异步/同步任务恰好执行一次, 同一生产者的异步任务保持提交顺序
+//   C. 工作线程同步等待主线程期间, 主线程 DirectRun 不等待直接转异步, 无死锁
+//   D. 重入 DirectRun 直接执行; 统计数据自洽
+//   另: 工作线程持续执行长任务时, 对比主线程同步 DirectRun 的耗时与 CPU 占用
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRBatonTaskRunner.h"
+
+static int g_fail = 0;
+#define CHECK(tag, cond)                                              \
+    do {                                                              \
+        if (cond) {                                                   \
+            printf("[PASS %s] %s\n", tag, #cond);                     \
+        } else {                                                      \
+            printf("[FAIL %s] %s (line %d)\n", tag, #cond, __LINE__); \
+            g_fail++;                                                 \
+        }                                                             \
+    } while (0)
+
+static double ThreadCpuMs() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+// 等待全部任务完成超时: 仍有任务持有栈上变量的引用, 不能离开作用域, 直接失败退出
+static void AbortOnTimeout(const char *tag) {
+    printf("[FAIL %s] tasks did not finish before deadline\n", tag);
+    printf(">>> %d FAILED <<<\n", g_fail + 1);
+    fflush(stdout);
+    std::_Exit(1);
+}
+
+// ---------------------------------------------------------------------------
+// KRThread 替身 (新实现): 队列/工作循环/执行权交接均为生产代码 KRBatonTaskRunner
+// ---------------------------------------------------------------------------
+class BatonThread {
+ public:
+    BatonThread() {
+        worker_ = std::thread([this] { runner_.RunLoop(); });
+    }
+    ~BatonThread() {
+        runner_.Stop();
+        worker_.join();
+    }
+    void DispatchAsync(KRTask task) {
+        runner_.Post(std::move(task));
+    }
+    void DirectRunOnCurThread(const std::function<void()> &task) {
+        // 同 KRThread::DirectRunOnCurThread
+        if (!runner_.TryRunOnCurThread(task, std::chrono::milliseconds(100))) {
+            DispatchAsync(task);
+        }
+    }
+    KRBatonTaskRunner &Runner() {
+        return runner_;
+    }
+
+ private:
+    KRBatonTaskRunner runner_;
+    std::thread worker_;
+};
+
+// ---------------------------------------------------------------------------
+// 旧实现复刻: TaskMutex 忙轮询
+// ---------------------------------------------------------------------------
+class SpinThread {
+ public:
+    SpinThread() {
+        worker_ = std::thread([this] { Worker(); });
+    }
+    ~SpinThread() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_one();
+        worker_.join();
+    }
+    void DispatchAsync(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push(std::move(task));
+        }
+        condition_.notify_one();
+    }
+    void DirectRunOnCurThread(const std::function<void()> &task) {
+        if (executing_.load()) {
+            task();
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+        bool handled = false;
+        while (!SyncMainTaskMutex(false, false, false)) {
+            if (std::chrono::steady_clock::now() - start > std::chrono::milliseconds(100)) {
+                break;
+            }
+            if (TaskMutex(true, false, false)) {
+                executing_.store(true);
+                task();
+                executing_.store(false);
+                TaskMutex(false, true, false);
+                handled = true;
+                break;
+            }
+        }
+        if (!handled) {
+            DispatchAsync(task);
+        }
+    }
+    bool TaskMutex(bool try_lock, bool is_set, bool value) {
+        std::unique_lock<std::mutex> lock(task_mutex_);
+        if (try_lock) {
+            if (locked_) {
+                return false;
+            }
+            locked_ = true;
+            return true;
+        }
+        if (is_set) {
+            locked_ = value;
+        }
+        return locked_;
+    }
+    bool SyncMainTaskMutex(bool try_lock, bool is_set, bool value) {
+        std::unique_lock<std::mutex> lock(sync_mutex_);
+        if (try_lock) {
+            if (sync_locked_) {
+                return false;
+            }
+            sync_locked_ = true;
+            return true;
+        }
+        if (is_set) {
+            sync_locked_ = value;
+        }
+        return sync_locked_;
+    }
+
+ private:
+    void Worker() {
+        while (true) {
+            std::queue<std::function<void()>> tasks;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                if (stop_ && tasks_.empty()) {
+                    break;
+                }
+                std::swap(tasks, tasks_);
+            }
+            if (TaskMutex(true, false, false)) {
+                while (!tasks.empty()) {
+                    tasks.front()();
+                    tasks.pop();
+                }
+                TaskMutex(false, true, false);
+            } else {
+                std::lock_guard<std::mutex> lock(mutex_);
+                while (!tasks.empty()) {
+                    tasks_.push(std::move(tasks.front()));
+                    tasks.pop();
+                }
+            }
+        }
+    }
+
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_ = false;
+    std::mutex task_mutex_;
+    bool locked_ = false;
+    std::mutex sync_mutex_;
+    bool sync_locked_ = false;
+    std::atomic<bool> executing_{false};
+    std::thread worker_;
+};
+
+// ---------------------------------------------------------------------------
+// "主线程": 服务工作线程同步投递的任务, 并自身发起同步 DirectRun
+// ---------------------------------------------------------------------------
+class FakeMainLoop {
+ public:
+    void Post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push(std::move(task));
+        }
+        condition_.notify_one();
+    }
+    void RunPending() {
+        std::queue<std::function<void()>> tasks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::swap(tasks, tasks_);
+        }
+        while (!tasks.empty()) {
+            tasks.front()();
+            tasks.pop();
+        }
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::queue<std::function<void()>> tasks_;
+};
+
+struct StressResult {
+    bool exclusive = true;
+    bool ordered = true;
+    bool all_ran = true;
+    double main_cpu_ms = 0;
+    double wall_ms = 0;
+};
+
+// 每个异步任务做少量计算, 每 64 个任务有一个同步等待主线程
+template <typename Thread>
+static StressResult RunStress(int producers, int tasks_per_producer, int sync_calls,
+                              void (*set_sync_pending)(Thread &, bool)) {
+    StressResult result;
+    FakeMainLoop main_loop;
+    std::atomic<int> executing{0};
+    std::atomic<bool> exclusive{true};
+    std::atomic<int> async_done{0};
+    std::atomic<int> sync_done{0};
+    std::vector<int> last_seen(producers, -1);
+    std::atomic<bool> ordered{true};
+    auto enter = [&] {
+        if (executing.fetch_add(1) != 0) {
+            exclusive = false;
+        }
+    };
+    auto leave = [&] { executing.fetch_sub(1); };
+    // 最后声明: 先于上面被任务引用的局部变量析构, 析构时执行完剩余任务并回收工作线程
+    auto thread = std::make_unique<Thread>();
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < tasks_per_producer; ++i) {
+                thread->DispatchAsync([&, p, i] {
+                    enter();
+                    if (last_seen[p] + 1 != i) {
+                        ordered = false;
+                    }
+                    last_seen[p] = i;
+                    volatile uint64_t h = i;
+                    for (int k = 0; k < 200; ++k) {
+                        h = h * 6364136223846793005ull + 1;
+                    }
+                    leave();
+                    if (i % 64 == 0) {
+                        // 同 KRContextScheduler::ScheduleTaskOnMainThread(sync=true)
+                        set_sync_pending(*thread, true);
+                        std::mutex mutex;
+                        std::condition_variable condition;
+                        bool done = false;
+                        main_loop.Post([&] {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            done = true;
+                            condition.notify_one();
+                        });
+                        std::unique_lock<std::mutex> lock(mutex);
+                        condition.wait(lock, [&] { return done; });
+                        set_sync_pending(*thread, false);
+                    }
+                    async_done++;
+                });
+                if (i % 256 == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // 主线程: 交替处理工作线程投递的同步任务与自身的同步 DirectRun
+    double cpu_start = ThreadCpuMs();
+    int total_async = producers * tasks_per_producer;
+    for (int s = 0; s < sync_calls; ++s) {
+        main_loop.RunPending();
+        thread->DirectRunOnCurThread([&] {
+            enter();
+            // 重入
+            thread->DirectRunOnCurThread([&] { sync_done++; });
+            leave();
+        });
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+    while ((async_done.load() < total_async || sync_done.load() < sync_calls) &&
+           std::chrono::steady_clock::now() < deadline) {
+        main_loop.RunPending();
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    if (async_done.load() < total_async || sync_done.load() < sync_calls) {
+        AbortOnTimeout("B");
+    }
+    result.main_cpu_ms = ThreadCpuMs() - cpu_start;
+    for (auto &t : threads) {
+        t.join();
+    }
+    thread.reset();
+    result.wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    result.exclusive = exclusive;
+    result.ordered = ordered;
+    result.all_ran = async_done.load() == total_async && sync_done.load() == sync_calls;
+    return result;
+}
+
+// 工作线程持续执行 1ms 左右的长任务, 主线程反复同步 DirectRun: 旧实现在等待期间忙轮询
+template <typename Thread>
+static void RunContended(const char *name, int rounds) {
+    std::atomic<int> done{0};
+    std::atomic<int> sync_done{0};
+    auto thread = std::make_unique<Thread>();
+    auto busy_task = [&done] {
+        auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+        while (std::chrono::steady_clock::now() < end) {
+        }
+        done++;
+    };
+    const int kWorkerTasks = rounds * 5;
+    for (int i = 0; i < kWorkerTasks; ++i) {
+        thread->DispatchAsync(busy_task);
+    }
+    double cpu_start = ThreadCpuMs();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i) {
+        thread->DirectRunOnCurThread([&sync_done] { sync_done++; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    double main_cpu_ms = ThreadCpuMs() - cpu_start;
+    double wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+    while ((done.load() < kWorkerTasks || sync_done.load() < rounds) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (done.load() < kWorkerTasks || sync_done.load() < rounds) {
+        AbortOnTimeout(name);
+    }
+    thread.reset();
+    printf("%-16s %12.1f %12.1f   (contended, %d sync calls)\n", name, wall_ms, main_cpu_ms, rounds);
+}
+
+int main(int argc, char **argv) {
+    int producers = argc > 1 ? atoi(argv[1]) : 4;
+    int tasks_per_producer = argc > 2 ? atoi(argv[2]) : 20000;
+    int sync_calls = argc > 3 ? atoi(argv[3]) : 5000;
+
+    // D. 基本语义
+    {
+        BatonThread thread;
+        bool nested = false;
+        thread.DirectRunOnCurThread([&] {
+            nested = thread.Runner().IsHeldByCurrentThread();
+            thread.DirectRunOnCurThread([&] { nested = nested && true; });
+        });
+        CHECK("D", nested);
+        CHECK("D", !thread.Runner().IsHeldByCurrentThread());
+        thread.Runner().SetSyncMainTaskPending(true);
+        bool ran = false;
+        CHECK("C", !thread.Runner().TryRunOnCurThread([&ran] { ran = true; }, std::chrono::milliseconds(100)));
+        CHECK("C", !ran);
+        thread.Runner().SetSyncMainTaskPending(false);
+        auto stats = thread.Runner().GetStats();
+        CHECK("D", stats.acquire_count == 2 && stats.immediate_count == 1 && stats.failed_count == 1);
+    }
+
+    auto baton = RunStress<BatonThread>(producers, tasks_per_producer, sync_calls,
+                                        [](BatonThread &t, bool v) { t.Runner().SetSyncMainTaskPending(v); });
+    CHECK("A", baton.exclusive);
+    CHECK("B", baton.ordered);
+    CHECK("B", baton.all_ran);
+
+    auto spin = RunStress<SpinThread>(producers, tasks_per_producer, sync_calls, [](SpinThread &t, bool v) {
+        if (v) {
+            t.SyncMainTaskMutex(true, false, false);
+        } else {
+            t.SyncMainTaskMutex(false, true, false);
+        }
+    });
+    CHECK("B", spin.all_ran);
+
+    printf("producers=%d tasks/producer=%d main sync calls=%d\n", producers, tasks_per_producer, sync_calls);
+    printf("%-16s %12s %12s\n", "impl", "wall ms", "main cpu ms");
+    printf("%-16s %12.1f %12.1f\n", "spin (legacy)", spin.wall_ms, spin.main_cpu_ms);
+    printf("%-16s %12.1f %12.1f\n", "baton", baton.wall_ms, baton.main_cpu_ms);
+    RunContended<SpinThread>("spin (legacy)", 50);
+    RunContended<BatonThread>("baton", 50);
+
+    if (g_fail) {
+        printf(">>> %d FAILED <<<\n", g_fail);
+        exit(1);
+    }
+    printf(">>> ALL PASS <<<\n");
+    return 0;
+}
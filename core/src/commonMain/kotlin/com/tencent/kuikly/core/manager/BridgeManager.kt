@@ -58,6 +58,7 @@ object BridgeManager {
     @Deprecated("使用Pager上下文的pagerId代替")
     var currentPageId : String = ""
 
+    // currentPageId及以下映射表为进程级共享状态且未加锁，只能在唯一的Context线程上访问
     private val nativeBridgeMap = fastMutableMapOf<String, NativeBridge>()
     private val callObserverMap = fastMutableMapOf<String, IBridgeCallObserver>()
 
@@ -329,6 +330,10 @@ object BridgeManager {
         callNativeMethod(NativeMethod.SET_TIMEOUT, instanceId, delayTimeMs, callbackId)
     }
 
+    fun clearTimeout(instanceId: String, callbackId: String) {
+        callNativeMethod(NativeMethod.CLEAR_TIMEOUT, instanceId, callbackId)
+    }
+
     fun callShadowMethod(
         instanceId: String,
         tag: Int,
@@ -371,4 +376,5 @@ object NativeMethod {
     const val FIRE_FATAL_EXCEPTION = 15 // "fireFatalException" 方法
     const val SYNC_FLUSH_UI = 16 // "syncFlushUI" 方法
     const val CALL_TDF_MODULE_METHOD = 17 // "callTDFModuleMethod" 方法
+    const val CLEAR_TIMEOUT = 18 // "clearTimeout" 方法
 }
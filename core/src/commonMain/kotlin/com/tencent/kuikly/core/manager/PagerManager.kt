@@ -29,6 +29,7 @@ import com.tencent.kuikly.core.utils.getParamFromUrl
 
 object PagerManager {
     private const val TAG = "PagerManager"
+    // 以下映射表为进程级共享状态且未加锁，只能在唯一的Context线程上访问
     private val pagerMap = fastHashMapOf<String, IPager>()
     private val pagerNameMap = fastHashMapOf<String, () -> IPager>()
     private val reactiveObserverMap = fastHashMapOf<String, ReactiveObserver>()
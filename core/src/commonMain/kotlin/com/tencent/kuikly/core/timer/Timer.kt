@@ -19,6 +19,7 @@ import com.tencent.kuikly.core.base.PagerScope
 import com.tencent.kuikly.core.coroutines.*
 import com.tencent.kuikly.core.global.GlobalFunctions
 import com.tencent.kuikly.core.manager.BridgeManager
+import com.tencent.kuikly.core.manager.PagerManager
 /**
  * @brief Timer等价Android的Timer类功能(定时器)。
  */
@@ -110,11 +111,28 @@ fun PagerScope.setTimeout(timeout: Int = 0, callback: () -> Unit): String {
 
 @Deprecated("Use PagerScope.clearTimeout(timeoutRef) instead")
 fun clearTimeout(timeoutRef: String) {
-    GlobalFunctions.destroyGlobalFunction(BridgeManager.currentPageId, timeoutRef)
+    clearTimeout(BridgeManager.currentPageId, timeoutRef)
 }
 
 fun PagerScope.clearTimeout(timeoutRef: String) {
     // 用currentPageId兜底，以保持向前兼容
     val pagerId = this.pagerId.ifEmpty { BridgeManager.currentPageId }
+    clearTimeout(pagerId, timeoutRef)
+}
+
+private fun clearTimeout(pagerId: String, timeoutRef: String) {
     GlobalFunctions.destroyGlobalFunction(pagerId, timeoutRef)
+    // 目前只有鸿蒙渲染层实现了取消定时器，其它平台到期后查不到callback即丢弃
+    if (isNativeClearTimeoutSupported(pagerId)) {
+        BridgeManager.clearTimeout(pagerId, timeoutRef)
+    }
+}
+
+private fun isNativeClearTimeoutSupported(pagerId: String): Boolean {
+    return try {
+        PagerManager.getPager(pagerId).pageData.isOhOs
+    } catch (e: Throwable) {
+        // 页面已销毁，Native侧的定时器随页面一起取消
+        false
+    }
 }
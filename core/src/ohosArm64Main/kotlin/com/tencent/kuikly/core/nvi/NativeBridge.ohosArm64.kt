@@ -29,6 +29,8 @@ actual open class NativeBridge actual constructor() {
 
     var callNativeCallback: CallNativeCallback? = null
     private var pagerId = ""
+    private val commandBuffer = RenderCommandBuffer()
+    private var hasPendingCommands = false
 
     actual fun toNative(
         methodId: Int,
@@ -42,10 +44,30 @@ actual open class NativeBridge actual constructor() {
         if (pagerId.isEmpty()) {
             pagerId = arg0 as String
         }
+        if (commandBuffer.append(methodId, arg1, arg2, arg3, arg4, arg5)) {
+            if (!hasPendingCommands) {
+                hasPendingCommands = true
+                RenderCommandBatcher.markPending(this)
+            }
+            if (commandBuffer.isFull) {
+                flushRenderCommands()
+            }
+            return null
+        }
+        // 保持指令顺序：逐条调用前先把已缓存的指令交给 native
+        flushRenderCommands()
         return callNativeCallback?.invoke(methodId, arg0, arg1, arg2, arg3, arg4, arg5)
     }
 
+    internal fun flushRenderCommands() {
+        hasPendingCommands = false
+        if (!commandBuffer.isEmpty) {
+            commandBuffer.flush(pagerId)
+        }
+    }
+
     actual fun destroy() {
+        flushRenderCommands()
     }
 
 }
\ No newline at end of file
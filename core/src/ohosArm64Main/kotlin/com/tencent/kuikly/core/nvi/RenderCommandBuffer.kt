@@ -0,0 +1,294 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.tencent.kuikly.core.nvi
+
+import com.tencent.kuikly.core.manager.NativeMethod
+import kotlinx.cinterop.ExperimentalForeignApi
+import kotlinx.cinterop.addressOf
+import kotlinx.cinterop.reinterpret
+import kotlinx.cinterop.usePinned
+import ohos.com_tencent_kuikly_CallNativeBatch
+
+/**
+ * 渲染指令批量编码，格式与 core-render-ohos 的 KRRenderCommandBuffer.h 一致（小端）：
+ *   header : magic(u32 'KRCB') | version(u16) | flags(u16) | op_count(u32)
+ *   op     : opcode(u8) | tag(i32) | 操作数...
+ *   string : length(u32) | utf8 bytes
+ *   value  : type(u8, 同 KRRenderCValue.Type) | payload
+ * view/shadow 的创建、删除、插入、属性及 frame 指令先写入 buffer，由 [flush] 整批交给 native，
+ * native 侧一次解码，整批 view 指令合并为一个主线程任务。
+ */
+internal class RenderCommandBuffer {
+
+    private var bytes = ByteArray(INITIAL_CAPACITY)
+    private var position = HEADER_SIZE
+    private var opCount = 0
+    private var flags = 0
+
+    val isEmpty: Boolean
+        get() = opCount == 0
+
+    val isFull: Boolean
+        get() = position >= FLUSH_THRESHOLD
+
+    /**
+     * 追加一条指令
+     * @return false 表示该指令不能批量执行（事件、非渲染指令或不支持的属性值类型），需逐条调用
+     */
+    fun append(methodId: Int, arg1: Any?, arg2: Any?, arg3: Any?, arg4: Any?, arg5: Any?): Boolean {
+        val tag = arg1 as? Int ?: return false
+        when (methodId) {
+            NativeMethod.CREATE_RENDER_VIEW, NativeMethod.CREATE_SHADOW -> {
+                val viewName = arg2 as? String ?: return false
+                beginOp(methodId, tag)
+                writeString(viewName)
+            }
+            NativeMethod.REMOVE_RENDER_VIEW, NativeMethod.REMOVE_SHADOW, NativeMethod.SET_SHADOW_FOR_VIEW -> {
+                beginOp(methodId, tag)
+            }
+            NativeMethod.INSERT_SUB_RENDER_VIEW -> {
+                val childTag = arg2 as? Int ?: return false
+                val index = arg3 as? Int ?: return false
+                beginOp(methodId, tag)
+                writeInt(childTag)
+                writeInt(index)
+            }
+            NativeMethod.SET_VIEW_PROP, NativeMethod.SET_SHADOW_PROP -> {
+                // 事件需要在 native 侧注册回调，仍逐条调用
+                if (methodId == NativeMethod.SET_VIEW_PROP && arg4 != 0) {
+                    return false
+                }
+                val key = arg2 as? String ?: return false
+                if (!isSupportedValue(arg3)) {
+                    return false
+                }
+                beginOp(methodId, tag)
+                writeString(key)
+                writeValue(arg3)
+            }
+            NativeMethod.SET_RENDER_VIEW_FRAME -> {
+                val x = arg2 as? Float ?: return false
+                val y = arg3 as? Float ?: return false
+                val width = arg4 as? Float ?: return false
+                val height = arg5 as? Float ?: return false
+                beginOp(methodId, tag)
+                writeInt(x.toRawBits())
+                writeInt(y.toRawBits())
+                writeInt(width.toRawBits())
+                writeInt(height.toRawBits())
+            }
+            else -> return false
+        }
+        if (methodId >= NativeMethod.CREATE_SHADOW) {
+            flags = flags or FLAG_HAS_SHADOW_OPS
+        }
+        return true
+    }
+
+    /**
+     * 把已编码的指令整批交给 native，native 在调用期间拷贝 buffer，返回后即可复用
+     */
+    @OptIn(ExperimentalForeignApi::class)
+    fun flush(pagerId: String) {
+        if (opCount == 0) {
+            return
+        }
+        val size = position
+        position = 0
+        writeInt(MAGIC)
+        writeShort(VERSION)
+        writeShort(flags)
+        writeInt(opCount)
+        position = HEADER_SIZE
+        opCount = 0
+        flags = 0
+        bytes.usePinned {
+            com_tencent_kuikly_CallNativeBatch(pagerId, it.addressOf(0).reinterpret(), size)
+        }
+    }
+
+    private fun isSupportedValue(value: Any?): Boolean {
+        return value == null || value is String || value is Int || value is Float || value is Double ||
+            value is Long || value is Boolean || value is ByteArray
+    }
+
+    private fun beginOp(methodId: Int, tag: Int) {
+        opCount++
+        writeByte(methodId)
+        writeInt(tag)
+    }
+
+    private fun writeValue(value: Any?) {
+        when (value) {
+            is String -> {
+                writeByte(TYPE_STRING)
+                writeString(value)
+            }
+            is Int -> {
+                writeByte(TYPE_INT)
+                writeInt(value)
+            }
+            is Float -> {
+                writeByte(TYPE_FLOAT)
+                writeInt(value.toRawBits())
+            }
+            is Double -> {
+                writeByte(TYPE_DOUBLE)
+                writeLong(value.toRawBits())
+            }
+            is Long -> {
+                writeByte(TYPE_LONG)
+                writeLong(value)
+            }
+            is Boolean -> {
+                writeByte(TYPE_BOOL)
+                writeByte(if (value) 1 else 0)
+            }
+            is ByteArray -> {
+                writeByte(TYPE_BYTES)
+                writeInt(value.size)
+                ensureCapacity(value.size)
+                value.copyInto(bytes, position)
+                position += value.size
+            }
+            else -> writeByte(TYPE_NULL)
+        }
+    }
+
+    private fun ensureCapacity(extra: Int) {
+        val required = position + extra
+        if (required <= bytes.size) {
+            return
+        }
+        var capacity = bytes.size * 2
+        while (capacity < required) {
+            capacity *= 2
+        }
+        bytes = bytes.copyOf(capacity)
+    }
+
+    private fun writeByte(value: Int) {
+        ensureCapacity(1)
+        bytes[position++] = value.toByte()
+    }
+
+    private fun writeShort(value: Int) {
+        ensureCapacity(2)
+        bytes[position++] = value.toByte()
+        bytes[position++] = (value shr 8).toByte()
+    }
+
+    private fun writeInt(value: Int) {
+        ensureCapacity(4)
+        bytes[position++] = value.toByte()
+        bytes[position++] = (value shr 8).toByte()
+        bytes[position++] = (value shr 16).toByte()
+        bytes[position++] = (value shr 24).toByte()
+    }
+
+    private fun writeLong(value: Long) {
+        writeInt(value.toInt())
+        writeInt((value ushr 32).toInt())
+    }
+
+    /**
+     * 直接按 UTF-8 编码写入，不产生中间 ByteArray；非法的代理项与 String.encodeToByteArray 一样写为 U+FFFD
+     */
+    private fun writeString(value: String) {
+        // 每个 UTF-16 字符最多编码为 3 字节（代理对 2 个字符编码为 4 字节）
+        ensureCapacity(4 + value.length * 3)
+        val lengthPosition = position
+        position += 4
+        var i = 0
+        while (i < value.length) {
+            val c = value[i].code
+            when {
+                c < 0x80 -> bytes[position++] = c.toByte()
+                c < 0x800 -> {
+                    bytes[position++] = (0xC0 or (c shr 6)).toByte()
+                    bytes[position++] = (0x80 or (c and 0x3F)).toByte()
+                }
+                c in 0xD800..0xDBFF && i + 1 < value.length && value[i + 1].code in 0xDC00..0xDFFF -> {
+                    val codePoint = 0x10000 + ((c - 0xD800) shl 10) + (value[i + 1].code - 0xDC00)
+                    bytes[position++] = (0xF0 or (codePoint shr 18)).toByte()
+                    bytes[position++] = (0x80 or ((codePoint shr 12) and 0x3F)).toByte()
+                    bytes[position++] = (0x80 or ((codePoint shr 6) and 0x3F)).toByte()
+                    bytes[position++] = (0x80 or (codePoint and 0x3F)).toByte()
+                    i++
+                }
+                else -> {
+                    val code = if (c in 0xD800..0xDFFF) 0xFFFD else c
+                    bytes[position++] = (0xE0 or (code shr 12)).toByte()
+                    bytes[position++] = (0x80 or ((code shr 6) and 0x3F)).toByte()
+                    bytes[position++] = (0x80 or (code and 0x3F)).toByte()
+                }
+            }
+            i++
+        }
+        val length = position - lengthPosition - 4
+        bytes[lengthPosition] = length.toByte()
+        bytes[lengthPosition + 1] = (length shr 8).toByte()
+        bytes[lengthPosition + 2] = (length shr 16).toByte()
+        bytes[lengthPosition + 3] = (length shr 24).toByte()
+    }
+
+    companion object {
+        private const val MAGIC = 0x4243524B  // "KRCB"
+        private const val VERSION = 1
+        private const val HEADER_SIZE = 12
+        private const val FLAG_HAS_SHADOW_OPS = 1
+        private const val INITIAL_CAPACITY = 4 * 1024
+        // 超过该大小时提前交给 native，限制单批内存
+        private const val FLUSH_THRESHOLD = 256 * 1024
+
+        // 与 KRRenderCValue.Type 一致
+        private const val TYPE_NULL = 0
+        private const val TYPE_INT = 1
+        private const val TYPE_LONG = 2
+        private const val TYPE_FLOAT = 3
+        private const val TYPE_DOUBLE = 4
+        private const val TYPE_BOOL = 5
+        private const val TYPE_STRING = 6
+        private const val TYPE_BYTES = 7
+    }
+}
+
+/**
+ * 本轮 Kotlin 调用中有待发送渲染指令的 [NativeBridge]。
+ * 每次从 native 进入 Kotlin（callKotlin 及 context 线程任务）结束时调用 [flushAll]，
+ * 保证指令在本次 context 任务内到达 native，与逐条调用时进入同一次 UI 刷新。
+ * 只在唯一的 Context 线程上访问。
+ */
+object RenderCommandBatcher {
+
+    private val pendingBridges = mutableListOf<NativeBridge>()
+
+    internal fun markPending(bridge: NativeBridge) {
+        pendingBridges.add(bridge)
+    }
+
+    fun flushAll() {
+        if (pendingBridges.isEmpty()) {
+            return
+        }
+        // flush 期间不会再有新的指令入队，仍按副本遍历避免修改中的列表
+        val bridges = pendingBridges.toList()
+        pendingBridges.clear()
+        for (bridge in bridges) {
+            bridge.flushRenderCommands()
+        }
+    }
+}